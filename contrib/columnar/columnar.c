@@ -0,0 +1,83 @@
+/*-------------------------------------------------------------------------
+ *
+ * columnar.c
+ *		Column-oriented table access method.
+ *
+ * Portions Copyright (c) 2021, PostgreSQL Global Development Group
+ *
+ * IDENTIFICATION
+ *	  contrib/columnar/columnar.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "columnar.h"
+#include "fmgr.h"
+#include "utils/guc.h"
+
+PG_MODULE_MAGIC;
+
+/* GUC parameters */
+int			columnar_stripe_row_limit = 150000;
+int			columnar_compression = COLUMNAR_COMPRESSION_PGLZ;
+bool		columnar_enable_custom_scan = true;
+
+static const struct config_enum_entry compression_options[] = {
+	{"none", COLUMNAR_COMPRESSION_NONE, false},
+	{"pglz", COLUMNAR_COMPRESSION_PGLZ, false},
+#ifdef USE_LZ4
+	{"lz4", COLUMNAR_COMPRESSION_LZ4, false},
+#endif
+	{NULL, 0, false}
+};
+
+void		_PG_init(void);
+
+/*
+ * Module load callback
+ */
+void
+_PG_init(void)
+{
+	DefineCustomIntVariable("columnar.stripe_row_limit",
+							"Sets the maximum number of rows per stripe of columnar tables.",
+							NULL,
+							&columnar_stripe_row_limit,
+							150000,
+							1000,
+							10000000,
+							PGC_USERSET,
+							0,
+							NULL,
+							NULL,
+							NULL);
+
+	DefineCustomEnumVariable("columnar.compression",
+							 "Sets the compression method for columnar table data.",
+							 NULL,
+							 &columnar_compression,
+							 COLUMNAR_COMPRESSION_PGLZ,
+							 compression_options,
+							 PGC_USERSET,
+							 0,
+							 NULL,
+							 NULL,
+							 NULL);
+
+	DefineCustomBoolVariable("columnar.enable_custom_scan",
+							 "Enables the planner's use of columnar scans, which read only the needed columns.",
+							 NULL,
+							 &columnar_enable_custom_scan,
+							 true,
+							 PGC_USERSET,
+							 0,
+							 NULL,
+							 NULL,
+							 NULL);
+
+	EmitWarningsOnPlaceholders("columnar");
+
+	columnar_init_writer();
+	columnar_init_customscan();
+}
@@ -0,0 +1,191 @@
+/*-------------------------------------------------------------------------
+ *
+ * columnar.h
+ *	  Header for the columnar table access method.
+ *
+ * Portions Copyright (c) 2021, PostgreSQL Global Development Group
+ *
+ * IDENTIFICATION
+ *	  contrib/columnar/columnar.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef COLUMNAR_H
+#define COLUMNAR_H
+
+#include "access/relscan.h"
+#include "access/tableam.h"
+#include "nodes/pg_list.h"
+#include "storage/bufpage.h"
+#include "utils/rel.h"
+#include "utils/snapshot.h"
+
+/*
+ * A columnar table is a sequence of stripes.  Each stripe holds rows inserted
+ * by one command of one (sub)transaction, up to columnar.stripe_row_limit of
+ * them, and occupies a range of consecutive pages.  The contents of a stripe
+ * form a single stream of bytes spread over its pages: a ColumnarStripeHeader
+ * at the start of the first page, followed by a ColumnarChunk for each
+ * attribute, followed by the chunks themselves, which hold the values of
+ * each attribute for all rows of the stripe, each compressed separately.
+ *
+ * Stripes are never modified once written, except that VACUUM replaces the
+ * xid of old stripes, like it freezes heap tuples.  The first page of a
+ * stripe is written last, so that a crash in the middle of writing a stripe
+ * leaves a zeroed first page behind, which readers step over.
+ */
+
+/* Opaque data stored in the special space of each page */
+typedef struct ColumnarPageOpaqueData
+{
+	uint16		flags;			/* see bit definitions below */
+	uint16		columnar_page_id;	/* for identification of columnar pages */
+} ColumnarPageOpaqueData;
+
+typedef ColumnarPageOpaqueData *ColumnarPageOpaque;
+
+#define COLUMNAR_STRIPE_START	(1 << 0)	/* first page of a stripe */
+
+/*
+ * The page ID is for the convenience of pg_filedump and similar utilities,
+ * which otherwise would have a hard time telling pages of different index
+ * and table types apart.
+ */
+#define COLUMNAR_PAGE_ID		0xFF84
+
+#define ColumnarPageGetOpaque(page) \
+	((ColumnarPageOpaque) PageGetSpecialPointer(page))
+#define ColumnarPageIsStripeStart(page) \
+	((ColumnarPageGetOpaque(page)->flags & COLUMNAR_STRIPE_START) != 0)
+
+/* Number of bytes of a stripe's contents that fit on one page */
+#define COLUMNAR_PAGE_CAPACITY \
+	(BLCKSZ - MAXALIGN(SizeOfPageHeaderData) - \
+	 MAXALIGN(sizeof(ColumnarPageOpaqueData)))
+
+#define COLUMNAR_STRIPE_MAGIC	0x434C5231	/* "CLR1" */
+
+typedef struct ColumnarStripeHeader
+{
+	uint32		magic;			/* COLUMNAR_STRIPE_MAGIC */
+	uint32		nblocks;		/* number of pages in the stripe */
+	uint32		length;			/* length of the contents after the header */
+	TransactionId xid;			/* inserting (sub)transaction, or
+								 * FrozenTransactionId, or
+								 * InvalidTransactionId if dead */
+	CommandId	cid;			/* inserting command */
+	uint32		nrows;			/* number of rows */
+	uint16		natts;			/* number of attributes */
+} ColumnarStripeHeader;
+
+/* Number of bytes of a stripe's contents that fit on its first page */
+#define COLUMNAR_FIRST_PAGE_CAPACITY \
+	(COLUMNAR_PAGE_CAPACITY - MAXALIGN(sizeof(ColumnarStripeHeader)))
+
+/* Compression methods, for ColumnarChunk.compression */
+#define COLUMNAR_COMPRESSION_NONE	0
+#define COLUMNAR_COMPRESSION_PGLZ	1
+#define COLUMNAR_COMPRESSION_LZ4	2
+
+/*
+ * Location and summary of the values of one attribute in a stripe.
+ *
+ * Uncompressed, a chunk consists of a null bitmap, if nnulls > 0, padded to
+ * MAXALIGN, followed by the non-null values, each aligned as per attalign.
+ * For pass-by-value types with a btree comparison function, the smallest and
+ * largest non-null values are stored in the chunk header, which lets scans
+ * skip stripes that can't contain matching rows.
+ */
+typedef struct ColumnarChunk
+{
+	uint32		offset;			/* start within the stripe's contents */
+	uint32		length;			/* stored length */
+	uint32		rawlength;		/* length after decompression */
+	uint32		nnulls;			/* number of null values */
+	uint8		compression;	/* COLUMNAR_COMPRESSION_* */
+	bool		hasminmax;		/* are minval and maxval valid? */
+	uint64		minval;			/* smallest value, as a Datum */
+	uint64		maxval;			/* largest value, as a Datum */
+} ColumnarChunk;
+
+/* Buffered rows are written out once their data reaches this size */
+#define COLUMNAR_MAX_BUFFERED_BYTES	(64 * 1024 * 1024)
+
+/* GUC parameters */
+extern int	columnar_stripe_row_limit;
+extern int	columnar_compression;
+extern bool columnar_enable_custom_scan;
+
+/*
+ * Comparison of an attribute with a constant, used to skip stripes; see
+ * columnar_build_skip_quals().
+ */
+typedef struct ColumnarSkipQual
+{
+	AttrNumber	attnum;			/* attribute compared */
+	int			strategy;		/* btree strategy of the comparison */
+	Datum		value;			/* constant compared to */
+	Oid			collation;		/* collation of the comparison */
+	FmgrInfo	cmpfn;			/* btree comparison function */
+} ColumnarSkipQual;
+
+/* Scan descriptor of a columnar table scan */
+typedef struct ColumnarReadState ColumnarReadState;
+
+typedef struct ColumnarScanDescData
+{
+	TableScanDescData rs_base;	/* AM independent part of the descriptor */
+	ColumnarReadState *reader;
+	bool	   *needed;			/* attributes to read */
+	double		analyze_deadrows;	/* dead rows found by ANALYZE */
+} ColumnarScanDescData;
+
+typedef struct ColumnarScanDescData *ColumnarScanDesc;
+
+/* columnar_storage.c */
+extern void columnar_write_stripe(Relation rel, ColumnarStripeHeader *header,
+								  const char *contents);
+extern bool columnar_read_stripe_header(Relation rel,
+										BufferAccessStrategy strategy,
+										BlockNumber blkno,
+										ColumnarStripeHeader *header);
+extern void columnar_read_stripe_contents(Relation rel,
+										  BufferAccessStrategy strategy,
+										  BlockNumber blkno, uint32 offset,
+										  uint32 length, char *dest);
+extern void columnar_set_stripe_xid(Relation rel, BlockNumber blkno,
+									TransactionId xid);
+
+/* columnar_writer.c */
+extern void columnar_init_writer(void);
+extern void columnar_insert_row(Relation rel, TupleTableSlot *slot,
+								CommandId cid);
+extern void columnar_flush_pending(Relation rel);
+extern void columnar_discard_pending(Relation rel);
+
+/* columnar_reader.c */
+extern ColumnarReadState *columnar_begin_read(Relation rel, Snapshot snapshot,
+											  bool *needed, List *skipquals,
+											  ParallelTableScanDesc pscan);
+extern bool columnar_read_next_row(ColumnarReadState *state,
+								   Datum *values, bool *isnull);
+extern bool columnar_read_stripe_row(ColumnarReadState *state,
+									 Datum *values, bool *isnull);
+extern bool columnar_read_stripe_for_analyze(ColumnarReadState *state,
+											 BlockNumber blkno,
+											 double *deadrows);
+extern void columnar_restart_read(ColumnarReadState *state);
+extern void columnar_end_read(ColumnarReadState *state);
+extern uint64 columnar_stripes_skipped(ColumnarReadState *state);
+extern bool columnar_stripe_visible(ColumnarStripeHeader *header,
+									Snapshot snapshot);
+extern List *columnar_build_skip_quals(List *quals, Index varno);
+
+/* columnar_tableam.c */
+extern const TableAmRoutine *GetColumnarTableAmRoutine(void);
+extern bool IsColumnarRelation(Relation rel);
+
+/* columnar_customscan.c */
+extern void columnar_init_customscan(void);
+
+#endif							/* COLUMNAR_H */
@@ -0,0 +1,343 @@
+/*-------------------------------------------------------------------------
+ *
+ * columnar_customscan.c
+ *		Custom scan provider for columnar tables.
+ *
+ * A plain sequential scan of a columnar table must read all attributes,
+ * because the table AM interface gives it no way to know which ones the
+ * query needs.  The ColumnarScan custom scan replaces it with a scan that
+ * only reads the attributes referenced by the query, and that skips the
+ * stripes whose min/max summaries show that no row matches the scan's
+ * quals.
+ *
+ * Portions Copyright (c) 2021, PostgreSQL Global Development Group
+ *
+ * IDENTIFICATION
+ *	  contrib/columnar/columnar_customscan.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include <math.h>
+
+#include "access/sysattr.h"
+#include "access/table.h"
+#include "columnar.h"
+#include "commands/explain.h"
+#include "executor/executor.h"
+#include "lib/stringinfo.h"
+#include "nodes/extensible.h"
+#include "optimizer/cost.h"
+#include "optimizer/optimizer.h"
+#include "optimizer/pathnode.h"
+#include "optimizer/paths.h"
+#include "optimizer/prep.h"
+#include "optimizer/restrictinfo.h"
+#include "utils/spccache.h"
+
+typedef struct ColumnarScanState
+{
+	CustomScanState css;
+	bool	   *needed;			/* attributes to read */
+	List	   *skipquals;		/* ColumnarSkipQuals built from the quals */
+	ColumnarReadState *reader;	/* NULL until the first row is fetched */
+} ColumnarScanState;
+
+static set_rel_pathlist_hook_type prev_set_rel_pathlist_hook = NULL;
+
+static void columnar_set_rel_pathlist(PlannerInfo *root, RelOptInfo *rel,
+									  Index rti, RangeTblEntry *rte);
+static Plan *columnar_plan_custom_path(PlannerInfo *root, RelOptInfo *rel,
+									   CustomPath *best_path, List *tlist,
+									   List *clauses, List *custom_plans);
+static Node *columnar_create_scan_state(CustomScan *cscan);
+static void columnar_begin_scan(CustomScanState *node, EState *estate,
+								int eflags);
+static TupleTableSlot *columnar_exec_scan(CustomScanState *node);
+static void columnar_end_scan(CustomScanState *node);
+static void columnar_rescan_scan(CustomScanState *node);
+static void columnar_explain_scan(CustomScanState *node, List *ancestors,
+								  ExplainState *es);
+
+static const CustomPathMethods columnar_path_methods = {
+	.CustomName = "ColumnarScan",
+	.PlanCustomPath = columnar_plan_custom_path,
+};
+
+static const CustomScanMethods columnar_scan_methods = {
+	.CustomName = "ColumnarScan",
+	.CreateCustomScanState = columnar_create_scan_state,
+};
+
+static const CustomExecMethods columnar_exec_methods = {
+	.CustomName = "ColumnarScan",
+	.BeginCustomScan = columnar_begin_scan,
+	.ExecCustomScan = columnar_exec_scan,
+	.EndCustomScan = columnar_end_scan,
+	.ReScanCustomScan = columnar_rescan_scan,
+	.ExplainCustomScan = columnar_explain_scan,
+};
+
+/*
+ * Install the planner hook.  Called from _PG_init().
+ */
+void
+columnar_init_customscan(void)
+{
+	prev_set_rel_pathlist_hook = set_rel_pathlist_hook;
+	set_rel_pathlist_hook = columnar_set_rel_pathlist;
+
+	RegisterCustomScanMethods(&columnar_scan_methods);
+}
+
+/*
+ * Replace the sequential scan path of a columnar table with a ColumnarScan
+ * path.
+ */
+static void
+columnar_set_rel_pathlist(PlannerInfo *root, RelOptInfo *rel, Index rti,
+						  RangeTblEntry *rte)
+{
+	Relation	relation;
+	bool		iscolumnar;
+	PlanRowMark *rowmark;
+	Bitmapset  *attrs = NULL;
+	List	   *needed = NIL;
+	int			natts;
+	CustomPath *cpath;
+	ParamPathInfo *param_info;
+	double		spc_seq_page_cost;
+	double		pages;
+	Cost		cpu_per_tuple;
+	ListCell   *lc;
+
+	if (prev_set_rel_pathlist_hook)
+		(*prev_set_rel_pathlist_hook) (root, rel, rti, rte);
+
+	if (rel->reloptkind == RELOPT_UPPER_REL ||
+		rte->rtekind != RTE_RELATION || rte->inh)
+		return;
+
+	relation = table_open(rte->relid, NoLock);
+	iscolumnar = IsColumnarRelation(relation);
+	natts = RelationGetDescr(relation)->natts;
+	table_close(relation, NoLock);
+
+	if (!iscolumnar)
+		return;
+
+	/*
+	 * Rows of columnar tables have no item pointers, so there's nothing to
+	 * identify them by for UPDATE, DELETE or row locking.  Complain here,
+	 * rather than when the executor fails to fetch the ctid.
+	 */
+	if (bms_is_member(rti, root->all_result_relids))
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("UPDATE and DELETE are not supported on columnar tables")));
+	rowmark = get_plan_rowmark(root->rowMarks, rti);
+	if (rowmark != NULL && rowmark->markType != ROW_MARK_COPY)
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("row locking is not supported on columnar tables")));
+
+	if (!columnar_enable_custom_scan || rte->tablesample != NULL)
+		return;
+
+	/* find out which attributes the query needs */
+	pull_varattnos((Node *) rel->reltarget->exprs, rel->relid, &attrs);
+	foreach(lc, rel->baserestrictinfo)
+	{
+		RestrictInfo *rinfo = (RestrictInfo *) lfirst(lc);
+
+		pull_varattnos((Node *) rinfo->clause, rel->relid, &attrs);
+	}
+
+	for (AttrNumber attnum = 1; attnum <= natts; attnum++)
+	{
+		/* a whole-row reference needs all attributes */
+		if (bms_is_member(attnum - FirstLowInvalidHeapAttributeNumber, attrs) ||
+			bms_is_member(InvalidAttrNumber - FirstLowInvalidHeapAttributeNumber,
+						  attrs))
+			needed = lappend_int(needed, attnum);
+	}
+
+	param_info = get_baserel_parampathinfo(root, rel, rel->lateral_relids);
+
+	cpath = makeNode(CustomPath);
+	cpath->path.pathtype = T_CustomScan;
+	cpath->path.parent = rel;
+	cpath->path.pathtarget = rel->reltarget;
+	cpath->path.param_info = param_info;
+	cpath->path.parallel_aware = false;
+	cpath->path.parallel_safe = rel->consider_parallel;
+	cpath->path.parallel_workers = 0;
+	cpath->path.pathkeys = NIL;
+	cpath->flags = 0;
+	cpath->custom_private = needed;
+	cpath->methods = &columnar_path_methods;
+
+	/*
+	 * Cost it like a sequential scan that only reads the pages of the needed
+	 * attributes.
+	 */
+	get_tablespace_page_costs(rel->reltablespace, NULL, &spc_seq_page_cost);
+	pages = ceil(rel->pages * (double) list_length(needed) / Max(natts, 1));
+
+	cpath->path.rows = param_info ? param_info->ppi_rows : rel->rows;
+	cpath->path.startup_cost = rel->baserestrictcost.startup +
+		rel->reltarget->cost.startup;
+	cpu_per_tuple = cpu_tuple_cost + rel->baserestrictcost.per_tuple;
+	cpath->path.total_cost = cpath->path.startup_cost +
+		spc_seq_page_cost * pages +
+		cpu_per_tuple * rel->tuples +
+		rel->reltarget->cost.per_tuple * cpath->path.rows;
+
+	/* the sequential scan would read all attributes, so get rid of it */
+	rel->pathlist = NIL;
+	add_path(rel, &cpath->path);
+}
+
+static Plan *
+columnar_plan_custom_path(PlannerInfo *root, RelOptInfo *rel,
+						  CustomPath *best_path, List *tlist,
+						  List *clauses, List *custom_plans)
+{
+	CustomScan *cscan = makeNode(CustomScan);
+
+	cscan->scan.plan.targetlist = tlist;
+	cscan->scan.plan.qual = extract_actual_clauses(clauses, false);
+	cscan->scan.scanrelid = rel->relid;
+	cscan->flags = best_path->flags;
+	cscan->custom_private = best_path->custom_private;
+	cscan->methods = &columnar_scan_methods;
+
+	return &cscan->scan.plan;
+}
+
+static Node *
+columnar_create_scan_state(CustomScan *cscan)
+{
+	ColumnarScanState *cstate = palloc0(sizeof(ColumnarScanState));
+
+	NodeSetTag(cstate, T_CustomScanState);
+	cstate->css.flags = cscan->flags;
+	cstate->css.methods = &columnar_exec_methods;
+
+	return (Node *) cstate;
+}
+
+static void
+columnar_begin_scan(CustomScanState *node, EState *estate, int eflags)
+{
+	ColumnarScanState *cstate = (ColumnarScanState *) node;
+	CustomScan *cscan = (CustomScan *) node->ss.ps.plan;
+	Relation	rel = node->ss.ss_currentRelation;
+	ListCell   *lc;
+
+	cstate->needed = palloc0(sizeof(bool) * Max(RelationGetDescr(rel)->natts, 1));
+	foreach(lc, cscan->custom_private)
+		cstate->needed[lfirst_int(lc) - 1] = true;
+
+	cstate->skipquals = columnar_build_skip_quals(cscan->scan.plan.qual,
+												  cscan->scan.scanrelid);
+}
+
+/*
+ * Fetch the next row into the scan slot.  This is the access method
+ * routine for ExecScan().
+ */
+static TupleTableSlot *
+columnar_scan_next(ScanState *node)
+{
+	ColumnarScanState *cstate = (ColumnarScanState *) node;
+	TupleTableSlot *slot = node->ss_ScanTupleSlot;
+	Relation	rel = node->ss_currentRelation;
+
+	if (cstate->reader == NULL)
+		cstate->reader = columnar_begin_read(rel,
+											 node->ps.state->es_snapshot,
+											 cstate->needed,
+											 cstate->skipquals,
+											 NULL);
+
+	ExecClearTuple(slot);
+	if (columnar_read_next_row(cstate->reader, slot->tts_values,
+							   slot->tts_isnull))
+	{
+		ExecStoreVirtualTuple(slot);
+		slot->tts_tableOid = RelationGetRelid(rel);
+	}
+
+	return slot;
+}
+
+/*
+ * There are no EvalPlanQual rechecks, because columnar tables don't support
+ * row locking.
+ */
+static bool
+columnar_scan_recheck(ScanState *node, TupleTableSlot *slot)
+{
+	return true;
+}
+
+static TupleTableSlot *
+columnar_exec_scan(CustomScanState *node)
+{
+	return ExecScan(&node->ss,
+					(ExecScanAccessMtd) columnar_scan_next,
+					(ExecScanRecheckMtd) columnar_scan_recheck);
+}
+
+static void
+columnar_end_scan(CustomScanState *node)
+{
+	ColumnarScanState *cstate = (ColumnarScanState *) node;
+
+	if (cstate->reader != NULL)
+		columnar_end_read(cstate->reader);
+	cstate->reader = NULL;
+}
+
+static void
+columnar_rescan_scan(CustomScanState *node)
+{
+	ColumnarScanState *cstate = (ColumnarScanState *) node;
+
+	if (cstate->reader != NULL)
+		columnar_restart_read(cstate->reader);
+
+	ExecScanReScan(&node->ss);
+}
+
+static void
+columnar_explain_scan(CustomScanState *node, List *ancestors,
+					  ExplainState *es)
+{
+	ColumnarScanState *cstate = (ColumnarScanState *) node;
+	CustomScan *cscan = (CustomScan *) node->ss.ps.plan;
+	TupleDesc	tupdesc = RelationGetDescr(node->ss.ss_currentRelation);
+	StringInfoData columns;
+	ListCell   *lc;
+
+	initStringInfo(&columns);
+	foreach(lc, cscan->custom_private)
+	{
+		Form_pg_attribute att = TupleDescAttr(tupdesc, lfirst_int(lc) - 1);
+
+		if (columns.len > 0)
+			appendStringInfoString(&columns, ", ");
+		appendStringInfoString(&columns, NameStr(att->attname));
+	}
+	if (columns.len == 0)
+		appendStringInfoString(&columns, "<none>");
+	ExplainPropertyText("Columnar Projected Columns", columns.data, es);
+
+	if (es->analyze)
+		ExplainPropertyInteger("Columnar Stripes Removed by Filter", NULL,
+							   cstate->reader != NULL ?
+							   columnar_stripes_skipped(cstate->reader) : 0,
+							   es);
+}
@@ -0,0 +1,655 @@
+/*-------------------------------------------------------------------------
+ *
+ * columnar_reader.c
+ *		Reading rows from columnar tables.
+ *
+ * A scan reads the stripes of the table one at a time.  For each stripe
+ * whose inserting transaction is visible to the scan's snapshot, it first
+ * checks the min/max summaries of the attributes against the scan's skip
+ * quals, and passes over the stripe if no row can match.  Otherwise, only
+ * the chunks of the attributes the scan needs are read and decompressed,
+ * and the rows are returned from them.
+ *
+ * Portions Copyright (c) 2021, PostgreSQL Global Development Group
+ *
+ * IDENTIFICATION
+ *	  contrib/columnar/columnar_reader.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#ifdef USE_LZ4
+#include <lz4.h>
+#endif
+
+#include "access/heaptoast.h"
+#include "access/nbtree.h"
+#include "access/transam.h"
+#include "access/xact.h"
+#include "catalog/pg_am.h"
+#include "columnar.h"
+#include "commands/defrem.h"
+#include "common/pg_lzcompress.h"
+#include "miscadmin.h"
+#include "nodes/primnodes.h"
+#include "storage/bufmgr.h"
+#include "storage/procarray.h"
+#include "utils/lsyscache.h"
+#include "utils/memutils.h"
+#include "utils/snapmgr.h"
+
+struct ColumnarReadState
+{
+	Relation	rel;
+	TupleDesc	tupdesc;
+	Snapshot	snapshot;
+	bool	   *needed;			/* which attributes to return */
+	List	   *skipquals;		/* ColumnarSkipQuals to skip stripes by */
+	BufferAccessStrategy strategy;
+
+	/* position of the scan */
+	ParallelBlockTableScanDesc pscan;	/* shared state of a parallel scan */
+	ParallelBlockTableScanWorkerData pwork; /* our part of it */
+	bool		pstarted;		/* has pwork been initialized? */
+	BlockNumber nblocks;		/* size of the table when the scan started */
+	BlockNumber nextblock;		/* where to look for the next stripe */
+
+	/* current stripe */
+	MemoryContext stripecxt;	/* holds the current stripe's values */
+	uint32		nrows;			/* number of rows in it */
+	uint32		currow;			/* next row to return */
+	Datum	  **values;			/* per-attribute values, if needed */
+	bool	  **isnull;			/* per-attribute null flags, if needed */
+
+	uint64		stripes_skipped;	/* stripes skipped thanks to skipquals */
+};
+
+static bool columnar_next_stripe(ColumnarReadState *state);
+static bool columnar_load_stripe(ColumnarReadState *state, BlockNumber blkno,
+								 ColumnarStripeHeader *header);
+static bool columnar_can_skip_stripe(ColumnarReadState *state,
+									 ColumnarStripeHeader *header,
+									 ColumnarChunk *chunks);
+static void columnar_load_chunk(ColumnarReadState *state, BlockNumber blkno,
+								ColumnarStripeHeader *header,
+								ColumnarChunk *chunk, int attnum);
+
+/*
+ * Start reading rel.
+ *
+ * needed[i] tells whether attribute i + 1 is needed; the other attributes
+ * are returned as nulls.  skipquals is a list of ColumnarSkipQuals that all
+ * rows the caller is interested in satisfy.  pscan is the shared state of
+ * a parallel scan, or NULL.  If snapshot is NULL, all rows of committed
+ * transactions and of the current transaction are returned.
+ */
+ColumnarReadState *
+columnar_begin_read(Relation rel, Snapshot snapshot, bool *needed,
+					List *skipquals, ParallelTableScanDesc pscan)
+{
+	ColumnarReadState *state = palloc0(sizeof(ColumnarReadState));
+	int			natts = RelationGetDescr(rel)->natts;
+
+	state->rel = rel;
+	state->tupdesc = RelationGetDescr(rel);
+	state->snapshot = snapshot;
+	state->needed = needed;
+	state->skipquals = skipquals;
+	state->pscan = (ParallelBlockTableScanDesc) pscan;
+	state->stripecxt = AllocSetContextCreate(CurrentMemoryContext,
+											 "columnar stripe",
+											 ALLOCSET_DEFAULT_SIZES);
+	state->values = palloc0(sizeof(Datum *) * Max(natts, 1));
+	state->isnull = palloc0(sizeof(bool *) * Max(natts, 1));
+
+	columnar_restart_read(state);
+
+	return state;
+}
+
+/*
+ * Restart the scan from the beginning.
+ */
+void
+columnar_restart_read(ColumnarReadState *state)
+{
+	/* make the rows we have inserted ourselves readable */
+	columnar_flush_pending(state->rel);
+
+	if (state->pscan != NULL)
+		state->nblocks = state->pscan->phs_nblocks;
+	else
+		state->nblocks = RelationGetNumberOfBlocks(state->rel);
+
+	/* as in heap scans, use a ring buffer for large tables */
+	if (state->strategy == NULL && state->nblocks > NBuffers / 4)
+		state->strategy = GetAccessStrategy(BAS_BULKREAD);
+
+	state->pstarted = false;
+	state->nextblock = 0;
+	state->nrows = 0;
+	state->currow = 0;
+}
+
+/*
+ * Finish the scan.
+ */
+void
+columnar_end_read(ColumnarReadState *state)
+{
+	if (state->strategy != NULL)
+		FreeAccessStrategy(state->strategy);
+	MemoryContextDelete(state->stripecxt);
+	pfree(state->values);
+	pfree(state->isnull);
+	pfree(state);
+}
+
+/*
+ * Return the next row in values and isnull, which must have room for all
+ * of the table's attributes.  Returns false at the end of the scan.
+ *
+ * Pass-by-reference values remain valid until the scan moves on to the next
+ * stripe, that is, until the next call at least.
+ */
+bool
+columnar_read_next_row(ColumnarReadState *state, Datum *values, bool *isnull)
+{
+	while (!columnar_read_stripe_row(state, values, isnull))
+	{
+		if (!columnar_next_stripe(state))
+			return false;
+	}
+
+	return true;
+}
+
+/*
+ * Like columnar_read_next_row(), but return false at the end of the current
+ * stripe rather than moving on to the next one.
+ */
+bool
+columnar_read_stripe_row(ColumnarReadState *state, Datum *values, bool *isnull)
+{
+	int			natts = state->tupdesc->natts;
+	uint32		row;
+
+	if (state->currow >= state->nrows)
+		return false;
+
+	row = state->currow++;
+	for (int i = 0; i < natts; i++)
+	{
+		if (state->needed[i])
+		{
+			values[i] = state->values[i][row];
+			isnull[i] = state->isnull[i][row];
+		}
+		else
+		{
+			values[i] = (Datum) 0;
+			isnull[i] = true;
+		}
+	}
+
+	return true;
+}
+
+/*
+ * For ANALYZE: load the stripe starting at blkno, if there is one and its
+ * rows are live, so that they are returned by the following calls of
+ * columnar_read_stripe_row().  Rows of aborted transactions are counted in
+ * *deadrows.
+ */
+bool
+columnar_read_stripe_for_analyze(ColumnarReadState *state, BlockNumber blkno,
+								 double *deadrows)
+{
+	ColumnarStripeHeader header;
+	TransactionId xid;
+
+	state->nrows = 0;
+	state->currow = 0;
+
+	if (!columnar_read_stripe_header(state->rel, state->strategy, blkno,
+									 &header))
+		return false;
+
+	/* count rows the way heapam_scan_analyze_next_tuple() does */
+	xid = header.xid;
+	if (!TransactionIdIsValid(xid))
+		return false;
+	else if (TransactionIdEquals(xid, FrozenTransactionId) ||
+			 TransactionIdIsCurrentTransactionId(xid))
+		 /* live */ ;
+	else if (TransactionIdIsInProgress(xid))
+		return false;
+	else if (!TransactionIdDidCommit(xid))
+	{
+		*deadrows += header.nrows;
+		return false;
+	}
+
+	return columnar_load_stripe(state, blkno, &header);
+}
+
+/*
+ * Number of stripes the scan has skipped thanks to its skip quals.
+ */
+uint64
+columnar_stripes_skipped(ColumnarReadState *state)
+{
+	return state->stripes_skipped;
+}
+
+/*
+ * Is a stripe visible to snapshot?  See columnar_begin_read() for the
+ * meaning of a NULL snapshot.
+ */
+bool
+columnar_stripe_visible(ColumnarStripeHeader *header, Snapshot snapshot)
+{
+	TransactionId xid = header->xid;
+
+	/* removed by VACUUM */
+	if (!TransactionIdIsValid(xid))
+		return false;
+
+	if (TransactionIdEquals(xid, FrozenTransactionId))
+		return true;
+
+	if (snapshot != NULL && snapshot->snapshot_type == SNAPSHOT_ANY)
+		return true;
+
+	if (TransactionIdIsCurrentTransactionId(xid))
+	{
+		/* rows inserted by the scanning command or later are invisible */
+		if (snapshot != NULL && IsMVCCSnapshot(snapshot))
+			return header->cid < snapshot->curcid;
+		return true;
+	}
+
+	if (snapshot != NULL && IsMVCCSnapshot(snapshot))
+	{
+		if (XidInMVCCSnapshot(xid, snapshot))
+			return false;
+	}
+	else if (TransactionIdIsInProgress(xid))
+		return false;
+
+	return TransactionIdDidCommit(xid);
+}
+
+/*
+ * Build the ColumnarSkipQuals corresponding to those of quals that compare
+ * an attribute of relation varno with a constant, using an operator of the
+ * attribute type's default btree operator family.
+ */
+List *
+columnar_build_skip_quals(List *quals, Index varno)
+{
+	List	   *result = NIL;
+	ListCell   *lc;
+
+	foreach(lc, quals)
+	{
+		OpExpr	   *opexpr = (OpExpr *) lfirst(lc);
+		Node	   *leftop;
+		Node	   *rightop;
+		Var		   *var;
+		Const	   *con;
+		Oid			opclass;
+		Oid			opfamily;
+		int			strategy;
+		Oid			lefttype;
+		Oid			righttype;
+		RegProcedure cmpproc;
+		ColumnarSkipQual *skipqual;
+
+		if (!IsA(opexpr, OpExpr) || list_length(opexpr->args) != 2)
+			continue;
+
+		leftop = linitial(opexpr->args);
+		rightop = lsecond(opexpr->args);
+		if (IsA(leftop, RelabelType))
+			leftop = (Node *) ((RelabelType *) leftop)->arg;
+		if (IsA(rightop, RelabelType))
+			rightop = (Node *) ((RelabelType *) rightop)->arg;
+
+		if (IsA(leftop, Var) && IsA(rightop, Const))
+		{
+			var = (Var *) leftop;
+			con = (Const *) rightop;
+		}
+		else if (IsA(rightop, Var) && IsA(leftop, Const))
+		{
+			var = (Var *) rightop;
+			con = (Const *) leftop;
+		}
+		else
+			continue;
+
+		if (var->varno != varno || var->varattno <= 0 || con->constisnull)
+			continue;
+
+		opclass = GetDefaultOpClass(var->vartype, BTREE_AM_OID);
+		if (!OidIsValid(opclass))
+			continue;
+		opfamily = get_opclass_family(opclass);
+		if (!op_in_opfamily(opexpr->opno, opfamily))
+			continue;
+
+		get_op_opfamily_properties(opexpr->opno, opfamily, false,
+								   &strategy, &lefttype, &righttype);
+
+		/* make it "var op const" */
+		if ((Node *) var != leftop)
+		{
+			Oid			tmp = lefttype;
+
+			strategy = BTCommuteStrategyNumber(strategy);
+			lefttype = righttype;
+			righttype = tmp;
+		}
+
+		cmpproc = get_opfamily_proc(opfamily, lefttype, righttype,
+									BTORDER_PROC);
+		if (!RegProcedureIsValid(cmpproc))
+			continue;
+
+		skipqual = palloc0(sizeof(ColumnarSkipQual));
+		skipqual->attnum = var->varattno;
+		skipqual->strategy = strategy;
+		skipqual->value = con->constvalue;
+		skipqual->collation = opexpr->inputcollid;
+		fmgr_info(cmpproc, &skipqual->cmpfn);
+
+		result = lappend(result, skipqual);
+	}
+
+	return result;
+}
+
+/*
+ * Move on to the next stripe visible to the scan, and load it.  Returns
+ * false at the end of the scan.
+ */
+static bool
+columnar_next_stripe(ColumnarReadState *state)
+{
+	state->nrows = 0;
+	state->currow = 0;
+
+	for (;;)
+	{
+		BlockNumber blkno;
+		ColumnarStripeHeader header;
+
+		CHECK_FOR_INTERRUPTS();
+
+		/*
+		 * In a parallel scan, each participant looks for stripes starting
+		 * at the pages it is allotted.
+		 */
+		if (state->pscan != NULL)
+		{
+			if (!state->pstarted)
+			{
+				table_block_parallelscan_startblock_init(state->rel,
+														 &state->pwork,
+														 state->pscan);
+				state->pstarted = true;
+			}
+			blkno = table_block_parallelscan_nextpage(state->rel,
+													  &state->pwork,
+													  state->pscan);
+			if (blkno == InvalidBlockNumber)
+				return false;
+		}
+		else
+		{
+			if (state->nextblock >= state->nblocks)
+				return false;
+			blkno = state->nextblock++;
+		}
+
+		/*
+		 * No stripe starts here if this is a page in the middle of a stripe,
+		 * or the first page of a stripe that is still being written or whose
+		 * writer crashed.  Step over those page by page.
+		 */
+		if (!columnar_read_stripe_header(state->rel, state->strategy, blkno,
+										 &header))
+			continue;
+
+		if (state->pscan == NULL)
+			state->nextblock = blkno + header.nblocks;
+
+		if (!columnar_stripe_visible(&header, state->snapshot))
+			continue;
+
+		if (columnar_load_stripe(state, blkno, &header))
+			return true;
+	}
+}
+
+/*
+ * Load the needed attributes of a stripe, unless the skip quals rule out all
+ * its rows, in which case we return false.
+ */
+static bool
+columnar_load_stripe(ColumnarReadState *state, BlockNumber blkno,
+					 ColumnarStripeHeader *header)
+{
+	TupleDesc	tupdesc = state->tupdesc;
+	ColumnarChunk *chunks;
+	MemoryContext oldcontext;
+
+	MemoryContextReset(state->stripecxt);
+	oldcontext = MemoryContextSwitchTo(state->stripecxt);
+
+	if (header->natts > tupdesc->natts ||
+		(uint64) sizeof(ColumnarChunk) * header->natts > header->length)
+		ereport(ERROR,
+				(errcode(ERRCODE_DATA_CORRUPTED),
+				 errmsg("invalid stripe header in block %u of relation \"%s\"",
+						blkno, RelationGetRelationName(state->rel))));
+
+	chunks = palloc(sizeof(ColumnarChunk) * Max(header->natts, 1));
+	columnar_read_stripe_contents(state->rel, state->strategy, blkno, 0,
+								  sizeof(ColumnarChunk) * header->natts,
+								  (char *) chunks);
+
+	if (columnar_can_skip_stripe(state, header, chunks))
+	{
+		state->stripes_skipped++;
+		MemoryContextSwitchTo(oldcontext);
+		return false;
+	}
+
+	for (int i = 0; i < tupdesc->natts; i++)
+	{
+		if (!state->needed[i])
+			continue;
+
+		state->values[i] = palloc(sizeof(Datum) * header->nrows);
+		state->isnull[i] = palloc(sizeof(bool) * header->nrows);
+
+		if (i < header->natts)
+			columnar_load_chunk(state, blkno, header, &chunks[i], i);
+		else
+		{
+			/* attribute added after the stripe was written */
+			bool		isnull;
+			Datum		value = getmissingattr(tupdesc, i + 1, &isnull);
+
+			for (uint32 row = 0; row < header->nrows; row++)
+			{
+				state->values[i][row] = value;
+				state->isnull[i][row] = isnull;
+			}
+		}
+	}
+
+	MemoryContextSwitchTo(oldcontext);
+
+	state->nrows = header->nrows;
+	state->currow = 0;
+
+	return true;
+}
+
+/*
+ * Can the min/max summaries of a stripe's attributes tell that none of its
+ * rows satisfies the skip quals?
+ */
+static bool
+columnar_can_skip_stripe(ColumnarReadState *state,
+						 ColumnarStripeHeader *header, ColumnarChunk *chunks)
+{
+	ListCell   *lc;
+
+	foreach(lc, state->skipquals)
+	{
+		ColumnarSkipQual *skipqual = (ColumnarSkipQual *) lfirst(lc);
+		ColumnarChunk *chunk;
+		int32		mincmp;
+		int32		maxcmp;
+
+		if (skipqual->attnum > header->natts)
+			continue;
+		chunk = &chunks[skipqual->attnum - 1];
+
+		/* btree operators are strict, so nulls never match */
+		if (chunk->nnulls == header->nrows)
+			return true;
+		if (!chunk->hasminmax)
+			continue;
+
+		mincmp = DatumGetInt32(FunctionCall2Coll(&skipqual->cmpfn,
+												 skipqual->collation,
+												 (Datum) chunk->minval,
+												 skipqual->value));
+		maxcmp = DatumGetInt32(FunctionCall2Coll(&skipqual->cmpfn,
+												 skipqual->collation,
+												 (Datum) chunk->maxval,
+												 skipqual->value));
+
+		switch (skipqual->strategy)
+		{
+			case BTLessStrategyNumber:
+				if (mincmp >= 0)
+					return true;
+				break;
+			case BTLessEqualStrategyNumber:
+				if (mincmp > 0)
+					return true;
+				break;
+			case BTEqualStrategyNumber:
+				if (mincmp > 0 || maxcmp < 0)
+					return true;
+				break;
+			case BTGreaterEqualStrategyNumber:
+				if (maxcmp < 0)
+					return true;
+				break;
+			case BTGreaterStrategyNumber:
+				if (maxcmp <= 0)
+					return true;
+				break;
+		}
+	}
+
+	return false;
+}
+
+/*
+ * Read, decompress and decode the values of attribute attnum (zero-based)
+ * of a stripe into state->values[attnum] and state->isnull[attnum].
+ */
+static void
+columnar_load_chunk(ColumnarReadState *state, BlockNumber blkno,
+					ColumnarStripeHeader *header, ColumnarChunk *chunk,
+					int attnum)
+{
+	Form_pg_attribute att = TupleDescAttr(state->tupdesc, attnum);
+	Datum	   *values = state->values[attnum];
+	bool	   *isnull = state->isnull[attnum];
+	char	   *stored;
+	char	   *raw;
+	char	   *data;
+	bits8	   *bitmap = NULL;
+	Size		off = 0;
+
+	if ((uint64) chunk->offset + chunk->length > header->length)
+		ereport(ERROR,
+				(errcode(ERRCODE_DATA_CORRUPTED),
+				 errmsg("invalid stripe header in block %u of relation \"%s\"",
+						blkno, RelationGetRelationName(state->rel))));
+
+	stored = palloc(Max(chunk->length, 1));
+	columnar_read_stripe_contents(state->rel, state->strategy, blkno,
+								  chunk->offset, chunk->length, stored);
+
+	switch (chunk->compression)
+	{
+		case COLUMNAR_COMPRESSION_NONE:
+			raw = stored;
+			break;
+		case COLUMNAR_COMPRESSION_PGLZ:
+			raw = palloc(chunk->rawlength);
+			if (pglz_decompress(stored, chunk->length, raw, chunk->rawlength,
+								true) != chunk->rawlength)
+				ereport(ERROR,
+						(errcode(ERRCODE_DATA_CORRUPTED),
+						 errmsg_internal("compressed columnar data is corrupt")));
+			pfree(stored);
+			break;
+		case COLUMNAR_COMPRESSION_LZ4:
+#ifdef USE_LZ4
+			raw = palloc(chunk->rawlength);
+			if (LZ4_decompress_safe(stored, raw, chunk->length,
+									chunk->rawlength) != chunk->rawlength)
+				ereport(ERROR,
+						(errcode(ERRCODE_DATA_CORRUPTED),
+						 errmsg_internal("compressed columnar data is corrupt")));
+			pfree(stored);
+#else
+			ereport(ERROR,
+					(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+					 errmsg("compression method lz4 not supported"),
+					 errdetail("This functionality requires the server to be built with lz4 support.")));
+			raw = NULL;			/* keep compiler quiet */
+#endif
+			break;
+		default:
+			ereport(ERROR,
+					(errcode(ERRCODE_DATA_CORRUPTED),
+					 errmsg_internal("invalid compression method %d in columnar data",
+									 chunk->compression)));
+			raw = NULL;			/* keep compiler quiet */
+	}
+
+	data = raw;
+	if (chunk->nnulls > 0)
+	{
+		bitmap = (bits8 *) raw;
+		data += MAXALIGN(BITMAPLEN(header->nrows));
+	}
+
+	for (uint32 row = 0; row < header->nrows; row++)
+	{
+		if (bitmap != NULL && att_isnull(row, bitmap))
+		{
+			values[row] = (Datum) 0;
+			isnull[row] = true;
+			continue;
+		}
+
+		off = att_align_nominal(off, att->attalign);
+		values[row] = fetchatt(att, data + off);
+		isnull[row] = false;
+		off = att_addlength_pointer(off, att->attlen, data + off);
+	}
+}
@@ -0,0 +1,226 @@
+/*-------------------------------------------------------------------------
+ *
+ * columnar_storage.c
+ *		Page-level storage of columnar table stripes.
+ *
+ * Each stripe's contents are laid out over consecutive pages, with no
+ * item pointers; see columnar.h.  All changes are WAL-logged using the
+ * generic WAL facility.
+ *
+ * Portions Copyright (c) 2021, PostgreSQL Global Development Group
+ *
+ * IDENTIFICATION
+ *	  contrib/columnar/columnar_storage.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/generic_xlog.h"
+#include "columnar.h"
+#include "storage/bufmgr.h"
+#include "storage/lmgr.h"
+
+static void columnar_init_page(Page page, uint16 flags);
+static void columnar_fill_page(Relation rel, Buffer buffer, uint16 flags,
+							   const char *header, Size headerlen,
+							   const char *data, Size datalen);
+
+/*
+ * Initialize a page of a columnar table.
+ */
+static void
+columnar_init_page(Page page, uint16 flags)
+{
+	ColumnarPageOpaque opaque;
+
+	PageInit(page, BLCKSZ, sizeof(ColumnarPageOpaqueData));
+
+	opaque = ColumnarPageGetOpaque(page);
+	opaque->flags = flags;
+	opaque->columnar_page_id = COLUMNAR_PAGE_ID;
+}
+
+/*
+ * Initialize the page in buffer, which the caller has locked exclusively,
+ * store the given header (if any) followed by data in it, and WAL-log it.
+ */
+static void
+columnar_fill_page(Relation rel, Buffer buffer, uint16 flags,
+				   const char *header, Size headerlen,
+				   const char *data, Size datalen)
+{
+	GenericXLogState *state;
+	Page		page;
+	char	   *contents;
+
+	Assert(MAXALIGN(headerlen) + datalen <= COLUMNAR_PAGE_CAPACITY);
+
+	state = GenericXLogStart(rel);
+	page = GenericXLogRegisterBuffer(state, buffer, GENERIC_XLOG_FULL_IMAGE);
+
+	columnar_init_page(page, flags);
+	contents = PageGetContents(page);
+	if (headerlen > 0)
+		memcpy(contents, header, headerlen);
+	memcpy(contents + MAXALIGN(headerlen), data, datalen);
+
+	/* mark the rest of the page as a hole, for full-page images */
+	((PageHeader) page)->pd_lower = (contents - (char *) page) +
+		MAXALIGN(headerlen) + datalen;
+
+	GenericXLogFinish(state);
+}
+
+/*
+ * Append a stripe to the relation.
+ *
+ * header->length gives the length of contents, and header->nblocks is set
+ * here.  The pages are appended while holding the relation extension lock,
+ * so that they are consecutive; the first one is filled in last.
+ */
+void
+columnar_write_stripe(Relation rel, ColumnarStripeHeader *header,
+					  const char *contents)
+{
+	Buffer		firstbuf;
+	uint32		written;
+	uint32		firstlen;
+
+	firstlen = Min(header->length, COLUMNAR_FIRST_PAGE_CAPACITY);
+	header->nblocks = 1;
+	if (header->length > firstlen)
+		header->nblocks += (header->length - firstlen +
+							COLUMNAR_PAGE_CAPACITY - 1) / COLUMNAR_PAGE_CAPACITY;
+
+	LockRelationForExtension(rel, ExclusiveLock);
+
+	firstbuf = ReadBufferExtended(rel, MAIN_FORKNUM, P_NEW, RBM_NORMAL, NULL);
+
+	for (written = firstlen; written < header->length;)
+	{
+		Buffer		buffer;
+		uint32		len = Min(header->length - written, COLUMNAR_PAGE_CAPACITY);
+
+		buffer = ReadBufferExtended(rel, MAIN_FORKNUM, P_NEW, RBM_NORMAL,
+									NULL);
+		LockBuffer(buffer, BUFFER_LOCK_EXCLUSIVE);
+		columnar_fill_page(rel, buffer, 0, NULL, 0, contents + written, len);
+		UnlockReleaseBuffer(buffer);
+
+		written += len;
+	}
+
+	UnlockRelationForExtension(rel, ExclusiveLock);
+
+	LockBuffer(firstbuf, BUFFER_LOCK_EXCLUSIVE);
+	columnar_fill_page(rel, firstbuf, COLUMNAR_STRIPE_START,
+					   (char *) header, sizeof(ColumnarStripeHeader),
+					   contents, firstlen);
+	UnlockReleaseBuffer(firstbuf);
+}
+
+/*
+ * Read the header of the stripe starting at blkno.  Returns false if no
+ * stripe starts there.
+ */
+bool
+columnar_read_stripe_header(Relation rel, BufferAccessStrategy strategy,
+							BlockNumber blkno, ColumnarStripeHeader *header)
+{
+	Buffer		buffer;
+	Page		page;
+	bool		found = false;
+
+	buffer = ReadBufferExtended(rel, MAIN_FORKNUM, blkno, RBM_NORMAL,
+								strategy);
+	LockBuffer(buffer, BUFFER_LOCK_SHARE);
+	page = BufferGetPage(buffer);
+
+	if (!PageIsNew(page) && ColumnarPageIsStripeStart(page))
+	{
+		memcpy(header, PageGetContents(page), sizeof(ColumnarStripeHeader));
+		if (header->magic != COLUMNAR_STRIPE_MAGIC)
+			ereport(ERROR,
+					(errcode(ERRCODE_DATA_CORRUPTED),
+					 errmsg("invalid stripe header in block %u of relation \"%s\"",
+							blkno, RelationGetRelationName(rel))));
+		found = true;
+	}
+
+	UnlockReleaseBuffer(buffer);
+
+	return found;
+}
+
+/*
+ * Copy length bytes of the contents of the stripe starting at blkno,
+ * beginning at offset, to dest.
+ */
+void
+columnar_read_stripe_contents(Relation rel, BufferAccessStrategy strategy,
+							  BlockNumber blkno, uint32 offset, uint32 length,
+							  char *dest)
+{
+	while (length > 0)
+	{
+		BlockNumber pageno;
+		uint32		pageoff;
+		uint32		pagelen;
+		Buffer		buffer;
+		char	   *contents;
+
+		/* find the page holding the byte at offset */
+		if (offset < COLUMNAR_FIRST_PAGE_CAPACITY)
+		{
+			pageno = 0;
+			pageoff = MAXALIGN(sizeof(ColumnarStripeHeader)) + offset;
+			pagelen = COLUMNAR_FIRST_PAGE_CAPACITY - offset;
+		}
+		else
+		{
+			uint32		rest = offset - COLUMNAR_FIRST_PAGE_CAPACITY;
+
+			pageno = 1 + rest / COLUMNAR_PAGE_CAPACITY;
+			pageoff = rest % COLUMNAR_PAGE_CAPACITY;
+			pagelen = COLUMNAR_PAGE_CAPACITY - pageoff;
+		}
+		pagelen = Min(pagelen, length);
+
+		buffer = ReadBufferExtended(rel, MAIN_FORKNUM, blkno + pageno,
+									RBM_NORMAL, strategy);
+		LockBuffer(buffer, BUFFER_LOCK_SHARE);
+		contents = PageGetContents(BufferGetPage(buffer));
+		memcpy(dest, contents + pageoff, pagelen);
+		UnlockReleaseBuffer(buffer);
+
+		dest += pagelen;
+		offset += pagelen;
+		length -= pagelen;
+	}
+}
+
+/*
+ * Change the xid of the stripe starting at blkno.
+ */
+void
+columnar_set_stripe_xid(Relation rel, BlockNumber blkno, TransactionId xid)
+{
+	Buffer		buffer;
+	GenericXLogState *state;
+	Page		page;
+	ColumnarStripeHeader *header;
+
+	buffer = ReadBuffer(rel, blkno);
+	LockBuffer(buffer, BUFFER_LOCK_EXCLUSIVE);
+
+	state = GenericXLogStart(rel);
+	page = GenericXLogRegisterBuffer(state, buffer, 0);
+
+	Assert(ColumnarPageIsStripeStart(page));
+	header = (ColumnarStripeHeader *) PageGetContents(page);
+	header->xid = xid;
+
+	GenericXLogFinish(state);
+	UnlockReleaseBuffer(buffer);
+}
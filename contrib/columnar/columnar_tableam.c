@@ -0,0 +1,759 @@
+/*-------------------------------------------------------------------------
+ *
+ * columnar_tableam.c
+ *		Table access method routines for columnar tables.
+ *
+ * Columnar tables only support appending rows and reading them back in
+ * sequential scans.  Rows have no item pointers, so indexes, UPDATE,
+ * DELETE, row locking and TABLESAMPLE are not supported.
+ *
+ * Portions Copyright (c) 2021, PostgreSQL Global Development Group
+ *
+ * IDENTIFICATION
+ *	  contrib/columnar/columnar_tableam.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include <math.h>
+
+#include "access/heapam.h"
+#include "access/multixact.h"
+#include "access/tableam.h"
+#include "access/transam.h"
+#include "access/xact.h"
+#include "catalog/index.h"
+#include "catalog/storage.h"
+#include "catalog/storage_xlog.h"
+#include "columnar.h"
+#include "commands/vacuum.h"
+#include "executor/tuptable.h"
+#include "miscadmin.h"
+#include "nodes/execnodes.h"
+#include "pgstat.h"
+#include "storage/bufmgr.h"
+#include "storage/smgr.h"
+#include "utils/snapmgr.h"
+
+static const TableAmRoutine columnar_methods;
+
+PG_FUNCTION_INFO_V1(columnar_tableam_handler);
+
+/*
+ * Report that an operation is not supported on columnar tables.
+ */
+static void
+columnar_unsupported(const char *what)
+{
+	ereport(ERROR,
+			(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+			 errmsg("%s is not supported on columnar tables", what)));
+}
+
+
+/* ------------------------------------------------------------------------
+ * Slot related callbacks for columnar AM
+ * ------------------------------------------------------------------------
+ */
+
+static const TupleTableSlotOps *
+columnar_slot_callbacks(Relation relation)
+{
+	return &TTSOpsVirtual;
+}
+
+
+/* ------------------------------------------------------------------------
+ * Scan related callbacks for columnar AM
+ * ------------------------------------------------------------------------
+ */
+
+static TableScanDesc
+columnar_beginscan(Relation relation, Snapshot snapshot,
+				   int nkeys, ScanKey key,
+				   ParallelTableScanDesc parallel_scan,
+				   uint32 flags)
+{
+	ColumnarScanDesc scan;
+	TupleDesc	tupdesc = RelationGetDescr(relation);
+
+	if (flags & SO_TYPE_SAMPLESCAN)
+		columnar_unsupported("TABLESAMPLE");
+	if (flags & (SO_TYPE_BITMAPSCAN | SO_TYPE_TIDSCAN | SO_TYPE_TIDRANGESCAN))
+		columnar_unsupported("scanning by tuple identifier");
+
+	/* see heap_beginscan() */
+	RelationIncrementReferenceCount(relation);
+
+	scan = (ColumnarScanDesc) palloc0(sizeof(ColumnarScanDescData));
+	scan->rs_base.rs_rd = relation;
+	scan->rs_base.rs_snapshot = snapshot;
+	scan->rs_base.rs_nkeys = nkeys;
+	scan->rs_base.rs_key = NULL;
+	scan->rs_base.rs_flags = flags;
+	scan->rs_base.rs_parallel = parallel_scan;
+
+	/* a plain scan reads all attributes; see columnar_customscan.c */
+	scan->needed = palloc(sizeof(bool) * Max(tupdesc->natts, 1));
+	for (int i = 0; i < tupdesc->natts; i++)
+		scan->needed[i] = !TupleDescAttr(tupdesc, i)->attisdropped;
+
+	scan->reader = columnar_begin_read(relation, snapshot, scan->needed,
+									   NIL, parallel_scan);
+
+	return (TableScanDesc) scan;
+}
+
+static void
+columnar_endscan(TableScanDesc sscan)
+{
+	ColumnarScanDesc scan = (ColumnarScanDesc) sscan;
+
+	columnar_end_read(scan->reader);
+
+	RelationDecrementReferenceCount(scan->rs_base.rs_rd);
+
+	if (scan->rs_base.rs_flags & SO_TEMP_SNAPSHOT)
+		UnregisterSnapshot(scan->rs_base.rs_snapshot);
+
+	pfree(scan->needed);
+	pfree(scan);
+}
+
+static void
+columnar_rescan(TableScanDesc sscan, ScanKey key, bool set_params,
+				bool allow_strat, bool allow_sync, bool allow_pagemode)
+{
+	ColumnarScanDesc scan = (ColumnarScanDesc) sscan;
+
+	columnar_restart_read(scan->reader);
+}
+
+static bool
+columnar_getnextslot(TableScanDesc sscan, ScanDirection direction,
+					 TupleTableSlot *slot)
+{
+	ColumnarScanDesc scan = (ColumnarScanDesc) sscan;
+
+	if (ScanDirectionIsBackward(direction))
+		columnar_unsupported("backward scanning");
+
+	ExecClearTuple(slot);
+
+	if (!columnar_read_next_row(scan->reader, slot->tts_values,
+								slot->tts_isnull))
+		return false;
+
+	ExecStoreVirtualTuple(slot);
+	pgstat_count_heap_getnext(scan->rs_base.rs_rd);
+
+	return true;
+}
+
+static Size
+columnar_parallelscan_initialize(Relation rel, ParallelTableScanDesc pscan)
+{
+	/* the participants can't see the rows we have buffered */
+	columnar_flush_pending(rel);
+
+	return table_block_parallelscan_initialize(rel, pscan);
+}
+
+
+/* ------------------------------------------------------------------------
+ * Callbacks for non-modifying operations on individual tuples, which need
+ * item pointers and are therefore not supported
+ * ------------------------------------------------------------------------
+ */
+
+static IndexFetchTableData *
+columnar_index_fetch_begin(Relation rel)
+{
+	columnar_unsupported("index scanning");
+	return NULL;				/* keep compiler quiet */
+}
+
+static void
+columnar_index_fetch_reset(IndexFetchTableData *scan)
+{
+	columnar_unsupported("index scanning");
+}
+
+static void
+columnar_index_fetch_end(IndexFetchTableData *scan)
+{
+	columnar_unsupported("index scanning");
+}
+
+static bool
+columnar_index_fetch_tuple(struct IndexFetchTableData *scan,
+						   ItemPointer tid,
+						   Snapshot snapshot,
+						   TupleTableSlot *slot,
+						   bool *call_again, bool *all_dead)
+{
+	columnar_unsupported("index scanning");
+	return false;				/* keep compiler quiet */
+}
+
+static bool
+columnar_fetch_row_version(Relation relation,
+						   ItemPointer tid,
+						   Snapshot snapshot,
+						   TupleTableSlot *slot)
+{
+	columnar_unsupported("fetching rows by tuple identifier");
+	return false;				/* keep compiler quiet */
+}
+
+static void
+columnar_get_latest_tid(TableScanDesc sscan, ItemPointer tid)
+{
+	columnar_unsupported("fetching rows by tuple identifier");
+}
+
+static bool
+columnar_tuple_tid_valid(TableScanDesc scan, ItemPointer tid)
+{
+	columnar_unsupported("fetching rows by tuple identifier");
+	return false;				/* keep compiler quiet */
+}
+
+static bool
+columnar_tuple_satisfies_snapshot(Relation rel, TupleTableSlot *slot,
+								  Snapshot snapshot)
+{
+	columnar_unsupported("fetching rows by tuple identifier");
+	return false;				/* keep compiler quiet */
+}
+
+static TransactionId
+columnar_index_delete_tuples(Relation rel, TM_IndexDeleteOp *delstate)
+{
+	columnar_unsupported("index scanning");
+	return InvalidTransactionId;	/* keep compiler quiet */
+}
+
+
+/* ------------------------------------------------------------------------
+ * Functions for manipulations of physical tuples for columnar AM
+ * ------------------------------------------------------------------------
+ */
+
+static void
+columnar_tuple_insert(Relation relation, TupleTableSlot *slot, CommandId cid,
+					  int options, BulkInsertState bistate)
+{
+	columnar_insert_row(relation, slot, cid);
+}
+
+static void
+columnar_tuple_insert_speculative(Relation relation, TupleTableSlot *slot,
+								  CommandId cid, int options,
+								  BulkInsertState bistate, uint32 specToken)
+{
+	columnar_unsupported("INSERT ... ON CONFLICT");
+}
+
+static void
+columnar_tuple_complete_speculative(Relation relation, TupleTableSlot *slot,
+									uint32 specToken, bool succeeded)
+{
+	columnar_unsupported("INSERT ... ON CONFLICT");
+}
+
+static void
+columnar_multi_insert(Relation relation, TupleTableSlot **slots, int ntuples,
+					  CommandId cid, int options, BulkInsertState bistate)
+{
+	for (int i = 0; i < ntuples; i++)
+		columnar_insert_row(relation, slots[i], cid);
+}
+
+static TM_Result
+columnar_tuple_delete(Relation relation, ItemPointer tid, CommandId cid,
+					  Snapshot snapshot, Snapshot crosscheck, bool wait,
+					  TM_FailureData *tmfd, bool changingPart)
+{
+	columnar_unsupported("DELETE");
+	return TM_Ok;				/* keep compiler quiet */
+}
+
+static TM_Result
+columnar_tuple_update(Relation relation, ItemPointer otid,
+					  TupleTableSlot *slot, CommandId cid, Snapshot snapshot,
+					  Snapshot crosscheck, bool wait, TM_FailureData *tmfd,
+					  LockTupleMode *lockmode, bool *update_indexes)
+{
+	columnar_unsupported("UPDATE");
+	return TM_Ok;				/* keep compiler quiet */
+}
+
+static TM_Result
+columnar_tuple_lock(Relation relation, ItemPointer tid, Snapshot snapshot,
+					TupleTableSlot *slot, CommandId cid, LockTupleMode mode,
+					LockWaitPolicy wait_policy, uint8 flags,
+					TM_FailureData *tmfd)
+{
+	columnar_unsupported("row locking");
+	return TM_Ok;				/* keep compiler quiet */
+}
+
+static void
+columnar_finish_bulk_insert(Relation relation, int options)
+{
+	columnar_flush_pending(relation);
+}
+
+
+/* ------------------------------------------------------------------------
+ * DDL related callbacks for columnar AM.
+ * ------------------------------------------------------------------------
+ */
+
+static void
+columnar_relation_set_new_filenode(Relation rel,
+								   const RelFileNode *newrnode,
+								   char persistence,
+								   TransactionId *freezeXid,
+								   MultiXactId *minmulti)
+{
+	SMgrRelation srel;
+
+	/* rows buffered for the old relfilenode must not end up in the new one */
+	columnar_discard_pending(rel);
+
+	/* see heapam_relation_set_new_filenode() */
+	*freezeXid = RecentXmin;
+	*minmulti = GetOldestMultiXactId();
+
+	srel = RelationCreateStorage(*newrnode, persistence);
+
+	if (persistence == RELPERSISTENCE_UNLOGGED)
+	{
+		Assert(rel->rd_rel->relkind == RELKIND_RELATION ||
+			   rel->rd_rel->relkind == RELKIND_MATVIEW);
+		smgrcreate(srel, INIT_FORKNUM, false);
+		log_smgrcreate(newrnode, INIT_FORKNUM);
+		smgrimmedsync(srel, INIT_FORKNUM);
+	}
+
+	smgrclose(srel);
+}
+
+static void
+columnar_relation_nontransactional_truncate(Relation rel)
+{
+	columnar_discard_pending(rel);
+	RelationTruncate(rel, 0);
+}
+
+static void
+columnar_relation_copy_data(Relation rel, const RelFileNode *newrnode)
+{
+	SMgrRelation dstrel;
+
+	/* the buffered rows must be copied too */
+	columnar_flush_pending(rel);
+
+	dstrel = smgropen(*newrnode, rel->rd_backend);
+	RelationOpenSmgr(rel);
+
+	/* see heapam_relation_copy_data() */
+	FlushRelationBuffers(rel);
+
+	RelationCreateStorage(*newrnode, rel->rd_rel->relpersistence);
+
+	RelationCopyStorage(rel->rd_smgr, dstrel, MAIN_FORKNUM,
+						rel->rd_rel->relpersistence);
+
+	for (ForkNumber forkNum = MAIN_FORKNUM + 1;
+		 forkNum <= MAX_FORKNUM; forkNum++)
+	{
+		if (smgrexists(rel->rd_smgr, forkNum))
+		{
+			smgrcreate(dstrel, forkNum, false);
+
+			if (RelationIsPermanent(rel) ||
+				(rel->rd_rel->relpersistence == RELPERSISTENCE_UNLOGGED &&
+				 forkNum == INIT_FORKNUM))
+				log_smgrcreate(newrnode, forkNum);
+			RelationCopyStorage(rel->rd_smgr, dstrel, forkNum,
+								rel->rd_rel->relpersistence);
+		}
+	}
+
+	RelationDropStorage(rel);
+	smgrclose(dstrel);
+}
+
+/*
+ * VACUUM FULL and CLUSTER rewrite the rows of committed transactions into
+ * new stripes, leaving behind those of aborted transactions.
+ */
+static void
+columnar_relation_copy_for_cluster(Relation OldTable, Relation NewTable,
+								   Relation OldIndex, bool use_sort,
+								   TransactionId OldestXmin,
+								   TransactionId *xid_cutoff,
+								   MultiXactId *multi_cutoff,
+								   double *num_tuples,
+								   double *tups_vacuumed,
+								   double *tups_recently_dead)
+{
+	TupleDesc	oldTupDesc = RelationGetDescr(OldTable);
+	TupleTableSlot *slot;
+	ColumnarReadState *reader;
+	bool	   *needed;
+	CommandId	cid = GetCurrentCommandId(true);
+
+	if (OldIndex != NULL || use_sort)
+		columnar_unsupported("CLUSTER");
+
+	Assert(oldTupDesc->natts == RelationGetDescr(NewTable)->natts);
+
+	needed = palloc(sizeof(bool) * Max(oldTupDesc->natts, 1));
+	for (int i = 0; i < oldTupDesc->natts; i++)
+		needed[i] = !TupleDescAttr(oldTupDesc, i)->attisdropped;
+
+	slot = MakeSingleTupleTableSlot(RelationGetDescr(NewTable),
+									&TTSOpsVirtual);
+	reader = columnar_begin_read(OldTable, NULL, needed, NIL, NULL);
+
+	*num_tuples = 0;
+	*tups_vacuumed = 0;
+	*tups_recently_dead = 0;
+
+	for (;;)
+	{
+		CHECK_FOR_INTERRUPTS();
+
+		ExecClearTuple(slot);
+		if (!columnar_read_next_row(reader, slot->tts_values, slot->tts_isnull))
+			break;
+		ExecStoreVirtualTuple(slot);
+
+		columnar_insert_row(NewTable, slot, cid);
+		*num_tuples += 1;
+	}
+
+	columnar_flush_pending(NewTable);
+
+	columnar_end_read(reader);
+	ExecDropSingleTupleTableSlot(slot);
+	pfree(needed);
+}
+
+/*
+ * VACUUM freezes the stripes of transactions that committed before
+ * OldestXmin, so that relfrozenxid can advance, and marks those of aborted
+ * transactions as dead.  The space of dead stripes is only reclaimed by
+ * VACUUM FULL.
+ */
+static void
+columnar_vacuum_rel(Relation rel, VacuumParams *params,
+					BufferAccessStrategy bstrategy)
+{
+	TransactionId OldestXmin;
+	TransactionId FreezeLimit;
+	TransactionId xidFullScanLimit;
+	MultiXactId MultiXactCutoff;
+	MultiXactId mxactFullScanLimit;
+	BlockNumber nblocks;
+	BlockNumber blkno;
+	double		live_tuples = 0;
+	double		dead_tuples = 0;
+
+	columnar_flush_pending(rel);
+
+	vacuum_set_xid_limits(rel,
+						  params->freeze_min_age,
+						  params->freeze_table_age,
+						  params->multixact_freeze_min_age,
+						  params->multixact_freeze_table_age,
+						  &OldestXmin, &FreezeLimit, &xidFullScanLimit,
+						  &MultiXactCutoff, &mxactFullScanLimit);
+
+	nblocks = RelationGetNumberOfBlocks(rel);
+	for (blkno = 0; blkno < nblocks;)
+	{
+		ColumnarStripeHeader header;
+		TransactionId xid;
+
+		vacuum_delay_point();
+
+		if (!columnar_read_stripe_header(rel, bstrategy, blkno, &header))
+		{
+			blkno++;
+			continue;
+		}
+
+		xid = header.xid;
+		if (!TransactionIdIsValid(xid))
+			 /* dead already */ ;
+		else if (TransactionIdEquals(xid, FrozenTransactionId))
+			live_tuples += header.nrows;
+		else if (!TransactionIdPrecedes(xid, OldestXmin))
+		{
+			/* might still be running, or invisible to someone */
+			live_tuples += header.nrows;
+		}
+		else if (TransactionIdDidCommit(xid))
+		{
+			columnar_set_stripe_xid(rel, blkno, FrozenTransactionId);
+			live_tuples += header.nrows;
+		}
+		else
+		{
+			columnar_set_stripe_xid(rel, blkno, InvalidTransactionId);
+			dead_tuples += header.nrows;
+		}
+
+		blkno += header.nblocks;
+	}
+
+	/* all stripes older than OldestXmin are now frozen or dead */
+	vac_update_relstats(rel, nblocks, live_tuples, 0, false,
+						OldestXmin, MultiXactCutoff, false);
+
+	pgstat_report_vacuum(RelationGetRelid(rel),
+						 rel->rd_rel->relisshared,
+						 live_tuples,
+						 dead_tuples);
+}
+
+static bool
+columnar_scan_analyze_next_block(TableScanDesc sscan, BlockNumber blockno,
+								 BufferAccessStrategy bstrategy)
+{
+	ColumnarScanDesc scan = (ColumnarScanDesc) sscan;
+
+	/*
+	 * Only the first block of a stripe yields rows, namely all the stripe's
+	 * rows.  The sampled blocks therefore still see the right number of rows
+	 * on average.
+	 */
+	columnar_read_stripe_for_analyze(scan->reader, blockno,
+									 &scan->analyze_deadrows);
+
+	return true;
+}
+
+static bool
+columnar_scan_analyze_next_tuple(TableScanDesc sscan, TransactionId OldestXmin,
+								 double *liverows, double *deadrows,
+								 TupleTableSlot *slot)
+{
+	ColumnarScanDesc scan = (ColumnarScanDesc) sscan;
+
+	*deadrows += scan->analyze_deadrows;
+	scan->analyze_deadrows = 0;
+
+	/* the reader moves on to the next stripe only when asked to */
+	ExecClearTuple(slot);
+	if (!columnar_read_stripe_row(scan->reader, slot->tts_values,
+								  slot->tts_isnull))
+		return false;
+	ExecStoreVirtualTuple(slot);
+
+	*liverows += 1;
+
+	return true;
+}
+
+static double
+columnar_index_build_range_scan(Relation tableRelation,
+								Relation indexRelation,
+								IndexInfo *indexInfo,
+								bool allow_sync,
+								bool anyvisible,
+								bool progress,
+								BlockNumber start_blockno,
+								BlockNumber numblocks,
+								IndexBuildCallback callback,
+								void *callback_state,
+								TableScanDesc scan)
+{
+	columnar_unsupported("indexing");
+	return 0;					/* keep compiler quiet */
+}
+
+static void
+columnar_index_validate_scan(Relation tableRelation,
+							 Relation indexRelation,
+							 IndexInfo *indexInfo,
+							 Snapshot snapshot,
+							 ValidateIndexState *state)
+{
+	columnar_unsupported("indexing");
+}
+
+
+/* ------------------------------------------------------------------------
+ * Miscellaneous callbacks for the columnar AM
+ * ------------------------------------------------------------------------
+ */
+
+/*
+ * Values are detoasted when they are inserted, and stored in the stripes,
+ * compressed together with the other values of their attribute.
+ */
+static bool
+columnar_relation_needs_toast_table(Relation rel)
+{
+	return false;
+}
+
+
+/* ------------------------------------------------------------------------
+ * Planner related callbacks for the columnar AM
+ * ------------------------------------------------------------------------
+ */
+
+/*
+ * The tuple density of a columnar table depends on the compression ratio,
+ * so we don't try to guess it from the attribute widths like heap does.
+ * Instead, the density recorded by the last VACUUM or ANALYZE is applied
+ * to the current size, and for a table that was never processed, the row
+ * counts of its stripes are added up.
+ */
+static void
+columnar_estimate_rel_size(Relation rel, int32 *attr_widths,
+						   BlockNumber *pages, double *tuples,
+						   double *allvisfrac)
+{
+	BlockNumber curpages = RelationGetNumberOfBlocks(rel);
+	BlockNumber relpages = (BlockNumber) rel->rd_rel->relpages;
+	double		reltuples = (double) rel->rd_rel->reltuples;
+
+	*pages = curpages;
+	*allvisfrac = 0;
+
+	if (curpages == 0)
+		*tuples = 0;
+	else if (relpages > 0 && reltuples >= 0)
+		*tuples = rint(reltuples / (double) relpages * curpages);
+	else
+	{
+		BlockNumber blkno;
+
+		*tuples = 0;
+		for (blkno = 0; blkno < curpages;)
+		{
+			ColumnarStripeHeader header;
+
+			if (!columnar_read_stripe_header(rel, NULL, blkno, &header))
+			{
+				blkno++;
+				continue;
+			}
+			if (TransactionIdIsValid(header.xid))
+				*tuples += header.nrows;
+			blkno += header.nblocks;
+		}
+	}
+}
+
+
+/* ------------------------------------------------------------------------
+ * TABLESAMPLE callbacks, which are not supported
+ * ------------------------------------------------------------------------
+ */
+
+static bool
+columnar_scan_sample_next_block(TableScanDesc scan,
+								SampleScanState *scanstate)
+{
+	columnar_unsupported("TABLESAMPLE");
+	return false;				/* keep compiler quiet */
+}
+
+static bool
+columnar_scan_sample_next_tuple(TableScanDesc scan,
+								SampleScanState *scanstate,
+								TupleTableSlot *slot)
+{
+	columnar_unsupported("TABLESAMPLE");
+	return false;				/* keep compiler quiet */
+}
+
+
+/* ------------------------------------------------------------------------
+ * Definition of the columnar table access method.
+ * ------------------------------------------------------------------------
+ */
+
+static const TableAmRoutine columnar_methods = {
+	.type = T_TableAmRoutine,
+
+	.slot_callbacks = columnar_slot_callbacks,
+
+	.scan_begin = columnar_beginscan,
+	.scan_end = columnar_endscan,
+	.scan_rescan = columnar_rescan,
+	.scan_getnextslot = columnar_getnextslot,
+
+	.parallelscan_estimate = table_block_parallelscan_estimate,
+	.parallelscan_initialize = columnar_parallelscan_initialize,
+	.parallelscan_reinitialize = table_block_parallelscan_reinitialize,
+
+	.index_fetch_begin = columnar_index_fetch_begin,
+	.index_fetch_reset = columnar_index_fetch_reset,
+	.index_fetch_end = columnar_index_fetch_end,
+	.index_fetch_tuple = columnar_index_fetch_tuple,
+
+	.tuple_insert = columnar_tuple_insert,
+	.tuple_insert_speculative = columnar_tuple_insert_speculative,
+	.tuple_complete_speculative = columnar_tuple_complete_speculative,
+	.multi_insert = columnar_multi_insert,
+	.tuple_delete = columnar_tuple_delete,
+	.tuple_update = columnar_tuple_update,
+	.tuple_lock = columnar_tuple_lock,
+	.finish_bulk_insert = columnar_finish_bulk_insert,
+
+	.tuple_fetch_row_version = columnar_fetch_row_version,
+	.tuple_get_latest_tid = columnar_get_latest_tid,
+	.tuple_tid_valid = columnar_tuple_tid_valid,
+	.tuple_satisfies_snapshot = columnar_tuple_satisfies_snapshot,
+	.index_delete_tuples = columnar_index_delete_tuples,
+
+	.relation_set_new_filenode = columnar_relation_set_new_filenode,
+	.relation_nontransactional_truncate = columnar_relation_nontransactional_truncate,
+	.relation_copy_data = columnar_relation_copy_data,
+	.relation_copy_for_cluster = columnar_relation_copy_for_cluster,
+	.relation_vacuum = columnar_vacuum_rel,
+	.scan_analyze_next_block = columnar_scan_analyze_next_block,
+	.scan_analyze_next_tuple = columnar_scan_analyze_next_tuple,
+	.index_build_range_scan = columnar_index_build_range_scan,
+	.index_validate_scan = columnar_index_validate_scan,
+
+	.relation_size = table_block_relation_size,
+	.relation_needs_toast_table = columnar_relation_needs_toast_table,
+
+	.relation_estimate_size = columnar_estimate_rel_size,
+
+	.scan_sample_next_block = columnar_scan_sample_next_block,
+	.scan_sample_next_tuple = columnar_scan_sample_next_tuple
+};
+
+const TableAmRoutine *
+GetColumnarTableAmRoutine(void)
+{
+	return &columnar_methods;
+}
+
+/*
+ * Is rel a columnar table?
+ */
+bool
+IsColumnarRelation(Relation rel)
+{
+	return rel->rd_tableam == &columnar_methods;
+}
+
+Datum
+columnar_tableam_handler(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_POINTER(&columnar_methods);
+}
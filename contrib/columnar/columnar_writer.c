@@ -0,0 +1,528 @@
+/*-------------------------------------------------------------------------
+ *
+ * columnar_writer.c
+ *		Buffering and writing of rows inserted into columnar tables.
+ *
+ * Rows inserted into a columnar table are buffered in backend memory, one
+ * buffer per table, and written out as a stripe when the buffer is full,
+ * when a row inserted by a different command or subtransaction comes along,
+ * before the table is scanned, and at commit.  Since a stripe only holds
+ * rows of one command of one subtransaction, its visibility can be decided
+ * as a whole.  Buffers of aborted subtransactions are simply thrown away.
+ *
+ * Portions Copyright (c) 2021, PostgreSQL Global Development Group
+ *
+ * IDENTIFICATION
+ *	  contrib/columnar/columnar_writer.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#ifdef USE_LZ4
+#include <lz4.h>
+#endif
+
+#include "access/detoast.h"
+#include "access/relation.h"
+#include "access/table.h"
+#include "access/xact.h"
+#include "columnar.h"
+#include "common/pg_lzcompress.h"
+#include "utils/datum.h"
+#include "utils/memutils.h"
+#include "utils/typcache.h"
+
+/* Rows buffered for one table */
+typedef struct ColumnarWriteState
+{
+	Oid			relid;			/* table the rows belong to */
+	RelFileNode relnode;		/* and its storage */
+	SubTransactionId subid;		/* subtransaction that inserted them */
+	TransactionId xid;			/* its xid */
+	CommandId	cid;			/* command that inserted them */
+	MemoryContext context;		/* holds everything below */
+	TupleDesc	tupdesc;		/* the table's descriptor */
+	int			nrows;			/* number of rows buffered */
+	int			maxrows;		/* allocated size of the arrays */
+	Size		datasize;		/* size of the pass-by-reference values */
+	Datum	  **values;			/* per-attribute arrays of values */
+	bool	  **isnull;			/* per-attribute null flags */
+} ColumnarWriteState;
+
+/* Buffers of the current transaction, in TopTransactionContext */
+static List *pending_writes = NIL;
+
+static ColumnarWriteState *columnar_get_write_state(Relation rel,
+													CommandId cid);
+static void columnar_init_write_state(ColumnarWriteState *ws, Relation rel);
+static void columnar_flush(ColumnarWriteState *ws, Relation rel);
+static void columnar_reset_write_state(ColumnarWriteState *ws);
+static char *columnar_encode_chunk(ColumnarWriteState *ws, int attnum,
+								   ColumnarChunk *chunk);
+static char *columnar_compress_chunk(char *raw, ColumnarChunk *chunk);
+static void columnar_xact_callback(XactEvent event, void *arg);
+static void columnar_subxact_callback(SubXactEvent event,
+									  SubTransactionId mySubid,
+									  SubTransactionId parentSubid,
+									  void *arg);
+
+/*
+ * Register the transaction callbacks that write out or discard buffers.
+ */
+void
+columnar_init_writer(void)
+{
+	RegisterXactCallback(columnar_xact_callback, NULL);
+	RegisterSubXactCallback(columnar_subxact_callback, NULL);
+}
+
+/*
+ * Buffer a row inserted into rel by command cid.
+ */
+void
+columnar_insert_row(Relation rel, TupleTableSlot *slot, CommandId cid)
+{
+	ColumnarWriteState *ws = columnar_get_write_state(rel, cid);
+	TupleDesc	tupdesc = ws->tupdesc;
+	MemoryContext oldcontext;
+	int			row;
+
+	slot_getallattrs(slot);
+
+	oldcontext = MemoryContextSwitchTo(ws->context);
+
+	if (ws->nrows == ws->maxrows)
+	{
+		ws->maxrows *= 2;
+		for (int i = 0; i < tupdesc->natts; i++)
+		{
+			ws->values[i] = repalloc(ws->values[i],
+									 sizeof(Datum) * ws->maxrows);
+			ws->isnull[i] = repalloc(ws->isnull[i],
+									 sizeof(bool) * ws->maxrows);
+		}
+	}
+
+	row = ws->nrows++;
+	for (int i = 0; i < tupdesc->natts; i++)
+	{
+		Form_pg_attribute att = TupleDescAttr(tupdesc, i);
+		Datum		value = slot->tts_values[i];
+
+		if (slot->tts_isnull[i] || att->attisdropped)
+		{
+			ws->values[i][row] = (Datum) 0;
+			ws->isnull[i][row] = true;
+			continue;
+		}
+
+		if (!att->attbyval)
+		{
+			/* we store all values inline, so fetch any toasted ones */
+			if (att->attlen == -1 &&
+				VARATT_IS_EXTERNAL(DatumGetPointer(value)))
+				value = PointerGetDatum(detoast_external_attr((struct varlena *)
+															  DatumGetPointer(value)));
+			else
+				value = datumCopy(value, false, att->attlen);
+			ws->datasize += datumGetSize(value, false, att->attlen);
+		}
+
+		ws->values[i][row] = value;
+		ws->isnull[i][row] = false;
+	}
+
+	MemoryContextSwitchTo(oldcontext);
+
+	if (ws->nrows >= columnar_stripe_row_limit ||
+		ws->datasize >= COLUMNAR_MAX_BUFFERED_BYTES)
+		columnar_flush(ws, rel);
+}
+
+/*
+ * Write out the rows buffered for rel, if any.  This must be done before
+ * the table is read in the current transaction.
+ */
+void
+columnar_flush_pending(Relation rel)
+{
+	ListCell   *lc;
+
+	foreach(lc, pending_writes)
+	{
+		ColumnarWriteState *ws = (ColumnarWriteState *) lfirst(lc);
+
+		if (ws->relid == RelationGetRelid(rel) && ws->nrows > 0)
+			columnar_flush(ws, rel);
+	}
+}
+
+/*
+ * Throw away the rows buffered for rel, because its contents are being
+ * replaced.
+ */
+void
+columnar_discard_pending(Relation rel)
+{
+	ListCell   *lc;
+
+	foreach(lc, pending_writes)
+	{
+		ColumnarWriteState *ws = (ColumnarWriteState *) lfirst(lc);
+
+		if (ws->relid == RelationGetRelid(rel))
+			columnar_reset_write_state(ws);
+	}
+}
+
+/*
+ * Find or create the buffer for rows inserted into rel by command cid of
+ * the current subtransaction.  If the buffer holds rows of another command
+ * or subtransaction, they are written out first.
+ */
+static ColumnarWriteState *
+columnar_get_write_state(Relation rel, CommandId cid)
+{
+	TransactionId xid = GetCurrentTransactionId();
+	ColumnarWriteState *ws = NULL;
+	ListCell   *lc;
+
+	foreach(lc, pending_writes)
+	{
+		ColumnarWriteState *cur = (ColumnarWriteState *) lfirst(lc);
+
+		if (cur->relid == RelationGetRelid(rel) &&
+			RelFileNodeEquals(cur->relnode, rel->rd_node))
+		{
+			ws = cur;
+			break;
+		}
+	}
+
+	if (ws == NULL)
+	{
+		ws = MemoryContextAllocZero(TopTransactionContext,
+									sizeof(ColumnarWriteState));
+		pending_writes = lappend(pending_writes, ws);
+	}
+	else if (ws->nrows > 0)
+	{
+		if (ws->xid == xid && ws->cid == cid &&
+			ws->tupdesc->natts == RelationGetDescr(rel)->natts)
+			return ws;
+		columnar_flush(ws, rel);
+	}
+
+	ws->xid = xid;
+	ws->cid = cid;
+	columnar_init_write_state(ws, rel);
+
+	return ws;
+}
+
+/*
+ * Set up an empty buffer for rel, for rows of the current subtransaction.
+ */
+static void
+columnar_init_write_state(ColumnarWriteState *ws, Relation rel)
+{
+	MemoryContext oldcontext;
+
+	/* start afresh, in case the table's descriptor changed */
+	if (ws->context != NULL)
+		MemoryContextDelete(ws->context);
+
+	ws->relid = RelationGetRelid(rel);
+	ws->relnode = rel->rd_node;
+	ws->subid = GetCurrentSubTransactionId();
+	ws->context = AllocSetContextCreate(TopTransactionContext,
+										"columnar write buffer",
+										ALLOCSET_DEFAULT_SIZES);
+
+	oldcontext = MemoryContextSwitchTo(ws->context);
+	ws->tupdesc = CreateTupleDescCopy(RelationGetDescr(rel));
+	ws->nrows = 0;
+	ws->maxrows = 1024;
+	ws->datasize = 0;
+	ws->values = palloc(sizeof(Datum *) * Max(ws->tupdesc->natts, 1));
+	ws->isnull = palloc(sizeof(bool *) * Max(ws->tupdesc->natts, 1));
+	for (int i = 0; i < ws->tupdesc->natts; i++)
+	{
+		ws->values[i] = palloc(sizeof(Datum) * ws->maxrows);
+		ws->isnull[i] = palloc(sizeof(bool) * ws->maxrows);
+	}
+	MemoryContextSwitchTo(oldcontext);
+}
+
+/*
+ * Forget the rows in a buffer.
+ */
+static void
+columnar_reset_write_state(ColumnarWriteState *ws)
+{
+	ws->nrows = 0;
+	ws->datasize = 0;
+}
+
+/*
+ * Write the rows in a buffer out as a new stripe of rel.
+ */
+static void
+columnar_flush(ColumnarWriteState *ws, Relation rel)
+{
+	int			natts = ws->tupdesc->natts;
+	ColumnarStripeHeader header;
+	ColumnarChunk *chunks;
+	char	  **data;
+	char	   *contents;
+	uint32		length;
+	MemoryContext oldcontext;
+
+	Assert(ws->relid == RelationGetRelid(rel));
+
+	if (ws->nrows == 0)
+		return;
+
+	oldcontext = MemoryContextSwitchTo(ws->context);
+
+	chunks = palloc0(sizeof(ColumnarChunk) * Max(natts, 1));
+	data = palloc(sizeof(char *) * Max(natts, 1));
+
+	/* encode and compress each attribute's values */
+	length = sizeof(ColumnarChunk) * natts;
+	for (int i = 0; i < natts; i++)
+	{
+		char	   *raw = columnar_encode_chunk(ws, i, &chunks[i]);
+
+		data[i] = columnar_compress_chunk(raw, &chunks[i]);
+		chunks[i].offset = length;
+		if ((uint64) length + chunks[i].length > PG_UINT32_MAX)
+			ereport(ERROR,
+					(errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
+					 errmsg("columnar stripe too large")));
+		length += chunks[i].length;
+	}
+
+	/* and assemble the stripe */
+	contents = palloc(Max(length, 1));
+	memcpy(contents, chunks, sizeof(ColumnarChunk) * natts);
+	for (int i = 0; i < natts; i++)
+		memcpy(contents + chunks[i].offset, data[i], chunks[i].length);
+
+	memset(&header, 0, sizeof(header));
+	header.magic = COLUMNAR_STRIPE_MAGIC;
+	header.length = length;
+	header.xid = ws->xid;
+	header.cid = ws->cid;
+	header.nrows = ws->nrows;
+	header.natts = natts;
+
+	columnar_write_stripe(rel, &header, contents);
+
+	MemoryContextSwitchTo(oldcontext);
+
+	/* free the written rows, and get ready for more of the same command */
+	columnar_init_write_state(ws, rel);
+}
+
+/*
+ * Build the uncompressed chunk holding the buffered values of attribute
+ * attnum (zero-based), and fill in the corresponding fields of chunk.
+ */
+static char *
+columnar_encode_chunk(ColumnarWriteState *ws, int attnum, ColumnarChunk *chunk)
+{
+	Form_pg_attribute att = TupleDescAttr(ws->tupdesc, attnum);
+	Datum	   *values = ws->values[attnum];
+	bool	   *isnull = ws->isnull[attnum];
+	FmgrInfo   *cmpfn = NULL;
+	Size		bitmaplen = 0;
+	Size		off = 0;
+	char	   *raw;
+	char	   *data;
+
+	chunk->nnulls = 0;
+	for (int row = 0; row < ws->nrows; row++)
+	{
+		if (isnull[row])
+		{
+			chunk->nnulls++;
+			continue;
+		}
+		off = att_align_nominal(off, att->attalign);
+		off = att_addlength_datum(off, att->attlen, values[row]);
+	}
+
+	if (chunk->nnulls > 0)
+		bitmaplen = MAXALIGN(BITMAPLEN(ws->nrows));
+	if (bitmaplen + off > MaxAllocSize)
+		ereport(ERROR,
+				(errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
+				 errmsg("columnar stripe too large")));
+
+	chunk->rawlength = bitmaplen + off;
+	raw = palloc0(Max(chunk->rawlength, 1));
+	data = raw + bitmaplen;
+
+	/* min/max summaries are kept for pass-by-value types only */
+	if (att->attbyval && chunk->nnulls < ws->nrows)
+	{
+		TypeCacheEntry *typentry;
+
+		typentry = lookup_type_cache(att->atttypid, TYPECACHE_CMP_PROC_FINFO);
+		if (OidIsValid(typentry->cmp_proc_finfo.fn_oid))
+			cmpfn = &typentry->cmp_proc_finfo;
+	}
+	chunk->hasminmax = false;
+
+	off = 0;
+	for (int row = 0; row < ws->nrows; row++)
+	{
+		Datum		value = values[row];
+
+		if (isnull[row])
+			continue;
+		if (bitmaplen > 0)
+			raw[row >> 3] |= (1 << (row & 0x07));
+
+		off = att_align_nominal(off, att->attalign);
+		if (att->attbyval)
+			store_att_byval(data + off, value, att->attlen);
+		else
+			memcpy(data + off, DatumGetPointer(value),
+				   datumGetSize(value, false, att->attlen));
+		off = att_addlength_datum(off, att->attlen, value);
+
+		if (cmpfn == NULL)
+			continue;
+		if (!chunk->hasminmax)
+		{
+			chunk->minval = chunk->maxval = (uint64) value;
+			chunk->hasminmax = true;
+		}
+		else if (DatumGetInt32(FunctionCall2Coll(cmpfn, att->attcollation,
+												 value,
+												 (Datum) chunk->minval)) < 0)
+			chunk->minval = (uint64) value;
+		else if (DatumGetInt32(FunctionCall2Coll(cmpfn, att->attcollation,
+												 value,
+												 (Datum) chunk->maxval)) > 0)
+			chunk->maxval = (uint64) value;
+	}
+
+	return raw;
+}
+
+/*
+ * Compress a chunk as per columnar.compression, if that makes it smaller.
+ * Returns the data to store, and sets the chunk's length and compression.
+ */
+static char *
+columnar_compress_chunk(char *raw, ColumnarChunk *chunk)
+{
+	char	   *compressed = NULL;
+	int32		len = -1;
+
+	switch (columnar_compression)
+	{
+		case COLUMNAR_COMPRESSION_NONE:
+			break;
+		case COLUMNAR_COMPRESSION_PGLZ:
+			compressed = palloc(PGLZ_MAX_OUTPUT(chunk->rawlength));
+			len = pglz_compress(raw, chunk->rawlength, compressed,
+								PGLZ_strategy_default);
+			break;
+		case COLUMNAR_COMPRESSION_LZ4:
+#ifdef USE_LZ4
+			compressed = palloc(LZ4_compressBound(chunk->rawlength));
+			len = LZ4_compress_default(raw, compressed, chunk->rawlength,
+									   LZ4_compressBound(chunk->rawlength));
+			if (len == 0)
+				len = -1;
+#endif
+			break;
+	}
+
+	if (len >= 0 && len < chunk->rawlength)
+	{
+		pfree(raw);
+		chunk->compression = columnar_compression;
+		chunk->length = len;
+		return compressed;
+	}
+
+	if (compressed)
+		pfree(compressed);
+	chunk->compression = COLUMNAR_COMPRESSION_NONE;
+	chunk->length = chunk->rawlength;
+	return raw;
+}
+
+/*
+ * Write out all buffers before commit; forget them afterwards.
+ */
+static void
+columnar_xact_callback(XactEvent event, void *arg)
+{
+	switch (event)
+	{
+		case XACT_EVENT_PRE_COMMIT:
+		case XACT_EVENT_PARALLEL_PRE_COMMIT:
+		case XACT_EVENT_PRE_PREPARE:
+			{
+				ListCell   *lc;
+
+				foreach(lc, pending_writes)
+				{
+					ColumnarWriteState *ws = (ColumnarWriteState *) lfirst(lc);
+					Relation	rel;
+
+					if (ws->nrows == 0)
+						continue;
+
+					/* the table might have been dropped meanwhile */
+					rel = try_relation_open(ws->relid, NoLock);
+					if (rel == NULL)
+						continue;
+					if (RelFileNodeEquals(ws->relnode, rel->rd_node))
+						columnar_flush(ws, rel);
+					relation_close(rel, NoLock);
+				}
+				break;
+			}
+
+		case XACT_EVENT_COMMIT:
+		case XACT_EVENT_PARALLEL_COMMIT:
+		case XACT_EVENT_PREPARE:
+		case XACT_EVENT_ABORT:
+		case XACT_EVENT_PARALLEL_ABORT:
+			/* the buffers went away with TopTransactionContext */
+			pending_writes = NIL;
+			break;
+	}
+}
+
+/*
+ * Forget the buffers of aborted subtransactions, and hand those of
+ * committed subtransactions over to the parent.
+ */
+static void
+columnar_subxact_callback(SubXactEvent event, SubTransactionId mySubid,
+						  SubTransactionId parentSubid, void *arg)
+{
+	ListCell   *lc;
+
+	foreach(lc, pending_writes)
+	{
+		ColumnarWriteState *ws = (ColumnarWriteState *) lfirst(lc);
+
+		if (ws->subid != mySubid)
+			continue;
+
+		if (event == SUBXACT_EVENT_ABORT_SUB)
+			columnar_reset_write_state(ws);
+		else if (event == SUBXACT_EVENT_COMMIT_SUB)
+			ws->subid = parentSubid;
+	}
+}
@@ -0,0 +1,64 @@
+CREATE EXTENSION columnar;
+
+CREATE TABLE col_t (a int, b int8, c text, d float8) USING columnar;
+
+-- write 10 stripes of 1000 rows
+SET columnar.stripe_row_limit = 1000;
+INSERT INTO col_t SELECT i, i % 7, 'row ' || i, i / 4.0
+FROM generate_series(1, 10000) i;
+
+SELECT count(*), sum(a), min(b), max(b), max(c), sum(d) FROM col_t;
+SELECT * FROM col_t WHERE a = 4242;
+SELECT col_t FROM col_t WHERE a = 1;
+
+-- only the referenced columns are read, and stripes are skipped by min/max
+EXPLAIN (COSTS OFF) SELECT a FROM col_t WHERE a > 9500;
+EXPLAIN (ANALYZE, COSTS OFF, TIMING OFF, SUMMARY OFF)
+SELECT count(*) FROM col_t WHERE a > 9500;
+EXPLAIN (ANALYZE, COSTS OFF, TIMING OFF, SUMMARY OFF)
+SELECT b FROM col_t WHERE 1500 >= a AND a >= 1499;
+SELECT count(*), sum(b) FROM col_t WHERE a > 9500;
+
+SET columnar.enable_custom_scan = off;
+EXPLAIN (COSTS OFF) SELECT a FROM col_t WHERE a > 9500;
+SELECT count(*), sum(b) FROM col_t WHERE a > 9500;
+RESET columnar.enable_custom_scan;
+
+-- visibility of buffered rows, subtransactions and aborted transactions
+BEGIN;
+INSERT INTO col_t VALUES (20001, 1, 'in xact', 1);
+SELECT count(*) FROM col_t WHERE a > 20000;
+SAVEPOINT s1;
+INSERT INTO col_t VALUES (20002, 2, 'rolled back', 2);
+ROLLBACK TO s1;
+INSERT INTO col_t VALUES (20003, 3, 'after savepoint', 3);
+COMMIT;
+SELECT a, c FROM col_t WHERE a > 20000 ORDER BY a;
+
+BEGIN;
+INSERT INTO col_t SELECT i, 0, 'aborted', 0 FROM generate_series(30001, 32000) i;
+ROLLBACK;
+SELECT count(*) FROM col_t;
+
+VACUUM col_t;
+SELECT count(*), sum(a) FROM col_t;
+VACUUM FULL col_t;
+SELECT count(*), sum(a) FROM col_t;
+ANALYZE col_t;
+SELECT reltuples FROM pg_class WHERE relname = 'col_t';
+
+-- columns added later read as their default in older stripes
+ALTER TABLE col_t ADD COLUMN e int DEFAULT 5;
+INSERT INTO col_t VALUES (40001, 1, 'with e', 1, 6);
+SELECT count(*), sum(e) FROM col_t;
+
+-- rows have no item pointers
+UPDATE col_t SET b = 0 WHERE a = 1;
+DELETE FROM col_t WHERE a = 1;
+SELECT * FROM col_t WHERE a = 1 FOR UPDATE;
+CREATE INDEX ON col_t (a);
+
+TRUNCATE col_t;
+SELECT count(*) FROM col_t;
+
+DROP TABLE col_t;
@@ -71,6 +71,10 @@
 #define VARLENA_ATT_IS_PACKABLE(att) \
 	((att)->attstorage != TYPSTORAGE_PLAIN)
 
+static void heap_deform_tuple_columns(TupleDesc tupleDesc, HeapTupleHeader tup,
+									  int firstatt, uint32 off, int natts,
+									  Datum **values, bool **isnull, int row);
+
 
 /* ----------------------------------------------------------------
  *						misc support routines
@@ -1331,6 +1335,198 @@ heap_deform_tuple(HeapTuple tuple, TupleDesc tupleDesc,
 		values[attnum] = getmissingattr(tupleDesc, attnum + 1, &isnull[attnum]);
 }
 
+/*
+ * heap_deform_tuples
+ *		Extract the first natts attributes of many tuples at once, into
+ *		per-attribute arrays: attribute attnum of tuples[i] is stored in
+ *		values[attnum - 1][row + i] and isnull[attnum - 1][row + i].
+ *
+ *		Tuples that have no nulls among the leading fixed-width attributes
+ *		have those attributes at the same offsets, which we cache in the
+ *		tuple descriptor.  For those tuples, we extract one such attribute
+ *		at a time from all of them, rather than walking over all of the
+ *		attributes of one tuple at a time.  This makes extracting a few
+ *		attributes of many tuples, as batch-mode scans do, much cheaper.
+ *		Everything else is deformed like heap_deform_tuple() does.
+ *
+ *		ntuples must not exceed MaxHeapTuplesPerPage.  As with
+ *		heap_deform_tuple(), pass-by-reference values point into the
+ *		tuples.
+ */
+void
+heap_deform_tuples(TupleDesc tupleDesc, HeapTupleHeader *tuples, int ntuples,
+				   int natts, Datum **values, bool **isnull, int row)
+{
+	int			fast[MaxHeapTuplesPerPage];
+	int			nfast = 0;
+	int			nfixed;
+	uint32		fixedlen = 0;
+
+	Assert(natts <= tupleDesc->natts);
+	Assert(ntuples <= MaxHeapTuplesPerPage);
+
+	/*
+	 * Find the leading fixed-width attributes, making sure their offsets are
+	 * cached.
+	 */
+	for (nfixed = 0; nfixed < natts; nfixed++)
+	{
+		Form_pg_attribute att = TupleDescAttr(tupleDesc, nfixed);
+
+		if (att->attlen <= 0)
+			break;
+		fixedlen = att_align_nominal(fixedlen, att->attalign);
+		if (att->attcacheoff < 0)
+			att->attcacheoff = fixedlen;
+		Assert(att->attcacheoff == fixedlen);
+		fixedlen += att->attlen;
+	}
+
+	/*
+	 * Sort out the tuples that have all of those attributes, none of them
+	 * null, and deform the others the slow way.
+	 */
+	for (int i = 0; i < ntuples; i++)
+	{
+		HeapTupleHeader tup = tuples[i];
+		bool		isfast = (HeapTupleHeaderGetNatts(tup) >= nfixed);
+
+		if (isfast && (tup->t_infomask & HEAP_HASNULL))
+		{
+			for (int attnum = 0; attnum < nfixed; attnum++)
+			{
+				if (att_isnull(attnum, tup->t_bits))
+				{
+					isfast = false;
+					break;
+				}
+			}
+		}
+
+		if (isfast)
+			fast[nfast++] = i;
+		else
+			heap_deform_tuple_columns(tupleDesc, tup, 0, 0, natts,
+									  values, isnull, row + i);
+	}
+
+	if (nfast == 0)
+		return;
+
+	/* Extract the fixed-width attributes, one attribute at a time */
+	for (int attnum = 0; attnum < nfixed; attnum++)
+	{
+		Form_pg_attribute att = TupleDescAttr(tupleDesc, attnum);
+		Datum	   *colvalues = values[attnum];
+		bool	   *colisnull = isnull[attnum];
+		uint32		off = att->attcacheoff;
+
+#define DEFORM_FIXED_COLUMN(attbyval, attlen) \
+		for (int j = 0; j < nfast; j++) \
+		{ \
+			HeapTupleHeader tup = tuples[fast[j]]; \
+			\
+			colvalues[row + fast[j]] = \
+				fetch_att((char *) tup + tup->t_hoff + off, attbyval, attlen); \
+			colisnull[row + fast[j]] = false; \
+		}
+
+		if (!att->attbyval)
+			DEFORM_FIXED_COLUMN(false, att->attlen)
+		else if (att->attlen == sizeof(int32))
+			DEFORM_FIXED_COLUMN(true, sizeof(int32))
+#if SIZEOF_DATUM == 8
+		else if (att->attlen == sizeof(Datum))
+			DEFORM_FIXED_COLUMN(true, sizeof(Datum))
+#endif
+		else if (att->attlen == sizeof(int16))
+			DEFORM_FIXED_COLUMN(true, sizeof(int16))
+		else
+			DEFORM_FIXED_COLUMN(true, att->attlen)
+
+#undef DEFORM_FIXED_COLUMN
+	}
+
+	/* Deform any remaining attributes tuple by tuple */
+	if (nfixed < natts)
+	{
+		for (int j = 0; j < nfast; j++)
+			heap_deform_tuple_columns(tupleDesc, tuples[fast[j]],
+									  nfixed, fixedlen, natts,
+									  values, isnull, row + fast[j]);
+	}
+}
+
+/*
+ * heap_deform_tuple_columns
+ *		Subroutine of heap_deform_tuples(): extract attributes firstatt to
+ *		natts - 1 of one tuple into the row'th entries of per-attribute
+ *		arrays.  off is the offset of attribute firstatt's data before
+ *		alignment; there must be no nulls before that attribute.
+ */
+static void
+heap_deform_tuple_columns(TupleDesc tupleDesc, HeapTupleHeader tup,
+						  int firstatt, uint32 off, int natts,
+						  Datum **values, bool **isnull, int row)
+{
+	bool		hasnulls = (tup->t_infomask & HEAP_HASNULL) != 0;
+	int			tupnatts = Min(HeapTupleHeaderGetNatts(tup), natts);
+	char	   *tp = (char *) tup + tup->t_hoff;
+	bits8	   *bp = tup->t_bits;
+	bool		slow = false;	/* can we use/set attcacheoff? */
+	int			attnum;
+
+	for (attnum = firstatt; attnum < tupnatts; attnum++)
+	{
+		Form_pg_attribute thisatt = TupleDescAttr(tupleDesc, attnum);
+
+		if (hasnulls && att_isnull(attnum, bp))
+		{
+			values[attnum][row] = (Datum) 0;
+			isnull[attnum][row] = true;
+			slow = true;		/* can't use attcacheoff anymore */
+			continue;
+		}
+
+		isnull[attnum][row] = false;
+
+		if (!slow && thisatt->attcacheoff >= 0)
+			off = thisatt->attcacheoff;
+		else if (thisatt->attlen == -1)
+		{
+			/* see heap_deform_tuple() */
+			if (!slow &&
+				off == att_align_nominal(off, thisatt->attalign))
+				thisatt->attcacheoff = off;
+			else
+			{
+				off = att_align_pointer(off, thisatt->attalign, -1,
+										tp + off);
+				slow = true;
+			}
+		}
+		else
+		{
+			/* not varlena, so safe to use att_align_nominal */
+			off = att_align_nominal(off, thisatt->attalign);
+
+			if (!slow)
+				thisatt->attcacheoff = off;
+		}
+
+		values[attnum][row] = fetchatt(thisatt, tp + off);
+
+		off = att_addlength_pointer(off, thisatt->attlen, tp + off);
+
+		if (thisatt->attlen <= 0)
+			slow = true;		/* can't use attcacheoff anymore */
+	}
+
+	for (; attnum < natts; attnum++)
+		values[attnum][row] = getmissingattr(tupleDesc, attnum + 1,
+											 &isnull[attnum][row]);
+}
+
 /*
  * heap_freetuple
  */
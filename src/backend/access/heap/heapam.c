@@ -67,6 +67,7 @@
 #include "utils/datum.h"
 #include "utils/inval.h"
 #include "utils/lsyscache.h"
+#include "utils/memutils.h"
 #include "utils/relcache.h"
 #include "utils/snapmgr.h"
 #include "utils/spccache.h"
@@ -360,6 +361,86 @@ heap_setscanlimits(TableScanDesc sscan, BlockNumber startBlk, BlockNumber numBlk
 	scan->rs_numblocks = numBlks;
 }
 
+/*
+ * heap_scan_stream_next_block - read stream callback for sequential scans
+ *
+ * Returns the blocks of a serial forward scan in the order heapgettup()
+ * visits them: from rs_startblock to the end of the relation, then wrapping
+ * around to block 0, limited by rs_numblocks if set.
+ */
+static BlockNumber
+heap_scan_stream_next_block(ReadStream *stream, void *callback_private_data)
+{
+	HeapScanDesc scan = (HeapScanDesc) callback_private_data;
+	BlockNumber page;
+
+	if (scan->rs_stream_nblocksleft == 0)
+		return InvalidBlockNumber;
+
+	page = scan->rs_stream_nextblock;
+	scan->rs_stream_nblocksleft--;
+	if (++scan->rs_stream_nextblock >= scan->rs_nblocks)
+		scan->rs_stream_nextblock = 0;
+
+	return page;
+}
+
+/*
+ * heap_scan_read_page - read and pin a page for heapgetpage()
+ *
+ * A serial sequential scan over a user relation reads its pages through a
+ * read stream, which combines consecutive blocks into vectored reads.  The
+ * stream is started when the scan reads its first page.  If the scan ever
+ * asks for a page other than the one the stream predicted, as happens when
+ * a cursor changes direction, the stream is abandoned and we go on reading
+ * one page at a time.
+ */
+static Buffer
+heap_scan_read_page(HeapScanDesc scan, BlockNumber page)
+{
+	Relation	rel = scan->rs_base.rs_rd;
+
+	if (scan->rs_read_stream == NULL &&
+		!scan->rs_inited &&
+		page == scan->rs_startblock &&
+		scan->rs_nblocks > 1 &&
+		(scan->rs_base.rs_flags & SO_TYPE_SEQSCAN) &&
+		scan->rs_base.rs_parallel == NULL &&
+		!IsCatalogRelation(rel))
+	{
+		/* the stream must live as long as the scan descriptor */
+		MemoryContext oldcxt = MemoryContextSwitchTo(GetMemoryChunkContext(scan));
+
+		scan->rs_stream_nextblock = page;
+		if (scan->rs_numblocks != InvalidBlockNumber)
+			scan->rs_stream_nblocksleft = Min(scan->rs_numblocks,
+											  scan->rs_nblocks);
+		else
+			scan->rs_stream_nblocksleft = scan->rs_nblocks;
+		scan->rs_read_stream = ReadStreamBegin(rel, MAIN_FORKNUM,
+											   scan->rs_strategy,
+											   heap_scan_stream_next_block,
+											   scan);
+		MemoryContextSwitchTo(oldcxt);
+	}
+
+	if (scan->rs_read_stream != NULL)
+	{
+		Buffer		buffer = ReadStreamNextBuffer(scan->rs_read_stream);
+
+		if (BufferIsValid(buffer) && BufferGetBlockNumber(buffer) == page)
+			return buffer;
+
+		if (BufferIsValid(buffer))
+			ReleaseBuffer(buffer);
+		ReadStreamEnd(scan->rs_read_stream);
+		scan->rs_read_stream = NULL;
+	}
+
+	return ReadBufferExtended(rel, MAIN_FORKNUM, page,
+							  RBM_NORMAL, scan->rs_strategy);
+}
+
 /*
  * heapgetpage - subroutine for heapgettup()
  *
@@ -397,8 +478,7 @@ heapgetpage(TableScanDesc sscan, BlockNumber page)
 	CHECK_FOR_INTERRUPTS();
 
 	/* read page using selected strategy */
-	scan->rs_cbuf = ReadBufferExtended(scan->rs_base.rs_rd, MAIN_FORKNUM, page,
-									   RBM_NORMAL, scan->rs_strategy);
+	scan->rs_cbuf = heap_scan_read_page(scan, page);
 	scan->rs_cblock = page;
 
 	if (!(scan->rs_base.rs_flags & SO_ALLOW_PAGEMODE))
@@ -1209,6 +1289,7 @@ heap_beginscan(Relation relation, Snapshot snapshot,
 	scan->rs_base.rs_flags = flags;
 	scan->rs_base.rs_parallel = parallel_scan;
 	scan->rs_strategy = NULL;	/* set in initscan */
+	scan->rs_read_stream = NULL;	/* set in heapgetpage */
 
 	/*
 	 * Disable page-at-a-time mode if it's not a MVCC-safe snapshot.
@@ -1297,6 +1378,12 @@ heap_rescan(TableScanDesc sscan, ScanKey key, bool set_params,
 	if (BufferIsValid(scan->rs_cbuf))
 		ReleaseBuffer(scan->rs_cbuf);
 
+	if (scan->rs_read_stream != NULL)
+	{
+		ReadStreamEnd(scan->rs_read_stream);
+		scan->rs_read_stream = NULL;
+	}
+
 	/*
 	 * reinitialize scan descriptor
 	 */
@@ -1316,6 +1403,9 @@ heap_endscan(TableScanDesc sscan)
 	if (BufferIsValid(scan->rs_cbuf))
 		ReleaseBuffer(scan->rs_cbuf);
 
+	if (scan->rs_read_stream != NULL)
+		ReadStreamEnd(scan->rs_read_stream);
+
 	/*
 	 * decrement relation reference count and free scan descriptor storage
 	 */
@@ -1415,6 +1505,82 @@ heap_getnextslot(TableScanDesc sscan, ScanDirection direction, TupleTableSlot *s
 	return true;
 }
 
+/*
+ * heap_getnextbatch - fetch tuples in columnar form
+ *
+ * In page-at-a-time mode, we return all the remaining visible tuples of the
+ * current page at once (up to maxrows), deformed by heap_deform_tuples().
+ * Otherwise, or with scan keys, we return one tuple at a time.  Either way,
+ * the tuples all come from the page in rs_cbuf, which we return in *buffer.
+ */
+int
+heap_getnextbatch(TableScanDesc sscan, int natts,
+				  Datum **values, bool **isnull, int row, int maxrows,
+				  Buffer *buffer)
+{
+	HeapScanDesc scan = (HeapScanDesc) sscan;
+	HeapTupleHeader tuples[MaxHeapTuplesPerPage];
+	int			ntuples = 1;
+
+	Assert(maxrows > 0);
+
+	if (sscan->rs_flags & SO_ALLOW_PAGEMODE)
+		heapgettup_pagemode(scan, ForwardScanDirection,
+							sscan->rs_nkeys, sscan->rs_key);
+	else
+		heapgettup(scan, ForwardScanDirection,
+				   sscan->rs_nkeys, sscan->rs_key);
+
+	if (scan->rs_ctup.t_data == NULL)
+	{
+		*buffer = InvalidBuffer;
+		return 0;
+	}
+
+	tuples[0] = scan->rs_ctup.t_data;
+
+	if ((sscan->rs_flags & SO_ALLOW_PAGEMODE) && sscan->rs_nkeys == 0)
+	{
+		Page		dp = BufferGetPage(scan->rs_cbuf);
+		int			lineindex = scan->rs_cindex;
+		OffsetNumber lineoff = InvalidOffsetNumber;
+
+		/*
+		 * Take the following visible tuples on the page too, and make the
+		 * scan continue after the last one, as if we had returned each of
+		 * them in turn.
+		 */
+		while (ntuples < maxrows && lineindex + 1 < scan->rs_ntuples)
+		{
+			ItemId		lpp;
+
+			lineindex++;
+			lineoff = scan->rs_vistuples[lineindex];
+			lpp = PageGetItemId(dp, lineoff);
+			Assert(ItemIdIsNormal(lpp));
+			tuples[ntuples++] = (HeapTupleHeader) PageGetItem(dp, lpp);
+		}
+
+		if (lineindex != scan->rs_cindex)
+		{
+			ItemId		lpp = PageGetItemId(dp, lineoff);
+
+			scan->rs_ctup.t_data = tuples[ntuples - 1];
+			scan->rs_ctup.t_len = ItemIdGetLength(lpp);
+			ItemPointerSet(&scan->rs_ctup.t_self, scan->rs_cblock, lineoff);
+			scan->rs_cindex = lineindex;
+		}
+	}
+
+	heap_deform_tuples(RelationGetDescr(sscan->rs_rd), tuples, ntuples,
+					   natts, values, isnull, row);
+
+	pgstat_count_heap_getnext_n(sscan->rs_rd, ntuples);
+
+	*buffer = scan->rs_cbuf;
+	return ntuples;
+}
+
 void
 heap_set_tidrange(TableScanDesc sscan, ItemPointer mintid,
 				  ItemPointer maxtid)
@@ -35,6 +35,7 @@
 #include "access/xlog_internal.h"
 #include "access/xlogarchive.h"
 #include "access/xloginsert.h"
+#include "access/xlogprefetch.h"
 #include "access/xlogreader.h"
 #include "access/xlogutils.h"
 #include "catalog/catversion.h"
@@ -43,11 +44,14 @@
 #include "commands/progress.h"
 #include "commands/tablespace.h"
 #include "common/controldata_utils.h"
+#include "common/hashfn.h"
 #include "executor/instrument.h"
 #include "miscadmin.h"
+#include "optimizer/cardfeedback.h"
 #include "pg_trace.h"
 #include "pgstat.h"
 #include "port/atomics.h"
+#include "port/pg_bitutils.h"
 #include "port/pg_iovec.h"
 #include "postmaster/bgwriter.h"
 #include "postmaster/startup.h"
@@ -98,7 +102,7 @@ char	   *XLogArchiveCommand = NULL;
 bool		EnableHotStandby = false;
 bool		fullPageWrites = true;
 bool		wal_log_hints = false;
-bool		wal_compression = false;
+int			wal_compression = WAL_COMPRESSION_NONE;
 char	   *wal_consistency_checking_string = NULL;
 bool	   *wal_consistency_checking = NULL;
 bool		wal_init_zero = true;
@@ -119,11 +123,12 @@ bool		XLOG_DEBUG = false;
 int			wal_segment_size = DEFAULT_XLOG_SEG_SIZE;
 
 /*
- * Number of WAL insertion locks to use. A higher value allows more insertions
- * to happen concurrently, but adds some CPU overhead to flushing the WAL,
- * which needs to iterate all the locks.
+ * Number of WAL insertion locks to use (wal_insert_locks). A higher value
+ * allows more insertions to happen concurrently, but adds some CPU overhead
+ * to flushing the WAL, which needs to iterate all the locks.  -1 means to
+ * choose a value based on the number of CPUs, see XLOGChooseNumInsertLocks().
  */
-#define NUM_XLOGINSERT_LOCKS  8
+int			NumXLogInsertLocks = -1;
 
 /*
  * Max distance from last checkpoint, before triggering a new xlog-based
@@ -502,6 +507,36 @@ typedef union WALInsertLockPadded
 	char		pad[PG_CACHE_LINE_SIZE];
 } WALInsertLockPadded;
 
+/*
+ * Since WAL space is reserved with an atomic fetch-add on CurrBytePos, an
+ * inserter doesn't learn the start position of the record reserved just
+ * before its own, which it needs for its xl_prev field.  Instead, every
+ * inserter publishes the start and end position of its own record in the
+ * prev-link table, right after reserving it, and then looks up the entry
+ * whose end position equals its own start position, which is the previous
+ * record.  The entry is removed once it has been looked up, so each entry
+ * is consumed by exactly one inserter.
+ *
+ * The table is a small open-addressing hash table in shared memory, keyed by
+ * endpos.  An endpos of 0 marks a free entry (no record can end at usable
+ * byte position 0), and XLOG_PREVLINK_BUSY marks an entry that has been
+ * claimed but whose startpos isn't filled in yet.
+ *
+ * Reserving WAL always happens while holding an insertion lock, so at most
+ * one entry per insertion lock is waiting to be looked up by an inserter that
+ * has already reserved its record, and one more by the next inserter to come
+ * along; each lock holder can additionally have one claimed entry.  Sizing
+ * the table at four entries per lock keeps it sparsely populated, so that
+ * an entry is normally found at its home position.
+ */
+typedef struct XLogPrevLink
+{
+	pg_atomic_uint64 endpos;	/* end of a reserved record, or 0 if unused */
+	uint64		startpos;		/* start of that record */
+} XLogPrevLink;
+
+#define XLOG_PREVLINK_BUSY		PG_UINT64_MAX
+
 /*
  * State of an exclusive backup, necessary to control concurrent activities
  * across sessions when working on exclusive backups.
@@ -536,24 +571,24 @@ static SessionBackupState sessionBackupState = SESSION_BACKUP_NONE;
  */
 typedef struct XLogCtlInsert
 {
-	slock_t		insertpos_lck;	/* protects CurrBytePos and PrevBytePos */
-
 	/*
 	 * CurrBytePos is the end of reserved WAL. The next record will be
-	 * inserted at that position. PrevBytePos is the start position of the
-	 * previously inserted (or rather, reserved) record - it is copied to the
-	 * prev-link of the next record. These are stored as "usable byte
-	 * positions" rather than XLogRecPtrs (see XLogBytePosToRecPtr()).
+	 * inserted at that position. It is stored as a "usable byte position"
+	 * rather than an XLogRecPtr (see XLogBytePosToRecPtr()), and is advanced
+	 * with an atomic fetch-add, so that reserving WAL doesn't need a lock.
+	 *
+	 * The start position of the previously reserved record, which is copied
+	 * to the prev-link of the next record, is handed from each inserter to
+	 * the next one through the PrevLinks table, see XLogPrevLinkPublish().
 	 */
-	uint64		CurrBytePos;
-	uint64		PrevBytePos;
+	pg_atomic_uint64 CurrBytePos;
 
 	/*
-	 * Make sure the above heavily-contended spinlock and byte positions are
-	 * on their own cache line. In particular, the RedoRecPtr and full page
-	 * write variables below should be on a different cache line. They are
-	 * read on every WAL insertion, but updated rarely, and we don't want
-	 * those reads to steal the cache line containing Curr/PrevBytePos.
+	 * Make sure the above heavily-contended byte position is on its own
+	 * cache line. In particular, the RedoRecPtr and full page write variables
+	 * below should be on a different cache line. They are read on every WAL
+	 * insertion, but updated rarely, and we don't want those reads to steal
+	 * the cache line containing CurrBytePos.
 	 */
 	char		pad[PG_CACHE_LINE_SIZE];
 
@@ -588,6 +623,12 @@ typedef struct XLogCtlInsert
 	 * WAL insertion locks.
 	 */
 	WALInsertLockPadded *WALInsertLocks;
+
+	/*
+	 * Prev-link hand-off table, with PrevLinksMask + 1 entries.
+	 */
+	XLogPrevLink *PrevLinks;
+	uint32		PrevLinksMask;
 } XLogCtlInsert;
 
 /*
@@ -740,6 +781,9 @@ static XLogCtlData *XLogCtl = NULL;
 /* a private copy of XLogCtl->Insert.WALInsertLocks, for convenience */
 static WALInsertLockPadded *WALInsertLocks = NULL;
 
+/* likewise for XLogCtl->Insert.PrevLinks */
+static XLogPrevLink *PrevLinks = NULL;
+
 /*
  * We maintain an image of pg_control in shared memory.
  */
@@ -967,6 +1011,8 @@ static void ReserveXLogInsertLocation(int size, XLogRecPtr *StartPos,
 									  XLogRecPtr *EndPos, XLogRecPtr *PrevPtr);
 static bool ReserveXLogSwitch(XLogRecPtr *StartPos, XLogRecPtr *EndPos,
 							  XLogRecPtr *PrevPtr);
+static void XLogPrevLinkPublish(uint64 startbytepos, uint64 endbytepos);
+static uint64 XLogPrevLinkConsume(uint64 startbytepos);
 static XLogRecPtr WaitXLogInsertionsToFinish(XLogRecPtr upto);
 static char *GetXLogBuffer(XLogRecPtr ptr);
 static XLogRecPtr XLogBytePosToRecPtr(uint64 bytepos);
@@ -1036,8 +1082,8 @@ XLogInsertRecord(XLogRecData *rdata,
 	 * record to the shared WAL buffer cache is a two-step process:
 	 *
 	 * 1. Reserve the right amount of space from the WAL. The current head of
-	 *	  reserved space is kept in Insert->CurrBytePos, and is protected by
-	 *	  insertpos_lck.
+	 *	  reserved space is kept in Insert->CurrBytePos, and is advanced
+	 *	  atomically.
 	 *
 	 * 2. Copy the record to the reserved WAL space. This involves finding the
 	 *	  correct WAL buffer containing the reserved space, and copying the
@@ -1046,8 +1092,8 @@ XLogInsertRecord(XLogRecData *rdata,
 	 * To keep track of which insertions are still in-progress, each concurrent
 	 * inserter acquires an insertion lock. In addition to just indicating that
 	 * an insertion is in progress, the lock tells others how far the inserter
-	 * has progressed. There is a small fixed number of insertion locks,
-	 * determined by NUM_XLOGINSERT_LOCKS. When an inserter crosses a page
+	 * has progressed. There is a fixed number of insertion locks, determined
+	 * by wal_insert_locks. When an inserter crosses a page
 	 * boundary, it updates the value stored in the lock to the how far it has
 	 * inserted, to allow the previous buffer to be flushed.
 	 *
@@ -1282,9 +1328,10 @@ XLogInsertRecord(XLogRecData *rdata,
  * used to set the xl_prev of this record.
  *
  * This is the performance critical part of XLogInsert that must be serialized
- * across backends. The rest can happen mostly in parallel. Try to keep this
- * section as short as possible, insertpos_lck can be heavily contended on a
- * busy system.
+ * across backends. The rest can happen mostly in parallel. The serialized
+ * part is just an atomic fetch-add on CurrBytePos, but the cache line
+ * containing it can be heavily contended on a busy system, so try to keep
+ * work that touches it to a minimum.
  *
  * NB: The space calculation here must match the code in CopyXLogRecordToWAL,
  * where we actually copy the record to the reserved space.
@@ -1304,24 +1351,23 @@ ReserveXLogInsertLocation(int size, XLogRecPtr *StartPos, XLogRecPtr *EndPos,
 	Assert(size > SizeOfXLogRecord);
 
 	/*
-	 * The duration the spinlock needs to be held is minimized by minimizing
-	 * the calculations that have to be done while holding the lock. The
-	 * current tip of reserved WAL is kept in CurrBytePos, as a byte position
-	 * that only counts "usable" bytes in WAL, that is, it excludes all WAL
-	 * page headers. The mapping between "usable" byte positions and physical
-	 * positions (XLogRecPtrs) can be done outside the locked region, and
-	 * because the usable byte position doesn't include any headers, reserving
-	 * X bytes from WAL is almost as simple as "CurrBytePos += X".
+	 * The current tip of reserved WAL is kept in CurrBytePos, as a byte
+	 * position that only counts "usable" bytes in WAL, that is, it excludes
+	 * all WAL page headers. The mapping between "usable" byte positions and
+	 * physical positions (XLogRecPtrs) can be done afterwards, and because
+	 * the usable byte position doesn't include any headers, reserving X bytes
+	 * from WAL is as simple as an atomic "CurrBytePos += X".
 	 */
-	SpinLockAcquire(&Insert->insertpos_lck);
-
-	startbytepos = Insert->CurrBytePos;
+	startbytepos = pg_atomic_fetch_add_u64(&Insert->CurrBytePos, size);
 	endbytepos = startbytepos + size;
-	prevbytepos = Insert->PrevBytePos;
-	Insert->CurrBytePos = endbytepos;
-	Insert->PrevBytePos = startbytepos;
 
-	SpinLockRelease(&Insert->insertpos_lck);
+	/*
+	 * Tell the inserter of the next record where ours starts, and find out
+	 * where the previous one starts.  Publish first: the inserter of the
+	 * previous record might in turn be waiting for us otherwise.
+	 */
+	XLogPrevLinkPublish(startbytepos, endbytepos);
+	prevbytepos = XLogPrevLinkConsume(startbytepos);
 
 	*StartPos = XLogBytePosToRecPtr(startbytepos);
 	*EndPos = XLogBytePosToEndRecPtr(endbytepos);
@@ -1357,25 +1403,21 @@ ReserveXLogSwitch(XLogRecPtr *StartPos, XLogRecPtr *EndPos, XLogRecPtr *PrevPtr)
 	uint32		segleft;
 
 	/*
-	 * These calculations are a bit heavy-weight to be done while holding a
-	 * spinlock, but since we're holding all the WAL insertion locks, there
-	 * are no other inserters competing for it. GetXLogInsertRecPtr() does
-	 * compete for it, but that's not called very frequently.
+	 * Since we're holding all the WAL insertion locks, there are no other
+	 * inserters that could advance CurrBytePos concurrently, so we can
+	 * simply read it and store the new value back.
 	 */
-	SpinLockAcquire(&Insert->insertpos_lck);
-
-	startbytepos = Insert->CurrBytePos;
+	Assert(holdingAllLocks);
+	startbytepos = pg_atomic_read_u64(&Insert->CurrBytePos);
 
 	ptr = XLogBytePosToEndRecPtr(startbytepos);
 	if (XLogSegmentOffset(ptr, wal_segment_size) == 0)
 	{
-		SpinLockRelease(&Insert->insertpos_lck);
 		*EndPos = *StartPos = ptr;
 		return false;
 	}
 
 	endbytepos = startbytepos + size;
-	prevbytepos = Insert->PrevBytePos;
 
 	*StartPos = XLogBytePosToRecPtr(startbytepos);
 	*EndPos = XLogBytePosToEndRecPtr(endbytepos);
@@ -1387,10 +1429,10 @@ ReserveXLogSwitch(XLogRecPtr *StartPos, XLogRecPtr *EndPos, XLogRecPtr *PrevPtr)
 		*EndPos += segleft;
 		endbytepos = XLogRecPtrToBytePos(*EndPos);
 	}
-	Insert->CurrBytePos = endbytepos;
-	Insert->PrevBytePos = startbytepos;
+	pg_atomic_write_u64(&Insert->CurrBytePos, endbytepos);
 
-	SpinLockRelease(&Insert->insertpos_lck);
+	XLogPrevLinkPublish(startbytepos, endbytepos);
+	prevbytepos = XLogPrevLinkConsume(startbytepos);
 
 	*PrevPtr = XLogBytePosToRecPtr(prevbytepos);
 
@@ -1402,6 +1444,95 @@ ReserveXLogSwitch(XLogRecPtr *StartPos, XLogRecPtr *EndPos, XLogRecPtr *PrevPtr)
 	return true;
 }
 
+/*
+ * Home position of the prev-link table entry for the record ending at
+ * 'endbytepos'.
+ */
+static inline uint32
+XLogPrevLinkHash(uint64 endbytepos)
+{
+	return murmurhash32((uint32) (endbytepos / MAXIMUM_ALIGNOF)) &
+		XLogCtl->Insert.PrevLinksMask;
+}
+
+/*
+ * Publish the location of a just-reserved record in the prev-link table, for
+ * the inserter of the following record.
+ */
+static void
+XLogPrevLinkPublish(uint64 startbytepos, uint64 endbytepos)
+{
+	uint32		mask = XLogCtl->Insert.PrevLinksMask;
+	uint32		i = XLogPrevLinkHash(endbytepos);
+
+	Assert(endbytepos != 0 && endbytepos != XLOG_PREVLINK_BUSY);
+
+	/*
+	 * Claim a free entry.  The table is sized so that there's always one
+	 * available.
+	 */
+	for (;;)
+	{
+		XLogPrevLink *link = &PrevLinks[i];
+		uint64		expected = 0;
+
+		if (pg_atomic_read_u64(&link->endpos) == 0 &&
+			pg_atomic_compare_exchange_u64(&link->endpos, &expected,
+										   XLOG_PREVLINK_BUSY))
+		{
+			/* the start position must be visible before the key is */
+			link->startpos = startbytepos;
+			pg_write_barrier();
+			pg_atomic_write_u64(&link->endpos, endbytepos);
+			return;
+		}
+		i = (i + 1) & mask;
+	}
+}
+
+/*
+ * Look up and remove the prev-link table entry of the record that ends at
+ * 'startbytepos', and return its start position.
+ *
+ * The inserter of that record has already reserved it, since CurrBytePos has
+ * moved past it, but it might not have published it yet.  It does so right
+ * away, while in a critical section, so we just spin until it shows up.
+ */
+static uint64
+XLogPrevLinkConsume(uint64 startbytepos)
+{
+	uint32		mask = XLogCtl->Insert.PrevLinksMask;
+	uint32		home = XLogPrevLinkHash(startbytepos);
+	uint32		i = home;
+	SpinDelayStatus delayStatus;
+
+	init_local_spin_delay(&delayStatus);
+
+	for (;;)
+	{
+		XLogPrevLink *link = &PrevLinks[i];
+
+		if (pg_atomic_read_u64(&link->endpos) == startbytepos)
+		{
+			uint64		prevbytepos;
+
+			pg_read_barrier();
+			prevbytepos = link->startpos;
+
+			/* don't let the entry be reused before we have read it */
+			pg_memory_barrier();
+			pg_atomic_write_u64(&link->endpos, 0);
+
+			finish_spin_delay(&delayStatus);
+			return prevbytepos;
+		}
+
+		i = (i + 1) & mask;
+		if (i == home)
+			perform_spin_delay(&delayStatus);
+	}
+}
+
 /*
  * Checks whether the current buffer page and backup page stored in the
  * WAL record are consistent or not. Before comparing the two pages, a
@@ -1677,7 +1808,7 @@ WALInsertLockAcquire(void)
 	static int	lockToTry = -1;
 
 	if (lockToTry == -1)
-		lockToTry = MyProc->pgprocno % NUM_XLOGINSERT_LOCKS;
+		lockToTry = MyProc->pgprocno % NumXLogInsertLocks;
 	MyLockNo = lockToTry;
 
 	/*
@@ -1695,7 +1826,7 @@ WALInsertLockAcquire(void)
 		 * than locks, it still helps to distribute the inserters evenly
 		 * across the locks.
 		 */
-		lockToTry = (lockToTry + 1) % NUM_XLOGINSERT_LOCKS;
+		lockToTry = (lockToTry + 1) % NumXLogInsertLocks;
 	}
 }
 
@@ -1713,7 +1844,7 @@ WALInsertLockAcquireExclusive(void)
 	 * indicator is set to 0xFFFFFFFFFFFFFFFF, which is higher than any real
 	 * XLogRecPtr value, to make sure that no-one blocks waiting on those.
 	 */
-	for (i = 0; i < NUM_XLOGINSERT_LOCKS - 1; i++)
+	for (i = 0; i < NumXLogInsertLocks - 1; i++)
 	{
 		LWLockAcquire(&WALInsertLocks[i].l.lock, LW_EXCLUSIVE);
 		LWLockUpdateVar(&WALInsertLocks[i].l.lock,
@@ -1739,7 +1870,7 @@ WALInsertLockRelease(void)
 	{
 		int			i;
 
-		for (i = 0; i < NUM_XLOGINSERT_LOCKS; i++)
+		for (i = 0; i < NumXLogInsertLocks; i++)
 			LWLockReleaseClearVar(&WALInsertLocks[i].l.lock,
 								  &WALInsertLocks[i].l.insertingAt,
 								  0);
@@ -1767,8 +1898,8 @@ WALInsertLockUpdateInsertingAt(XLogRecPtr insertingAt)
 		 * We use the last lock to mark our actual position, see comments in
 		 * WALInsertLockAcquireExclusive.
 		 */
-		LWLockUpdateVar(&WALInsertLocks[NUM_XLOGINSERT_LOCKS - 1].l.lock,
-						&WALInsertLocks[NUM_XLOGINSERT_LOCKS - 1].l.insertingAt,
+		LWLockUpdateVar(&WALInsertLocks[NumXLogInsertLocks - 1].l.lock,
+						&WALInsertLocks[NumXLogInsertLocks - 1].l.insertingAt,
 						insertingAt);
 	}
 	else
@@ -1804,9 +1935,7 @@ WaitXLogInsertionsToFinish(XLogRecPtr upto)
 		elog(PANIC, "cannot wait without a PGPROC structure");
 
 	/* Read the current insert position */
-	SpinLockAcquire(&Insert->insertpos_lck);
-	bytepos = Insert->CurrBytePos;
-	SpinLockRelease(&Insert->insertpos_lck);
+	bytepos = pg_atomic_read_u64(&Insert->CurrBytePos);
 	reservedUpto = XLogBytePosToEndRecPtr(bytepos);
 
 	/*
@@ -1835,7 +1964,7 @@ WaitXLogInsertionsToFinish(XLogRecPtr upto)
 	 * out for any insertion that's still in progress.
 	 */
 	finishedUpto = reservedUpto;
-	for (i = 0; i < NUM_XLOGINSERT_LOCKS; i++)
+	for (i = 0; i < NumXLogInsertLocks; i++)
 	{
 		XLogRecPtr	insertingat = InvalidXLogRecPtr;
 
@@ -5023,6 +5152,59 @@ XLOGChooseNumBuffers(void)
 	return xbuffers;
 }
 
+/*
+ * Auto-tune the number of WAL insertion locks.
+ *
+ * Concurrent insertions are limited by the number of insertion locks, so we
+ * want about one per CPU, but flushing WAL has to visit all of them.  Use the
+ * number of online CPUs, clamped to a range that keeps that cost small, with
+ * a minimum of 8 (which was the fixed number before wal_insert_locks was
+ * added).
+ */
+static int
+XLOGChooseNumInsertLocks(void)
+{
+	int			nlocks = 8;
+
+#ifdef _SC_NPROCESSORS_ONLN
+	{
+		long		ncpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+		if (ncpus > nlocks)
+			nlocks = (int) Min(ncpus, 128);
+	}
+#endif
+
+	return nlocks;
+}
+
+/*
+ * GUC check_hook for wal_insert_locks
+ */
+bool
+check_wal_insert_locks(int *newval, void **extra, GucSource source)
+{
+	/*
+	 * -1 indicates a request for auto-tune.  As with wal_buffers, we leave
+	 * the boot_val alone and fix it when XLOGShmemSize is called.
+	 */
+	if (*newval == -1)
+	{
+		if (NumXLogInsertLocks == -1)
+			return true;
+
+		*newval = XLOGChooseNumInsertLocks();
+	}
+
+	if (*newval == 0)
+	{
+		GUC_check_errdetail("\"wal_insert_locks\" must be -1 or at least 1.");
+		return false;
+	}
+
+	return true;
+}
+
 /*
  * GUC check_hook for wal_buffers
  */
@@ -5078,6 +5260,16 @@ LocalProcessControlFile(bool reset)
 	ReadControlFile();
 }
 
+/*
+ * Number of entries in the prev-link table: four per insertion lock, see
+ * XLogPrevLink, rounded up to a power of 2.
+ */
+static uint32
+XLOGPrevLinksSize(void)
+{
+	return pg_nextpower2_32(4 * (NumXLogInsertLocks + 1));
+}
+
 /*
  * Initialization of shared memory for XLOG
  */
@@ -5101,11 +5293,23 @@ XLOGShmemSize(void)
 	}
 	Assert(XLOGbuffers > 0);
 
+	/* Likewise for wal_insert_locks */
+	if (NumXLogInsertLocks == -1)
+	{
+		char		buf[32];
+
+		snprintf(buf, sizeof(buf), "%d", XLOGChooseNumInsertLocks());
+		SetConfigOption("wal_insert_locks", buf, PGC_POSTMASTER, PGC_S_OVERRIDE);
+	}
+	Assert(NumXLogInsertLocks > 0);
+
 	/* XLogCtl */
 	size = sizeof(XLogCtlData);
 
 	/* WAL insertion locks, plus alignment */
-	size = add_size(size, mul_size(sizeof(WALInsertLockPadded), NUM_XLOGINSERT_LOCKS + 1));
+	size = add_size(size, mul_size(sizeof(WALInsertLockPadded), NumXLogInsertLocks + 1));
+	/* prev-link table */
+	size = add_size(size, mul_size(sizeof(XLogPrevLink), XLOGPrevLinksSize()));
 	/* xlblocks array */
 	size = add_size(size, mul_size(sizeof(XLogRecPtr), XLOGbuffers));
 	/* extra alignment padding for XLOG I/O buffers */
@@ -5160,8 +5364,9 @@ XLOGShmemInit(void)
 		/* both should be present or neither */
 		Assert(foundCFile && foundXLog);
 
-		/* Initialize local copy of WALInsertLocks */
+		/* Initialize local copies of WALInsertLocks and PrevLinks */
 		WALInsertLocks = XLogCtl->Insert.WALInsertLocks;
+		PrevLinks = XLogCtl->Insert.PrevLinks;
 
 		if (localControlFile)
 			pfree(localControlFile);
@@ -5195,15 +5400,25 @@ XLOGShmemInit(void)
 		((uintptr_t) allocptr) % sizeof(WALInsertLockPadded);
 	WALInsertLocks = XLogCtl->Insert.WALInsertLocks =
 		(WALInsertLockPadded *) allocptr;
-	allocptr += sizeof(WALInsertLockPadded) * NUM_XLOGINSERT_LOCKS;
+	allocptr += sizeof(WALInsertLockPadded) * NumXLogInsertLocks;
 
-	for (i = 0; i < NUM_XLOGINSERT_LOCKS; i++)
+	for (i = 0; i < NumXLogInsertLocks; i++)
 	{
 		LWLockInitialize(&WALInsertLocks[i].l.lock, LWTRANCHE_WAL_INSERT);
 		WALInsertLocks[i].l.insertingAt = InvalidXLogRecPtr;
 		WALInsertLocks[i].l.lastImportantAt = InvalidXLogRecPtr;
 	}
 
+	/* Prev-link table, all entries initially free */
+	PrevLinks = XLogCtl->Insert.PrevLinks = (XLogPrevLink *) allocptr;
+	XLogCtl->Insert.PrevLinksMask = XLOGPrevLinksSize() - 1;
+	for (i = 0; i < XLOGPrevLinksSize(); i++)
+	{
+		pg_atomic_init_u64(&PrevLinks[i].endpos, 0);
+		PrevLinks[i].startpos = 0;
+	}
+	allocptr += sizeof(XLogPrevLink) * XLOGPrevLinksSize();
+
 	/*
 	 * Align the start of the page buffers to a full xlog block size boundary.
 	 * This simplifies some calculations in XLOG insertion. It is also
@@ -5223,7 +5438,7 @@ XLOGShmemInit(void)
 	XLogCtl->SharedPromoteIsTriggered = false;
 	XLogCtl->WalWriterSleeping = false;
 
-	SpinLockInit(&XLogCtl->Insert.insertpos_lck);
+	pg_atomic_init_u64(&XLogCtl->Insert.CurrBytePos, 0);
 	SpinLockInit(&XLogCtl->info_lck);
 	SpinLockInit(&XLogCtl->ulsn_lck);
 	InitSharedLatch(&XLogCtl->recoveryWakeupLatch);
@@ -7312,6 +7527,7 @@ StartupXLOG(void)
 			ErrorContextCallback errcallback;
 			TimestampTz xtime;
 			PGRUsage	ru0;
+			XLogPrefetcher *prefetcher;
 
 			pg_rusage_init(&ru0);
 
@@ -7321,6 +7537,9 @@ StartupXLOG(void)
 					(errmsg("redo starts at %X/%X",
 							LSN_FORMAT_ARGS(ReadRecPtr))));
 
+			/* Prepare to prefetch the blocks that upcoming records use. */
+			prefetcher = XLogPrefetcherAllocate();
+
 			/*
 			 * main redo apply loop
 			 */
@@ -7465,6 +7684,9 @@ StartupXLOG(void)
 					TransactionIdIsValid(record->xl_xid))
 					RecordKnownAssignedTransactionIds(record->xl_xid);
 
+				/* Look ahead for blocks that will be needed soon */
+				XLogPrefetcherReadAhead(prefetcher, ReadRecPtr, EndRecPtr);
+
 				/* Now apply the WAL record itself */
 				RmgrTable[record->xl_rmid].rm_redo(xlogreader);
 
@@ -7539,6 +7761,8 @@ StartupXLOG(void)
 			 * end of main redo apply loop
 			 */
 
+			XLogPrefetcherFree(prefetcher);
+
 			if (reachedRecoveryTarget)
 			{
 				if (!reachedConsistency)
@@ -7803,8 +8027,9 @@ StartupXLOG(void)
 	 * previous incarnation.
 	 */
 	Insert = &XLogCtl->Insert;
-	Insert->PrevBytePos = XLogRecPtrToBytePos(LastRec);
-	Insert->CurrBytePos = XLogRecPtrToBytePos(EndOfLog);
+	pg_atomic_write_u64(&Insert->CurrBytePos, XLogRecPtrToBytePos(EndOfLog));
+	XLogPrevLinkPublish(XLogRecPtrToBytePos(LastRec),
+						XLogRecPtrToBytePos(EndOfLog));
 
 	/*
 	 * Tricky point here: readBuf contains the *last* block that the LastRec
@@ -8582,7 +8807,7 @@ GetLastImportantRecPtr(void)
 	XLogRecPtr	res = InvalidXLogRecPtr;
 	int			i;
 
-	for (i = 0; i < NUM_XLOGINSERT_LOCKS; i++)
+	for (i = 0; i < NumXLogInsertLocks; i++)
 	{
 		XLogRecPtr	last_important;
 
@@ -8982,7 +9207,7 @@ CreateCheckPoint(int flags)
 	 * determine the checkpoint REDO pointer.
 	 */
 	WALInsertLockAcquireExclusive();
-	curInsert = XLogBytePosToRecPtr(Insert->CurrBytePos);
+	curInsert = XLogBytePosToRecPtr(pg_atomic_read_u64(&Insert->CurrBytePos));
 
 	/*
 	 * If this isn't a shutdown or forced checkpoint, and if there has been no
@@ -9361,6 +9586,7 @@ CheckPointGuts(XLogRecPtr checkPointRedo, int flags)
 	CheckPointSnapBuild();
 	CheckPointLogicalRewriteHeap();
 	CheckPointReplicationOrigin();
+	CheckPointCardinalityFeedback();
 
 	/* Write out all dirty data in SLRUs and the main buffer pool */
 	TRACE_POSTGRESQL_BUFFER_CHECKPOINT_START(flags);
@@ -10504,10 +10730,20 @@ static int
 get_sync_bit(int method)
 {
 	int			o_direct_flag = 0;
+	int			wal_direct_flag = 0;
+
+	/*
+	 * With io_direct = 'wal', always bypass the kernel cache, whatever the
+	 * sync method.  WAL is written from page-aligned WAL buffers in whole
+	 * pages, which satisfies the alignment rules of direct I/O.  The
+	 * walreceiver exception explained below applies here too.
+	 */
+	if ((io_direct_flags & IO_DIRECT_WAL) && !AmWalReceiverProcess())
+		wal_direct_flag = PG_O_DIRECT;
 
 	/* If fsync is disabled, never open in sync mode */
 	if (!enableFsync)
-		return 0;
+		return wal_direct_flag;
 
 	/*
 	 * Optimize writes by bypassing kernel cache with O_DIRECT when using
@@ -10537,14 +10773,14 @@ get_sync_bit(int method)
 		case SYNC_METHOD_FSYNC:
 		case SYNC_METHOD_FSYNC_WRITETHROUGH:
 		case SYNC_METHOD_FDATASYNC:
-			return 0;
+			return wal_direct_flag;
 #ifdef OPEN_SYNC_FLAG
 		case SYNC_METHOD_OPEN:
-			return OPEN_SYNC_FLAG | o_direct_flag;
+			return OPEN_SYNC_FLAG | o_direct_flag | wal_direct_flag;
 #endif
 #ifdef OPEN_DATASYNC_FLAG
 		case SYNC_METHOD_OPEN_DSYNC:
-			return OPEN_DATASYNC_FLAG | o_direct_flag;
+			return OPEN_DATASYNC_FLAG | o_direct_flag | wal_direct_flag;
 #endif
 		default:
 			/* can't happen (unless we are out of sync with option array) */
@@ -11722,9 +11958,7 @@ GetXLogInsertRecPtr(void)
 	XLogCtlInsert *Insert = &XLogCtl->Insert;
 	uint64		current_bytepos;
 
-	SpinLockAcquire(&Insert->insertpos_lck);
-	current_bytepos = Insert->CurrBytePos;
-	SpinLockRelease(&Insert->insertpos_lck);
+	current_bytepos = pg_atomic_read_u64(&Insert->CurrBytePos);
 
 	return XLogBytePosToRecPtr(current_bytepos);
 }
@@ -0,0 +1,765 @@
+/*-------------------------------------------------------------------------
+ *
+ * xlogprefetch.c
+ *		Prefetching support for recovery.
+ *
+ * Portions Copyright (c) 2021, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ * IDENTIFICATION
+ *		src/backend/access/transam/xlogprefetch.c
+ *
+ * The goal of this module is to read future WAL records and issue
+ * PrefetchSharedBuffer() calls for referenced blocks, so that we avoid I/O
+ * stalls in the main recovery loop.
+ *
+ * The prefetcher has its own XLogReaderState, which reads ahead of the
+ * startup process's reader by up to recovery_prefetch_distance bytes.  It
+ * reads WAL files directly from pg_wal and never waits for WAL to arrive:
+ * if the next record isn't available yet (because it hasn't been received
+ * or restored, or because we've reached the end of valid WAL), the
+ * prefetcher gives up until replay has caught up with that point, and then
+ * starts again from replay's position.  On a standby that's streaming, it
+ * doesn't read beyond the position the WAL receiver has flushed.
+ *
+ * To avoid having too many prefetches in flight, we track the LSN of the
+ * record that caused each prefetch, and consider the I/O to be finished once
+ * replay has reached that record.  The number of prefetches still in flight
+ * is limited to maintenance_io_concurrency.
+ *
+ * Several kinds of block references are not worth prefetching, and are
+ * skipped: blocks that replay will restore from a full page image or
+ * initialize from scratch, repeated references to the block we looked at
+ * last, and blocks that don't exist yet.  For the latter, we also remember
+ * the relation, so that we don't keep probing the file system for blocks
+ * that a relation being extended or created by the WAL we've read ahead
+ * won't have until replay gets there.  Such a "filter" is dropped once
+ * replay has passed the record that installed it.
+ *
+ * Prefetching is only a hint.  Nothing here affects the correctness of
+ * replay: if we look at the wrong timeline's WAL or prefetch a block that's
+ * about to be dropped, we've just wasted some I/O.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#include "postgres.h"
+
+#include <unistd.h>
+
+#include "access/xlog.h"
+#include "access/xlog_internal.h"
+#include "access/xlogprefetch.h"
+#include "access/xlogreader.h"
+#include "access/xlogrecord.h"
+#include "catalog/storage_xlog.h"
+#include "commands/dbcommands_xlog.h"
+#include "miscadmin.h"
+#include "pgstat.h"
+#include "port/atomics.h"
+#include "replication/walreceiver.h"
+#include "storage/bufmgr.h"
+#include "storage/fd.h"
+#include "storage/shmem.h"
+#include "storage/smgr.h"
+#include "utils/guc.h"
+#include "utils/hsearch.h"
+#include "utils/timestamp.h"
+
+/* GUCs */
+int			recovery_prefetch = RECOVERY_PREFETCH_TRY;
+int			recovery_prefetch_distance = 256 * 1024;
+
+/*
+ * Size of the queue of prefetches in flight.  maintenance_io_concurrency
+ * can't be higher than MAX_IO_CONCURRENCY, and the queue needs a spare slot.
+ */
+#define PREFETCH_QUEUE_SIZE		(MAX_IO_CONCURRENCY + 1)
+
+/*
+ * A relation, or a whole database if rnode.relNode is InvalidOid, whose blocks
+ * from filter_from_block onwards we won't try to prefetch until replay has
+ * passed filter_until_replayed.
+ */
+typedef struct XLogPrefetcherFilter
+{
+	RelFileNode rnode;
+	XLogRecPtr	filter_until_replayed;
+	BlockNumber filter_from_block;
+	dlist_node	link;
+} XLogPrefetcherFilter;
+
+/*
+ * Counters exposed in shared memory for pg_stat_recovery_prefetch.  Only the
+ * startup process writes them.
+ */
+typedef struct XLogPrefetchStats
+{
+	pg_atomic_uint64 reset_time;	/* time of last reset */
+	pg_atomic_uint64 reset_request; /* incremented to ask for a reset */
+	pg_atomic_uint64 prefetch;
+	pg_atomic_uint64 hit;
+	pg_atomic_uint64 skip_init;
+	pg_atomic_uint64 skip_new;
+	pg_atomic_uint64 skip_fpw;
+	pg_atomic_uint64 skip_rep;
+
+	/* dynamic values */
+	int			wal_distance;
+	int			io_depth;
+} XLogPrefetchStats;
+
+/*
+ * Private state of the startup process.
+ */
+struct XLogPrefetcher
+{
+	/* Reader and its WAL file */
+	XLogReaderState *reader;
+	int			fd;
+	XLogSegNo	segno;
+	TimeLineID	tli;
+	XLogRecPtr	read_upto;		/* don't read past here, if valid */
+
+	/* Are we reading, and have we got a record whose blocks we haven't seen? */
+	bool		reading;
+	bool		have_record;
+	int			next_block_id;
+
+	/* If we couldn't read a record, wait for replay to get there */
+	XLogRecPtr	blocked_lsn;
+
+	/* The block we looked at last */
+	RelFileNode last_rnode;
+	ForkNumber	last_forknum;
+	BlockNumber last_blkno;
+
+	/* Relations and databases we aren't prefetching for the moment */
+	HTAB	   *filter_table;
+	dlist_head	filter_queue;
+
+	/* LSNs of records that caused the prefetches in flight, oldest first */
+	XLogRecPtr	prefetch_queue[PREFETCH_QUEUE_SIZE];
+	int			prefetch_head;
+	int			prefetch_tail;
+	int			inflight;
+
+	/* Local copies of the counters, and the last reset request seen */
+	uint64		reset_request;
+	int64		prefetch;
+	int64		hit;
+	int64		skip_init;
+	int64		skip_new;
+	int64		skip_fpw;
+	int64		skip_rep;
+};
+
+static XLogPrefetchStats *SharedStats;
+
+static bool XLogPrefetcherEnabled(void);
+static void XLogPrefetcherRestart(XLogPrefetcher *prefetcher, XLogRecPtr lsn);
+static void XLogPrefetcherStop(XLogPrefetcher *prefetcher);
+static bool XLogPrefetcherScanBlocks(XLogPrefetcher *prefetcher);
+static void XLogPrefetcherScanRecord(XLogPrefetcher *prefetcher);
+static void XLogPrefetcherAddFilter(XLogPrefetcher *prefetcher,
+									RelFileNode rnode, BlockNumber blockno,
+									XLogRecPtr lsn);
+static bool XLogPrefetcherIsFiltered(XLogPrefetcher *prefetcher,
+									 RelFileNode rnode, BlockNumber blockno);
+static void XLogPrefetcherCompleteFilters(XLogPrefetcher *prefetcher,
+										  XLogRecPtr replaying_lsn);
+static void XLogPrefetcherCompletedIO(XLogPrefetcher *prefetcher,
+									  XLogRecPtr replaying_lsn);
+static void XLogPrefetcherResetStats(XLogPrefetcher *prefetcher);
+static void XLogPrefetcherPublishStats(XLogPrefetcher *prefetcher,
+									   XLogRecPtr replaying_lsn);
+static int	XLogPrefetcherReadPage(XLogReaderState *reader,
+								   XLogRecPtr targetPagePtr, int reqLen,
+								   XLogRecPtr targetRecPtr, char *readBuf);
+
+Size
+XLogPrefetchShmemSize(void)
+{
+	return sizeof(XLogPrefetchStats);
+}
+
+void
+XLogPrefetchShmemInit(void)
+{
+	bool		found;
+
+	SharedStats = (XLogPrefetchStats *)
+		ShmemInitStruct("XLogPrefetchStats",
+						sizeof(XLogPrefetchStats),
+						&found);
+
+	if (!found)
+	{
+		pg_atomic_init_u64(&SharedStats->reset_time, GetCurrentTimestamp());
+		pg_atomic_init_u64(&SharedStats->reset_request, 0);
+		pg_atomic_init_u64(&SharedStats->prefetch, 0);
+		pg_atomic_init_u64(&SharedStats->hit, 0);
+		pg_atomic_init_u64(&SharedStats->skip_init, 0);
+		pg_atomic_init_u64(&SharedStats->skip_new, 0);
+		pg_atomic_init_u64(&SharedStats->skip_fpw, 0);
+		pg_atomic_init_u64(&SharedStats->skip_rep, 0);
+		SharedStats->wal_distance = 0;
+		SharedStats->io_depth = 0;
+	}
+}
+
+/*
+ * Ask the startup process to reset the counters, the next time it looks
+ * ahead.  Called by pg_stat_reset_shared('recovery_prefetch').
+ */
+void
+XLogPrefetchRequestReset(void)
+{
+	pg_atomic_fetch_add_u64(&SharedStats->reset_request, 1);
+}
+
+/*
+ * Copy the current statistics, for pg_stat_recovery_prefetch.
+ */
+void
+XLogPrefetchGetStats(XLogPrefetchStatsData *stats)
+{
+	stats->reset_time = (TimestampTz) pg_atomic_read_u64(&SharedStats->reset_time);
+	stats->prefetch = pg_atomic_read_u64(&SharedStats->prefetch);
+	stats->hit = pg_atomic_read_u64(&SharedStats->hit);
+	stats->skip_init = pg_atomic_read_u64(&SharedStats->skip_init);
+	stats->skip_new = pg_atomic_read_u64(&SharedStats->skip_new);
+	stats->skip_fpw = pg_atomic_read_u64(&SharedStats->skip_fpw);
+	stats->skip_rep = pg_atomic_read_u64(&SharedStats->skip_rep);
+	stats->wal_distance = SharedStats->wal_distance;
+	stats->io_depth = SharedStats->io_depth;
+}
+
+/*
+ * GUC check_hook for recovery_prefetch
+ */
+bool
+check_recovery_prefetch(int *new_value, void **extra, GucSource source)
+{
+#ifndef USE_PREFETCH
+	if (*new_value == RECOVERY_PREFETCH_ON)
+	{
+		GUC_check_errdetail("recovery_prefetch is not supported on platforms that lack posix_fadvise().");
+		return false;
+	}
+#endif
+
+	return true;
+}
+
+/*
+ * Should we be prefetching, with the current settings?
+ *
+ * In "try" mode, we don't bother when the main fork is accessed with direct
+ * I/O, because the advice we can give would only pull blocks into the kernel's
+ * page cache, which direct reads bypass.
+ */
+static bool
+XLogPrefetcherEnabled(void)
+{
+#ifdef USE_PREFETCH
+	if (recovery_prefetch == RECOVERY_PREFETCH_OFF)
+		return false;
+	if (maintenance_io_concurrency == 0)
+		return false;
+	if (recovery_prefetch == RECOVERY_PREFETCH_TRY &&
+		(io_direct_flags & IO_DIRECT_DATA) != 0)
+		return false;
+	return true;
+#else
+	return false;
+#endif
+}
+
+/*
+ * Create a prefetcher, at the start of redo.
+ */
+XLogPrefetcher *
+XLogPrefetcherAllocate(void)
+{
+	XLogPrefetcher *prefetcher;
+	HASHCTL		hash_table_ctl;
+
+	prefetcher = palloc0(sizeof(XLogPrefetcher));
+	prefetcher->reader = XLogReaderAllocate(wal_segment_size, NULL,
+											XL_ROUTINE(.page_read = &XLogPrefetcherReadPage,
+													   .segment_open = NULL,
+													   .segment_close = NULL),
+											prefetcher);
+	if (!prefetcher->reader)
+		ereport(ERROR,
+				(errcode(ERRCODE_OUT_OF_MEMORY),
+				 errmsg("out of memory"),
+				 errdetail("Failed while allocating a WAL reading processor.")));
+	prefetcher->fd = -1;
+	prefetcher->blocked_lsn = InvalidXLogRecPtr;
+
+	hash_table_ctl.keysize = sizeof(RelFileNode);
+	hash_table_ctl.entrysize = sizeof(XLogPrefetcherFilter);
+	prefetcher->filter_table = hash_create("XLogPrefetcherFilterTable", 1024,
+										   &hash_table_ctl,
+										   HASH_ELEM | HASH_BLOBS);
+	dlist_init(&prefetcher->filter_queue);
+
+	/* Start counting from scratch for each recovery. */
+	prefetcher->reset_request = pg_atomic_read_u64(&SharedStats->reset_request);
+	XLogPrefetcherResetStats(prefetcher);
+
+	return prefetcher;
+}
+
+/*
+ * Destroy a prefetcher, at the end of redo.
+ */
+void
+XLogPrefetcherFree(XLogPrefetcher *prefetcher)
+{
+	XLogPrefetcherStop(prefetcher);
+	XLogReaderFree(prefetcher->reader);
+	hash_destroy(prefetcher->filter_table);
+
+	/* Nothing is in flight anymore. */
+	SharedStats->wal_distance = 0;
+	SharedStats->io_depth = 0;
+
+	pfree(prefetcher);
+}
+
+/*
+ * Look ahead in the WAL, and prefetch blocks that replay will need soon.
+ *
+ * Called by the startup process before it replays each record.
+ * 'replaying_lsn' is the start of the record about to be replayed, and
+ * 'next_lsn' is its end, where the following record starts.
+ */
+void
+XLogPrefetcherReadAhead(XLogPrefetcher *prefetcher,
+						XLogRecPtr replaying_lsn,
+						XLogRecPtr next_lsn)
+{
+	uint64		reset_request;
+
+	/* Forget about prefetches and filters that replay has caught up with. */
+	XLogPrefetcherCompletedIO(prefetcher, replaying_lsn);
+	XLogPrefetcherCompleteFilters(prefetcher, replaying_lsn);
+
+	reset_request = pg_atomic_read_u64(&SharedStats->reset_request);
+	if (reset_request != prefetcher->reset_request)
+	{
+		prefetcher->reset_request = reset_request;
+		XLogPrefetcherResetStats(prefetcher);
+	}
+
+	if (!XLogPrefetcherEnabled())
+	{
+		/* The settings might have been changed by a reload. */
+		if (prefetcher->reading)
+			XLogPrefetcherStop(prefetcher);
+		XLogPrefetcherPublishStats(prefetcher, replaying_lsn);
+		return;
+	}
+
+	/* If we couldn't read WAL before, wait for replay to get there. */
+	if (!XLogRecPtrIsInvalid(prefetcher->blocked_lsn))
+	{
+		if (replaying_lsn < prefetcher->blocked_lsn)
+		{
+			XLogPrefetcherPublishStats(prefetcher, replaying_lsn);
+			return;
+		}
+		prefetcher->blocked_lsn = InvalidXLogRecPtr;
+	}
+
+	/* Start reading at replay's position, if we aren't ahead of it. */
+	if (!prefetcher->reading || prefetcher->reader->EndRecPtr < next_lsn)
+		XLogPrefetcherRestart(prefetcher, next_lsn);
+
+	/*
+	 * On a standby that's streaming, don't read beyond what the WAL receiver
+	 * has flushed; anything after that might be incomplete.
+	 */
+	if (WalRcvStreaming())
+		prefetcher->read_upto = GetWalRcvFlushRecPtr(NULL, NULL);
+	else
+		prefetcher->read_upto = InvalidXLogRecPtr;
+
+	for (;;)
+	{
+		XLogRecord *record;
+		char	   *errormsg;
+
+		/* Finish off the blocks of the record we have. */
+		if (prefetcher->have_record)
+		{
+			if (!XLogPrefetcherScanBlocks(prefetcher))
+				break;			/* too many prefetches in flight */
+			prefetcher->have_record = false;
+		}
+
+		/* Don't look too far ahead. */
+		if (prefetcher->reader->EndRecPtr - replaying_lsn >=
+			(XLogRecPtr) recovery_prefetch_distance)
+			break;
+
+		record = XLogReadRecord(prefetcher->reader, &errormsg);
+		if (record == NULL)
+		{
+			/*
+			 * We can't read any further for now.  Try again from scratch once
+			 * replay has reached this point.
+			 */
+			prefetcher->blocked_lsn = prefetcher->reader->EndRecPtr;
+			XLogPrefetcherStop(prefetcher);
+			break;
+		}
+
+		XLogPrefetcherScanRecord(prefetcher);
+		prefetcher->have_record = true;
+		prefetcher->next_block_id = 0;
+	}
+
+	XLogPrefetcherPublishStats(prefetcher, replaying_lsn);
+}
+
+/*
+ * Start reading WAL at 'lsn', which is the end of a record.
+ */
+static void
+XLogPrefetcherRestart(XLogPrefetcher *prefetcher, XLogRecPtr lsn)
+{
+	/* A record never starts in the middle of a page header. */
+	if (XLogSegmentOffset(lsn, wal_segment_size) == 0)
+		lsn += SizeOfXLogLongPHD;
+	else if (lsn % XLOG_BLCKSZ == 0)
+		lsn += SizeOfXLogShortPHD;
+
+	XLogBeginRead(prefetcher->reader, lsn);
+	prefetcher->tli = ThisTimeLineID;
+	prefetcher->reading = true;
+	prefetcher->have_record = false;
+}
+
+/*
+ * Stop reading WAL, until we're restarted.
+ */
+static void
+XLogPrefetcherStop(XLogPrefetcher *prefetcher)
+{
+	if (prefetcher->fd >= 0)
+	{
+		close(prefetcher->fd);
+		prefetcher->fd = -1;
+	}
+	prefetcher->reading = false;
+	prefetcher->have_record = false;
+}
+
+/*
+ * Take note of records that create relations or databases, so that we don't
+ * try to prefetch blocks of them before replay has created them.
+ */
+static void
+XLogPrefetcherScanRecord(XLogPrefetcher *prefetcher)
+{
+	XLogReaderState *reader = prefetcher->reader;
+	RmgrId		rmid = XLogRecGetRmid(reader);
+	uint8		info = XLogRecGetInfo(reader) & ~XLR_INFO_MASK;
+
+	if (rmid == RM_SMGR_ID && info == XLOG_SMGR_CREATE)
+	{
+		xl_smgr_create *xlrec = (xl_smgr_create *) XLogRecGetData(reader);
+
+		XLogPrefetcherAddFilter(prefetcher, xlrec->rnode, 0,
+								reader->ReadRecPtr);
+	}
+	else if (rmid == RM_DBASE_ID && info == XLOG_DBASE_CREATE)
+	{
+		xl_dbase_create_rec *xlrec = (xl_dbase_create_rec *) XLogRecGetData(reader);
+		RelFileNode rnode = {InvalidOid, InvalidOid, InvalidOid};
+
+		rnode.spcNode = xlrec->tablespace_id;
+		rnode.dbNode = xlrec->db_id;
+		XLogPrefetcherAddFilter(prefetcher, rnode, 0, reader->ReadRecPtr);
+	}
+}
+
+/*
+ * Prefetch the blocks referenced by the record we have read.  Returns false
+ * if we have to stop before the end because there are too many prefetches in
+ * flight, in which case we'll continue where we left off next time.
+ */
+static bool
+XLogPrefetcherScanBlocks(XLogPrefetcher *prefetcher)
+{
+	XLogReaderState *reader = prefetcher->reader;
+
+	for (; prefetcher->next_block_id <= reader->max_block_id;
+		 prefetcher->next_block_id++)
+	{
+		DecodedBkpBlock *block = &reader->blocks[prefetcher->next_block_id];
+		SMgrRelation reln;
+		BlockNumber nblocks;
+		PrefetchBufferResult result;
+
+		if (!block->in_use)
+			continue;
+
+		if (prefetcher->inflight >= maintenance_io_concurrency)
+			return false;
+
+		/* Redo will restore the page from the image, no need to read it. */
+		if (block->has_image && block->apply_image)
+		{
+			prefetcher->skip_fpw++;
+			continue;
+		}
+
+		/* Likewise if redo will initialize the page from scratch. */
+		if (block->flags & BKPBLOCK_WILL_INIT)
+		{
+			prefetcher->skip_init++;
+			continue;
+		}
+
+		/* Many records reference the same block as the one before. */
+		if (RelFileNodeEquals(block->rnode, prefetcher->last_rnode) &&
+			block->forknum == prefetcher->last_forknum &&
+			block->blkno == prefetcher->last_blkno)
+		{
+			prefetcher->skip_rep++;
+			continue;
+		}
+		prefetcher->last_rnode = block->rnode;
+		prefetcher->last_forknum = block->forknum;
+		prefetcher->last_blkno = block->blkno;
+
+		if (XLogPrefetcherIsFiltered(prefetcher, block->rnode, block->blkno))
+		{
+			prefetcher->skip_new++;
+			continue;
+		}
+
+		/*
+		 * If the relation doesn't exist yet, or is too short, it's being
+		 * created or extended by WAL we haven't replayed yet.  Don't look at
+		 * it again until replay has reached this record.
+		 */
+		reln = smgropen(block->rnode, InvalidBackendId);
+		nblocks = smgrnblocks_cached(reln, block->forknum);
+		if (nblocks == InvalidBlockNumber)
+		{
+			if (!smgrexists(reln, block->forknum))
+			{
+				XLogPrefetcherAddFilter(prefetcher, block->rnode, 0,
+										reader->ReadRecPtr);
+				prefetcher->skip_new++;
+				continue;
+			}
+			nblocks = smgrnblocks(reln, block->forknum);
+		}
+		if (block->blkno >= nblocks)
+		{
+			XLogPrefetcherAddFilter(prefetcher, block->rnode, nblocks,
+									reader->ReadRecPtr);
+			prefetcher->skip_new++;
+			continue;
+		}
+
+		result = PrefetchSharedBuffer(reln, block->forknum, block->blkno);
+		if (BufferIsValid(result.recent_buffer))
+			prefetcher->hit++;
+		else if (result.initiated_io)
+		{
+			prefetcher->prefetch++;
+			prefetcher->prefetch_queue[prefetcher->prefetch_head] =
+				reader->ReadRecPtr;
+			prefetcher->prefetch_head =
+				(prefetcher->prefetch_head + 1) % PREFETCH_QUEUE_SIZE;
+			prefetcher->inflight++;
+		}
+	}
+
+	return true;
+}
+
+/*
+ * Don't prefetch any blocks >= 'blockno' of 'rnode' until replay has passed
+ * 'lsn'.  A relNode of InvalidOid stands for the whole database.
+ */
+static void
+XLogPrefetcherAddFilter(XLogPrefetcher *prefetcher, RelFileNode rnode,
+						BlockNumber blockno, XLogRecPtr lsn)
+{
+	XLogPrefetcherFilter *filter;
+	bool		found;
+
+	filter = hash_search(prefetcher->filter_table, &rnode, HASH_ENTER, &found);
+	if (!found)
+	{
+		filter->filter_until_replayed = lsn;
+		filter->filter_from_block = blockno;
+		dlist_push_head(&prefetcher->filter_queue, &filter->link);
+	}
+	else
+	{
+		/*
+		 * The queue is kept in LSN order by removal time only approximately;
+		 * an entry that's extended here just holds up the removal of newer
+		 * entries a little longer.
+		 */
+		filter->filter_until_replayed = Max(filter->filter_until_replayed, lsn);
+		filter->filter_from_block = Min(filter->filter_from_block, blockno);
+	}
+}
+
+/*
+ * Is 'blockno' of 'rnode', or its whole database, filtered out?
+ */
+static bool
+XLogPrefetcherIsFiltered(XLogPrefetcher *prefetcher, RelFileNode rnode,
+						 BlockNumber blockno)
+{
+	XLogPrefetcherFilter *filter;
+
+	if (dlist_is_empty(&prefetcher->filter_queue))
+		return false;
+
+	filter = hash_search(prefetcher->filter_table, &rnode, HASH_FIND, NULL);
+	if (filter && filter->filter_from_block <= blockno)
+		return true;
+
+	rnode.relNode = InvalidOid;
+	filter = hash_search(prefetcher->filter_table, &rnode, HASH_FIND, NULL);
+	if (filter)
+		return true;
+
+	return false;
+}
+
+/*
+ * Remove the filters that replay has passed.
+ */
+static void
+XLogPrefetcherCompleteFilters(XLogPrefetcher *prefetcher,
+							  XLogRecPtr replaying_lsn)
+{
+	while (!dlist_is_empty(&prefetcher->filter_queue))
+	{
+		XLogPrefetcherFilter *filter =
+		dlist_tail_element(XLogPrefetcherFilter, link,
+						   &prefetcher->filter_queue);
+
+		if (filter->filter_until_replayed >= replaying_lsn)
+			break;
+		dlist_delete(&filter->link);
+		hash_search(prefetcher->filter_table, filter, HASH_REMOVE, NULL);
+	}
+}
+
+/*
+ * Consider the prefetches caused by records up to and including the one
+ * being replayed to be finished: replay is going to read those blocks now.
+ */
+static void
+XLogPrefetcherCompletedIO(XLogPrefetcher *prefetcher,
+						  XLogRecPtr replaying_lsn)
+{
+	while (prefetcher->inflight > 0 &&
+		   prefetcher->prefetch_queue[prefetcher->prefetch_tail] <= replaying_lsn)
+	{
+		prefetcher->prefetch_tail =
+			(prefetcher->prefetch_tail + 1) % PREFETCH_QUEUE_SIZE;
+		prefetcher->inflight--;
+	}
+}
+
+static void
+XLogPrefetcherResetStats(XLogPrefetcher *prefetcher)
+{
+	prefetcher->prefetch = 0;
+	prefetcher->hit = 0;
+	prefetcher->skip_init = 0;
+	prefetcher->skip_new = 0;
+	prefetcher->skip_fpw = 0;
+	prefetcher->skip_rep = 0;
+	pg_atomic_write_u64(&SharedStats->reset_time, GetCurrentTimestamp());
+}
+
+/*
+ * Expose our counters in shared memory.  There's only one writer, so plain
+ * atomic writes are enough.
+ */
+static void
+XLogPrefetcherPublishStats(XLogPrefetcher *prefetcher,
+						   XLogRecPtr replaying_lsn)
+{
+	pg_atomic_write_u64(&SharedStats->prefetch, prefetcher->prefetch);
+	pg_atomic_write_u64(&SharedStats->hit, prefetcher->hit);
+	pg_atomic_write_u64(&SharedStats->skip_init, prefetcher->skip_init);
+	pg_atomic_write_u64(&SharedStats->skip_new, prefetcher->skip_new);
+	pg_atomic_write_u64(&SharedStats->skip_fpw, prefetcher->skip_fpw);
+	pg_atomic_write_u64(&SharedStats->skip_rep, prefetcher->skip_rep);
+
+	if (prefetcher->reading && prefetcher->reader->EndRecPtr > replaying_lsn)
+		SharedStats->wal_distance =
+			(int) (prefetcher->reader->EndRecPtr - replaying_lsn);
+	else
+		SharedStats->wal_distance = 0;
+	SharedStats->io_depth = prefetcher->inflight;
+}
+
+/*
+ * XLogReaderRoutine->page_read callback for the prefetcher's reader.
+ *
+ * Unlike the startup process's callback, this never waits for WAL to become
+ * available, and never restores it from the archive; it just fails.
+ */
+static int
+XLogPrefetcherReadPage(XLogReaderState *reader, XLogRecPtr targetPagePtr,
+					   int reqLen, XLogRecPtr targetRecPtr, char *readBuf)
+{
+	XLogPrefetcher *prefetcher = (XLogPrefetcher *) reader->private_data;
+	XLogSegNo	segno;
+	int			count = XLOG_BLCKSZ;
+	int			r;
+
+	if (!XLogRecPtrIsInvalid(prefetcher->read_upto))
+	{
+		if (targetPagePtr + reqLen > prefetcher->read_upto)
+			return -1;
+		if (targetPagePtr + XLOG_BLCKSZ > prefetcher->read_upto)
+			count = prefetcher->read_upto - targetPagePtr;
+	}
+
+	XLByteToSeg(targetPagePtr, segno, wal_segment_size);
+	if (prefetcher->fd < 0 || segno != prefetcher->segno)
+	{
+		char		path[MAXPGPATH];
+
+		if (prefetcher->fd >= 0)
+			close(prefetcher->fd);
+		XLogFilePath(path, prefetcher->tli, segno, wal_segment_size);
+		prefetcher->fd = BasicOpenFile(path, O_RDONLY | PG_BINARY);
+		if (prefetcher->fd < 0)
+			return -1;
+		prefetcher->segno = segno;
+	}
+
+	pgstat_report_wait_start(WAIT_EVENT_WAL_READ);
+	r = pg_pread(prefetcher->fd, readBuf, XLOG_BLCKSZ,
+				 (off_t) XLogSegmentOffset(targetPagePtr, wal_segment_size));
+	pgstat_report_wait_end();
+	if (r != XLOG_BLCKSZ)
+		return -1;
+
+	reader->seg.ws_tli = prefetcher->tli;
+	reader->seg.ws_segno = segno;
+
+	return count;
+}
@@ -866,6 +866,18 @@ CREATE VIEW pg_stat_replication AS
         JOIN pg_stat_get_wal_senders() AS W ON (S.pid = W.pid)
         LEFT JOIN pg_authid AS U ON (S.usesysid = U.oid);
 
+CREATE VIEW pg_stat_buffer_partitions AS
+    SELECT
+            s.partition,
+            s.first_buffer,
+            s.num_buffers,
+            s.buffers_scanned,
+            s.buffers_allocated,
+            s.numa_node,
+            s.local_hits,
+            s.remote_hits
+    FROM pg_stat_get_buffer_partitions() s;
+
 CREATE VIEW pg_stat_slru AS
     SELECT
             s.name,
@@ -1085,6 +1097,19 @@ CREATE VIEW pg_stat_wal AS
         w.stats_reset
     FROM pg_stat_get_wal() w;
 
+CREATE VIEW pg_stat_recovery_prefetch AS
+    SELECT
+        s.stats_reset,
+        s.prefetch,
+        s.hit,
+        s.skip_init,
+        s.skip_new,
+        s.skip_fpw,
+        s.skip_rep,
+        s.wal_distance,
+        s.io_depth
+     FROM pg_stat_get_recovery_prefetch() s;
+
 CREATE VIEW pg_stat_progress_analyze AS
     SELECT
         S.pid AS pid, S.datid AS datid, D.datname AS datname,
@@ -109,6 +109,7 @@ static void show_sort_info(SortState *sortstate, ExplainState *es);
 static void show_incremental_sort_info(IncrementalSortState *incrsortstate,
 									   ExplainState *es);
 static void show_hash_info(HashState *hashstate, ExplainState *es);
+static void show_nestloop_info(NestLoopState *nlstate, ExplainState *es);
 static void show_resultcache_info(ResultCacheState *rcstate, List *ancestors,
 								  ExplainState *es);
 static void show_hashagg_info(AggState *hashstate, ExplainState *es);
@@ -116,6 +117,7 @@ static void show_tidbitmap_info(BitmapHeapScanState *planstate,
 								ExplainState *es);
 static void show_instrumentation_count(const char *qlabel, int which,
 									   PlanState *planstate, ExplainState *es);
+static void show_bloom_filter_count(PlanState *planstate, ExplainState *es);
 static void show_foreignscan_info(ForeignScanState *fsstate, ExplainState *es);
 static void show_eval_params(Bitmapset *bms_params, ExplainState *es);
 static const char *explain_get_index_name(Oid indexId);
@@ -625,6 +627,14 @@ ExplainOnePlan(PlannedStmt *plannedstmt, IntoClause *into, ExplainState *es,
 		double		plantime = INSTR_TIME_GET_DOUBLE(*planduration);
 
 		ExplainPropertyFloat("Planning Time", "ms", 1000.0 * plantime, 3, es);
+
+		/* Show the join search phases of planning, if there were any */
+		if (plannedstmt->joinOrderTime > 0)
+			ExplainPropertyFloat("Join Ordering Time", "ms",
+								 plannedstmt->joinOrderTime, 3, es);
+		if (plannedstmt->joinSearchTime > 0)
+			ExplainPropertyFloat("Join Search Time", "ms",
+								 plannedstmt->joinSearchTime, 3, es);
 	}
 
 	/* Print info about runtime of triggers */
@@ -1740,6 +1750,7 @@ ExplainNode(PlanState *planstate, List *ancestors,
 			if (plan->qual)
 				show_instrumentation_count("Rows Removed by Filter", 1,
 										   planstate, es);
+			show_bloom_filter_count(planstate, es);
 			break;
 		case T_IndexOnlyScan:
 			show_scan_qual(((IndexOnlyScan *) plan)->indexqual,
@@ -1753,6 +1764,7 @@ ExplainNode(PlanState *planstate, List *ancestors,
 			if (plan->qual)
 				show_instrumentation_count("Rows Removed by Filter", 1,
 										   planstate, es);
+			show_bloom_filter_count(planstate, es);
 			if (es->analyze)
 				ExplainPropertyFloat("Heap Fetches", NULL,
 									 planstate->instrument->ntuples2, 0, es);
@@ -1771,6 +1783,7 @@ ExplainNode(PlanState *planstate, List *ancestors,
 			if (plan->qual)
 				show_instrumentation_count("Rows Removed by Filter", 1,
 										   planstate, es);
+			show_bloom_filter_count(planstate, es);
 			if (es->analyze)
 				show_tidbitmap_info((BitmapHeapScanState *) planstate, es);
 			break;
@@ -1789,6 +1802,7 @@ ExplainNode(PlanState *planstate, List *ancestors,
 			if (plan->qual)
 				show_instrumentation_count("Rows Removed by Filter", 1,
 										   planstate, es);
+			show_bloom_filter_count(planstate, es);
 			break;
 		case T_Gather:
 			{
@@ -1942,6 +1956,8 @@ ExplainNode(PlanState *planstate, List *ancestors,
 			if (plan->qual)
 				show_instrumentation_count("Rows Removed by Filter", 2,
 										   planstate, es);
+			if (es->analyze)
+				show_nestloop_info(castNode(NestLoopState, planstate), es);
 			break;
 		case T_MergeJoin:
 			show_upper_qual(((MergeJoin *) plan)->mergeclauses,
@@ -1955,6 +1971,10 @@ ExplainNode(PlanState *planstate, List *ancestors,
 			if (plan->qual)
 				show_instrumentation_count("Rows Removed by Filter", 2,
 										   planstate, es);
+			if (((MergeJoin *) plan)->rangeBounds != NIL)
+				ExplainPropertyInteger("Key Ranges", NULL,
+									   list_length(((MergeJoin *) plan)->rangeBounds) + 1,
+									   es);
 			break;
 		case T_HashJoin:
 			show_upper_qual(((HashJoin *) plan)->hashclauses,
@@ -2021,6 +2041,10 @@ ExplainNode(PlanState *planstate, List *ancestors,
 			break;
 	}
 
+	/* Show whether the node returns its output in batches */
+	if (planstate->ExecProcNodeBatch != NULL)
+		ExplainPropertyBool("Batch Mode", true, es);
+
 	/*
 	 * Prepare per-worker JIT instrumentation.  As with the overall JIT
 	 * summary, this is printed only if printing costs is enabled.
@@ -3084,6 +3108,36 @@ show_hash_info(HashState *hashstate, ExplainState *es)
 	}
 }
 
+/*
+ * Show whether a nested loop switched to hashing its inner side.
+ */
+static void
+show_nestloop_info(NestLoopState *nlstate, ExplainState *es)
+{
+	if (nlstate->nl_SwitchedAfter == 0)
+		return;
+
+	if (es->format != EXPLAIN_FORMAT_TEXT)
+	{
+		ExplainPropertyFloat("Hash Switch After Outer Rows", NULL,
+							 nlstate->nl_SwitchedAfter, 0, es);
+		ExplainPropertyBool("Hash Switch Failed", nlstate->nl_SwitchFailed,
+							es);
+	}
+	else
+	{
+		ExplainIndentText(es);
+		if (nlstate->nl_SwitchFailed)
+			appendStringInfo(es->str,
+							 "Hash Switch: failed after %.0f outer rows, inner side exceeded hash memory\n",
+							 nlstate->nl_SwitchedAfter);
+		else
+			appendStringInfo(es->str,
+							 "Hash Switch: after %.0f outer rows\n",
+							 nlstate->nl_SwitchedAfter);
+	}
+}
+
 /*
  * Show information on result cache hits/misses/evictions and memory usage.
  */
@@ -3138,7 +3192,7 @@ show_resultcache_info(ResultCacheState *rcstate, List *ancestors,
 	if (!es->analyze)
 		return;
 
-	if (rcstate->stats.cache_misses > 0)
+	if (rcstate->stats.cache_hits > 0 || rcstate->stats.cache_misses > 0)
 	{
 		/*
 		 * mem_peak is only set when we freed memory, so we must use mem_used
@@ -3181,10 +3235,11 @@ show_resultcache_info(ResultCacheState *rcstate, List *ancestors,
 		si = &rcstate->shared_info->sinstrument[n];
 
 		/*
-		 * Skip workers that didn't do any work.  We needn't bother checking
-		 * for cache hits as a miss will always occur before a cache hit.
+		 * Skip workers that didn't do any work.  With a shared cache, a
+		 * worker may find everything it looks up already cached by the
+		 * others, so we must check for cache hits as well as misses.
 		 */
-		if (si->cache_misses == 0)
+		if (si->cache_hits == 0 && si->cache_misses == 0)
 			continue;
 
 		if (es->workers_state)
@@ -3391,7 +3446,9 @@ show_instrumentation_count(const char *qlabel, int which,
 	if (!es->analyze || !planstate->instrument)
 		return;
 
-	if (which == 2)
+	if (which == 3)
+		nfiltered = planstate->instrument->nfiltered3;
+	else if (which == 2)
 		nfiltered = planstate->instrument->nfiltered2;
 	else
 		nfiltered = planstate->instrument->nfiltered1;
@@ -3407,6 +3464,21 @@ show_instrumentation_count(const char *qlabel, int which,
 	}
 }
 
+/*
+ * If it's EXPLAIN ANALYZE, show how many rows a hash join's Bloom filter
+ * removed from a scan.  Whether a scan gets a filter is only decided at run
+ * time, so unlike the other counters, this one is left out in all formats
+ * when it's zero.
+ */
+static void
+show_bloom_filter_count(PlanState *planstate, ExplainState *es)
+{
+	if (es->analyze && planstate->instrument &&
+		planstate->instrument->nfiltered3 > 0)
+		show_instrumentation_count("Rows Removed by Bloom Filter", 3,
+								   planstate, es);
+}
+
 /*
  * Show extra information for a ForeignScan node.
  */
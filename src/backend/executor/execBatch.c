@@ -0,0 +1,223 @@
+/*-------------------------------------------------------------------------
+ *
+ * execBatch.c
+ *	  Support routines for batch-at-a-time execution of plan nodes.
+ *
+ * Normally, plan nodes hand their output to the parent one tuple at a time
+ * through ExecProcNode().  For some combinations of nodes, the parent can
+ * instead ask the child, once both have been initialized, to return its
+ * output in batches of up to EXEC_BATCH_SIZE deformed rows (see TupleBatch).
+ * The parent then reads the child with ExecProcNodeBatch() only, and can
+ * evaluate expressions over a whole batch at once with the EEOP_BATCH_*
+ * expression steps.  This saves the per-tuple overhead of calling into the
+ * child and dispatching each expression step, which dominates simple scans
+ * and aggregations.
+ *
+ * Batch mode is only used when the batch_execution setting is on.  Nodes
+ * that can be read in batches are SeqScan, for scans of heap tables, and
+ * Result, on top of such a node.  Agg is currently the only consumer.
+ *
+ * Portions Copyright (c) 1996-2021, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * IDENTIFICATION
+ *	  src/backend/executor/execBatch.c
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#include "postgres.h"
+
+#include "executor/execBatch.h"
+#include "executor/executor.h"
+#include "executor/instrument.h"
+#include "executor/nodeResult.h"
+#include "executor/nodeSeqscan.h"
+#include "nodes/primnodes.h"
+
+/* GUC parameter */
+bool		batch_execution = false;
+
+static TupleBatch *ExecProcNodeBatchInstr(PlanState *node);
+
+
+/*
+ * ExecEnableBatchMode
+ *
+ * Ask a child node to return its output in batches, of which the caller
+ * needs the first natts columns.  Returns false, and leaves the node alone,
+ * if the node can't do that.  Otherwise, the node must only be read with
+ * ExecProcNodeBatch() from now on.
+ *
+ * This must be called during the parent's initialization, after the child
+ * has been initialized.
+ */
+bool
+ExecEnableBatchMode(PlanState *node, int natts)
+{
+	bool		enabled;
+
+	switch (nodeTag(node))
+	{
+		case T_SeqScanState:
+			enabled = ExecSeqScanEnableBatch((SeqScanState *) node, natts);
+			break;
+		case T_ResultState:
+			enabled = ExecResultEnableBatch((ResultState *) node, natts);
+			break;
+		default:
+			enabled = false;
+			break;
+	}
+
+	if (!enabled)
+		return false;
+
+	Assert(node->ExecProcNodeBatchReal != NULL);
+
+	/* add an instrumentation wrapper, if needed */
+	if (node->instrument)
+		node->ExecProcNodeBatch = ExecProcNodeBatchInstr;
+	else
+		node->ExecProcNodeBatch = node->ExecProcNodeBatchReal;
+
+	return true;
+}
+
+/*
+ * ExecProcNodeBatch wrapper that performs instrumentation calls.
+ */
+static TupleBatch *
+ExecProcNodeBatchInstr(PlanState *node)
+{
+	TupleBatch *result;
+
+	InstrStartNode(node->instrument);
+
+	result = node->ExecProcNodeBatchReal(node);
+
+	if (result == NULL)
+	{
+		InstrStopNode(node->instrument, 0.0);
+		node->instrument->exhausted = true;
+	}
+	else
+		InstrStopNode(node->instrument, result->nvalid);
+
+	return result;
+}
+
+/*
+ * MakeTupleBatch
+ *
+ * Create a batch with room for EXEC_BATCH_SIZE rows of natts columns, in
+ * the current memory context.
+ */
+TupleBatch *
+MakeTupleBatch(int natts)
+{
+	TupleBatch *batch = MakeTupleBatchHeader(natts);
+
+	for (int col = 0; col < natts; col++)
+	{
+		batch->values[col] = (Datum *) palloc(sizeof(Datum) * EXEC_BATCH_SIZE);
+		batch->isnull[col] = (bool *) palloc(sizeof(bool) * EXEC_BATCH_SIZE);
+	}
+	batch->sel = (uint16 *) palloc(sizeof(uint16) * EXEC_BATCH_SIZE);
+
+	return batch;
+}
+
+/*
+ * MakeTupleBatchHeader
+ *
+ * Create a batch of natts columns without any storage for the rows.  Used
+ * for batches that point into another batch's storage; see
+ * ExecProjectBatch().
+ */
+TupleBatch *
+MakeTupleBatchHeader(int natts)
+{
+	TupleBatch *batch = (TupleBatch *) palloc0(sizeof(TupleBatch));
+
+	batch->natts = natts;
+	batch->values = (Datum **) palloc0(sizeof(Datum *) * Max(natts, 1));
+	batch->isnull = (bool **) palloc0(sizeof(bool *) * Max(natts, 1));
+
+	return batch;
+}
+
+/*
+ * TupleBatchSelectAll
+ *
+ * Mark the first nrows rows of the batch as present and selected.
+ */
+void
+TupleBatchSelectAll(TupleBatch *batch, int nrows)
+{
+	Assert(nrows <= EXEC_BATCH_SIZE);
+
+	for (int i = 0; i < nrows; i++)
+		batch->sel[i] = (uint16) i;
+	batch->nrows = nrows;
+	batch->nvalid = nrows;
+}
+
+/*
+ * ExecBuildBatchColumnMap
+ *
+ * A node in batch mode can only project by picking columns of its input,
+ * which costs nothing since the output batch can just point at the input's
+ * column arrays.  Check whether targetlist consists of nothing but plain
+ * Vars of the given varno, and if so, return an array mapping each output
+ * column to the (zero-based) input column it takes its value from, and set
+ * *ninputcols to the number of input columns needed.  Otherwise, return
+ * NULL.
+ */
+int *
+ExecBuildBatchColumnMap(List *targetlist, Index varno, int *ninputcols)
+{
+	int		   *colmap;
+	int			outcol = 0;
+	ListCell   *lc;
+
+	colmap = (int *) palloc(sizeof(int) * Max(list_length(targetlist), 1));
+	*ninputcols = 0;
+
+	foreach(lc, targetlist)
+	{
+		TargetEntry *tle = lfirst_node(TargetEntry, lc);
+		Var		   *var = (Var *) tle->expr;
+
+		if (!IsA(var, Var) || var->varno != varno || var->varattno <= 0)
+		{
+			pfree(colmap);
+			return NULL;
+		}
+
+		colmap[outcol++] = var->varattno - 1;
+		*ninputcols = Max(*ninputcols, var->varattno);
+	}
+
+	return colmap;
+}
+
+/*
+ * ExecProjectBatch
+ *
+ * Make result, created with MakeTupleBatchHeader(), point at the input
+ * columns that colmap selects for it.
+ */
+void
+ExecProjectBatch(TupleBatch *result, TupleBatch *input, const int *colmap)
+{
+	for (int col = 0; col < result->natts; col++)
+	{
+		Assert(colmap[col] < input->natts);
+		result->values[col] = input->values[colmap[col]];
+		result->isnull[col] = input->isnull[colmap[col]];
+	}
+	result->nrows = input->nrows;
+	result->nvalid = input->nvalid;
+	result->sel = input->sel;
+}
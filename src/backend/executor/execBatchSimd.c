@@ -0,0 +1,868 @@
+/*-------------------------------------------------------------------------
+ *
+ * execBatchSimd.c
+ *	  Vectorized kernels for filtering and aggregating batch columns.
+ *
+ * These are used by the EEOP_BATCH_QUAL_INT64/FLOAT8 and
+ * EEOP_BATCH_AGG_*_INT64 expression steps, for comparisons of fixed-width
+ * columns against constants and for count/sum/min/max aggregates.
+ *
+ * The vectorized loops only handle batches in which all rows are selected,
+ * which is the common case for the first qual clause applied to a batch and
+ * for aggregates over unfiltered scans.  Rows that are not processed by a
+ * vectorized loop, including all rows of sparser selections, are handled
+ * one at a time by the same code the plain C implementation uses.
+ *
+ * Portions Copyright (c) 1996-2021, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * IDENTIFICATION
+ *	  src/backend/executor/execBatchSimd.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#ifdef USE_FLOAT8_BYVAL
+
+#if defined(__x86_64__) && defined(__GNUC__) && defined(HAVE__GET_CPUID)
+#define USE_BATCH_SIMD_X86
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define USE_BATCH_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+#include "executor/execBatchSimd.h"
+#include "port/pg_bitutils.h"
+
+/* outcomes of comparing a value with the constant */
+#define CMP_LT		0x01
+#define CMP_EQ		0x02
+#define CMP_GT		0x04
+
+/* outcomes for which each comparison operator holds */
+static const int batch_cmp_accept[] = {
+	[BATCH_CMP_EQ] = CMP_EQ,
+	[BATCH_CMP_NE] = CMP_LT | CMP_GT,
+	[BATCH_CMP_LT] = CMP_LT,
+	[BATCH_CMP_LE] = CMP_LT | CMP_EQ,
+	[BATCH_CMP_GT] = CMP_GT,
+	[BATCH_CMP_GE] = CMP_GT | CMP_EQ
+};
+
+/*
+ * Are rows 0 .. nsel - 1 all selected?  Since sel[] is in ascending order,
+ * it's enough to look at the last entry.
+ */
+static inline bool
+sel_is_dense(const uint16 *sel, int nsel)
+{
+	return nsel > 0 && sel[nsel - 1] == nsel - 1;
+}
+
+/*
+ * Given bitmasks of the rows less than and equal to the constant, return the
+ * mask of rows for which the comparison holds.  mask has a bit set for each
+ * row under consideration.
+ */
+static inline uint32
+cmp_match(int accept, uint32 lt, uint32 eq, uint32 mask)
+{
+	uint32		match = 0;
+
+	if (accept & CMP_LT)
+		match |= lt;
+	if (accept & CMP_EQ)
+		match |= eq;
+	if (accept & CMP_GT)
+		match |= ~(lt | eq);
+	return match & mask;
+}
+
+/* bitmask of which of the n rows starting at isnull are null */
+static inline uint32
+null_mask(const bool *isnull, int n)
+{
+	uint32		mask = 0;
+
+	for (int i = 0; i < n; i++)
+		mask |= (uint32) isnull[i] << i;
+	return mask;
+}
+
+/* append the rows whose bits are set in match, counting from base, to sel */
+static inline int
+emit_rows(uint16 *sel, int n, int base, uint32 match)
+{
+	while (match != 0)
+	{
+		sel[n++] = (uint16) (base + pg_rightmost_one_pos32(match));
+		match &= match - 1;
+	}
+	return n;
+}
+
+/*
+ * Row-at-a-time versions of the kernels.  They process sel[from .. nsel-1],
+ * continuing where a vectorized loop left off.
+ */
+static inline int
+filter_int64_rows(const Datum *values, const bool *isnull, uint16 *sel,
+				  int from, int nsel, int n, int64 constval, int accept)
+{
+	for (int i = from; i < nsel; i++)
+	{
+		int			row = sel[i];
+		int64		value;
+		int			outcome;
+
+		if (isnull[row])
+			continue;
+		value = DatumGetInt64(values[row]);
+		if (value < constval)
+			outcome = CMP_LT;
+		else if (value == constval)
+			outcome = CMP_EQ;
+		else
+			outcome = CMP_GT;
+		if (accept & outcome)
+			sel[n++] = row;
+	}
+	return n;
+}
+
+static inline int
+filter_float8_rows(const Datum *values, const bool *isnull, uint16 *sel,
+				   int from, int nsel, int n, float8 constval, int accept)
+{
+	for (int i = from; i < nsel; i++)
+	{
+		int			row = sel[i];
+		float8		value;
+		int			outcome;
+
+		if (isnull[row])
+			continue;
+		value = DatumGetFloat8(values[row]);
+		/* NaN is neither less than nor equal to the constant */
+		if (value < constval)
+			outcome = CMP_LT;
+		else if (value == constval)
+			outcome = CMP_EQ;
+		else
+			outcome = CMP_GT;
+		if (accept & outcome)
+			sel[n++] = row;
+	}
+	return n;
+}
+
+static inline int
+sum_int64_rows(const Datum *values, const bool *isnull, const uint16 *sel,
+			   int from, int nsel, uint64 *sum)
+{
+	int			count = 0;
+
+	for (int i = from; i < nsel; i++)
+	{
+		int			row = sel[i];
+
+		if (isnull[row])
+			continue;
+		*sum += (uint64) DatumGetInt64(values[row]);
+		count++;
+	}
+	return count;
+}
+
+static inline int
+minmax_int64_rows(const Datum *values, const bool *isnull, const uint16 *sel,
+				  int from, int nsel, int64 *min, int64 *max)
+{
+	int			count = 0;
+
+	for (int i = from; i < nsel; i++)
+	{
+		int			row = sel[i];
+		int64		value;
+
+		if (isnull[row])
+			continue;
+		value = DatumGetInt64(values[row]);
+		if (value < *min)
+			*min = value;
+		if (value > *max)
+			*max = value;
+		count++;
+	}
+	return count;
+}
+
+#ifndef USE_BATCH_SIMD_NEON
+
+/*
+ * Plain C implementations
+ */
+static int
+pg_batch_filter_int64_c(const Datum *values, const bool *isnull,
+						uint16 *sel, int nsel, int64 constval, BatchCmpOp op)
+{
+	return filter_int64_rows(values, isnull, sel, 0, nsel, 0, constval,
+							 batch_cmp_accept[op]);
+}
+
+static int
+pg_batch_filter_float8_c(const Datum *values, const bool *isnull,
+						 uint16 *sel, int nsel, float8 constval, BatchCmpOp op)
+{
+	return filter_float8_rows(values, isnull, sel, 0, nsel, 0, constval,
+							  batch_cmp_accept[op]);
+}
+
+static int
+pg_batch_sum_int64_c(const Datum *values, const bool *isnull,
+					 const uint16 *sel, int nsel, int64 *sum)
+{
+	uint64		total = 0;
+	int			count;
+
+	count = sum_int64_rows(values, isnull, sel, 0, nsel, &total);
+	if (count > 0)
+		*sum = (int64) total;
+	return count;
+}
+
+static int
+pg_batch_minmax_int64_c(const Datum *values, const bool *isnull,
+						const uint16 *sel, int nsel, int64 *min, int64 *max)
+{
+	int64		lo = PG_INT64_MAX;
+	int64		hi = PG_INT64_MIN;
+	int			count;
+
+	count = minmax_int64_rows(values, isnull, sel, 0, nsel, &lo, &hi);
+	if (count > 0)
+	{
+		*min = lo;
+		*max = hi;
+	}
+	return count;
+}
+
+#endif							/* !USE_BATCH_SIMD_NEON */
+
+#ifdef USE_BATCH_SIMD_X86
+
+/*
+ * AVX2 implementations, processing four rows at a time
+ */
+static int
+__attribute__((target("avx2")))
+pg_batch_filter_int64_avx2(const Datum *values, const bool *isnull,
+						   uint16 *sel, int nsel, int64 constval, BatchCmpOp op)
+{
+	int			accept = batch_cmp_accept[op];
+	int			n = 0;
+	int			i = 0;
+
+	if (sel_is_dense(sel, nsel))
+	{
+		__m256i		c = _mm256_set1_epi64x(constval);
+
+		for (; i + 4 <= nsel; i += 4)
+		{
+			__m256i		v = _mm256_loadu_si256((const __m256i *) &values[i]);
+			uint32		lt;
+			uint32		eq;
+
+			lt = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(c, v)));
+			eq = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(v, c)));
+			n = emit_rows(sel, n, i,
+						  cmp_match(accept, lt, eq,
+									~null_mask(&isnull[i], 4) & 0xF));
+		}
+	}
+
+	return filter_int64_rows(values, isnull, sel, i, nsel, n, constval, accept);
+}
+
+static int
+__attribute__((target("avx2")))
+pg_batch_filter_float8_avx2(const Datum *values, const bool *isnull,
+							uint16 *sel, int nsel, float8 constval, BatchCmpOp op)
+{
+	int			accept = batch_cmp_accept[op];
+	int			n = 0;
+	int			i = 0;
+
+	if (sel_is_dense(sel, nsel))
+	{
+		__m256d		c = _mm256_set1_pd(constval);
+
+		for (; i + 4 <= nsel; i += 4)
+		{
+			__m256d		v = _mm256_loadu_pd((const double *) &values[i]);
+			uint32		lt;
+			uint32		eq;
+
+			/* ordered comparisons, so NaNs come out as greater */
+			lt = _mm256_movemask_pd(_mm256_cmp_pd(v, c, _CMP_LT_OQ));
+			eq = _mm256_movemask_pd(_mm256_cmp_pd(v, c, _CMP_EQ_OQ));
+			n = emit_rows(sel, n, i,
+						  cmp_match(accept, lt, eq,
+									~null_mask(&isnull[i], 4) & 0xF));
+		}
+	}
+
+	return filter_float8_rows(values, isnull, sel, i, nsel, n, constval,
+							  accept);
+}
+
+/* all-ones in the lanes of the four rows at isnull that are null */
+static inline __m256i
+__attribute__((target("avx2")))
+null_lanes_avx2(const bool *isnull)
+{
+	int32		bytes;
+
+	memcpy(&bytes, isnull, sizeof(bytes));
+	return _mm256_cmpgt_epi64(_mm256_cvtepu8_epi64(_mm_cvtsi32_si128(bytes)),
+							  _mm256_setzero_si256());
+}
+
+static int
+__attribute__((target("avx2")))
+pg_batch_sum_int64_avx2(const Datum *values, const bool *isnull,
+						const uint16 *sel, int nsel, int64 *sum)
+{
+	uint64		total = 0;
+	int			count = 0;
+	int			i = 0;
+
+	if (sel_is_dense(sel, nsel))
+	{
+		__m256i		acc = _mm256_setzero_si256();
+		int64		lanes[4];
+
+		for (; i + 4 <= nsel; i += 4)
+		{
+			__m256i		v = _mm256_loadu_si256((const __m256i *) &values[i]);
+
+			acc = _mm256_add_epi64(acc,
+								   _mm256_andnot_si256(null_lanes_avx2(&isnull[i]), v));
+			count += 4 - isnull[i] - isnull[i + 1] - isnull[i + 2] - isnull[i + 3];
+		}
+
+		_mm256_storeu_si256((__m256i *) lanes, acc);
+		for (int j = 0; j < 4; j++)
+			total += (uint64) lanes[j];
+	}
+
+	count += sum_int64_rows(values, isnull, sel, i, nsel, &total);
+	if (count > 0)
+		*sum = (int64) total;
+	return count;
+}
+
+static int
+__attribute__((target("avx2")))
+pg_batch_minmax_int64_avx2(const Datum *values, const bool *isnull,
+						   const uint16 *sel, int nsel, int64 *min, int64 *max)
+{
+	int64		lo = PG_INT64_MAX;
+	int64		hi = PG_INT64_MIN;
+	int			count = 0;
+	int			i = 0;
+
+	if (sel_is_dense(sel, nsel))
+	{
+		__m256i		vlo = _mm256_set1_epi64x(PG_INT64_MAX);
+		__m256i		vhi = _mm256_set1_epi64x(PG_INT64_MIN);
+		int64		lanes[4];
+
+		for (; i + 4 <= nsel; i += 4)
+		{
+			__m256i		v = _mm256_loadu_si256((const __m256i *) &values[i]);
+			__m256i		nulls = null_lanes_avx2(&isnull[i]);
+			__m256i		vl;
+			__m256i		vh;
+
+			/* replace nulls with values that can't change the result */
+			vl = _mm256_blendv_epi8(v, _mm256_set1_epi64x(PG_INT64_MAX), nulls);
+			vh = _mm256_blendv_epi8(v, _mm256_set1_epi64x(PG_INT64_MIN), nulls);
+			vlo = _mm256_blendv_epi8(vlo, vl, _mm256_cmpgt_epi64(vlo, vl));
+			vhi = _mm256_blendv_epi8(vhi, vh, _mm256_cmpgt_epi64(vh, vhi));
+			count += 4 - isnull[i] - isnull[i + 1] - isnull[i + 2] - isnull[i + 3];
+		}
+
+		_mm256_storeu_si256((__m256i *) lanes, vlo);
+		for (int j = 0; j < 4; j++)
+			lo = Min(lo, lanes[j]);
+		_mm256_storeu_si256((__m256i *) lanes, vhi);
+		for (int j = 0; j < 4; j++)
+			hi = Max(hi, lanes[j]);
+	}
+
+	count += minmax_int64_rows(values, isnull, sel, i, nsel, &lo, &hi);
+	if (count > 0)
+	{
+		*min = lo;
+		*max = hi;
+	}
+	return count;
+}
+
+/*
+ * SSE4.2 implementations, processing two rows at a time
+ */
+static int
+__attribute__((target("sse4.2")))
+pg_batch_filter_int64_sse42(const Datum *values, const bool *isnull,
+							uint16 *sel, int nsel, int64 constval, BatchCmpOp op)
+{
+	int			accept = batch_cmp_accept[op];
+	int			n = 0;
+	int			i = 0;
+
+	if (sel_is_dense(sel, nsel))
+	{
+		__m128i		c = _mm_set1_epi64x(constval);
+
+		for (; i + 2 <= nsel; i += 2)
+		{
+			__m128i		v = _mm_loadu_si128((const __m128i *) &values[i]);
+			uint32		lt;
+			uint32		eq;
+
+			lt = _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(c, v)));
+			eq = _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpeq_epi64(v, c)));
+			n = emit_rows(sel, n, i,
+						  cmp_match(accept, lt, eq,
+									~null_mask(&isnull[i], 2) & 0x3));
+		}
+	}
+
+	return filter_int64_rows(values, isnull, sel, i, nsel, n, constval, accept);
+}
+
+static int
+__attribute__((target("sse4.2")))
+pg_batch_filter_float8_sse42(const Datum *values, const bool *isnull,
+							 uint16 *sel, int nsel, float8 constval, BatchCmpOp op)
+{
+	int			accept = batch_cmp_accept[op];
+	int			n = 0;
+	int			i = 0;
+
+	if (sel_is_dense(sel, nsel))
+	{
+		__m128d		c = _mm_set1_pd(constval);
+
+		for (; i + 2 <= nsel; i += 2)
+		{
+			__m128d		v = _mm_loadu_pd((const double *) &values[i]);
+			uint32		lt;
+			uint32		eq;
+
+			/* ordered comparisons, so NaNs come out as greater */
+			lt = _mm_movemask_pd(_mm_cmplt_pd(v, c));
+			eq = _mm_movemask_pd(_mm_cmpeq_pd(v, c));
+			n = emit_rows(sel, n, i,
+						  cmp_match(accept, lt, eq,
+									~null_mask(&isnull[i], 2) & 0x3));
+		}
+	}
+
+	return filter_float8_rows(values, isnull, sel, i, nsel, n, constval,
+							  accept);
+}
+
+/* all-ones in the lanes of the two rows at isnull that are null */
+static inline __m128i
+__attribute__((target("sse4.2")))
+null_lanes_sse42(const bool *isnull)
+{
+	int16		bytes;
+
+	memcpy(&bytes, isnull, sizeof(bytes));
+	return _mm_cmpgt_epi64(_mm_cvtepu8_epi64(_mm_cvtsi32_si128((uint16) bytes)),
+						   _mm_setzero_si128());
+}
+
+static int
+__attribute__((target("sse4.2")))
+pg_batch_sum_int64_sse42(const Datum *values, const bool *isnull,
+						 const uint16 *sel, int nsel, int64 *sum)
+{
+	uint64		total = 0;
+	int			count = 0;
+	int			i = 0;
+
+	if (sel_is_dense(sel, nsel))
+	{
+		__m128i		acc = _mm_setzero_si128();
+		int64		lanes[2];
+
+		for (; i + 2 <= nsel; i += 2)
+		{
+			__m128i		v = _mm_loadu_si128((const __m128i *) &values[i]);
+
+			acc = _mm_add_epi64(acc,
+								_mm_andnot_si128(null_lanes_sse42(&isnull[i]), v));
+			count += 2 - isnull[i] - isnull[i + 1];
+		}
+
+		_mm_storeu_si128((__m128i *) lanes, acc);
+		total = (uint64) lanes[0] + (uint64) lanes[1];
+	}
+
+	count += sum_int64_rows(values, isnull, sel, i, nsel, &total);
+	if (count > 0)
+		*sum = (int64) total;
+	return count;
+}
+
+static int
+__attribute__((target("sse4.2")))
+pg_batch_minmax_int64_sse42(const Datum *values, const bool *isnull,
+							const uint16 *sel, int nsel, int64 *min, int64 *max)
+{
+	int64		lo = PG_INT64_MAX;
+	int64		hi = PG_INT64_MIN;
+	int			count = 0;
+	int			i = 0;
+
+	if (sel_is_dense(sel, nsel))
+	{
+		__m128i		vlo = _mm_set1_epi64x(PG_INT64_MAX);
+		__m128i		vhi = _mm_set1_epi64x(PG_INT64_MIN);
+		int64		lanes[2];
+
+		for (; i + 2 <= nsel; i += 2)
+		{
+			__m128i		v = _mm_loadu_si128((const __m128i *) &values[i]);
+			__m128i		nulls = null_lanes_sse42(&isnull[i]);
+			__m128i		vl;
+			__m128i		vh;
+
+			/* replace nulls with values that can't change the result */
+			vl = _mm_blendv_epi8(v, _mm_set1_epi64x(PG_INT64_MAX), nulls);
+			vh = _mm_blendv_epi8(v, _mm_set1_epi64x(PG_INT64_MIN), nulls);
+			vlo = _mm_blendv_epi8(vlo, vl, _mm_cmpgt_epi64(vlo, vl));
+			vhi = _mm_blendv_epi8(vhi, vh, _mm_cmpgt_epi64(vh, vhi));
+			count += 2 - isnull[i] - isnull[i + 1];
+		}
+
+		_mm_storeu_si128((__m128i *) lanes, vlo);
+		lo = Min(lanes[0], lanes[1]);
+		_mm_storeu_si128((__m128i *) lanes, vhi);
+		hi = Max(lanes[0], lanes[1]);
+	}
+
+	count += minmax_int64_rows(values, isnull, sel, i, nsel, &lo, &hi);
+	if (count > 0)
+	{
+		*min = lo;
+		*max = hi;
+	}
+	return count;
+}
+
+#endif							/* USE_BATCH_SIMD_X86 */
+
+#ifdef USE_BATCH_SIMD_NEON
+
+/*
+ * NEON implementations, processing two rows at a time.  NEON is a mandatory
+ * part of AArch64, so these are used without any runtime check.
+ */
+
+/* bitmask of the lanes of a comparison result that are set */
+static inline uint32
+lane_mask_neon(uint64x2_t cmp)
+{
+	return (uint32) ((vgetq_lane_u64(cmp, 0) & 1) |
+					 ((vgetq_lane_u64(cmp, 1) & 1) << 1));
+}
+
+/* all-ones in the lanes of the two rows at isnull that are not null */
+static inline int64x2_t
+notnull_lanes_neon(const bool *isnull)
+{
+	int64		lanes[2] = {(int64) isnull[0] - 1, (int64) isnull[1] - 1};
+
+	return vld1q_s64(lanes);
+}
+
+static int
+pg_batch_filter_int64_neon(const Datum *values, const bool *isnull,
+						   uint16 *sel, int nsel, int64 constval, BatchCmpOp op)
+{
+	int			accept = batch_cmp_accept[op];
+	int			n = 0;
+	int			i = 0;
+
+	if (sel_is_dense(sel, nsel))
+	{
+		int64x2_t	c = vdupq_n_s64(constval);
+
+		for (; i + 2 <= nsel; i += 2)
+		{
+			int64x2_t	v = vld1q_s64((const int64 *) &values[i]);
+
+			n = emit_rows(sel, n, i,
+						  cmp_match(accept,
+									lane_mask_neon(vcltq_s64(v, c)),
+									lane_mask_neon(vceqq_s64(v, c)),
+									~null_mask(&isnull[i], 2) & 0x3));
+		}
+	}
+
+	return filter_int64_rows(values, isnull, sel, i, nsel, n, constval, accept);
+}
+
+static int
+pg_batch_filter_float8_neon(const Datum *values, const bool *isnull,
+							uint16 *sel, int nsel, float8 constval, BatchCmpOp op)
+{
+	int			accept = batch_cmp_accept[op];
+	int			n = 0;
+	int			i = 0;
+
+	if (sel_is_dense(sel, nsel))
+	{
+		float64x2_t c = vdupq_n_f64(constval);
+
+		for (; i + 2 <= nsel; i += 2)
+		{
+			float64x2_t v = vld1q_f64((const float8 *) &values[i]);
+
+			/* ordered comparisons, so NaNs come out as greater */
+			n = emit_rows(sel, n, i,
+						  cmp_match(accept,
+									lane_mask_neon(vcltq_f64(v, c)),
+									lane_mask_neon(vceqq_f64(v, c)),
+									~null_mask(&isnull[i], 2) & 0x3));
+		}
+	}
+
+	return filter_float8_rows(values, isnull, sel, i, nsel, n, constval,
+							  accept);
+}
+
+static int
+pg_batch_sum_int64_neon(const Datum *values, const bool *isnull,
+						const uint16 *sel, int nsel, int64 *sum)
+{
+	uint64		total = 0;
+	int			count = 0;
+	int			i = 0;
+
+	if (sel_is_dense(sel, nsel))
+	{
+		int64x2_t	acc = vdupq_n_s64(0);
+
+		for (; i + 2 <= nsel; i += 2)
+		{
+			int64x2_t	v = vld1q_s64((const int64 *) &values[i]);
+
+			acc = vaddq_s64(acc, vandq_s64(v, notnull_lanes_neon(&isnull[i])));
+			count += 2 - isnull[i] - isnull[i + 1];
+		}
+
+		total = (uint64) vgetq_lane_s64(acc, 0) + (uint64) vgetq_lane_s64(acc, 1);
+	}
+
+	count += sum_int64_rows(values, isnull, sel, i, nsel, &total);
+	if (count > 0)
+		*sum = (int64) total;
+	return count;
+}
+
+static int
+pg_batch_minmax_int64_neon(const Datum *values, const bool *isnull,
+						   const uint16 *sel, int nsel, int64 *min, int64 *max)
+{
+	int64		lo = PG_INT64_MAX;
+	int64		hi = PG_INT64_MIN;
+	int			count = 0;
+	int			i = 0;
+
+	if (sel_is_dense(sel, nsel))
+	{
+		int64x2_t	vlo = vdupq_n_s64(PG_INT64_MAX);
+		int64x2_t	vhi = vdupq_n_s64(PG_INT64_MIN);
+
+		for (; i + 2 <= nsel; i += 2)
+		{
+			int64x2_t	v = vld1q_s64((const int64 *) &values[i]);
+			uint64x2_t	notnull;
+			int64x2_t	vl;
+			int64x2_t	vh;
+
+			/* replace nulls with values that can't change the result */
+			notnull = vreinterpretq_u64_s64(notnull_lanes_neon(&isnull[i]));
+			vl = vbslq_s64(notnull, v, vdupq_n_s64(PG_INT64_MAX));
+			vh = vbslq_s64(notnull, v, vdupq_n_s64(PG_INT64_MIN));
+			vlo = vbslq_s64(vcltq_s64(vl, vlo), vl, vlo);
+			vhi = vbslq_s64(vcgtq_s64(vh, vhi), vh, vhi);
+			count += 2 - isnull[i] - isnull[i + 1];
+		}
+
+		lo = Min(vgetq_lane_s64(vlo, 0), vgetq_lane_s64(vlo, 1));
+		hi = Max(vgetq_lane_s64(vhi, 0), vgetq_lane_s64(vhi, 1));
+	}
+
+	count += minmax_int64_rows(values, isnull, sel, i, nsel, &lo, &hi);
+	if (count > 0)
+	{
+		*min = lo;
+		*max = hi;
+	}
+	return count;
+}
+
+#endif							/* USE_BATCH_SIMD_NEON */
+
+#if defined(USE_BATCH_SIMD_X86)
+
+static bool
+pg_batch_sse42_available(void)
+{
+	unsigned int exx[4] = {0, 0, 0, 0};
+
+	__get_cpuid(1, &exx[0], &exx[1], &exx[2], &exx[3]);
+
+	return (exx[2] & (1 << 20)) != 0;	/* SSE 4.2 */
+}
+
+static bool
+pg_batch_avx2_available(void)
+{
+	unsigned int exx[4] = {0, 0, 0, 0};
+	uint32		xcr0_lo;
+	uint32		xcr0_hi;
+
+	if (__get_cpuid_max(0, NULL) < 7)
+		return false;
+
+	/* the OS must be saving the YMM registers on context switches */
+	__get_cpuid(1, &exx[0], &exx[1], &exx[2], &exx[3]);
+	if ((exx[2] & (1 << 27)) == 0)	/* OSXSAVE */
+		return false;
+	__asm__ __volatile__("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+	if ((xcr0_lo & 0x6) != 0x6)
+		return false;
+
+	__cpuid_count(7, 0, exx[0], exx[1], exx[2], exx[3]);
+
+	return (exx[1] & (1 << 5)) != 0;	/* AVX2 */
+}
+
+/*
+ * Point all the kernel pointers at the best implementations available.
+ * This gets called on the first call of any kernel.
+ */
+static void
+pg_batch_simd_choose(void)
+{
+	if (pg_batch_avx2_available())
+	{
+		pg_batch_filter_int64 = pg_batch_filter_int64_avx2;
+		pg_batch_filter_float8 = pg_batch_filter_float8_avx2;
+		pg_batch_sum_int64 = pg_batch_sum_int64_avx2;
+		pg_batch_minmax_int64 = pg_batch_minmax_int64_avx2;
+	}
+	else if (pg_batch_sse42_available())
+	{
+		pg_batch_filter_int64 = pg_batch_filter_int64_sse42;
+		pg_batch_filter_float8 = pg_batch_filter_float8_sse42;
+		pg_batch_sum_int64 = pg_batch_sum_int64_sse42;
+		pg_batch_minmax_int64 = pg_batch_minmax_int64_sse42;
+	}
+	else
+	{
+		pg_batch_filter_int64 = pg_batch_filter_int64_c;
+		pg_batch_filter_float8 = pg_batch_filter_float8_c;
+		pg_batch_sum_int64 = pg_batch_sum_int64_c;
+		pg_batch_minmax_int64 = pg_batch_minmax_int64_c;
+	}
+}
+
+static int
+pg_batch_filter_int64_choose(const Datum *values, const bool *isnull,
+							 uint16 *sel, int nsel, int64 constval, BatchCmpOp op)
+{
+	pg_batch_simd_choose();
+	return pg_batch_filter_int64(values, isnull, sel, nsel, constval, op);
+}
+
+static int
+pg_batch_filter_float8_choose(const Datum *values, const bool *isnull,
+							  uint16 *sel, int nsel, float8 constval, BatchCmpOp op)
+{
+	pg_batch_simd_choose();
+	return pg_batch_filter_float8(values, isnull, sel, nsel, constval, op);
+}
+
+static int
+pg_batch_sum_int64_choose(const Datum *values, const bool *isnull,
+						  const uint16 *sel, int nsel, int64 *sum)
+{
+	pg_batch_simd_choose();
+	return pg_batch_sum_int64(values, isnull, sel, nsel, sum);
+}
+
+static int
+pg_batch_minmax_int64_choose(const Datum *values, const bool *isnull,
+							 const uint16 *sel, int nsel, int64 *min, int64 *max)
+{
+	pg_batch_simd_choose();
+	return pg_batch_minmax_int64(values, isnull, sel, nsel, min, max);
+}
+
+int			(*pg_batch_filter_int64) (const Datum *values, const bool *isnull,
+									  uint16 *sel, int nsel,
+									  int64 constval, BatchCmpOp op) = pg_batch_filter_int64_choose;
+int			(*pg_batch_filter_float8) (const Datum *values, const bool *isnull,
+									   uint16 *sel, int nsel,
+									   float8 constval, BatchCmpOp op) = pg_batch_filter_float8_choose;
+int			(*pg_batch_sum_int64) (const Datum *values, const bool *isnull,
+								   const uint16 *sel, int nsel, int64 *sum) = pg_batch_sum_int64_choose;
+int			(*pg_batch_minmax_int64) (const Datum *values, const bool *isnull,
+									  const uint16 *sel, int nsel,
+									  int64 *min, int64 *max) = pg_batch_minmax_int64_choose;
+
+#elif defined(USE_BATCH_SIMD_NEON)
+
+int			(*pg_batch_filter_int64) (const Datum *values, const bool *isnull,
+									  uint16 *sel, int nsel,
+									  int64 constval, BatchCmpOp op) = pg_batch_filter_int64_neon;
+int			(*pg_batch_filter_float8) (const Datum *values, const bool *isnull,
+									   uint16 *sel, int nsel,
+									   float8 constval, BatchCmpOp op) = pg_batch_filter_float8_neon;
+int			(*pg_batch_sum_int64) (const Datum *values, const bool *isnull,
+								   const uint16 *sel, int nsel, int64 *sum) = pg_batch_sum_int64_neon;
+int			(*pg_batch_minmax_int64) (const Datum *values, const bool *isnull,
+									  const uint16 *sel, int nsel,
+									  int64 *min, int64 *max) = pg_batch_minmax_int64_neon;
+
+#else
+
+int			(*pg_batch_filter_int64) (const Datum *values, const bool *isnull,
+									  uint16 *sel, int nsel,
+									  int64 constval, BatchCmpOp op) = pg_batch_filter_int64_c;
+int			(*pg_batch_filter_float8) (const Datum *values, const bool *isnull,
+									   uint16 *sel, int nsel,
+									   float8 constval, BatchCmpOp op) = pg_batch_filter_float8_c;
+int			(*pg_batch_sum_int64) (const Datum *values, const bool *isnull,
+								   const uint16 *sel, int nsel, int64 *sum) = pg_batch_sum_int64_c;
+int			(*pg_batch_minmax_int64) (const Datum *values, const bool *isnull,
+									  const uint16 *sel, int nsel,
+									  int64 *min, int64 *max) = pg_batch_minmax_int64_c;
+
+#endif
+
+#endif							/* USE_FLOAT8_BYVAL */
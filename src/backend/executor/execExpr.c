@@ -30,9 +30,14 @@
  */
 #include "postgres.h"
 
+#include <math.h>
+
 #include "access/nbtree.h"
 #include "catalog/objectaccess.h"
+#include "catalog/pg_aggregate.h"
+#include "catalog/pg_opfamily.h"
 #include "catalog/pg_type.h"
+#include "executor/execBatchSimd.h"
 #include "executor/execExpr.h"
 #include "executor/nodeSubplan.h"
 #include "funcapi.h"
@@ -41,12 +46,14 @@
 #include "nodes/makefuncs.h"
 #include "nodes/nodeFuncs.h"
 #include "nodes/subscripting.h"
+#include "optimizer/clauses.h"
 #include "optimizer/optimizer.h"
 #include "pgstat.h"
 #include "utils/acl.h"
 #include "utils/array.h"
 #include "utils/builtins.h"
 #include "utils/datum.h"
+#include "utils/fmgroids.h"
 #include "utils/lsyscache.h"
 #include "utils/typcache.h"
 
@@ -83,6 +90,12 @@ static void ExecBuildAggTransCall(ExprState *state, AggState *aggstate,
 								  FunctionCallInfo fcinfo, AggStatePerTrans pertrans,
 								  int transno, int setno, int setoff, bool ishash,
 								  bool nullcheck);
+static bool ExecInitBatchQualOp(ExprEvalStep *scratch, Expr *node);
+static bool ExecInitBatchQualConst(ExprEvalStep *scratch, OpExpr *opexpr,
+								   const int *cols, Const *const *consts);
+static ExprEvalOp ExecBatchAggTransOpcode(AggStatePerTrans pertrans, int col);
+static void ExecInitBatchQualRows(ExprState *state, List *rowquals,
+								  PlanState *parent, int natts);
 
 
 /*
@@ -311,6 +324,314 @@ ExecInitCheck(List *qual, PlanState *parent)
 	return ExecInitExpr(make_ands_explicit(qual), parent);
 }
 
+/*
+ * ExecInitQualBatch: prepare a qual for filtering batches of scan tuples
+ *
+ * The returned expression is evaluated with ExecEvalExpr() (its result is
+ * meaningless) with econtext->ecxt_batch set to a batch of rows of the
+ * scan tuple type of 'parent'; it deselects the rows of the batch for which
+ * the qual isn't true.  Clauses of the form "column op column" and "column
+ * op constant", with a strict operator, are evaluated over the whole batch
+ * in one step each.  Runs of other clauses are evaluated a row at a time,
+ * so that the clauses are still applied to each row in their original
+ * order.
+ *
+ * The batch must hold at least the first *natts columns of the scan tuple,
+ * *natts being set here.  Returns NULL if the qual can't be evaluated over
+ * batches, because it references system columns or the whole row, or
+ * contains subplans.
+ */
+ExprState *
+ExecInitQualBatch(List *qual, PlanState *parent, int *natts)
+{
+	ExprState  *state;
+	ExprEvalStep scratch = {0};
+	List	   *vars;
+	List	   *rowquals = NIL;
+	ListCell   *lc;
+
+	Assert(qual != NIL && IsA(qual, List));
+
+	/*
+	 * A subplan would be added to the parent's list of subplans a second
+	 * time, on top of the copy in the parent's regular qual.
+	 */
+	if (contain_subplans((Node *) qual))
+		return NULL;
+
+	*natts = 0;
+	vars = pull_var_clause((Node *) qual, 0);
+	foreach(lc, vars)
+	{
+		Var		   *var = lfirst_node(Var, lc);
+
+		if (IS_SPECIAL_VARNO(var->varno) || var->varattno <= 0)
+		{
+			list_free(vars);
+			return NULL;
+		}
+		*natts = Max(*natts, var->varattno);
+	}
+	list_free(vars);
+
+	state = makeNode(ExprState);
+	state->expr = (Expr *) qual;
+	state->parent = parent;
+	state->ext_params = NULL;
+
+	foreach(lc, qual)
+	{
+		Expr	   *node = (Expr *) lfirst(lc);
+
+		if (ExecInitBatchQualOp(&scratch, node))
+		{
+			if (rowquals != NIL)
+			{
+				ExecInitBatchQualRows(state, rowquals, parent, *natts);
+				rowquals = NIL;
+			}
+			ExprEvalPushStep(state, &scratch);
+		}
+		else
+			rowquals = lappend(rowquals, node);
+	}
+	if (rowquals != NIL)
+		ExecInitBatchQualRows(state, rowquals, parent, *natts);
+
+	scratch.opcode = EEOP_DONE;
+	ExprEvalPushStep(state, &scratch);
+
+	ExecReadyExpr(state);
+
+	return state;
+}
+
+/*
+ * Prepare an EEOP_BATCH_QUAL_OP step for a qual clause, if it's a strict
+ * two-argument boolean operator over scan columns and non-null constants.
+ * Returns false if the clause isn't of that form.
+ */
+static bool
+ExecInitBatchQualOp(ExprEvalStep *scratch, Expr *node)
+{
+	OpExpr	   *opexpr;
+	int			cols[2];
+	Const	   *consts[2];
+	AclResult	aclresult;
+	FmgrInfo   *flinfo;
+	FunctionCallInfo fcinfo;
+
+	if (!IsA(node, OpExpr))
+		return false;
+	opexpr = (OpExpr *) node;
+	if (list_length(opexpr->args) != 2 ||
+		opexpr->opretset ||
+		opexpr->opresulttype != BOOLOID)
+		return false;
+
+	for (int argno = 0; argno < 2; argno++)
+	{
+		Expr	   *arg = (Expr *) list_nth(opexpr->args, argno);
+
+		/* binary-compatible coercions don't change the datum */
+		while (IsA(arg, RelabelType))
+			arg = ((RelabelType *) arg)->arg;
+
+		cols[argno] = -1;
+		consts[argno] = NULL;
+		if (IsA(arg, Var))
+		{
+			/* ExecInitQualBatch checked it's a user column */
+			cols[argno] = ((Var *) arg)->varattno - 1;
+		}
+		else if (IsA(arg, Const) && !((Const *) arg)->constisnull)
+			consts[argno] = (Const *) arg;
+		else
+			return false;
+	}
+
+	set_opfuncid(opexpr);
+	if (!func_strict(opexpr->opfuncid))
+		return false;
+
+	/* Check permission to call function */
+	aclresult = pg_proc_aclcheck(opexpr->opfuncid, GetUserId(), ACL_EXECUTE);
+	if (aclresult != ACLCHECK_OK)
+		aclcheck_error(aclresult, OBJECT_FUNCTION,
+					   get_func_name(opexpr->opfuncid));
+	InvokeFunctionExecuteHook(opexpr->opfuncid);
+
+	flinfo = palloc0(sizeof(FmgrInfo));
+	fmgr_info(opexpr->opfuncid, flinfo);
+	fmgr_info_set_expr((Node *) node, flinfo);
+
+	/* leave calls that are tracked in pg_stat_user_functions to EEOP_FUNCEXPR */
+	if (pgstat_track_functions > flinfo->fn_stats)
+	{
+		pfree(flinfo);
+		return false;
+	}
+
+	/* comparisons of numeric columns with constants get vectorized steps */
+	if (ExecInitBatchQualConst(scratch, opexpr, cols, consts))
+	{
+		pfree(flinfo);
+		return true;
+	}
+
+	fcinfo = palloc0(SizeForFunctionCallInfo(2));
+	InitFunctionCallInfoData(*fcinfo, flinfo, 2, opexpr->inputcollid,
+							 NULL, NULL);
+	for (int argno = 0; argno < 2; argno++)
+	{
+		if (consts[argno])
+			fcinfo->args[argno].value = consts[argno]->constvalue;
+		fcinfo->args[argno].isnull = false;
+	}
+
+	scratch->opcode = EEOP_BATCH_QUAL_OP;
+	scratch->resvalue = NULL;
+	scratch->resnull = NULL;
+	scratch->d.batch_qual_op.fcinfo_data = fcinfo;
+	scratch->d.batch_qual_op.fn_addr = flinfo->fn_addr;
+	scratch->d.batch_qual_op.lcol = cols[0];
+	scratch->d.batch_qual_op.rcol = cols[1];
+
+	return true;
+}
+
+/*
+ * Prepare an EEOP_BATCH_QUAL_INT64 or EEOP_BATCH_QUAL_FLOAT8 step, if the
+ * clause compares a column with a constant using one of the btree operators
+ * of the integer types, or those for float8 alone.  cols and consts describe
+ * the operator's arguments, as in ExecInitBatchQualOp().
+ */
+static bool
+ExecInitBatchQualConst(ExprEvalStep *scratch, OpExpr *opexpr,
+					   const int *cols, Const *const *consts)
+{
+#ifdef USE_FLOAT8_BYVAL
+	Oid			lefttype;
+	Oid			righttype;
+	Oid			opfamily;
+	int			colarg;
+	Const	   *con;
+	Oid			negator;
+	BatchCmpOp	cmp;
+
+	if (cols[0] >= 0 && consts[1] != NULL)
+		colarg = 0;
+	else if (consts[0] != NULL && cols[1] >= 0)
+		colarg = 1;
+	else
+		return false;
+	con = consts[1 - colarg];
+
+	op_input_types(opexpr->opno, &lefttype, &righttype);
+	if ((lefttype == INT2OID || lefttype == INT4OID || lefttype == INT8OID) &&
+		(righttype == INT2OID || righttype == INT4OID || righttype == INT8OID))
+		opfamily = INTEGER_BTREE_FAM_OID;
+	else if (lefttype == FLOAT8OID && righttype == FLOAT8OID)
+		opfamily = FLOAT_BTREE_FAM_OID;
+	else
+		return false;
+
+	switch (get_op_opfamily_strategy(opexpr->opno, opfamily))
+	{
+		case BTLessStrategyNumber:
+			cmp = colarg == 0 ? BATCH_CMP_LT : BATCH_CMP_GT;
+			break;
+		case BTLessEqualStrategyNumber:
+			cmp = colarg == 0 ? BATCH_CMP_LE : BATCH_CMP_GE;
+			break;
+		case BTEqualStrategyNumber:
+			cmp = BATCH_CMP_EQ;
+			break;
+		case BTGreaterEqualStrategyNumber:
+			cmp = colarg == 0 ? BATCH_CMP_GE : BATCH_CMP_LE;
+			break;
+		case BTGreaterStrategyNumber:
+			cmp = colarg == 0 ? BATCH_CMP_GT : BATCH_CMP_LT;
+			break;
+		default:
+			/* <> isn't in the opfamily, but its negator is */
+			negator = get_negator(opexpr->opno);
+			if (!OidIsValid(negator) ||
+				get_op_opfamily_strategy(negator, opfamily) != BTEqualStrategyNumber)
+				return false;
+			cmp = BATCH_CMP_NE;
+			break;
+	}
+
+	scratch->resvalue = NULL;
+	scratch->resnull = NULL;
+	scratch->d.batch_qual_const.col = cols[colarg];
+	scratch->d.batch_qual_const.cmp = (int) cmp;
+
+	if (opfamily == FLOAT_BTREE_FAM_OID)
+	{
+		/* the kernel handles NaNs in the column, but not as the constant */
+		if (isnan(DatumGetFloat8(con->constvalue)))
+			return false;
+		scratch->opcode = EEOP_BATCH_QUAL_FLOAT8;
+		scratch->d.batch_qual_const.constval = con->constvalue;
+	}
+	else
+	{
+		int64		constval;
+
+		if (con->consttype == INT2OID)
+			constval = DatumGetInt16(con->constvalue);
+		else if (con->consttype == INT4OID)
+			constval = DatumGetInt32(con->constvalue);
+		else
+			constval = DatumGetInt64(con->constvalue);
+		scratch->opcode = EEOP_BATCH_QUAL_INT64;
+		scratch->d.batch_qual_const.constval = Int64GetDatum(constval);
+	}
+
+	return true;
+#else
+	return false;
+#endif
+}
+
+/*
+ * Emit an EEOP_BATCH_QUAL_ROWS step that evaluates rowquals for each row of
+ * the batch, copying the first natts columns into a virtual slot.
+ */
+static void
+ExecInitBatchQualRows(ExprState *state, List *rowquals, PlanState *parent,
+					  int natts)
+{
+	ExprEvalStep scratch = {0};
+	TupleTableSlot *slot;
+	const TupleTableSlotOps *save_scanops = parent->scanops;
+	bool		save_scanopsfixed = parent->scanopsfixed;
+
+	slot = ExecInitExtraTupleSlot(parent->state, parent->scandesc,
+								  &TTSOpsVirtual);
+	memset(slot->tts_isnull, true,
+		   sizeof(bool) * slot->tts_tupleDescriptor->natts);
+
+	/*
+	 * The clauses will see the virtual slot as their scan tuple, rather than
+	 * the parent's own scan slot, so compile them for that.
+	 */
+	parent->scanops = &TTSOpsVirtual;
+	parent->scanopsfixed = true;
+
+	scratch.opcode = EEOP_BATCH_QUAL_ROWS;
+	scratch.d.batch_qual_rows.qual = ExecInitQual(rowquals, parent);
+	scratch.d.batch_qual_rows.slot = slot;
+	scratch.d.batch_qual_rows.natts = natts;
+
+	parent->scanops = save_scanops;
+	parent->scanopsfixed = save_scanopsfixed;
+
+	ExprEvalPushStep(state, &scratch);
+}
+
 /*
  * Call ExecInitExpr() on a list of expressions, return a list of ExprStates.
  */
@@ -3668,6 +3989,129 @@ ExecBuildAggTransCall(ExprState *state, AggState *aggstate,
 	}
 }
 
+/*
+ * Build an expression that advances the transition values of all aggregates
+ * of a plain aggregation (no grouping sets) over a batch of input rows, set
+ * as econtext->ecxt_batch.  *natts is set to the number of leading columns
+ * of the input the batch must hold.
+ *
+ * This is only possible if each aggregate either has no arguments or takes
+ * a single input column as is, without FILTER, DISTINCT or ORDER BY.
+ * Returns NULL if that's not the case.
+ */
+ExprState *
+ExecBuildAggTransBatch(AggState *aggstate, int *natts)
+{
+	ExprState  *state;
+	ExprEvalStep scratch = {0};
+
+	Assert(aggstate->aggstrategy == AGG_PLAIN);
+
+	if (DO_AGGSPLIT_COMBINE(aggstate->aggsplit))
+		return NULL;
+
+	*natts = 0;
+	for (int transno = 0; transno < aggstate->numtrans; transno++)
+	{
+		AggStatePerTrans pertrans = &aggstate->pertrans[transno];
+		Aggref	   *aggref = pertrans->aggref;
+
+		if (aggref->aggkind != AGGKIND_NORMAL ||
+			aggref->aggfilter != NULL ||
+			pertrans->numSortCols != 0 ||
+			pertrans->numTransInputs > 1 ||
+			list_length(aggref->args) != pertrans->numTransInputs)
+			return NULL;
+
+		if (aggref->args != NIL)
+		{
+			TargetEntry *tle = linitial_node(TargetEntry, aggref->args);
+			Expr	   *arg = tle->expr;
+
+			while (IsA(arg, RelabelType))
+				arg = ((RelabelType *) arg)->arg;
+
+			if (!IsA(arg, Var) ||
+				((Var *) arg)->varno != OUTER_VAR ||
+				((Var *) arg)->varattno <= 0)
+				return NULL;
+
+			*natts = Max(*natts, ((Var *) arg)->varattno);
+		}
+	}
+
+	state = makeNode(ExprState);
+	state->expr = (Expr *) aggstate;
+	state->parent = &aggstate->ss.ps;
+
+	for (int transno = 0; transno < aggstate->numtrans; transno++)
+	{
+		AggStatePerTrans pertrans = &aggstate->pertrans[transno];
+		Aggref	   *aggref = pertrans->aggref;
+
+		scratch.d.batch_agg_trans.pertrans = pertrans;
+		scratch.d.batch_agg_trans.aggcontext = aggstate->aggcontexts[0];
+		scratch.d.batch_agg_trans.transno = transno;
+		scratch.d.batch_agg_trans.col = -1;
+		if (aggref->args != NIL)
+		{
+			Expr	   *arg = linitial_node(TargetEntry, aggref->args)->expr;
+
+			while (IsA(arg, RelabelType))
+				arg = ((RelabelType *) arg)->arg;
+			scratch.d.batch_agg_trans.col = ((Var *) arg)->varattno - 1;
+		}
+		scratch.opcode = ExecBatchAggTransOpcode(pertrans,
+												 scratch.d.batch_agg_trans.col);
+		ExprEvalPushStep(state, &scratch);
+	}
+
+	scratch.opcode = EEOP_DONE;
+	ExprEvalPushStep(state, &scratch);
+
+	ExecReadyExpr(state);
+
+	return state;
+}
+
+/*
+ * Choose the step to advance a transition value over a batch.  Common
+ * aggregates over integer columns are recognized by their transition
+ * function, and get steps that implement it with vectorized kernels.
+ */
+static ExprEvalOp
+ExecBatchAggTransOpcode(AggStatePerTrans pertrans, int col)
+{
+#ifdef USE_FLOAT8_BYVAL
+	switch (pertrans->transfn_oid)
+	{
+		case F_INT8INC:
+		case F_INT8INC_ANY:
+			if (!pertrans->initValueIsNull)
+				return EEOP_BATCH_AGG_COUNT;
+			break;
+		case F_INT2_SUM:
+		case F_INT4_SUM:
+			return EEOP_BATCH_AGG_SUM_INT64;
+		case F_INT2SMALLER:
+		case F_INT4SMALLER:
+		case F_INT8SMALLER:
+			return EEOP_BATCH_AGG_MIN_INT64;
+		case F_INT2LARGER:
+		case F_INT4LARGER:
+		case F_INT8LARGER:
+			return EEOP_BATCH_AGG_MAX_INT64;
+		default:
+			break;
+	}
+#endif
+
+	if (pertrans->transtypeByVal)
+		return EEOP_BATCH_AGG_TRANS_BYVAL;
+	else
+		return EEOP_BATCH_AGG_TRANS_BYREF;
+}
+
 /*
  * Build equality expression that can be evaluated using ExecQual(), returning
  * true if the expression context's inner/outer tuple are NOT DISTINCT. I.e
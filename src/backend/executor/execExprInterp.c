@@ -59,6 +59,8 @@
 #include "access/heaptoast.h"
 #include "catalog/pg_type.h"
 #include "commands/sequence.h"
+#include "common/int.h"
+#include "executor/execBatchSimd.h"
 #include "executor/execExpr.h"
 #include "executor/nodeSubplan.h"
 #include "funcapi.h"
@@ -490,6 +492,16 @@ ExecInterpExpr(ExprState *state, ExprContext *econtext, bool *isnull)
 		&&CASE_EEOP_AGG_PLAIN_TRANS_BYREF,
 		&&CASE_EEOP_AGG_ORDERED_TRANS_DATUM,
 		&&CASE_EEOP_AGG_ORDERED_TRANS_TUPLE,
+		&&CASE_EEOP_BATCH_QUAL_OP,
+		&&CASE_EEOP_BATCH_QUAL_INT64,
+		&&CASE_EEOP_BATCH_QUAL_FLOAT8,
+		&&CASE_EEOP_BATCH_QUAL_ROWS,
+		&&CASE_EEOP_BATCH_AGG_TRANS_BYVAL,
+		&&CASE_EEOP_BATCH_AGG_TRANS_BYREF,
+		&&CASE_EEOP_BATCH_AGG_COUNT,
+		&&CASE_EEOP_BATCH_AGG_SUM_INT64,
+		&&CASE_EEOP_BATCH_AGG_MIN_INT64,
+		&&CASE_EEOP_BATCH_AGG_MAX_INT64,
 		&&CASE_EEOP_LAST
 	};
 
@@ -1790,6 +1802,80 @@ ExecInterpExpr(ExprState *state, ExprContext *econtext, bool *isnull)
 			EEO_NEXT();
 		}
 
+		/*
+		 * Batch steps loop over all rows of the batch themselves, so they
+		 * aren't worth inlining.
+		 */
+		EEO_CASE(EEOP_BATCH_QUAL_OP)
+		{
+			ExecEvalBatchQualOp(state, op, econtext);
+
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_BATCH_QUAL_INT64)
+		{
+			ExecEvalBatchQualInt64(state, op, econtext);
+
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_BATCH_QUAL_FLOAT8)
+		{
+			ExecEvalBatchQualFloat8(state, op, econtext);
+
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_BATCH_QUAL_ROWS)
+		{
+			ExecEvalBatchQualRows(state, op, econtext);
+
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_BATCH_AGG_TRANS_BYVAL)
+		{
+			ExecEvalBatchAggTransByVal(state, op, econtext);
+
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_BATCH_AGG_TRANS_BYREF)
+		{
+			ExecEvalBatchAggTransByRef(state, op, econtext);
+
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_BATCH_AGG_COUNT)
+		{
+			ExecEvalBatchAggCount(state, op, econtext);
+
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_BATCH_AGG_SUM_INT64)
+		{
+			ExecEvalBatchAggSumInt64(state, op, econtext);
+
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_BATCH_AGG_MIN_INT64)
+		{
+			ExecEvalBatchAggMinInt64(state, op, econtext);
+
+			EEO_NEXT();
+		}
+
+		EEO_CASE(EEOP_BATCH_AGG_MAX_INT64)
+		{
+			ExecEvalBatchAggMaxInt64(state, op, econtext);
+
+			EEO_NEXT();
+		}
+
 		EEO_CASE(EEOP_LAST)
 		{
 			/* unreachable */
@@ -4373,3 +4459,325 @@ ExecAggPlainTransByRef(AggState *aggstate, AggStatePerTrans pertrans,
 
 	MemoryContextSwitchTo(oldContext);
 }
+
+/*
+ * Filter the selected rows of a batch with a strict boolean function of two
+ * arguments, each of which is either a column of the batch or a constant.
+ * Rows for which the function doesn't return true are deselected.
+ */
+void
+ExecEvalBatchQualOp(ExprState *state, ExprEvalStep *op, ExprContext *econtext)
+{
+	TupleBatch *batch = econtext->ecxt_batch;
+	FunctionCallInfo fcinfo = op->d.batch_qual_op.fcinfo_data;
+	PGFunction	fn_addr = op->d.batch_qual_op.fn_addr;
+	int			lcol = op->d.batch_qual_op.lcol;
+	int			rcol = op->d.batch_qual_op.rcol;
+	uint16	   *sel = batch->sel;
+	int			nvalid = 0;
+
+	for (int i = 0; i < batch->nvalid; i++)
+	{
+		int			row = sel[i];
+		Datum		d;
+
+		if (lcol >= 0)
+		{
+			if (batch->isnull[lcol][row])
+				continue;
+			fcinfo->args[0].value = batch->values[lcol][row];
+		}
+		if (rcol >= 0)
+		{
+			if (batch->isnull[rcol][row])
+				continue;
+			fcinfo->args[1].value = batch->values[rcol][row];
+		}
+
+		fcinfo->isnull = false;
+		d = fn_addr(fcinfo);
+
+		/* sel[] is compacted in place; we never write ahead of reading */
+		if (!fcinfo->isnull && DatumGetBool(d))
+			sel[nvalid++] = row;
+	}
+
+	batch->nvalid = nvalid;
+}
+
+/*
+ * Filter the selected rows of a batch by comparing an int2, int4 or int8
+ * column with a constant, using a vectorized kernel.
+ */
+void
+ExecEvalBatchQualInt64(ExprState *state, ExprEvalStep *op, ExprContext *econtext)
+{
+#ifdef USE_FLOAT8_BYVAL
+	TupleBatch *batch = econtext->ecxt_batch;
+	int			col = op->d.batch_qual_const.col;
+
+	batch->nvalid = pg_batch_filter_int64(batch->values[col],
+										  batch->isnull[col],
+										  batch->sel, batch->nvalid,
+										  DatumGetInt64(op->d.batch_qual_const.constval),
+										  (BatchCmpOp) op->d.batch_qual_const.cmp);
+#else
+	elog(ERROR, "vectorized batch filters are not supported");
+#endif
+}
+
+/*
+ * Likewise for a float8 column.
+ */
+void
+ExecEvalBatchQualFloat8(ExprState *state, ExprEvalStep *op, ExprContext *econtext)
+{
+#ifdef USE_FLOAT8_BYVAL
+	TupleBatch *batch = econtext->ecxt_batch;
+	int			col = op->d.batch_qual_const.col;
+
+	batch->nvalid = pg_batch_filter_float8(batch->values[col],
+										   batch->isnull[col],
+										   batch->sel, batch->nvalid,
+										   DatumGetFloat8(op->d.batch_qual_const.constval),
+										   (BatchCmpOp) op->d.batch_qual_const.cmp);
+#else
+	elog(ERROR, "vectorized batch filters are not supported");
+#endif
+}
+
+/*
+ * Filter the selected rows of a batch with a qual that can't be evaluated
+ * over the batch as a whole, by evaluating it with each row in turn stored
+ * in a virtual slot as the scan tuple.
+ */
+void
+ExecEvalBatchQualRows(ExprState *state, ExprEvalStep *op, ExprContext *econtext)
+{
+	TupleBatch *batch = econtext->ecxt_batch;
+	ExprState  *qual = op->d.batch_qual_rows.qual;
+	TupleTableSlot *slot = op->d.batch_qual_rows.slot;
+	int			natts = op->d.batch_qual_rows.natts;
+	TupleTableSlot *save_scantuple = econtext->ecxt_scantuple;
+	uint16	   *sel = batch->sel;
+	int			nvalid = 0;
+
+	econtext->ecxt_scantuple = slot;
+
+	for (int i = 0; i < batch->nvalid; i++)
+	{
+		int			row = sel[i];
+
+		ExecClearTuple(slot);
+		for (int col = 0; col < natts; col++)
+		{
+			slot->tts_values[col] = batch->values[col][row];
+			slot->tts_isnull[col] = batch->isnull[col][row];
+		}
+		ExecStoreVirtualTuple(slot);
+
+		if (ExecQual(qual, econtext))
+			sel[nvalid++] = row;
+	}
+
+	econtext->ecxt_scantuple = save_scantuple;
+	batch->nvalid = nvalid;
+}
+
+/*
+ * Advance the transition value of a plain aggregate, computed without
+ * grouping sets, over all selected rows of a batch.  The aggregate has
+ * either no argument or a single one taken directly from a batch column.
+ *
+ * This combines the work of the EEOP_AGG_STRICT_INPUT_CHECK_ARGS and
+ * EEOP_AGG_PLAIN_TRANS_* steps for each row.
+ */
+static pg_attribute_always_inline void
+ExecEvalBatchAggTrans(ExprState *state, ExprEvalStep *op,
+					  ExprContext *econtext, bool byval)
+{
+	AggState   *aggstate = castNode(AggState, state->parent);
+	AggStatePerTrans pertrans = op->d.batch_agg_trans.pertrans;
+	ExprContext *aggcontext = op->d.batch_agg_trans.aggcontext;
+	AggStatePerGroup pergroup =
+	&aggstate->all_pergroups[0][op->d.batch_agg_trans.transno];
+	FunctionCallInfo fcinfo = pertrans->transfn_fcinfo;
+	bool		strict = fcinfo->flinfo->fn_strict;
+	TupleBatch *batch = econtext->ecxt_batch;
+	int			col = op->d.batch_agg_trans.col;
+
+	Assert(pertrans->transtypeByVal == byval);
+
+	for (int i = 0; i < batch->nvalid; i++)
+	{
+		int			row = batch->sel[i];
+
+		if (col >= 0)
+		{
+			fcinfo->args[1].value = batch->values[col][row];
+			fcinfo->args[1].isnull = batch->isnull[col][row];
+
+			/* a strict transfn keeps the prior transValue on NULL input */
+			if (strict && fcinfo->args[1].isnull)
+				continue;
+		}
+
+		if (strict)
+		{
+			if (pergroup->noTransValue)
+			{
+				/* first non-NULL input becomes the initial transValue */
+				ExecAggInitGroup(aggstate, pertrans, pergroup, aggcontext);
+				continue;
+			}
+			if (pergroup->transValueIsNull)
+				continue;
+		}
+
+		if (byval)
+			ExecAggPlainTransByVal(aggstate, pertrans, pergroup, aggcontext, 0);
+		else
+			ExecAggPlainTransByRef(aggstate, pertrans, pergroup, aggcontext, 0);
+	}
+}
+
+void
+ExecEvalBatchAggTransByVal(ExprState *state, ExprEvalStep *op,
+						   ExprContext *econtext)
+{
+	ExecEvalBatchAggTrans(state, op, econtext, true);
+}
+
+void
+ExecEvalBatchAggTransByRef(ExprState *state, ExprEvalStep *op,
+						   ExprContext *econtext)
+{
+	ExecEvalBatchAggTrans(state, op, econtext, false);
+}
+
+/*
+ * Advance a count(*) or count(column) aggregate over a batch; that's what
+ * the int8inc and int8inc_any transition functions would do.
+ */
+void
+ExecEvalBatchAggCount(ExprState *state, ExprEvalStep *op,
+					  ExprContext *econtext)
+{
+	AggState   *aggstate = castNode(AggState, state->parent);
+	AggStatePerGroup pergroup =
+	&aggstate->all_pergroups[0][op->d.batch_agg_trans.transno];
+	TupleBatch *batch = econtext->ecxt_batch;
+	int			col = op->d.batch_agg_trans.col;
+	int64		count = batch->nvalid;
+	int64		result;
+
+	if (col >= 0)
+	{
+		bool	   *isnull = batch->isnull[col];
+
+		for (int i = 0; i < batch->nvalid; i++)
+			count -= isnull[batch->sel[i]];
+	}
+
+	Assert(!pergroup->transValueIsNull);
+	if (unlikely(pg_add_s64_overflow(DatumGetInt64(pergroup->transValue),
+									 count, &result)))
+		ereport(ERROR,
+				(errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE),
+				 errmsg("bigint out of range")));
+	pergroup->transValue = Int64GetDatum(result);
+}
+
+/*
+ * Advance a sum() of int2 or int4 over a batch, using a vectorized kernel;
+ * that's what the int2_sum and int4_sum transition functions would do.
+ */
+void
+ExecEvalBatchAggSumInt64(ExprState *state, ExprEvalStep *op,
+						 ExprContext *econtext)
+{
+#ifdef USE_FLOAT8_BYVAL
+	AggState   *aggstate = castNode(AggState, state->parent);
+	AggStatePerGroup pergroup =
+	&aggstate->all_pergroups[0][op->d.batch_agg_trans.transno];
+	TupleBatch *batch = econtext->ecxt_batch;
+	int			col = op->d.batch_agg_trans.col;
+	int64		sum;
+
+	if (pg_batch_sum_int64(batch->values[col], batch->isnull[col],
+						   batch->sel, batch->nvalid, &sum) == 0)
+		return;
+
+	if (pergroup->transValueIsNull)
+	{
+		pergroup->transValue = Int64GetDatum(sum);
+		pergroup->transValueIsNull = false;
+	}
+	else
+		pergroup->transValue =
+			Int64GetDatum(DatumGetInt64(pergroup->transValue) + sum);
+#else
+	elog(ERROR, "vectorized batch aggregates are not supported");
+#endif
+}
+
+/*
+ * Advance a min() or max() of int2, int4 or int8 over a batch, using a
+ * vectorized kernel; that's what the int[248]smaller and int[248]larger
+ * transition functions would do.
+ */
+static pg_attribute_always_inline void
+ExecEvalBatchAggMinMaxInt64(ExprState *state, ExprEvalStep *op,
+							ExprContext *econtext, bool ismax)
+{
+#ifdef USE_FLOAT8_BYVAL
+	AggState   *aggstate = castNode(AggState, state->parent);
+	AggStatePerGroup pergroup =
+	&aggstate->all_pergroups[0][op->d.batch_agg_trans.transno];
+	TupleBatch *batch = econtext->ecxt_batch;
+	int			col = op->d.batch_agg_trans.col;
+	int64		min;
+	int64		max;
+	int64		value;
+
+	if (pg_batch_minmax_int64(batch->values[col], batch->isnull[col],
+							  batch->sel, batch->nvalid, &min, &max) == 0)
+		return;
+	value = ismax ? max : min;
+
+	/*
+	 * The datums of all the integer types are sign-extended, so the datum of
+	 * the 64-bit result is also that of the result in the column's type.
+	 */
+	if (pergroup->noTransValue)
+	{
+		/* first non-NULL input becomes the initial transValue */
+		pergroup->transValue = Int64GetDatum(value);
+		pergroup->transValueIsNull = false;
+		pergroup->noTransValue = false;
+	}
+	else if (!pergroup->transValueIsNull)
+	{
+		int64		current = DatumGetInt64(pergroup->transValue);
+
+		if (ismax ? value > current : value < current)
+			pergroup->transValue = Int64GetDatum(value);
+	}
+#else
+	elog(ERROR, "vectorized batch aggregates are not supported");
+#endif
+}
+
+void
+ExecEvalBatchAggMinInt64(ExprState *state, ExprEvalStep *op,
+						 ExprContext *econtext)
+{
+	ExecEvalBatchAggMinMaxInt64(state, op, econtext, false);
+}
+
+void
+ExecEvalBatchAggMaxInt64(ExprState *state, ExprEvalStep *op,
+						 ExprContext *econtext)
+{
+	ExecEvalBatchAggMinMaxInt64(state, op, econtext, true);
+}
@@ -53,6 +53,7 @@
 #include "jit/jit.h"
 #include "mb/pg_wchar.h"
 #include "miscadmin.h"
+#include "optimizer/cardfeedback.h"
 #include "parser/parsetree.h"
 #include "storage/bufmgr.h"
 #include "storage/lmgr.h"
@@ -485,6 +486,11 @@ standard_ExecutorEnd(QueryDesc *queryDesc)
 	Assert(estate->es_finished ||
 		   (estate->es_top_eflags & EXEC_FLAG_EXPLAIN_ONLY));
 
+	/* Let the planner learn from the row counts, if we collected them */
+	if ((estate->es_instrument & (INSTRUMENT_TIMER | INSTRUMENT_ROWS)) &&
+		!(estate->es_top_eflags & EXEC_FLAG_EXPLAIN_ONLY))
+		CardinalityFeedbackRecord(queryDesc->planstate);
+
 	/*
 	 * Switch into per-query memory context to run ExecEndPlan
 	 */
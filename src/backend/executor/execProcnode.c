@@ -478,7 +478,13 @@ ExecProcNodeInstr(PlanState *node)
 
 	result = node->ExecProcNodeReal(node);
 
-	InstrStopNode(node->instrument, TupIsNull(result) ? 0.0 : 1.0);
+	if (TupIsNull(result))
+	{
+		InstrStopNode(node->instrument, 0.0);
+		node->instrument->exhausted = true;
+	}
+	else
+		InstrStopNode(node->instrument, 1.0);
 
 	return result;
 }
@@ -811,6 +817,9 @@ ExecShutdownNode(PlanState *node)
 		case T_HashJoinState:
 			ExecShutdownHashJoin((HashJoinState *) node);
 			break;
+		case T_ResultCacheState:
+			ExecShutdownResultCache((ResultCacheState *) node);
+			break;
 		default:
 			break;
 	}
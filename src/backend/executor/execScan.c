@@ -19,6 +19,7 @@
 #include "postgres.h"
 
 #include "executor/executor.h"
+#include "executor/nodeHashjoin.h"
 #include "miscadmin.h"
 #include "utils/memutils.h"
 
@@ -162,6 +163,7 @@ ExecScan(ScanState *node,
 	ExprContext *econtext;
 	ExprState  *qual;
 	ProjectionInfo *projInfo;
+	HashJoinBloomFilter *bloomfilter;
 
 	/*
 	 * Fetch data from node
@@ -169,6 +171,7 @@ ExecScan(ScanState *node,
 	qual = node->ps.qual;
 	projInfo = node->ps.ps_ProjInfo;
 	econtext = node->ps.ps_ExprContext;
+	bloomfilter = node->ss_BloomFilter;
 
 	/* interrupt checks are in ExecScanFetch */
 
@@ -176,7 +179,7 @@ ExecScan(ScanState *node,
 	 * If we have neither a qual to check nor a projection to do, just skip
 	 * all the overhead and return the raw scan tuple.
 	 */
-	if (!qual && !projInfo)
+	if (!qual && !projInfo && !bloomfilter)
 	{
 		ResetExprContext(econtext);
 		return ExecScanFetch(node, accessMtd, recheckMtd);
@@ -226,6 +229,21 @@ ExecScan(ScanState *node,
 		 */
 		if (qual == NULL || ExecQual(qual, econtext))
 		{
+			/*
+			 * If a hash join above us has told us which rows can't find a
+			 * join partner, discard those.  This must wait until the quals
+			 * have passed the row: they may guard against errors in the
+			 * hash keys, or be security barrier quals that must be checked
+			 * before anything else sees the row.
+			 */
+			if (bloomfilter &&
+				!ExecHashJoinBloomFilterCheck(bloomfilter, econtext))
+			{
+				InstrCountFiltered3(node, 1);
+				ResetExprContext(econtext);
+				continue;
+			}
+
 			/*
 			 * Found a satisfactory scan tuple.
 			 */
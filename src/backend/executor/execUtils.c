@@ -268,6 +268,8 @@ CreateExprContextInternal(EState *estate, Size minContextSize,
 	econtext->domainValue_datum = (Datum) 0;
 	econtext->domainValue_isNull = true;
 
+	econtext->ecxt_batch = NULL;
+
 	econtext->ecxt_estate = estate;
 
 	econtext->ecxt_callbacks = NULL;
@@ -383,6 +385,8 @@ CreateStandaloneExprContext(void)
 	econtext->domainValue_datum = (Datum) 0;
 	econtext->domainValue_isNull = true;
 
+	econtext->ecxt_batch = NULL;
+
 	econtext->ecxt_estate = NULL;
 
 	econtext->ecxt_callbacks = NULL;
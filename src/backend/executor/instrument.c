@@ -155,6 +155,8 @@ InstrEndLoop(Instrumentation *instr)
 	instr->total += totaltime;
 	instr->ntuples += instr->tuplecount;
 	instr->nloops += 1;
+	if (instr->exhausted)
+		instr->ncompleted += 1;
 
 	/* Reset for next cycle (if any) */
 	instr->running = false;
@@ -162,6 +164,7 @@ InstrEndLoop(Instrumentation *instr)
 	INSTR_TIME_SET_ZERO(instr->counter);
 	instr->firsttuple = 0;
 	instr->tuplecount = 0;
+	instr->exhausted = false;
 }
 
 /* aggregate instrumentation information */
@@ -184,8 +187,10 @@ InstrAggNode(Instrumentation *dst, Instrumentation *add)
 	dst->ntuples += add->ntuples;
 	dst->ntuples2 += add->ntuples2;
 	dst->nloops += add->nloops;
+	dst->ncompleted += add->ncompleted;
 	dst->nfiltered1 += add->nfiltered1;
 	dst->nfiltered2 += add->nfiltered2;
+	dst->nfiltered3 += add->nfiltered3;
 
 	/* Add delta of buffer usage since entry to node's totals */
 	if (dst->need_bufusage)
@@ -256,6 +256,8 @@
 #include "optimizer/optimizer.h"
 #include "parser/parse_agg.h"
 #include "parser/parse_coerce.h"
+#include "pgstat.h"
+#include "storage/barrier.h"
 #include "utils/acl.h"
 #include "utils/builtins.h"
 #include "utils/datum.h"
@@ -264,6 +266,7 @@
 #include "utils/logtape.h"
 #include "utils/lsyscache.h"
 #include "utils/memutils.h"
+#include "utils/sharedtuplestore.h"
 #include "utils/syscache.h"
 #include "utils/tuplesort.h"
 
@@ -311,6 +314,21 @@
  */
 #define CHUNKHDRSZ 16
 
+/*
+ * A Parallel HashAgg splits its input among at least this many partitions
+ * per participant, so that the participants finish at about the same time
+ * even if the partitions come out uneven.  Each partition being written
+ * needs a shared tuplestore chunk plus a BufFile buffer.
+ */
+#define PAGG_PARTITIONS_PER_PARTICIPANT 4
+#define PAGG_WRITE_BUFFER_SIZE (5 * BLCKSZ)
+
+/*
+ * Phases of a Parallel HashAgg's build_barrier.
+ */
+#define PAGG_PHASE_PARTITIONING		0
+#define PAGG_PHASE_AGGREGATING		1
+
 /*
  * Track all tapes needed for a HashAgg that spills. We don't know the maximum
  * number of tapes needed at the start of the algorithm (because it can
@@ -367,10 +385,40 @@ typedef struct HashAggBatch
 	int			used_bits;		/* number of bits of hash already used */
 	LogicalTapeSet *tapeset;	/* borrowed reference to tape set */
 	int			input_tapenum;	/* input partition tape */
+	SharedTuplestoreAccessor *input_sts;	/* or shared input partition */
 	int64		input_tuples;	/* number of tuples in this batch */
 	double		input_card;		/* estimated group cardinality */
 } HashAggBatch;
 
+/*
+ * Shared state of a Parallel HashAgg.
+ *
+ * All participants first read their share of the input and write each tuple
+ * to one of npartitions shared tuplestores, chosen by the hash value of its
+ * grouping columns.  Once everyone is done, each participant claims whole
+ * partitions and aggregates them on its own, as if they were batches it had
+ * spilled itself.  Since every group lives in exactly one partition, the
+ * groups emitted by different participants never overlap, and there is no
+ * need for a Finalize Aggregate above the Gather.
+ *
+ * The SharedTuplestore of each partition follows this struct in memory,
+ * and then the SharedAggInfo, if instrumentation is enabled.
+ */
+typedef struct ParallelAggState
+{
+	Barrier		build_barrier;	/* synchronizes the end of partitioning */
+	int			nparticipants;
+	int			npartitions;
+	pg_atomic_uint32 next_partition;	/* next partition to aggregate */
+	SharedFileSet fileset;		/* space for the partition files */
+	Size		info_offset;	/* offset of SharedAggInfo, or 0 */
+} ParallelAggState;
+
+#define ParallelAggPartition(pstate, partno)						\
+	((SharedTuplestore *)											\
+	 ((char *) (pstate) + MAXALIGN(sizeof(ParallelAggState)) +		\
+	  MAXALIGN(sts_estimate((pstate)->nparticipants)) * (partno)))
+
 /* used to find referenced colnos */
 typedef struct FindColsContext
 {
@@ -432,8 +480,11 @@ static void initialize_hash_entry(AggState *aggstate,
 								  TupleHashEntry entry);
 static void lookup_hash_entries(AggState *aggstate);
 static TupleTableSlot *agg_retrieve_direct(AggState *aggstate);
+static TupleTableSlot *agg_retrieve_plain_batch(AggState *aggstate);
 static void agg_fill_hash_table(AggState *aggstate);
+static void agg_partition_input(AggState *aggstate);
 static bool agg_refill_hash_table(AggState *aggstate);
+static HashAggBatch *agg_claim_partition(AggState *aggstate);
 static TupleTableSlot *agg_retrieve_hash_table(AggState *aggstate);
 static TupleTableSlot *agg_retrieve_hash_table_in_memory(AggState *aggstate);
 static void hash_agg_check_limits(AggState *aggstate);
@@ -450,6 +501,8 @@ static MinimalTuple hashagg_batch_read(HashAggBatch *batch, uint32 *hashp);
 static void hashagg_spill_init(HashAggSpill *spill, HashTapeInfo *tapeinfo,
 							   int used_bits, double input_groups,
 							   double hashentrysize);
+static TupleTableSlot *hashagg_spill_slot(AggState *aggstate,
+										  TupleTableSlot *inputslot);
 static Size hashagg_spill_tuple(AggState *aggstate, HashAggSpill *spill,
 								TupleTableSlot *slot, uint32 hash);
 static void hashagg_spill_finish(AggState *aggstate, HashAggSpill *spill,
@@ -458,6 +511,11 @@ static void hashagg_tapeinfo_init(AggState *aggstate);
 static void hashagg_tapeinfo_assign(HashTapeInfo *tapeinfo, int *dest,
 									int ndest);
 static void hashagg_tapeinfo_release(HashTapeInfo *tapeinfo, int tapenum);
+static int	parallel_agg_choose_num_partitions(AggState *aggstate,
+											   int nparticipants);
+static Size parallel_agg_state_size(int nparticipants, int npartitions);
+static void parallel_agg_attach(AggState *aggstate, ParallelAggState *pstate,
+								int participant, bool initialize);
 static Datum GetAggInitVal(Datum textInitVal, Oid transtype);
 static void build_pertrans_for_aggref(AggStatePerTrans pertrans,
 									  AggState *aggstate, EState *estate,
@@ -2165,12 +2223,23 @@ ExecAgg(PlanState *pstate)
 		{
 			case AGG_HASHED:
 				if (!node->table_filled)
-					agg_fill_hash_table(node);
+				{
+					if (node->parallel_state != NULL)
+						agg_partition_input(node);
+					else
+						agg_fill_hash_table(node);
+				}
 				/* FALLTHROUGH */
 			case AGG_MIXED:
 				result = agg_retrieve_hash_table(node);
 				break;
 			case AGG_PLAIN:
+				if (node->batch_evaltrans)
+				{
+					result = agg_retrieve_plain_batch(node);
+					break;
+				}
+				/* FALLTHROUGH */
 			case AGG_SORTED:
 				result = agg_retrieve_direct(node);
 				break;
@@ -2529,6 +2598,59 @@ agg_retrieve_direct(AggState *aggstate)
 	return NULL;
 }
 
+/*
+ * ExecAgg for plain aggregation, reading the input in batches
+ *
+ * This is what agg_retrieve_direct() does for AGG_PLAIN without grouping
+ * sets, except that the transition values are advanced over a whole batch
+ * of input rows at a time, using batch_evaltrans.
+ */
+static TupleTableSlot *
+agg_retrieve_plain_batch(AggState *aggstate)
+{
+	ExprContext *econtext = aggstate->ss.ps.ps_ExprContext;
+	ExprContext *tmpcontext = aggstate->tmpcontext;
+	PlanState  *outerPlan = outerPlanState(aggstate);
+	AggStatePerGroup *pergroups = aggstate->pergroups;
+	TupleBatch *batch;
+
+	Assert(aggstate->phase->numsets == 0);
+
+	ReScanExprContext(econtext);
+	ReScanExprContext(aggstate->aggcontexts[0]);
+
+	initialize_aggregates(aggstate, pergroups, 1);
+
+	while ((batch = ExecProcNodeBatch(outerPlan)) != NULL)
+	{
+		bool		isnull;
+
+		tmpcontext->ecxt_batch = batch;
+		(void) ExecEvalExprSwitchContext(aggstate->batch_evaltrans,
+										 tmpcontext, &isnull);
+		tmpcontext->ecxt_batch = NULL;
+
+		/* Reset per-input-tuple context after each batch */
+		ResetExprContext(tmpcontext);
+	}
+
+	aggstate->agg_done = true;
+
+	/*
+	 * There can't be any references to non-aggregated input columns, so
+	 * just leave the representative input tuple empty.
+	 */
+	econtext->ecxt_outertuple = ExecClearTuple(aggstate->ss.ss_ScanTupleSlot);
+
+	prepare_projection_slot(aggstate, econtext->ecxt_outertuple, 0);
+
+	select_current_set(aggstate, 0, false);
+
+	finalize_aggregates(aggstate, aggstate->peragg, pergroups[0]);
+
+	return project_aggregates(aggstate);
+}
+
 /*
  * ExecAgg for hashed case: read input and build hash table
  */
@@ -2574,6 +2696,102 @@ agg_fill_hash_table(AggState *aggstate)
 						   &aggstate->perhash[0].hashiter);
 }
 
+/*
+ * ExecAgg for Parallel HashAgg: write our share of the input to the shared
+ * partitions, and wait for the other participants to do the same.
+ *
+ * The hash table is left empty, so agg_retrieve_hash_table() moves straight
+ * on to agg_refill_hash_table(), which claims the partitions one at a time.
+ */
+static void
+agg_partition_input(AggState *aggstate)
+{
+	ParallelAggState *pstate = aggstate->parallel_state;
+	AggStatePerHash perhash = &aggstate->perhash[0];
+	ExprContext *tmpcontext = aggstate->tmpcontext;
+
+	Assert(aggstate->num_hashes == 1);
+
+	/*
+	 * If we attach after the partitioning is done, there's nothing left for
+	 * us to contribute; just go aggregate what the others wrote.
+	 */
+	if (BarrierAttach(&pstate->build_barrier) == PAGG_PHASE_PARTITIONING)
+	{
+		for (;;)
+		{
+			TupleTableSlot *outerslot;
+			MinimalTuple tuple;
+			bool		shouldFree;
+			uint32		hash;
+			int			partno;
+
+			outerslot = fetch_input_tuple(aggstate);
+			if (TupIsNull(outerslot))
+				break;
+
+			prepare_hash_slot(perhash, outerslot, perhash->hashslot);
+			hash = TupleHashTableHash(perhash->hashtable, perhash->hashslot);
+
+			/*
+			 * Hash the hash, so that the bits used for recursive spilling
+			 * within a partition stay independent of the partition number.
+			 */
+			partno = murmurhash32(hash) % pstate->npartitions;
+
+			tuple = ExecFetchSlotMinimalTuple(hashagg_spill_slot(aggstate,
+																 outerslot),
+											  &shouldFree);
+			sts_puttuple(aggstate->hash_partitions[partno], &hash, tuple);
+			if (shouldFree)
+				pfree(tuple);
+
+			ResetExprContext(tmpcontext);
+		}
+
+		for (int i = 0; i < pstate->npartitions; i++)
+			sts_end_write(aggstate->hash_partitions[i]);
+
+		BarrierArriveAndWait(&pstate->build_barrier,
+							 WAIT_EVENT_HASH_AGG_PARTITION);
+	}
+	BarrierDetach(&pstate->build_barrier);
+
+	/*
+	 * The whole input went to disk, so the table can't be reused on rescan,
+	 * and the partitions are aggregated with the spill machinery.
+	 */
+	aggstate->hash_ever_spilled = true;
+	aggstate->table_filled = true;
+	select_current_set(aggstate, 0, true);
+	ResetTupleHashIterator(perhash->hashtable, &perhash->hashiter);
+}
+
+/*
+ * Claim the next unprocessed partition of a Parallel HashAgg, and turn it
+ * into a batch.  Returns NULL if there are none left.
+ */
+static HashAggBatch *
+agg_claim_partition(AggState *aggstate)
+{
+	ParallelAggState *pstate = aggstate->parallel_state;
+	HashAggBatch *batch;
+	uint32		partno;
+
+	partno = pg_atomic_fetch_add_u32(&pstate->next_partition, 1);
+	if (partno >= pstate->npartitions)
+		return NULL;
+
+	batch = hashagg_batch_new(NULL, -1, 0, 0,
+							  aggstate->perhash[0].aggnode->numGroups /
+							  pstate->npartitions, 0);
+	batch->input_sts = aggstate->hash_partitions[partno];
+	sts_begin_parallel_scan(batch->input_sts);
+	aggstate->hash_batches_used++;
+
+	return batch;
+}
+
 /*
  * If any data was spilled during hash aggregation, reset the hash table and
  * reprocess one batch of spilled data. After reprocessing a batch, the hash
@@ -2595,12 +2813,21 @@ agg_refill_hash_table(AggState *aggstate)
 	HashTapeInfo *tapeinfo = aggstate->hash_tapeinfo;
 	bool		spill_initialized = false;
 
-	if (aggstate->hash_batches == NIL)
+	if (aggstate->hash_batches != NIL)
+	{
+		batch = linitial(aggstate->hash_batches);
+		aggstate->hash_batches = list_delete_first(aggstate->hash_batches);
+	}
+	else if (aggstate->parallel_state != NULL)
+	{
+		/* our own spilled batches are done; take another shared partition */
+		batch = agg_claim_partition(aggstate);
+		if (batch == NULL)
+			return false;
+	}
+	else
 		return false;
 
-	batch = linitial(aggstate->hash_batches);
-	aggstate->hash_batches = list_delete_first(aggstate->hash_batches);
-
 	hash_agg_set_limits(aggstate->hashentrysize, batch->input_card,
 						batch->used_bits, &aggstate->hash_mem_limit,
 						&aggstate->hash_ngroups_limit, NULL);
@@ -2688,6 +2915,12 @@ agg_refill_hash_table(AggState *aggstate)
 				 * that we don't assign tapes that will never be used.
 				 */
 				spill_initialized = true;
+
+				/* a shared partition may be the first thing we spill */
+				if (aggstate->hash_tapeinfo == NULL)
+					hashagg_tapeinfo_init(aggstate);
+				tapeinfo = aggstate->hash_tapeinfo;
+
 				hashagg_spill_init(&spill, tapeinfo, batch->used_bits,
 								   batch->input_card, aggstate->hashentrysize);
 			}
@@ -2704,7 +2937,10 @@ agg_refill_hash_table(AggState *aggstate)
 		ResetExprContext(aggstate->tmpcontext);
 	}
 
-	hashagg_tapeinfo_release(tapeinfo, batch->input_tapenum);
+	if (batch->input_sts != NULL)
+		sts_end_parallel_scan(batch->input_sts);
+	else
+		hashagg_tapeinfo_release(tapeinfo, batch->input_tapenum);
 
 	/* change back to phase 0 */
 	aggstate->current_phase = 0;
@@ -2971,6 +3207,38 @@ hashagg_spill_init(HashAggSpill *spill, HashTapeInfo *tapeinfo, int used_bits,
 		initHyperLogLog(&spill->hll_card[i], HASHAGG_HLL_BIT_WIDTH);
 }
 
+/*
+ * hashagg_spill_slot
+ *
+ * Return a slot holding only the attributes of the input tuple that we
+ * actually need, to keep the spilled tuples small.
+ */
+static TupleTableSlot *
+hashagg_spill_slot(AggState *aggstate, TupleTableSlot *inputslot)
+{
+	TupleTableSlot *spillslot;
+
+	if (aggstate->all_cols_needed)
+		return inputslot;
+
+	spillslot = aggstate->hash_spill_wslot;
+	slot_getsomeattrs(inputslot, aggstate->max_colno_needed);
+	ExecClearTuple(spillslot);
+	for (int i = 0; i < spillslot->tts_tupleDescriptor->natts; i++)
+	{
+		if (bms_is_member(i + 1, aggstate->colnos_needed))
+		{
+			spillslot->tts_values[i] = inputslot->tts_values[i];
+			spillslot->tts_isnull[i] = inputslot->tts_isnull[i];
+		}
+		else
+			spillslot->tts_isnull[i] = true;
+	}
+	ExecStoreVirtualTuple(spillslot);
+
+	return spillslot;
+}
+
 /*
  * hashagg_spill_tuple
  *
@@ -2991,27 +3259,7 @@ hashagg_spill_tuple(AggState *aggstate, HashAggSpill *spill,
 
 	Assert(spill->partitions != NULL);
 
-	/* spill only attributes that we actually need */
-	if (!aggstate->all_cols_needed)
-	{
-		spillslot = aggstate->hash_spill_wslot;
-		slot_getsomeattrs(inputslot, aggstate->max_colno_needed);
-		ExecClearTuple(spillslot);
-		for (int i = 0; i < spillslot->tts_tupleDescriptor->natts; i++)
-		{
-			if (bms_is_member(i + 1, aggstate->colnos_needed))
-			{
-				spillslot->tts_values[i] = inputslot->tts_values[i];
-				spillslot->tts_isnull[i] = inputslot->tts_isnull[i];
-			}
-			else
-				spillslot->tts_isnull[i] = true;
-		}
-		ExecStoreVirtualTuple(spillslot);
-	}
-	else
-		spillslot = inputslot;
-
+	spillslot = hashagg_spill_slot(aggstate, inputslot);
 	tuple = ExecFetchSlotMinimalTuple(spillslot, &shouldFree);
 
 	partition = (hash & spill->mask) >> spill->shift;
@@ -3074,6 +3322,20 @@ hashagg_batch_read(HashAggBatch *batch, uint32 *hashp)
 	size_t		nread;
 	uint32		hash;
 
+	if (batch->input_sts != NULL)
+	{
+		/*
+		 * The tuple is only valid until the next read, but the caller takes
+		 * ownership of it.
+		 */
+		tuple = sts_parallel_scan_next(batch->input_sts, &hash);
+		if (tuple == NULL)
+			return NULL;
+		if (hashp != NULL)
+			*hashp = hash;
+		return heap_copy_minimal_tuple(tuple);
+	}
+
 	nread = LogicalTapeRead(tapeset, tapenum, &hash, sizeof(uint32));
 	if (nread == 0)
 		return NULL;
@@ -4032,6 +4294,23 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 		phase->evaltrans_cache[0][0] = phase->evaltrans;
 	}
 
+	/*
+	 * For plain aggregation, try to read the input in batches; see
+	 * agg_retrieve_plain_batch().
+	 */
+	if (batch_execution &&
+		aggstate->aggstrategy == AGG_PLAIN &&
+		node->groupingSets == NIL)
+	{
+		ExprState  *evaltrans;
+		int			natts;
+
+		evaltrans = ExecBuildAggTransBatch(aggstate, &natts);
+		if (evaltrans != NULL &&
+			ExecEnableBatchMode(outerPlanState(aggstate), natts))
+			aggstate->batch_evaltrans = evaltrans;
+	}
+
 	return aggstate;
 }
 
@@ -4753,20 +5032,38 @@ AggRegisterCallback(FunctionCallInfo fcinfo,
  /* ----------------------------------------------------------------
   *		ExecAggEstimate
   *
-  *		Estimate space required to propagate aggregate statistics.
+  *		Estimate space required to propagate aggregate statistics,
+  *		and for the shared state of a Parallel HashAgg.
   * ----------------------------------------------------------------
   */
 void
 ExecAggEstimate(AggState *node, ParallelContext *pcxt)
 {
-	Size		size;
+	Size		size = 0;
 
-	/* don't need this if not instrumenting or no workers */
-	if (!node->ss.ps.instrument || pcxt->nworkers == 0)
+	/* don't need this if no workers */
+	if (pcxt->nworkers == 0)
+		return;
+
+	if (node->ss.ps.instrument)
+	{
+		size = mul_size(pcxt->nworkers, sizeof(AggregateInstrumentation));
+		size = add_size(size, offsetof(SharedAggInfo, sinstrument));
+	}
+
+	if (node->ss.ps.plan->parallel_aware)
+	{
+		int			nparticipants = pcxt->nworkers + 1;
+
+		size = add_size(size,
+						parallel_agg_state_size(nparticipants,
+												parallel_agg_choose_num_partitions(node,
+																				   nparticipants)));
+	}
+
+	if (size == 0)
 		return;
 
-	size = mul_size(pcxt->nworkers, sizeof(AggregateInstrumentation));
-	size = add_size(size, offsetof(SharedAggInfo, sinstrument));
 	shm_toc_estimate_chunk(&pcxt->estimator, size);
 	shm_toc_estimate_keys(&pcxt->estimator, 1);
 }
@@ -4774,39 +5071,198 @@ ExecAggEstimate(AggState *node, ParallelContext *pcxt)
 /* ----------------------------------------------------------------
  *		ExecAggInitializeDSM
  *
- *		Initialize DSM space for aggregate statistics.
+ *		Initialize DSM space for aggregate statistics, and for the
+ *		shared state of a Parallel HashAgg.
  * ----------------------------------------------------------------
  */
 void
 ExecAggInitializeDSM(AggState *node, ParallelContext *pcxt)
 {
-	Size		size;
+	Size		info_size = 0;
+	ParallelAggState *pstate;
+	int			nparticipants;
+	int			npartitions;
+	Size		state_size;
 
-	/* don't need this if not instrumenting or no workers */
-	if (!node->ss.ps.instrument || pcxt->nworkers == 0)
+	/* don't need this if no workers */
+	if (pcxt->nworkers == 0)
 		return;
 
-	size = offsetof(SharedAggInfo, sinstrument)
-		+ pcxt->nworkers * sizeof(AggregateInstrumentation);
-	node->shared_info = shm_toc_allocate(pcxt->toc, size);
-	/* ensure any unfilled slots will contain zeroes */
-	memset(node->shared_info, 0, size);
-	node->shared_info->num_workers = pcxt->nworkers;
-	shm_toc_insert(pcxt->toc, node->ss.ps.plan->plan_node_id,
-				   node->shared_info);
+	if (node->ss.ps.instrument)
+		info_size = offsetof(SharedAggInfo, sinstrument)
+			+ pcxt->nworkers * sizeof(AggregateInstrumentation);
+
+	if (!node->ss.ps.plan->parallel_aware)
+	{
+		if (info_size == 0)
+			return;
+
+		node->shared_info = shm_toc_allocate(pcxt->toc, info_size);
+		/* ensure any unfilled slots will contain zeroes */
+		memset(node->shared_info, 0, info_size);
+		node->shared_info->num_workers = pcxt->nworkers;
+		shm_toc_insert(pcxt->toc, node->ss.ps.plan->plan_node_id,
+					   node->shared_info);
+		return;
+	}
+
+	nparticipants = pcxt->nworkers + 1;
+	npartitions = parallel_agg_choose_num_partitions(node, nparticipants);
+	state_size = parallel_agg_state_size(nparticipants, npartitions);
+
+	pstate = shm_toc_allocate(pcxt->toc, state_size + info_size);
+	/* the shared tuplestores and instrumentation must start out zeroed */
+	memset(pstate, 0, state_size + info_size);
+	BarrierInit(&pstate->build_barrier, 0);
+	pstate->nparticipants = nparticipants;
+	pstate->npartitions = npartitions;
+	pg_atomic_init_u32(&pstate->next_partition, 0);
+	SharedFileSetInit(&pstate->fileset, pcxt->seg);
+
+	if (info_size > 0)
+	{
+		pstate->info_offset = state_size;
+		node->shared_info = (SharedAggInfo *) ((char *) pstate + state_size);
+		node->shared_info->num_workers = pcxt->nworkers;
+	}
+
+	/* the leader is participant 0 */
+	parallel_agg_attach(node, pstate, 0, true);
+
+	shm_toc_insert(pcxt->toc, node->ss.ps.plan->plan_node_id, pstate);
+}
+
+/* ----------------------------------------------------------------
+ *		ExecAggReInitializeDSM
+ *
+ *		Reset shared state before beginning a fresh scan.
+ * ----------------------------------------------------------------
+ */
+void
+ExecAggReInitializeDSM(AggState *node, ParallelContext *pcxt)
+{
+	ParallelAggState *pstate = node->parallel_state;
+
+	if (pstate == NULL)
+		return;
+
+	/* throw away the partitions of the previous scan */
+	SharedFileSetDeleteAll(&pstate->fileset);
+
+	BarrierInit(&pstate->build_barrier, 0);
+	pg_atomic_write_u32(&pstate->next_partition, 0);
+	memset(ParallelAggPartition(pstate, 0), 0,
+		   MAXALIGN(sts_estimate(pstate->nparticipants)) * pstate->npartitions);
+	parallel_agg_attach(node, pstate, 0, true);
 }
 
 /* ----------------------------------------------------------------
  *		ExecAggInitializeWorker
  *
- *		Attach worker to DSM space for aggregate statistics.
+ *		Attach worker to DSM space for aggregate statistics, and for
+ *		the shared state of a Parallel HashAgg.
  * ----------------------------------------------------------------
  */
 void
 ExecAggInitializeWorker(AggState *node, ParallelWorkerContext *pwcxt)
 {
-	node->shared_info =
-		shm_toc_lookup(pwcxt->toc, node->ss.ps.plan->plan_node_id, true);
+	ParallelAggState *pstate;
+
+	if (!node->ss.ps.plan->parallel_aware)
+	{
+		node->shared_info =
+			shm_toc_lookup(pwcxt->toc, node->ss.ps.plan->plan_node_id, true);
+		return;
+	}
+
+	pstate = shm_toc_lookup(pwcxt->toc, node->ss.ps.plan->plan_node_id, false);
+	if (pstate->info_offset > 0)
+		node->shared_info =
+			(SharedAggInfo *) ((char *) pstate + pstate->info_offset);
+
+	SharedFileSetAttach(&pstate->fileset, pwcxt->seg);
+	parallel_agg_attach(node, pstate, ParallelWorkerNumber + 1, false);
+}
+
+/*
+ * Choose the number of partitions for a Parallel HashAgg.  Like
+ * hash_choose_num_partitions(), aim for partitions that fit in hash_mem,
+ * but make enough of them to keep all participants busy.
+ */
+static int
+parallel_agg_choose_num_partitions(AggState *aggstate, int nparticipants)
+{
+	double		input_groups = aggstate->perhash[0].aggnode->numGroups;
+	int			hash_mem = get_hash_mem();
+	double		mem_wanted;
+	double		npartitions;
+	double		partition_limit;
+
+	/*
+	 * Avoid creating so many partitions that the memory requirements of the
+	 * open partition files are greater than 1/4 of hash_mem.
+	 */
+	partition_limit = hash_mem * 1024.0 * 0.25 / PAGG_WRITE_BUFFER_SIZE;
+
+	mem_wanted = HASHAGG_PARTITION_FACTOR * input_groups *
+		aggstate->hashentrysize;
+	npartitions = 1 + mem_wanted / (hash_mem * 1024.0);
+	npartitions = Max(npartitions,
+					  (double) nparticipants * PAGG_PARTITIONS_PER_PARTICIPANT);
+
+	if (npartitions > partition_limit)
+		npartitions = partition_limit;
+	if (npartitions > HASHAGG_MAX_PARTITIONS)
+		npartitions = HASHAGG_MAX_PARTITIONS;
+	if (npartitions < 1)
+		npartitions = 1;
+
+	return (int) npartitions;
+}
+
+/*
+ * Space needed for the shared state of a Parallel HashAgg, not counting
+ * instrumentation.
+ */
+static Size
+parallel_agg_state_size(int nparticipants, int npartitions)
+{
+	return add_size(MAXALIGN(sizeof(ParallelAggState)),
+					mul_size(npartitions,
+							 MAXALIGN(sts_estimate(nparticipants))));
+}
+
+/*
+ * Set up our accessors for the shared partitions.  The leader initializes
+ * them, the workers attach to them.
+ */
+static void
+parallel_agg_attach(AggState *aggstate, ParallelAggState *pstate,
+					int participant, bool initialize)
+{
+	aggstate->parallel_state = pstate;
+	if (aggstate->hash_partitions == NULL)
+		aggstate->hash_partitions =
+			palloc(sizeof(SharedTuplestoreAccessor *) * pstate->npartitions);
+
+	for (int i = 0; i < pstate->npartitions; i++)
+	{
+		SharedTuplestore *sts = ParallelAggPartition(pstate, i);
+
+		if (initialize)
+		{
+			char		name[MAXPGPATH];
+
+			snprintf(name, sizeof(name), "p%d", i);
+			aggstate->hash_partitions[i] =
+				sts_initialize(sts, pstate->nparticipants, participant,
+							   sizeof(uint32), SHARED_TUPLESTORE_SINGLE_PASS,
+							   &pstate->fileset, name);
+		}
+		else
+			aggstate->hash_partitions[i] =
+				sts_attach(sts, participant, &pstate->fileset);
+	}
 }
 
 /* ----------------------------------------------------------------
@@ -479,6 +479,51 @@ ExecReScanAppend(AppendState *node)
 	node->as_begun = false;
 }
 
+/* ----------------------------------------------------------------
+ *		ExecAppendSupportsJoinPruning
+ *
+ *		Can ExecAppendSetJoinSubplans be used with this node?
+ *
+ *		The subplan indexes a join computes are the planner's, which
+ *		are only ours if initial pruning didn't remove any subplans.
+ *		Parallel-aware and asynchronous Appends choose subplans in
+ *		ways we don't try to restrict.
+ * ----------------------------------------------------------------
+ */
+bool
+ExecAppendSupportsJoinPruning(AppendState *node)
+{
+	if (node->ps.plan->parallel_aware || node->as_nasyncplans > 0)
+		return false;
+	if (node->as_prune_state && node->as_prune_state->do_initial_prune)
+		return false;
+	return true;
+}
+
+/* ----------------------------------------------------------------
+ *		ExecAppendSetJoinSubplans
+ *
+ *		Restrict the subplans to scan to those in 'subplans', on behalf
+ *		of a join above that knows the others can't produce any row it
+ *		needs; or lift such a restriction, if 'pruned' is false.  Takes
+ *		effect when the next scan starts, and lasts until changed.
+ * ----------------------------------------------------------------
+ */
+void
+ExecAppendSetJoinSubplans(AppendState *node, bool pruned,
+						  Bitmapset *subplans)
+{
+	Assert(ExecAppendSupportsJoinPruning(node));
+
+	bms_free(node->as_join_subplans);
+	node->as_join_pruned = pruned;
+	node->as_join_subplans = pruned ? bms_copy(subplans) : NULL;
+
+	/* make choose_next_subplan_locally() recompute the valid subplans */
+	bms_free(node->as_valid_subplans);
+	node->as_valid_subplans = NULL;
+}
+
 /* ----------------------------------------------------------------
  *						Parallel Append Support
  * ----------------------------------------------------------------
@@ -589,8 +634,19 @@ choose_next_subplan_locally(AppendState *node)
 			Assert(node->as_valid_subplans);
 		}
 		else if (node->as_valid_subplans == NULL)
-			node->as_valid_subplans =
-				ExecFindMatchingSubPlans(node->as_prune_state);
+		{
+			if (node->as_prune_state && node->as_prune_state->do_exec_prune)
+				node->as_valid_subplans =
+					ExecFindMatchingSubPlans(node->as_prune_state);
+			else
+				node->as_valid_subplans =
+					bms_add_range(NULL, 0, node->as_nplans - 1);
+
+			if (node->as_join_pruned)
+				node->as_valid_subplans =
+					bms_int_members(node->as_valid_subplans,
+									node->as_join_subplans);
+		}
 
 		whichplan = -1;
 	}
@@ -34,6 +34,7 @@
 #include "executor/hashjoin.h"
 #include "executor/nodeHash.h"
 #include "executor/nodeHashjoin.h"
+#include "lib/bloomfilter.h"
 #include "miscadmin.h"
 #include "pgstat.h"
 #include "port/atomics.h"
@@ -79,6 +80,8 @@ static bool ExecParallelHashTuplePrealloc(HashJoinTable hashtable,
 										  int batchno,
 										  size_t size);
 static void ExecParallelHashMergeCounters(HashJoinTable hashtable);
+static void ExecParallelHashMergeBloomFilter(HashJoinTable hashtable);
+static size_t ExecHashBloomFilterSpace(HashJoinTable hashtable);
 static void ExecParallelHashCloseBatchAccessors(HashJoinTable hashtable);
 
 
@@ -174,6 +177,13 @@ MultiExecPrivateHash(HashState *node)
 		{
 			int			bucketNumber;
 
+			if (hashtable->bloom)
+				bloom_add_element(hashtable->bloom, (unsigned char *) &hashvalue,
+								  sizeof(hashvalue));
+			if (node->partition_prune)
+				ExecHashJoinCollectPruneValue(node->partition_prune,
+											  hashtable, econtext);
+
 			bucketNumber = ExecHashGetSkewBucket(hashtable, hashvalue);
 			if (bucketNumber != INVALID_SKEW_BUCKET_NO)
 			{
@@ -287,7 +297,13 @@ MultiExecParallelHash(HashState *node)
 				if (ExecHashGetHashValue(hashtable, econtext, hashkeys,
 										 false, hashtable->keepNulls,
 										 &hashvalue))
+				{
+					if (hashtable->bloom)
+						bloom_add_element(hashtable->bloom,
+										  (unsigned char *) &hashvalue,
+										  sizeof(hashvalue));
 					ExecParallelHashTableInsert(hashtable, slot, hashvalue);
+				}
 				hashtable->partialTuples++;
 			}
 
@@ -303,6 +319,8 @@ MultiExecParallelHash(HashState *node)
 			 * to control the empty table optimization.
 			 */
 			ExecParallelHashMergeCounters(hashtable);
+			if (hashtable->bloom)
+				ExecParallelHashMergeBloomFilter(hashtable);
 
 			BarrierDetach(&pstate->grow_buckets_barrier);
 			BarrierDetach(&pstate->grow_batches_barrier);
@@ -335,6 +353,17 @@ MultiExecParallelHash(HashState *node)
 	hashtable->totalTuples = pstate->total_tuples;
 	ExecParallelHashEnsureBatchAccessors(hashtable);
 
+	/*
+	 * Everyone's Bloom filter has been merged into the shared one, which is
+	 * the one to use from now on.
+	 */
+	if (hashtable->bloom)
+	{
+		bloom_free(hashtable->bloom);
+		hashtable->bloom = DsaPointerIsValid(pstate->bloom) ?
+			dsa_get_address(hashtable->area, pstate->bloom) : NULL;
+	}
+
 	/*
 	 * The next synchronization point is in ExecHashJoin's HJ_BUILD_HASHTABLE
 	 * case, which will bring the build phase to PHJ_BUILD_DONE (if it isn't
@@ -513,6 +542,7 @@ ExecHashTableCreate(HashState *state, List *hashOperators, List *hashCollations,
 	hashtable->parallel_state = state->parallel_state;
 	hashtable->area = state->ps.state->es_query_dsa;
 	hashtable->batches = NULL;
+	hashtable->bloom = NULL;
 
 #ifdef HJDEBUG
 	printf("Hashjoin %p: initial nbatch = %d, nbuckets = %d\n",
@@ -563,6 +593,32 @@ ExecHashTableCreate(HashState *state, List *hashOperators, List *hashCollations,
 		i++;
 	}
 
+	/*
+	 * Our parent may want a Bloom filter of the hash values for its outer
+	 * scan.  In a Parallel Hash, every participant fills its own filter and
+	 * they are merged at the end of the build, so they must all be created
+	 * alike.
+	 */
+	if (state->build_bloom_filter)
+	{
+		long		bloom_kb = get_hash_mem() * BLOOM_HASH_MEM_PERCENT / 100;
+
+		if (state->parallel_state != NULL)
+			bloom_kb /= state->parallel_state->nparticipants + 1;
+
+		/*
+		 * bloom_create() won't go below the memory it's given, up to 1MB, so
+		 * don't give it more than it needs: four bytes per element, which is
+		 * still two once rounded down to a power of two.
+		 */
+		if (rows * 4 / 1024 < bloom_kb)
+			bloom_kb = (long) (rows * 4 / 1024) + 1;
+		hashtable->bloom = bloom_create((int64) rows,
+										(int) Max(bloom_kb, 1), 0);
+		hashtable->spaceUsed = ExecHashBloomFilterSpace(hashtable);
+		hashtable->spacePeak = hashtable->spaceUsed;
+	}
+
 	if (nbatch > 1 && hashtable->parallel_state == NULL)
 	{
 		/*
@@ -607,7 +663,8 @@ ExecHashTableCreate(HashState *state, List *hashOperators, List *hashCollations,
 			BarrierArriveAndWait(build_barrier, WAIT_EVENT_HASH_BUILD_ELECT))
 		{
 			pstate->nbatch = nbatch;
-			pstate->space_allowed = space_allowed;
+			pstate->space_allowed = space_allowed -
+				ExecHashBloomFilterSpace(hashtable);
 			pstate->growth = PHJ_GROWTH_OK;
 
 			/* Set up the shared state for coordinating batches. */
@@ -1104,7 +1161,8 @@ ExecParallelHashIncreaseNumBatches(HashJoinTable hashtable)
 					 * to switch from one large combined memory budget to the
 					 * regular hash_mem budget.
 					 */
-					pstate->space_allowed = hash_mem * 1024L;
+					pstate->space_allowed = hash_mem * 1024L -
+						ExecHashBloomFilterSpace(hashtable);
 
 					/*
 					 * The combined hash_mem of all participants wasn't
@@ -1425,6 +1483,50 @@ ExecParallelHashMergeCounters(HashJoinTable hashtable)
 	LWLockRelease(&pstate->lock);
 }
 
+/*
+ * Add the hash values this backend inserted to the shared Bloom filter.
+ */
+static void
+ExecParallelHashMergeBloomFilter(HashJoinTable hashtable)
+{
+	ParallelHashJoinState *pstate = hashtable->parallel_state;
+
+	LWLockAcquire(&pstate->lock, LW_EXCLUSIVE);
+	if (!DsaPointerIsValid(pstate->bloom))
+	{
+		/* first one here; our filter becomes the shared one */
+		size_t		size = bloom_size(hashtable->bloom);
+
+		pstate->bloom = dsa_allocate(hashtable->area, size);
+		memcpy(dsa_get_address(hashtable->area, pstate->bloom),
+			   hashtable->bloom, size);
+	}
+	else
+		bloom_union(dsa_get_address(hashtable->area, pstate->bloom),
+					hashtable->bloom);
+	LWLockRelease(&pstate->lock);
+}
+
+/*
+ * Space taken out of the hash table's budget for the Bloom filter, if any.
+ * In a Parallel Hash, that's the private filters of all participants as well
+ * as the shared copy, since they all exist at once during the build.
+ */
+static size_t
+ExecHashBloomFilterSpace(HashJoinTable hashtable)
+{
+	size_t		size;
+
+	if (hashtable->bloom == NULL)
+		return 0;
+
+	size = bloom_size(hashtable->bloom);
+	if (hashtable->parallel_state != NULL)
+		size *= hashtable->parallel_state->nparticipants + 1;
+
+	return size;
+}
+
 /*
  * ExecHashIncreaseNumBuckets
  *		increase the original number of buckets in order to reduce
@@ -2154,7 +2256,8 @@ ExecHashTableReset(HashJoinTable hashtable)
 	hashtable->buckets.unshared = (HashJoinTuple *)
 		palloc0(nbuckets * sizeof(HashJoinTuple));
 
-	hashtable->spaceUsed = 0;
+	/* the Bloom filter, if any, lives on across batches */
+	hashtable->spaceUsed = ExecHashBloomFilterSpace(hashtable);
 
 	MemoryContextSwitchTo(oldcxt);
 
@@ -2162,6 +2265,80 @@ ExecHashTableReset(HashJoinTable hashtable)
 	hashtable->chunks = NULL;
 }
 
+/*
+ * ExecHashTableCluster
+ *		Rearrange the tuples of a private, single-batch hash table so that
+ *		they are laid out in bucket order
+ *
+ * The tuples are copied into fresh chunks in the order of the bucket array,
+ * so that each bucket chain is contiguous in memory and adjacent buckets are
+ * adjacent in memory.  That makes the table cache-friendly for a probe that
+ * visits the buckets in roughly ascending order, as the radix-partitioned
+ * probe in nodeHashjoin.c does.
+ *
+ * The old and the new copy of the tuples coexist while we work, so we only
+ * do this if there's room for both within the memory budget.  Returns false,
+ * leaving the table untouched, if there isn't.
+ */
+bool
+ExecHashTableCluster(HashJoinTable hashtable)
+{
+	MemoryContext oldBatchCxt = hashtable->batchCxt;
+	MemoryContext oldcxt;
+	HashJoinTuple *oldbuckets = hashtable->buckets.unshared;
+	int			i;
+
+	Assert(hashtable->nbatch == 1);
+	Assert(hashtable->parallel_state == NULL);
+	Assert(!hashtable->skewEnabled);
+
+	if (hashtable->spaceUsed * 2 > hashtable->spaceAllowed)
+		return false;
+
+	hashtable->batchCxt = AllocSetContextCreate(hashtable->hashCxt,
+												"HashBatchContext",
+												ALLOCSET_DEFAULT_SIZES);
+	hashtable->chunks = NULL;
+
+	oldcxt = MemoryContextSwitchTo(hashtable->batchCxt);
+	hashtable->buckets.unshared = (HashJoinTuple *)
+		palloc(hashtable->nbuckets * sizeof(HashJoinTuple));
+	MemoryContextSwitchTo(oldcxt);
+
+	for (i = 0; i < hashtable->nbuckets; i++)
+	{
+		HashJoinTuple hashTuple = oldbuckets[i];
+		HashJoinTuple *tail = &hashtable->buckets.unshared[i];
+
+		/* copy the chain, preserving the order of its tuples */
+		while (hashTuple != NULL)
+		{
+			MinimalTuple tuple = HJTUPLE_MINTUPLE(hashTuple);
+			int			hashTupleSize = (HJTUPLE_OVERHEAD + tuple->t_len);
+			HashJoinTuple copyTuple;
+
+			copyTuple = (HashJoinTuple) dense_alloc(hashtable, hashTupleSize);
+			memcpy(copyTuple, hashTuple, hashTupleSize);
+
+			*tail = copyTuple;
+			tail = &copyTuple->next.unshared;
+			hashTuple = hashTuple->next.unshared;
+		}
+		*tail = NULL;
+
+		/* allow this loop to be cancellable */
+		CHECK_FOR_INTERRUPTS();
+	}
+
+	/* both copies were alive at the same time */
+	hashtable->spacePeak = Max(hashtable->spacePeak,
+							   hashtable->spaceUsed * 2);
+
+	MemoryContextDelete(oldBatchCxt);
+
+	return true;
+}
+
 /*
  * ExecHashTableResetMatchFlags
  *		Clear all the HeapTupleHeaderHasMatch flags in the table
@@ -3162,7 +3339,8 @@ ExecHashTableDetachBatch(HashJoinTable hashtable)
 		 */
 		hashtable->spacePeak =
 			Max(hashtable->spacePeak,
-				batch->size + sizeof(dsa_pointer_atomic) * hashtable->nbuckets);
+				batch->size + sizeof(dsa_pointer_atomic) * hashtable->nbuckets +
+				ExecHashBloomFilterSpace(hashtable));
 
 		/* Remember that we are not attached to a batch. */
 		hashtable->curbatch = -1;
@@ -3200,8 +3378,14 @@ ExecHashTableDetach(HashJoinTable hashtable)
 				dsa_free(hashtable->area, pstate->batches);
 				pstate->batches = InvalidDsaPointer;
 			}
+			if (DsaPointerIsValid(pstate->bloom))
+			{
+				dsa_free(hashtable->area, pstate->bloom);
+				pstate->bloom = InvalidDsaPointer;
+			}
 		}
 
+		hashtable->bloom = NULL;
 		hashtable->parallel_state = NULL;
 	}
 }
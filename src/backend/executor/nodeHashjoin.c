@@ -110,10 +110,20 @@
 #include "access/parallel.h"
 #include "executor/executor.h"
 #include "executor/hashjoin.h"
+#include "executor/execPartition.h"
+#include "executor/nodeAppend.h"
 #include "executor/nodeHash.h"
 #include "executor/nodeHashjoin.h"
+#include "lib/bloomfilter.h"
 #include "miscadmin.h"
+#include "nodes/nodeFuncs.h"
+#include "optimizer/clauses.h"
+#include "optimizer/optimizer.h"
+#include "parser/parsetree.h"
 #include "pgstat.h"
+#include "port/pg_bitutils.h"
+#include "utils/datum.h"
+#include "utils/lsyscache.h"
 #include "utils/memutils.h"
 #include "utils/sharedtuplestore.h"
 
@@ -133,6 +143,49 @@
 /* Returns true if doing null-fill on inner relation */
 #define HJ_FILL_INNER(hjstate)	((hjstate)->hj_NullOuterTupleSlot != NULL)
 
+/*
+ * A Bloom filter for the outer scan is only built if the outer input is
+ * expected to have at least BLOOM_FILTER_MIN_OUTER_ROWS rows.  Every
+ * BLOOM_FILTER_CHECK_ROWS rows, the filter is dropped if it hasn't discarded
+ * at least BLOOM_FILTER_MIN_REMOVED of the rows it checked, since for rows
+ * that pass it, computing their hash value is wasted effort.
+ */
+#define BLOOM_FILTER_MIN_OUTER_ROWS	1000
+#define BLOOM_FILTER_CHECK_ROWS		4096
+#define BLOOM_FILTER_MIN_REMOVED	0.1
+
+/*
+ * Radix-partitioned probing splits the hash table into partitions of about
+ * HJ_RADIX_CACHE_SIZE bytes, but into no more than HJ_RADIX_MAX_PARTITIONS
+ * of them.  Outer tuples are read in blocks of at most HJ_RADIX_BLOCK_TUPLES
+ * tuples (and work_mem bytes).  While probing, the bucket header of the
+ * outer tuple HJ_PREFETCH_DISTANCE * 2 tuples ahead, and the first tuple in
+ * the bucket of the one HJ_PREFETCH_DISTANCE tuples ahead, are prefetched.
+ */
+#define HJ_RADIX_CACHE_SIZE			(256 * 1024)
+#define HJ_RADIX_MAX_PARTITIONS		1024
+#define HJ_RADIX_BLOCK_TUPLES		65536
+#define HJ_PREFETCH_DISTANCE		8
+
+/*
+ * Partitions of the outer Append are pruned by the distinct values of an
+ * inner key only if there are at most HJ_PRUNE_MAX_VALUES of them; beyond
+ * that, pruning is likely to cost more than it saves.  The values are kept
+ * in an open-addressing hash set of twice that size.
+ */
+#define HJ_PRUNE_MAX_VALUES			1024
+#define HJ_PRUNE_SET_SIZE			(HJ_PRUNE_MAX_VALUES * 2)
+
+/* GUC parameters */
+bool		hashjoin_bloom_filter = true;
+bool		hashjoin_radix_partitioning = false;
+
+typedef struct bloom_hashkeys_context
+{
+	List	   *tlist;			/* the outer scan's targetlist */
+	bool		failed;			/* found a Var we couldn't translate */
+} bloom_hashkeys_context;
+
 static TupleTableSlot *ExecHashJoinOuterGetTuple(PlanState *outerNode,
 												 HashJoinState *hjstate,
 												 uint32 *hashvalue);
@@ -146,6 +199,20 @@ static TupleTableSlot *ExecHashJoinGetSavedTuple(HashJoinState *hjstate,
 static bool ExecHashJoinNewBatch(HashJoinState *hjstate);
 static bool ExecParallelHashJoinNewBatch(HashJoinState *hjstate);
 static void ExecParallelHashJoinPartitionOuter(HashJoinState *node);
+static HashJoinBloomFilter *ExecHashJoinInitBloomFilter(HashJoinState *hjstate);
+static Node *bloom_hashkeys_mutator(Node *node,
+									bloom_hashkeys_context *context);
+static void ExecHashJoinInstallBloomFilter(HashJoinState *hjstate);
+static void ExecHashJoinRemoveBloomFilter(HashJoinState *hjstate);
+static void ExecHashJoinInitRadixState(HashJoinState *hjstate);
+static bool ExecHashJoinRadixFillBlock(PlanState *outerNode,
+									   HashJoinState *hjstate);
+static TupleTableSlot *ExecHashJoinRadixGetTuple(PlanState *outerNode,
+												 HashJoinState *hjstate,
+												 uint32 *hashvalue);
+static HashJoinPartitionPrune *ExecHashJoinInitPartitionPrune(HashJoinState *hjstate);
+static void ExecHashJoinResetPruneValues(HashJoinPartitionPrune *prune);
+static void ExecHashJoinPruneOuter(HashJoinState *hjstate);
 
 
 /* ----------------------------------------------------------------
@@ -257,7 +324,8 @@ ExecHashJoinImpl(PlanState *pstate, bool parallel)
 				}
 				else if (HJ_FILL_OUTER(node) ||
 						 (outerNode->plan->startup_cost < hashNode->ps.plan->total_cost &&
-						  !node->hj_OuterNotEmpty))
+						  !node->hj_OuterNotEmpty &&
+						  node->hj_PartitionPrune == NULL))
 				{
 					node->hj_FirstOuterTupleSlot = ExecProcNode(outerNode);
 					if (TupIsNull(node->hj_FirstOuterTupleSlot))
@@ -288,6 +356,8 @@ ExecHashJoinImpl(PlanState *pstate, bool parallel)
 				 * arrived too late.
 				 */
 				hashNode->hashtable = hashtable;
+				if (node->hj_PartitionPrune != NULL)
+					ExecHashJoinResetPruneValues(node->hj_PartitionPrune);
 				(void) MultiExecProcNode((PlanState *) hashNode);
 
 				/*
@@ -298,6 +368,17 @@ ExecHashJoinImpl(PlanState *pstate, bool parallel)
 				if (hashtable->totalTuples == 0 && !HJ_FILL_OUTER(node))
 					return NULL;
 
+				/*
+				 * Now that we know what's in the hash table, let the outer
+				 * scan discard rows that can't find a match in it.
+				 */
+				if (node->hj_BloomFilter != NULL && hashtable->bloom != NULL)
+					ExecHashJoinInstallBloomFilter(node);
+
+				/* Likewise, skip the outer partitions that can't match */
+				if (node->hj_PartitionPrune != NULL)
+					ExecHashJoinPruneOuter(node);
+
 				/*
 				 * need to remember whether nbatch has increased since we
 				 * began scanning the outer relation
@@ -338,7 +419,15 @@ ExecHashJoinImpl(PlanState *pstate, bool parallel)
 					continue;
 				}
 				else
+				{
+					/*
+					 * Probe in cache-sized partitions, if the table is worth
+					 * partitioning.
+					 */
+					if (hashjoin_radix_partitioning)
+						ExecHashJoinInitRadixState(node);
 					node->hj_JoinState = HJ_NEED_NEW_OUTER;
+				}
 
 				/* FALL THRU */
 
@@ -351,6 +440,9 @@ ExecHashJoinImpl(PlanState *pstate, bool parallel)
 					outerTupleSlot =
 						ExecParallelHashJoinOuterGetTuple(outerNode, node,
 														  &hashvalue);
+				else if (node->hj_RadixState != NULL)
+					outerTupleSlot =
+						ExecHashJoinRadixGetTuple(outerNode, node, &hashvalue);
 				else
 					outerTupleSlot =
 						ExecHashJoinOuterGetTuple(outerNode, node, &hashvalue);
@@ -751,6 +843,17 @@ ExecInitHashJoin(HashJoin *node, EState *estate, int eflags)
 	hjstate->hj_JoinState = HJ_BUILD_HASHTABLE;
 	hjstate->hj_MatchedOuter = false;
 	hjstate->hj_OuterNotEmpty = false;
+	hjstate->hj_RadixState = NULL;
+
+	if (!(eflags & EXEC_FLAG_EXPLAIN_ONLY))
+		hjstate->hj_BloomFilter = ExecHashJoinInitBloomFilter(hjstate);
+	if (hjstate->hj_BloomFilter != NULL)
+		((HashState *) innerPlanState(hjstate))->build_bloom_filter = true;
+
+	if (!(eflags & EXEC_FLAG_EXPLAIN_ONLY))
+		hjstate->hj_PartitionPrune = ExecHashJoinInitPartitionPrune(hjstate);
+	((HashState *) innerPlanState(hjstate))->partition_prune =
+		hjstate->hj_PartitionPrune;
 
 	return hjstate;
 }
@@ -769,8 +872,11 @@ ExecEndHashJoin(HashJoinState *node)
 	 */
 	if (node->hj_HashTable)
 	{
+		ExecHashJoinRemoveBloomFilter(node);
 		ExecHashTableDestroy(node->hj_HashTable);
 		node->hj_HashTable = NULL;
+		/* the radix state lived in the hash table's memory */
+		node->hj_RadixState = NULL;
 	}
 
 	/*
@@ -1322,6 +1428,17 @@ ExecReScanHashJoin(HashJoinState *node)
 			 */
 			node->hj_OuterNotEmpty = false;
 
+			/* Forget any outer tuples read ahead for radix probing */
+			if (node->hj_RadixState != NULL)
+			{
+				HashJoinRadixState *radix = node->hj_RadixState;
+
+				MemoryContextReset(radix->blockCxt);
+				radix->ntuples = 0;
+				radix->next = 0;
+				radix->exhausted = false;
+			}
+
 			/* ExecHashJoin can skip the BUILD_HASHTABLE step */
 			node->hj_JoinState = HJ_NEED_NEW_OUTER;
 		}
@@ -1342,8 +1459,10 @@ ExecReScanHashJoin(HashJoinState *node)
 			/* for safety, be sure to clear child plan node's pointer too */
 			hashNode->hashtable = NULL;
 
+			ExecHashJoinRemoveBloomFilter(node);
 			ExecHashTableDestroy(node->hj_HashTable);
 			node->hj_HashTable = NULL;
+			node->hj_RadixState = NULL;
 			node->hj_JoinState = HJ_BUILD_HASHTABLE;
 
 			/*
@@ -1382,6 +1501,7 @@ ExecShutdownHashJoin(HashJoinState *node)
 		 * sure that we don't have any pointers into DSM memory by the time
 		 * ExecEndHashJoin runs.
 		 */
+		ExecHashJoinRemoveBloomFilter(node);
 		ExecHashTableDetachBatch(node->hj_HashTable);
 		ExecHashTableDetach(node->hj_HashTable);
 	}
@@ -1478,6 +1598,7 @@ ExecHashJoinInitializeDSM(HashJoinState *state, ParallelContext *pcxt)
 	pg_atomic_init_u32(&pstate->distributor, 0);
 	pstate->nparticipants = pcxt->nworkers + 1;
 	pstate->total_tuples = 0;
+	pstate->bloom = InvalidDsaPointer;
 	LWLockInitialize(&pstate->lock,
 					 LWTRANCHE_PARALLEL_HASH_JOIN);
 	BarrierInit(&pstate->build_barrier, 0);
@@ -1520,6 +1641,7 @@ ExecHashJoinReInitializeDSM(HashJoinState *state, ParallelContext *cxt)
 	/* Detach, freeing any remaining shared memory. */
 	if (state->hj_HashTable != NULL)
 	{
+		ExecHashJoinRemoveBloomFilter(state);
 		ExecHashTableDetachBatch(state->hj_HashTable);
 		ExecHashTableDetach(state->hj_HashTable);
 	}
@@ -1549,3 +1671,535 @@ ExecHashJoinInitializeWorker(HashJoinState *state,
 
 	ExecSetExecProcNode(&state->js.ps, ExecParallelHashJoin);
 }
+
+/*
+ * Set up a Bloom filter for the outer scan, if it looks worthwhile.
+ *
+ * The filter is only possible if the outer input is a relation scan that
+ * goes through ExecScan(), and if outer rows without a join partner are
+ * thrown away.  The outer hash keys refer to the scan's output, so we
+ * rewrite them in terms of its scan tuple to check rows before projection.
+ */
+static HashJoinBloomFilter *
+ExecHashJoinInitBloomFilter(HashJoinState *hjstate)
+{
+	HashJoin   *node = (HashJoin *) hjstate->js.ps.plan;
+	PlanState  *outerState = outerPlanState(hjstate);
+	HashJoinBloomFilter *filter;
+	bloom_hashkeys_context context;
+	List	   *hashkeys;
+
+	if (!hashjoin_bloom_filter)
+		return NULL;
+	if (node->join.jointype != JOIN_INNER &&
+		node->join.jointype != JOIN_SEMI &&
+		node->join.jointype != JOIN_RIGHT)
+		return NULL;
+	if (outerState->plan->plan_rows < BLOOM_FILTER_MIN_OUTER_ROWS)
+		return NULL;
+
+	switch (nodeTag(outerState))
+	{
+		case T_SeqScanState:
+		case T_IndexScanState:
+		case T_IndexOnlyScanState:
+		case T_BitmapHeapScanState:
+			break;
+		default:
+			return NULL;
+	}
+
+	context.tlist = outerState->plan->targetlist;
+	context.failed = false;
+	hashkeys = (List *) bloom_hashkeys_mutator((Node *) node->hashkeys,
+											   &context);
+
+	/*
+	 * The keys are evaluated again if the row passes, so they had better not
+	 * have side effects.
+	 */
+	if (context.failed ||
+		contain_volatile_functions((Node *) hashkeys) ||
+		contain_subplans((Node *) hashkeys))
+		return NULL;
+
+	filter = (HashJoinBloomFilter *) palloc0(sizeof(HashJoinBloomFilter));
+	filter->scan = (ScanState *) outerState;
+	filter->hashkeys = ExecInitExprList(hashkeys, outerState);
+
+	return filter;
+}
+
+/*
+ * Replace references to the outer plan's output with the expressions the
+ * outer scan computes them from.
+ */
+static Node *
+bloom_hashkeys_mutator(Node *node, bloom_hashkeys_context *context)
+{
+	if (node == NULL)
+		return NULL;
+	if (IsA(node, Var) && ((Var *) node)->varno == OUTER_VAR)
+	{
+		TargetEntry *tle = get_tle_by_resno(context->tlist,
+											((Var *) node)->varattno);
+
+		if (tle == NULL)
+		{
+			context->failed = true;
+			return node;
+		}
+		return (Node *) copyObject(tle->expr);
+	}
+	return expression_tree_mutator(node, bloom_hashkeys_mutator,
+								   (void *) context);
+}
+
+/*
+ * Hand the Bloom filter of the newly built hash table to the outer scan.
+ */
+static void
+ExecHashJoinInstallBloomFilter(HashJoinState *hjstate)
+{
+	HashJoinBloomFilter *filter = hjstate->hj_BloomFilter;
+
+	/* don't try again if it didn't pay off the last time */
+	if (filter->disabled)
+		return;
+
+	filter->hashtable = hjstate->hj_HashTable;
+	filter->scan->ss_BloomFilter = filter;
+}
+
+/*
+ * Take the Bloom filter away from the outer scan, before the hash table it
+ * lives in goes away.
+ */
+static void
+ExecHashJoinRemoveBloomFilter(HashJoinState *hjstate)
+{
+	HashJoinBloomFilter *filter = hjstate->hj_BloomFilter;
+
+	if (filter == NULL)
+		return;
+
+	filter->scan->ss_BloomFilter = NULL;
+	filter->hashtable = NULL;
+}
+
+/*
+ * ExecHashJoinBloomFilterCheck
+ *		Check the current scan tuple against a hash join's Bloom filter.
+ *
+ * Returns false if the row is sure not to find a join partner, true if it
+ * might.  The scan tuple must be in econtext->ecxt_scantuple.
+ */
+bool
+ExecHashJoinBloomFilterCheck(HashJoinBloomFilter *filter,
+							 ExprContext *econtext)
+{
+	HashJoinTable hashtable = filter->hashtable;
+	uint32		hashvalue = 0;
+	bool		result = true;
+	ListCell   *hk;
+	int			i = 0;
+	MemoryContext oldContext;
+
+	oldContext = MemoryContextSwitchTo(econtext->ecxt_per_tuple_memory);
+
+	/* this must compute the same hash value as ExecHashGetHashValue() */
+	foreach(hk, filter->hashkeys)
+	{
+		ExprState  *keyexpr = (ExprState *) lfirst(hk);
+		Datum		keyval;
+		bool		isNull;
+
+		/* rotate hashkey left 1 bit at each step */
+		hashvalue = (hashvalue << 1) | ((hashvalue & 0x80000000) ? 1 : 0);
+
+		keyval = ExecEvalExpr(keyexpr, econtext, &isNull);
+
+		if (isNull)
+		{
+			/* the join would reject the row as well */
+			if (hashtable->hashStrict[i])
+			{
+				result = false;
+				break;
+			}
+		}
+		else
+			hashvalue ^= DatumGetUInt32(FunctionCall1Coll(&hashtable->outer_hashfunctions[i],
+														  hashtable->collations[i],
+														  keyval));
+		i++;
+	}
+
+	MemoryContextSwitchTo(oldContext);
+
+	if (result)
+		result = !bloom_lacks_element(hashtable->bloom,
+									  (unsigned char *) &hashvalue,
+									  sizeof(hashvalue));
+
+	filter->nchecked++;
+	if (!result)
+		filter->nremoved++;
+
+	if (filter->nchecked % BLOOM_FILTER_CHECK_ROWS == 0 &&
+		filter->nremoved < filter->nchecked * BLOOM_FILTER_MIN_REMOVED)
+	{
+		filter->disabled = true;
+		filter->scan->ss_BloomFilter = NULL;
+	}
+
+	return result;
+}
+
+/*
+ * Set up radix-partitioned probing of a private hash table, if it's large
+ * enough to be worth it.  Only single-batch tables qualify, since the outer
+ * tuples of later batches come back from temp files in no useful order
+ * anyway.
+ */
+static void
+ExecHashJoinInitRadixState(HashJoinState *hjstate)
+{
+	HashJoinTable hashtable = hjstate->hj_HashTable;
+	HashJoinRadixState *radix;
+	MemoryContext oldcxt;
+	Size		npartitions;
+	int			log2_npartitions;
+
+	Assert(hjstate->hj_RadixState == NULL);
+	Assert(hashtable->parallel_state == NULL);
+
+	if (hashtable->nbatch != 1 || hashtable->skewEnabled)
+		return;
+
+	/* one partition for each HJ_RADIX_CACHE_SIZE bytes of the table */
+	npartitions = (hashtable->spaceUsed + HJ_RADIX_CACHE_SIZE - 1) /
+		HJ_RADIX_CACHE_SIZE;
+	npartitions = Min(npartitions, HJ_RADIX_MAX_PARTITIONS);
+	log2_npartitions = pg_ceil_log2_32((uint32) npartitions);
+	log2_npartitions = Min(log2_npartitions, hashtable->log2_nbuckets);
+
+	/* if the table fits in cache already, there's nothing to gain */
+	if (log2_npartitions < 1)
+		return;
+
+	/*
+	 * Lay the tuples out in bucket order, so that each partition is also a
+	 * contiguous range of memory.  If there's no memory to spare for that,
+	 * partitioning still confines each partition's probes to a narrower range
+	 * of bucket headers, so carry on regardless.
+	 */
+	(void) ExecHashTableCluster(hashtable);
+
+	/* allocate the state where it'll go away with the hash table */
+	oldcxt = MemoryContextSwitchTo(hashtable->hashCxt);
+	radix = (HashJoinRadixState *) palloc0(sizeof(HashJoinRadixState));
+	radix->log2_npartitions = log2_npartitions;
+	radix->blockCxt = AllocSetContextCreate(hashtable->hashCxt,
+											"HashJoinRadixBlock",
+											ALLOCSET_DEFAULT_SIZES);
+	radix->counts = (int *) palloc(((1 << log2_npartitions) + 1) * sizeof(int));
+	MemoryContextSwitchTo(oldcxt);
+
+	hjstate->hj_RadixState = radix;
+}
+
+/*
+ * Read the next block of outer tuples, and sort them by partition.
+ *
+ * Returns false if the outer relation had no more tuples to give.
+ */
+static bool
+ExecHashJoinRadixFillBlock(PlanState *outerNode, HashJoinState *hjstate)
+{
+	HashJoinTable hashtable = hjstate->hj_HashTable;
+	HashJoinRadixState *radix = hjstate->hj_RadixState;
+	int			npartitions = 1 << radix->log2_npartitions;
+	int			shift = hashtable->log2_nbuckets - radix->log2_npartitions;
+	uint32		bucketmask = hashtable->nbuckets - 1;
+	int		   *counts = radix->counts;
+	int			ntuples = 0;
+	MemoryContext oldcxt;
+	int			i;
+
+	MemoryContextReset(radix->blockCxt);
+	radix->ntuples = 0;
+	radix->next = 0;
+
+	while (ntuples < HJ_RADIX_BLOCK_TUPLES &&
+		   MemoryContextMemAllocated(radix->blockCxt, false) < work_mem * 1024L)
+	{
+		TupleTableSlot *slot;
+		uint32		hashvalue;
+
+		slot = ExecHashJoinOuterGetTuple(outerNode, hjstate, &hashvalue);
+		if (TupIsNull(slot))
+		{
+			radix->exhausted = true;
+			break;
+		}
+
+		/* make room for more tuples, if needed */
+		if (ntuples >= radix->maxtuples)
+		{
+			int			newmax = Min(Max(radix->maxtuples * 2, 1024),
+									 HJ_RADIX_BLOCK_TUPLES);
+
+			oldcxt = MemoryContextSwitchTo(hashtable->hashCxt);
+			if (radix->tuples == NULL)
+			{
+				radix->tuples = (MinimalTuple *)
+					palloc(newmax * sizeof(MinimalTuple));
+				radix->hashvalues = (uint32 *) palloc(newmax * sizeof(uint32));
+				radix->order = (int *) palloc(newmax * sizeof(int));
+			}
+			else
+			{
+				radix->tuples = (MinimalTuple *)
+					repalloc(radix->tuples, newmax * sizeof(MinimalTuple));
+				radix->hashvalues = (uint32 *)
+					repalloc(radix->hashvalues, newmax * sizeof(uint32));
+				radix->order = (int *)
+					repalloc(radix->order, newmax * sizeof(int));
+			}
+			radix->maxtuples = newmax;
+			MemoryContextSwitchTo(oldcxt);
+		}
+
+		oldcxt = MemoryContextSwitchTo(radix->blockCxt);
+		radix->tuples[ntuples] = ExecCopySlotMinimalTuple(slot);
+		MemoryContextSwitchTo(oldcxt);
+		radix->hashvalues[ntuples] = hashvalue;
+		ntuples++;
+	}
+
+	if (ntuples == 0)
+		return false;
+
+	/*
+	 * Counting sort by partition.  It's stable, so tuples of the same
+	 * partition are probed in the order they arrived.
+	 */
+	memset(counts, 0, (npartitions + 1) * sizeof(int));
+	for (i = 0; i < ntuples; i++)
+		counts[((radix->hashvalues[i] & bucketmask) >> shift) + 1]++;
+	for (i = 1; i <= npartitions; i++)
+		counts[i] += counts[i - 1];
+	for (i = 0; i < ntuples; i++)
+		radix->order[counts[(radix->hashvalues[i] & bucketmask) >> shift]++] = i;
+
+	radix->ntuples = ntuples;
+
+	return true;
+}
+
+/*
+ * ExecHashJoinOuterGetTuple variant for radix-partitioned probing.
+ *
+ * Returns the outer tuples of the current block in partition order, reading
+ * a new block when the current one runs out.
+ */
+static TupleTableSlot *
+ExecHashJoinRadixGetTuple(PlanState *outerNode,
+						  HashJoinState *hjstate,
+						  uint32 *hashvalue)
+{
+	HashJoinTable hashtable = hjstate->hj_HashTable;
+	HashJoinRadixState *radix = hjstate->hj_RadixState;
+	uint32		bucketmask = hashtable->nbuckets - 1;
+	int			i;
+
+	if (radix->next >= radix->ntuples)
+	{
+		if (radix->exhausted ||
+			!ExecHashJoinRadixFillBlock(outerNode, hjstate))
+			return NULL;
+	}
+
+	/*
+	 * Start loading the bucket headers, and then the first tuple of the
+	 * buckets, that upcoming probes will need.
+	 */
+	i = radix->next + 2 * HJ_PREFETCH_DISTANCE;
+	if (i < radix->ntuples)
+		pg_prefetch_mem(&hashtable->buckets.unshared[radix->hashvalues[radix->order[i]] & bucketmask]);
+	i = radix->next + HJ_PREFETCH_DISTANCE;
+	if (i < radix->ntuples)
+		pg_prefetch_mem(hashtable->buckets.unshared[radix->hashvalues[radix->order[i]] & bucketmask]);
+
+	i = radix->order[radix->next++];
+	*hashvalue = radix->hashvalues[i];
+	ExecForceStoreMinimalTuple(radix->tuples[i], hjstate->hj_OuterTupleSlot,
+							   false);
+
+	return hjstate->hj_OuterTupleSlot;
+}
+
+/*
+ * Set up pruning of the outer Append's subplans by the values of an inner
+ * key, if the planner found that possible.
+ *
+ * The Hash node collects the distinct values while building the hash table
+ * (see ExecHashJoinCollectPruneValue), which must therefore see all inner
+ * rows; the planner doesn't ask for this in a Parallel Hash Join.
+ */
+static HashJoinPartitionPrune *
+ExecHashJoinInitPartitionPrune(HashJoinState *hjstate)
+{
+	HashJoin   *node = (HashJoin *) hjstate->js.ps.plan;
+	PlanState  *outerState = outerPlanState(hjstate);
+	HashState  *hashState = (HashState *) innerPlanState(hjstate);
+	HashJoinPartitionPrune *prune;
+	Expr	   *keyexpr;
+
+	if (node->part_prune_info == NULL)
+		return NULL;
+
+	/* setrefs.c may have replaced a single-child Append by its child */
+	if (!IsA(outerState, AppendState) ||
+		!ExecAppendSupportsJoinPruning((AppendState *) outerState))
+		return NULL;
+
+	prune = (HashJoinPartitionPrune *) palloc0(sizeof(HashJoinPartitionPrune));
+	prune->append = (AppendState *) outerState;
+	prune->prunestate = ExecCreatePartitionPruneState(&hjstate->js.ps,
+													  node->part_prune_info);
+	if (!prune->prunestate->do_exec_prune)
+		return NULL;
+
+	prune->keyno = node->part_prune_keyno;
+	prune->keyexpr = (ExprState *) list_nth(hashState->hashkeys, prune->keyno);
+	keyexpr = (Expr *) list_nth(((Hash *) hashState->ps.plan)->hashkeys,
+								prune->keyno);
+	get_typlenbyval(exprType((Node *) keyexpr), &prune->typlen,
+					&prune->typbyval);
+	prune->paramid = node->part_prune_paramid;
+	prune->valuecxt = AllocSetContextCreate(CurrentMemoryContext,
+											"HashJoin partition pruning",
+											ALLOCSET_DEFAULT_SIZES);
+
+	return prune;
+}
+
+/*
+ * Forget the values collected for the previous hash table.
+ */
+static void
+ExecHashJoinResetPruneValues(HashJoinPartitionPrune *prune)
+{
+	MemoryContextReset(prune->valuecxt);
+	prune->values = (HashJoinPruneValue *)
+		MemoryContextAllocZero(prune->valuecxt,
+							   HJ_PRUNE_SET_SIZE * sizeof(HashJoinPruneValue));
+	prune->nvalues = 0;
+	prune->overflowed = false;
+}
+
+/*
+ * ExecHashJoinCollectPruneValue
+ *		Remember the value of the pruning key of the inner tuple being
+ *		hashed, if we haven't seen it yet.
+ *
+ * The Hash node calls this for every inner tuple it puts in the hash table,
+ * with the tuple in econtext->ecxt_outertuple.
+ */
+void
+ExecHashJoinCollectPruneValue(HashJoinPartitionPrune *prune,
+							  HashJoinTable hashtable,
+							  ExprContext *econtext)
+{
+	Datum		value;
+	bool		isnull;
+	uint32		hash;
+	int			i;
+	MemoryContext oldContext;
+
+	if (prune->overflowed)
+		return;
+
+	oldContext = MemoryContextSwitchTo(econtext->ecxt_per_tuple_memory);
+	value = ExecEvalExpr(prune->keyexpr, econtext, &isnull);
+	if (!isnull)
+		hash = DatumGetUInt32(FunctionCall1Coll(&hashtable->inner_hashfunctions[prune->keyno],
+												hashtable->collations[prune->keyno],
+												value));
+	MemoryContextSwitchTo(oldContext);
+
+	/* a null key can't match any outer row */
+	if (isnull)
+		return;
+
+	/*
+	 * Values that are equal but not binary-equal are kept separately, which
+	 * costs a little pruning work but doesn't lose any partitions.
+	 */
+	for (i = hash % HJ_PRUNE_SET_SIZE;;
+		 i = (i + 1) % HJ_PRUNE_SET_SIZE)
+	{
+		HashJoinPruneValue *entry = &prune->values[i];
+
+		if (!entry->used)
+			break;
+		if (entry->hash == hash &&
+			datumIsEqual(entry->value, value, prune->typbyval, prune->typlen))
+			return;
+	}
+
+	if (prune->nvalues >= HJ_PRUNE_MAX_VALUES)
+	{
+		prune->overflowed = true;
+		return;
+	}
+
+	oldContext = MemoryContextSwitchTo(prune->valuecxt);
+	prune->values[i].value = datumCopy(value, prune->typbyval, prune->typlen);
+	MemoryContextSwitchTo(oldContext);
+	prune->values[i].hash = hash;
+	prune->values[i].used = true;
+	prune->nvalues++;
+}
+
+/*
+ * Restrict the outer Append to the subplans that may hold rows matching one
+ * of the inner key values collected while building the hash table, or scan
+ * them all if there were too many values.
+ */
+static void
+ExecHashJoinPruneOuter(HashJoinState *hjstate)
+{
+	HashJoinPartitionPrune *prune = hjstate->hj_PartitionPrune;
+	ParamExecData *prm;
+	Bitmapset  *subplans = NULL;
+	int			i;
+
+	if (prune->overflowed)
+	{
+		ExecAppendSetJoinSubplans(prune->append, false, NULL);
+		return;
+	}
+
+	prm = &hjstate->js.ps.state->es_param_exec_vals[prune->paramid];
+	for (i = 0; i < HJ_PRUNE_SET_SIZE; i++)
+	{
+		Bitmapset  *matching;
+
+		if (!prune->values[i].used)
+			continue;
+
+		prm->execPlan = NULL;
+		prm->value = prune->values[i].value;
+		prm->isnull = false;
+
+		matching = ExecFindMatchingSubPlans(prune->prunestate);
+		subplans = bms_add_members(subplans, matching);
+		bms_free(matching);
+	}
+
+	ExecAppendSetJoinSubplans(prune->append, true, subplans);
+	bms_free(subplans);
+}
@@ -774,6 +774,48 @@ ExecIndexAdvanceArrayKeys(IndexArrayKeyInfo *arrayKeys, int numArrayKeys)
 	return found;
 }
 
+/*
+ * ExecIndexAddLeadingScanKeys
+ *		Make room for 'nkeys' scan keys on the first index column, in front of
+ *		the scan keys built by ExecIndexBuildScanKeys.
+ *
+ * Returns the new keys, zeroed; the caller fills them in before the scan is
+ * started or rescanned.  This lets a parent node restrict the scan to a range
+ * of the leading column, as a parallel-aware merge join does.  It must be
+ * called before the scan is begun, since index_beginscan fixes the number of
+ * scan keys.
+ */
+ScanKey
+ExecIndexAddLeadingScanKeys(ScanKey *scanKeys, int *numScanKeys,
+							IndexRuntimeKeyInfo *runtimeKeys, int numRuntimeKeys,
+							int nkeys)
+{
+	ScanKey		oldkeys = *scanKeys;
+	ScanKey		newkeys;
+	int			j;
+
+	newkeys = (ScanKey) palloc0((*numScanKeys + nkeys) * sizeof(ScanKeyData));
+	if (*numScanKeys > 0)
+		memcpy(newkeys + nkeys, oldkeys, *numScanKeys * sizeof(ScanKeyData));
+
+	/*
+	 * Runtime keys point into the array we just replaced, unless they are
+	 * subsidiary keys of a row comparison, which live elsewhere.
+	 */
+	for (j = 0; j < numRuntimeKeys; j++)
+	{
+		ScanKey		scan_key = runtimeKeys[j].scan_key;
+
+		if (scan_key >= oldkeys && scan_key < oldkeys + *numScanKeys)
+			runtimeKeys[j].scan_key = newkeys + nkeys + (scan_key - oldkeys);
+	}
+
+	*scanKeys = newkeys;
+	*numScanKeys += nkeys;
+
+	return newkeys;
+}
+
 
 /* ----------------------------------------------------------------
  *		ExecEndIndexScan
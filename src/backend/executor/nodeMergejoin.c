@@ -17,6 +17,10 @@
  *		ExecMergeJoin			mergejoin outer and inner relations.
  *		ExecInitMergeJoin		creates and initializes run time states
  *		ExecEndMergeJoin		cleans up the node.
+ *		ExecMergeJoinEstimate	estimates DSM space for a parallel-aware join
+ *		ExecMergeJoinInitializeDSM initializes DSM for a parallel-aware join
+ *		ExecMergeJoinReInitializeDSM reinitializes DSM for a fresh scan
+ *		ExecMergeJoinInitializeWorker attaches to DSM in a parallel worker
  *
  * NOTES
  *
@@ -89,15 +93,29 @@
  *		proceed to another state.  This state is stored in the node's
  *		execution state information and is preserved across calls to
  *		ExecMergeJoin. -cim 10/31/89
+ *
+ *
+ *		A parallel-aware merge join reads both inputs through btree index
+ *		scans whose first column is the leading merge key.  The planner
+ *		splits that key into ranges, and each participant claims ranges
+ *		from a shared counter.  For each claimed range, both index scans
+ *		are restarted with scan keys restricting them to the range, and
+ *		the ordinary merge join runs on the restricted inputs.  Since
+ *		joined tuples have equal keys, every join result is produced by
+ *		exactly one range.  Tuples with a null key fall in no range, so
+ *		this is only done for inner joins and semijoins.
  */
 #include "postgres.h"
 
 #include "access/nbtree.h"
 #include "executor/execdebug.h"
+#include "executor/nodeIndexscan.h"
 #include "executor/nodeMergejoin.h"
 #include "miscadmin.h"
+#include "port/atomics.h"
 #include "utils/lsyscache.h"
 #include "utils/memutils.h"
+#include "utils/rel.h"
 
 
 /*
@@ -152,6 +170,32 @@ typedef enum
 #define MarkInnerTuple(innerTupleSlot, mergestate) \
 	ExecCopySlot((mergestate)->mj_MarkedTupleSlot, (innerTupleSlot))
 
+/*
+ * Shared state of a parallel-aware merge join
+ */
+typedef struct ParallelMergeJoinState
+{
+	pg_atomic_uint32 next_range;	/* next key range to claim */
+} ParallelMergeJoinState;
+
+/*
+ * Runtime data for restricting the inputs of a parallel-aware merge join to
+ * one key range at a time.  Range i covers the keys from boundary i - 1
+ * (inclusive) to boundary i (exclusive); the first and last ranges are open
+ * at one end.  Index 0 of the arrays is for the outer input, 1 for the inner.
+ */
+typedef struct MergeJoinRangeStateData
+{
+	int			nbounds;		/* number of boundaries */
+	Datum	   *bounds;			/* boundaries, in ascending order */
+	ScanKey		keys[2];		/* the two leading scan keys of each input */
+	ScanKeyData geKeys[2];		/* template "key >= boundary" keys */
+	ScanKeyData ltKeys[2];		/* template "key < boundary" keys */
+	ParallelMergeJoinState *pstate; /* shared state, or NULL if none */
+	uint32		nextLocal;		/* next range to claim, if no shared state */
+	bool		inRange;		/* joining a claimed range? */
+}			MergeJoinRangeStateData;
+
 
 /*
  * MJExamineQuals
@@ -1428,6 +1472,188 @@ ExecMergeJoin(PlanState *pstate)
 	}
 }
 
+/*
+ * MJInitRanges
+ *
+ * Set up the key ranges of a parallel-aware merge join: add two scan keys on
+ * the leading index column to each input, and prepare the comparisons with
+ * the range boundaries.
+ */
+static MergeJoinRangeState
+MJInitRanges(MergeJoinState *mergestate, MergeJoin *node)
+{
+	MergeJoinRangeState rs;
+	Oid			boundtype = linitial_node(Const, node->rangeBounds)->consttype;
+	ListCell   *lc;
+	int			i;
+
+	rs = (MergeJoinRangeState) palloc0(sizeof(MergeJoinRangeStateData));
+	rs->nbounds = list_length(node->rangeBounds);
+	rs->bounds = (Datum *) palloc(rs->nbounds * sizeof(Datum));
+	i = 0;
+	foreach(lc, node->rangeBounds)
+		rs->bounds[i++] = lfirst_node(Const, lc)->constvalue;
+
+	for (i = 0; i < 2; i++)
+	{
+		PlanState  *child = (i == 0) ? outerPlanState(mergestate) :
+		innerPlanState(mergestate);
+		Relation	indexRel;
+		Oid			geop;
+		Oid			ltop;
+
+		if (IsA(child, IndexScanState))
+		{
+			IndexScanState *iss = (IndexScanState *) child;
+
+			indexRel = iss->iss_RelationDesc;
+			rs->keys[i] = ExecIndexAddLeadingScanKeys(&iss->iss_ScanKeys,
+													  &iss->iss_NumScanKeys,
+													  iss->iss_RuntimeKeys,
+													  iss->iss_NumRuntimeKeys,
+													  2);
+		}
+		else if (IsA(child, IndexOnlyScanState))
+		{
+			IndexOnlyScanState *ioss = (IndexOnlyScanState *) child;
+
+			indexRel = ioss->ioss_RelationDesc;
+			rs->keys[i] = ExecIndexAddLeadingScanKeys(&ioss->ioss_ScanKeys,
+													  &ioss->ioss_NumScanKeys,
+													  ioss->ioss_RuntimeKeys,
+													  ioss->ioss_NumRuntimeKeys,
+													  2);
+		}
+		else
+			elog(ERROR, "unexpected input node type in parallel-aware merge join: %d",
+				 (int) nodeTag(child));
+
+		geop = get_opfamily_member(node->rangeFamily,
+								   indexRel->rd_opcintype[0], boundtype,
+								   BTGreaterEqualStrategyNumber);
+		ltop = get_opfamily_member(node->rangeFamily,
+								   indexRel->rd_opcintype[0], boundtype,
+								   BTLessStrategyNumber);
+		if (!OidIsValid(geop) || !OidIsValid(ltop))
+			elog(ERROR, "missing operator(%u,%u) in opfamily %u",
+				 indexRel->rd_opcintype[0], boundtype, node->rangeFamily);
+
+		ScanKeyEntryInitialize(&rs->geKeys[i], 0, 1,
+							   BTGreaterEqualStrategyNumber, boundtype,
+							   node->rangeCollation, get_opcode(geop),
+							   (Datum) 0);
+		ScanKeyEntryInitialize(&rs->ltKeys[i], 0, 1,
+							   BTLessStrategyNumber, boundtype,
+							   node->rangeCollation, get_opcode(ltop),
+							   (Datum) 0);
+	}
+
+	return rs;
+}
+
+/*
+ * MJResetJoin
+ *
+ * Return the merge join state machine to its initial state.
+ */
+static void
+MJResetJoin(MergeJoinState *node)
+{
+	ExecClearTuple(node->mj_MarkedTupleSlot);
+
+	node->mj_JoinState = EXEC_MJ_INITIALIZE_OUTER;
+	node->mj_MatchedOuter = false;
+	node->mj_MatchedInner = false;
+	node->mj_OuterTupleSlot = NULL;
+	node->mj_InnerTupleSlot = NULL;
+}
+
+/*
+ * MJClaimRange
+ *
+ * Claim the next key range that no participant has joined yet, and restart
+ * both inputs on it.  Returns false if all ranges have been claimed.
+ */
+static bool
+MJClaimRange(MergeJoinState *node)
+{
+	MergeJoinRangeState rs = node->mj_RangeState;
+	uint32		range;
+	int			i;
+
+	if (rs->pstate != NULL)
+		range = pg_atomic_fetch_add_u32(&rs->pstate->next_range, 1);
+	else
+		range = rs->nextLocal++;
+	if (range > (uint32) rs->nbounds)
+		return false;
+
+	/*
+	 * Both keys are always set, so that the number of scan keys doesn't
+	 * change; the ranges open at one end get the same key twice, and btree
+	 * discards the redundant one.
+	 */
+	for (i = 0; i < 2; i++)
+	{
+		ScanKey		keys = rs->keys[i];
+
+		if (range == 0)
+		{
+			keys[0] = rs->ltKeys[i];
+			keys[0].sk_argument = rs->bounds[0];
+			keys[1] = keys[0];
+		}
+		else if (range == rs->nbounds)
+		{
+			keys[0] = rs->geKeys[i];
+			keys[0].sk_argument = rs->bounds[range - 1];
+			keys[1] = keys[0];
+		}
+		else
+		{
+			keys[0] = rs->geKeys[i];
+			keys[0].sk_argument = rs->bounds[range - 1];
+			keys[1] = rs->ltKeys[i];
+			keys[1].sk_argument = rs->bounds[range];
+		}
+	}
+
+	MJResetJoin(node);
+	ExecReScan(outerPlanState(node));
+	ExecReScan(innerPlanState(node));
+	rs->inRange = true;
+
+	return true;
+}
+
+/* ----------------------------------------------------------------
+ *		ExecParallelMergeJoin
+ *
+ *		Join the key ranges this participant claims, one at a time.
+ * ----------------------------------------------------------------
+ */
+static TupleTableSlot *
+ExecParallelMergeJoin(PlanState *pstate)
+{
+	MergeJoinState *node = castNode(MergeJoinState, pstate);
+	MergeJoinRangeState rs = node->mj_RangeState;
+
+	for (;;)
+	{
+		if (rs->inRange)
+		{
+			TupleTableSlot *slot = ExecMergeJoin(pstate);
+
+			if (!TupIsNull(slot))
+				return slot;
+			rs->inRange = false;
+		}
+
+		if (!MJClaimRange(node))
+			return NULL;
+	}
+}
+
 /* ----------------------------------------------------------------
  *		ExecInitMergeJoin
  * ----------------------------------------------------------------
@@ -1612,6 +1838,18 @@ ExecInitMergeJoin(MergeJoin *node, EState *estate, int eflags)
 	mergestate->mj_OuterTupleSlot = NULL;
 	mergestate->mj_InnerTupleSlot = NULL;
 
+	/*
+	 * A parallel-aware join restricts its inputs to one key range at a time.
+	 * The index scans have no scan keys to add to if we're only explaining.
+	 */
+	if (node->rangeBounds != NIL && !(eflags & EXEC_FLAG_EXPLAIN_ONLY))
+	{
+		Assert(node->join.jointype == JOIN_INNER ||
+			   node->join.jointype == JOIN_SEMI);
+		mergestate->mj_RangeState = MJInitRanges(mergestate, node);
+		mergestate->js.ps.ExecProcNode = ExecParallelMergeJoin;
+	}
+
 	/*
 	 * initialization successful
 	 */
@@ -1658,13 +1896,14 @@ ExecEndMergeJoin(MergeJoinState *node)
 void
 ExecReScanMergeJoin(MergeJoinState *node)
 {
-	ExecClearTuple(node->mj_MarkedTupleSlot);
+	MJResetJoin(node);
 
-	node->mj_JoinState = EXEC_MJ_INITIALIZE_OUTER;
-	node->mj_MatchedOuter = false;
-	node->mj_MatchedInner = false;
-	node->mj_OuterTupleSlot = NULL;
-	node->mj_InnerTupleSlot = NULL;
+	/* start claiming ranges over; the shared counter is reset separately */
+	if (node->mj_RangeState != NULL)
+	{
+		node->mj_RangeState->nextLocal = 0;
+		node->mj_RangeState->inRange = false;
+	}
 
 	/*
 	 * if chgParam of subnodes is not null then plans will be re-scanned by
@@ -1676,3 +1915,68 @@ ExecReScanMergeJoin(MergeJoinState *node)
 		ExecReScan(node->js.ps.righttree);
 
 }
+
+/* ----------------------------------------------------------------
+ *		ExecMergeJoinEstimate
+ *
+ *		Estimate space required for the shared state of a parallel-aware
+ *		merge join.
+ * ----------------------------------------------------------------
+ */
+void
+ExecMergeJoinEstimate(MergeJoinState *state, ParallelContext *pcxt)
+{
+	shm_toc_estimate_chunk(&pcxt->estimator, sizeof(ParallelMergeJoinState));
+	shm_toc_estimate_keys(&pcxt->estimator, 1);
+}
+
+/* ----------------------------------------------------------------
+ *		ExecMergeJoinInitializeDSM
+ *
+ *		Set up the shared state of a parallel-aware merge join.
+ * ----------------------------------------------------------------
+ */
+void
+ExecMergeJoinInitializeDSM(MergeJoinState *state, ParallelContext *pcxt)
+{
+	ParallelMergeJoinState *pstate;
+
+	pstate = shm_toc_allocate(pcxt->toc, sizeof(ParallelMergeJoinState));
+	pg_atomic_init_u32(&pstate->next_range, 0);
+	shm_toc_insert(pcxt->toc, state->js.ps.plan->plan_node_id, pstate);
+
+	if (state->mj_RangeState != NULL)
+		state->mj_RangeState->pstate = pstate;
+}
+
+/* ----------------------------------------------------------------
+ *		ExecMergeJoinReInitializeDSM
+ *
+ *		Reset shared state before beginning a fresh scan.
+ * ----------------------------------------------------------------
+ */
+void
+ExecMergeJoinReInitializeDSM(MergeJoinState *state, ParallelContext *pcxt)
+{
+	ParallelMergeJoinState *pstate;
+
+	pstate = shm_toc_lookup(pcxt->toc, state->js.ps.plan->plan_node_id, false);
+	pg_atomic_write_u32(&pstate->next_range, 0);
+}
+
+/* ----------------------------------------------------------------
+ *		ExecMergeJoinInitializeWorker
+ *
+ *		Attach worker to the shared state of a parallel-aware merge join.
+ * ----------------------------------------------------------------
+ */
+void
+ExecMergeJoinInitializeWorker(MergeJoinState *state,
+							  ParallelWorkerContext *pwcxt)
+{
+	ParallelMergeJoinState *pstate;
+
+	pstate = shm_toc_lookup(pwcxt->toc, state->js.ps.plan->plan_node_id, false);
+	if (state->mj_RangeState != NULL)
+		state->mj_RangeState->pstate = pstate;
+}
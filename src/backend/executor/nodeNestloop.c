@@ -22,10 +22,56 @@
 #include "postgres.h"
 
 #include "executor/execdebug.h"
+#include "executor/nodeHash.h"
 #include "executor/nodeNestloop.h"
 #include "miscadmin.h"
+#include "nodes/makefuncs.h"
+#include "utils/lsyscache.h"
 #include "utils/memutils.h"
 
+/*
+ * State for switching to hashing the inner side.
+ *
+ * When the outer side returns more than nestloop_switch_threshold times as
+ * many rows as the planner estimated, we read the whole inner side once into
+ * a hash table keyed by the hashable join clauses, and from then on look up
+ * the inner tuples for each outer tuple there, instead of rescanning the
+ * inner side.  This is only possible if the inner side doesn't depend on the
+ * outer row, i.e. there are no nestParams.
+ *
+ * The tuples of each hash entry are kept in the order the inner side
+ * returned them, and the full join qual is still checked for each of them,
+ * so the join produces the same rows in the same order either way.
+ */
+typedef struct NestLoopHashStateData
+{
+	int			numCols;		/* number of hash keys */
+	AttrNumber *keyColIdx;		/* their columns in the key tuples: 1..n */
+	Oid		   *tab_eq_funcoids;	/* inner-type equality functions */
+	Oid		   *tab_collations; /* collations of the keys */
+	FmgrInfo   *tab_hash_funcs; /* inner-type hash functions */
+	FmgrInfo   *lhs_hash_funcs; /* outer-type hash functions */
+	ExprState  *cur_eq_comp;	/* outer-to-inner key comparison */
+	ProjectionInfo *projOuter;	/* computes the outer tuple's keys */
+	ProjectionInfo *projInner;	/* computes an inner tuple's keys */
+	TupleDesc	descInner;		/* descriptor of the inner key tuples */
+	double		threshold;		/* switch after this many outer rows */
+	MemoryContext tablecxt;		/* holds the hash table and its tuples */
+	MemoryContext tempcxt;		/* short-term memory for hashing */
+	TupleHashTable hashtable;	/* NULL if we haven't switched */
+	TupleTableSlot *innerslot;	/* for returning inner tuples */
+	List	   *matches;		/* inner tuples for the current outer one */
+	int			nextmatch;		/* index of next one to return */
+} NestLoopHashStateData;
+
+/* GUC parameter */
+double		nestloop_switch_threshold = 10.0;
+
+static void ExecNestLoopInitHashState(NestLoopState *nlstate, NestLoop *node);
+static bool ExecNestLoopBuildHashTable(NestLoopState *node);
+static bool ExecNestLoopHashOuter(NestLoopState *node);
+static bool ExecNestLoopKeysNotNull(TupleTableSlot *slot);
+
 
 /* ----------------------------------------------------------------
  *		ExecNestLoop(node)
@@ -123,33 +169,45 @@ ExecNestLoop(PlanState *pstate)
 			node->nl_MatchedOuter = false;
 
 			/*
-			 * fetch the values of any outer Vars that must be passed to the
-			 * inner scan, and store them in the appropriate PARAM_EXEC slots.
+			 * If we have switched to hashing the inner side, look up the
+			 * inner tuples for this outer tuple in the hash table.
 			 */
-			foreach(lc, nl->nestParams)
+			if (node->nl_HashState != NULL && ExecNestLoopHashOuter(node))
 			{
-				NestLoopParam *nlp = (NestLoopParam *) lfirst(lc);
-				int			paramno = nlp->paramno;
-				ParamExecData *prm;
-
-				prm = &(econtext->ecxt_param_exec_vals[paramno]);
-				/* Param value should be an OUTER_VAR var */
-				Assert(IsA(nlp->paramval, Var));
-				Assert(nlp->paramval->varno == OUTER_VAR);
-				Assert(nlp->paramval->varattno > 0);
-				prm->value = slot_getattr(outerTupleSlot,
-										  nlp->paramval->varattno,
-										  &(prm->isnull));
-				/* Flag parameter value as changed */
-				innerPlan->chgParam = bms_add_member(innerPlan->chgParam,
-													 paramno);
+				ENL1_printf("looked up outer tuple in inner hash table");
 			}
+			else
+			{
+				/*
+				 * fetch the values of any outer Vars that must be passed to
+				 * the inner scan, and store them in the appropriate
+				 * PARAM_EXEC slots.
+				 */
+				foreach(lc, nl->nestParams)
+				{
+					NestLoopParam *nlp = (NestLoopParam *) lfirst(lc);
+					int			paramno = nlp->paramno;
+					ParamExecData *prm;
+
+					prm = &(econtext->ecxt_param_exec_vals[paramno]);
+					/* Param value should be an OUTER_VAR var */
+					Assert(IsA(nlp->paramval, Var));
+					Assert(nlp->paramval->varno == OUTER_VAR);
+					Assert(nlp->paramval->varattno > 0);
+					prm->value = slot_getattr(outerTupleSlot,
+											  nlp->paramval->varattno,
+											  &(prm->isnull));
+					/* Flag parameter value as changed */
+					innerPlan->chgParam = bms_add_member(innerPlan->chgParam,
+														 paramno);
+				}
 
-			/*
-			 * now rescan the inner plan
-			 */
-			ENL1_printf("rescanning inner plan");
-			ExecReScan(innerPlan);
+				/*
+				 * now rescan the inner plan
+				 */
+				ENL1_printf("rescanning inner plan");
+				ExecReScan(innerPlan);
+			}
 		}
 
 		/*
@@ -157,7 +215,22 @@ ExecNestLoop(PlanState *pstate)
 		 */
 		ENL1_printf("getting new inner tuple");
 
-		innerTupleSlot = ExecProcNode(innerPlan);
+		if (node->nl_HashState != NULL &&
+			node->nl_HashState->hashtable != NULL)
+		{
+			NestLoopHashState hstate = node->nl_HashState;
+
+			if (hstate->nextmatch < list_length(hstate->matches))
+				innerTupleSlot =
+					ExecStoreMinimalTuple((MinimalTuple) list_nth(hstate->matches,
+																  hstate->nextmatch++),
+										  hstate->innerslot,
+										  false);
+			else
+				innerTupleSlot = NULL;
+		}
+		else
+			innerTupleSlot = ExecProcNode(innerPlan);
 		econtext->ecxt_innertuple = innerTupleSlot;
 
 		if (TupIsNull(innerTupleSlot))
@@ -301,6 +374,19 @@ ExecInitNestLoop(NestLoop *node, EState *estate, int eflags)
 		eflags &= ~EXEC_FLAG_REWIND;
 	innerPlanState(nlstate) = ExecInitNode(innerPlan(node), estate, eflags);
 
+	/*
+	 * If we might switch to hashing the inner side, the inner tuples may come
+	 * from the hash table rather than the inner plan, so the expressions
+	 * can't assume the inner plan's slot type.
+	 */
+	if (node->hashoperators != NIL && nestloop_switch_threshold > 0 &&
+		!(eflags & EXEC_FLAG_EXPLAIN_ONLY))
+	{
+		nlstate->js.ps.inneropsset = true;
+		nlstate->js.ps.inneropsfixed = false;
+		nlstate->js.ps.innerops = NULL;
+	}
+
 	/*
 	 * Initialize result slot, type and projection.
 	 */
@@ -340,6 +426,9 @@ ExecInitNestLoop(NestLoop *node, EState *estate, int eflags)
 				 (int) node->join.jointype);
 	}
 
+	if (nlstate->js.ps.inneropsset)
+		ExecNestLoopInitHashState(nlstate, node);
+
 	/*
 	 * finally, wipe the current outer tuple clean.
 	 */
@@ -374,6 +463,16 @@ ExecEndNestLoop(NestLoopState *node)
 	 */
 	ExecClearTuple(node->js.ps.ps_ResultTupleSlot);
 
+	/*
+	 * Free the inner hash table, if we built one
+	 */
+	if (node->nl_HashState != NULL)
+	{
+		MemoryContextDelete(node->nl_HashState->tablecxt);
+		MemoryContextDelete(node->nl_HashState->tempcxt);
+		node->nl_HashState->hashtable = NULL;
+	}
+
 	/*
 	 * close down subplans
 	 */
@@ -406,6 +505,278 @@ ExecReScanNestLoop(NestLoopState *node)
 	 * outer Vars are used as run-time keys...
 	 */
 
+	/*
+	 * A hash table of the inner side stays valid as long as the inner side's
+	 * parameters haven't changed.
+	 */
+	if (node->nl_HashState != NULL)
+	{
+		NestLoopHashState hstate = node->nl_HashState;
+
+		if (innerPlanState(node)->chgParam != NULL)
+		{
+			MemoryContextReset(hstate->tablecxt);
+			hstate->hashtable = NULL;
+			node->nl_SwitchedAfter = 0;
+			node->nl_SwitchFailed = false;
+		}
+		hstate->matches = NIL;
+		hstate->nextmatch = 0;
+		node->nl_OuterRows = 0;
+	}
+
 	node->nl_NeedNewOuter = true;
 	node->nl_MatchedOuter = false;
 }
+
+/*
+ * Set up the state for switching to hashing the inner side.
+ *
+ * This works the same way as the setup of a hashed SubPlan in
+ * ExecInitSubPlan: the hash keys are projected into virtual tuples of their
+ * own, and the table is keyed by the inner side's projected keys.
+ */
+static void
+ExecNestLoopInitHashState(NestLoopState *nlstate, NestLoop *node)
+{
+	EState	   *estate = nlstate->js.ps.state;
+	PlanState  *parent = &nlstate->js.ps;
+	NestLoopHashState hstate;
+	int			ncols = list_length(node->hashoperators);
+	Oid		   *cross_eq_funcoids;
+	List	   *outertlist = NIL;
+	List	   *innertlist = NIL;
+	TupleDesc	descOuter;
+	TupleTableSlot *slot;
+	ListCell   *lop;
+	ListCell   *lcoll;
+	ListCell   *lok;
+	ListCell   *lik;
+	int			i;
+
+	hstate = (NestLoopHashState) palloc0(sizeof(NestLoopHashStateData));
+	hstate->numCols = ncols;
+	hstate->keyColIdx = (AttrNumber *) palloc(ncols * sizeof(AttrNumber));
+	hstate->tab_eq_funcoids = (Oid *) palloc(ncols * sizeof(Oid));
+	hstate->tab_collations = (Oid *) palloc(ncols * sizeof(Oid));
+	hstate->tab_hash_funcs = (FmgrInfo *) palloc(ncols * sizeof(FmgrInfo));
+	hstate->lhs_hash_funcs = (FmgrInfo *) palloc(ncols * sizeof(FmgrInfo));
+	cross_eq_funcoids = (Oid *) palloc(ncols * sizeof(Oid));
+
+	i = 1;
+	forfour(lop, node->hashoperators, lcoll, node->hashcollations,
+			lok, node->outerhashkeys, lik, node->innerhashkeys)
+	{
+		Oid			hashop = lfirst_oid(lop);
+		Oid			rhs_eq_oper;
+		Oid			left_hashfn;
+		Oid			right_hashfn;
+
+		outertlist = lappend(outertlist,
+							 makeTargetEntry((Expr *) lfirst(lok), i,
+											 NULL, false));
+		innertlist = lappend(innertlist,
+							 makeTargetEntry((Expr *) lfirst(lik), i,
+											 NULL, false));
+
+		/* the equality function, possibly cross-type, for lookups */
+		cross_eq_funcoids[i - 1] = get_opcode(hashop);
+
+		/* the equality function for the inner type, for building */
+		if (!get_compatible_hash_operators(hashop, NULL, &rhs_eq_oper))
+			elog(ERROR, "could not find compatible hash operator for operator %u",
+				 hashop);
+		hstate->tab_eq_funcoids[i - 1] = get_opcode(rhs_eq_oper);
+
+		/* and the hash functions for both sides */
+		if (!get_op_hash_functions(hashop, &left_hashfn, &right_hashfn))
+			elog(ERROR, "could not find hash function for hash operator %u",
+				 hashop);
+		fmgr_info(left_hashfn, &hstate->lhs_hash_funcs[i - 1]);
+		fmgr_info(right_hashfn, &hstate->tab_hash_funcs[i - 1]);
+
+		hstate->tab_collations[i - 1] = lfirst_oid(lcoll);
+		hstate->keyColIdx[i - 1] = i;
+
+		i++;
+	}
+
+	descOuter = ExecTypeFromTL(outertlist);
+	slot = ExecInitExtraTupleSlot(estate, descOuter, &TTSOpsVirtual);
+	hstate->projOuter = ExecBuildProjectionInfo(outertlist,
+												nlstate->js.ps.ps_ExprContext,
+												slot,
+												parent,
+												NULL);
+
+	hstate->descInner = ExecTypeFromTL(innertlist);
+	slot = ExecInitExtraTupleSlot(estate, hstate->descInner, &TTSOpsVirtual);
+	hstate->projInner = ExecBuildProjectionInfo(innertlist,
+												nlstate->js.ps.ps_ExprContext,
+												slot,
+												parent,
+												NULL);
+
+	hstate->cur_eq_comp = ExecBuildGroupingEqual(descOuter, hstate->descInner,
+												 &TTSOpsVirtual,
+												 &TTSOpsMinimalTuple,
+												 ncols,
+												 hstate->keyColIdx,
+												 cross_eq_funcoids,
+												 hstate->tab_collations,
+												 parent);
+
+	hstate->innerslot =
+		ExecInitExtraTupleSlot(estate,
+							   ExecGetResultType(innerPlanState(nlstate)),
+							   &TTSOpsMinimalTuple);
+
+	hstate->tablecxt = AllocSetContextCreate(CurrentMemoryContext,
+											 "NestLoop HashTable Context",
+											 ALLOCSET_DEFAULT_SIZES);
+	hstate->tempcxt = AllocSetContextCreate(CurrentMemoryContext,
+											"NestLoop HashTable Temp Context",
+											ALLOCSET_SMALL_SIZES);
+
+	hstate->threshold = nestloop_switch_threshold *
+		Max(outerPlan(node)->plan_rows, 1.0);
+
+	nlstate->nl_HashState = hstate;
+}
+
+/*
+ * Read the whole inner side into a hash table.
+ *
+ * Returns false, leaving no hash table behind, if the inner side doesn't fit
+ * in hash_mem.  The inner plan has to be rescanned afterwards in either case.
+ */
+static bool
+ExecNestLoopBuildHashTable(NestLoopState *node)
+{
+	NestLoopHashState hstate = node->nl_HashState;
+	PlanState  *innerPlan = innerPlanState(node);
+	ExprContext *econtext = node->js.ps.ps_ExprContext;
+	Size		hash_mem_limit = (Size) get_hash_mem() * 1024;
+	long		nbuckets;
+
+	nbuckets = (long) Min(innerPlan->plan->plan_rows, (double) LONG_MAX);
+	if (nbuckets < 1)
+		nbuckets = 1;
+
+	hstate->hashtable = BuildTupleHashTableExt(&node->js.ps,
+											   hstate->descInner,
+											   hstate->numCols,
+											   hstate->keyColIdx,
+											   hstate->tab_eq_funcoids,
+											   hstate->tab_hash_funcs,
+											   hstate->tab_collations,
+											   nbuckets,
+											   0,
+											   hstate->tablecxt,
+											   hstate->tablecxt,
+											   hstate->tempcxt,
+											   false);
+
+	ExecReScan(innerPlan);
+	for (;;)
+	{
+		TupleTableSlot *innerTupleSlot = ExecProcNode(innerPlan);
+		TupleTableSlot *keyslot;
+		TupleHashEntry entry;
+		MinimalTuple tuple;
+		MemoryContext oldcxt;
+		bool		isnew;
+
+		if (TupIsNull(innerTupleSlot))
+			break;
+
+		econtext->ecxt_innertuple = innerTupleSlot;
+		keyslot = ExecProject(hstate->projInner);
+
+		/* the hash operators are strict, so a NULL key can't match */
+		if (ExecNestLoopKeysNotNull(keyslot))
+		{
+			entry = LookupTupleHashEntry(hstate->hashtable, keyslot, &isnew,
+										 NULL);
+
+			/* keep the entry's tuples in the order they arrived */
+			oldcxt = MemoryContextSwitchTo(hstate->tablecxt);
+			tuple = ExecCopySlotMinimalTuple(innerTupleSlot);
+			entry->additional = lappend(isnew ? NIL : (List *) entry->additional,
+										tuple);
+			MemoryContextSwitchTo(oldcxt);
+		}
+
+		ResetExprContext(econtext);
+
+		if (MemoryContextMemAllocated(hstate->tablecxt, true) > hash_mem_limit)
+		{
+			MemoryContextReset(hstate->tablecxt);
+			hstate->hashtable = NULL;
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/*
+ * Count a new outer tuple, switch to hashing the inner side if it's time to,
+ * and if we're hashing, find the inner tuples the outer tuple joins to.
+ *
+ * Returns true if the inner tuples come from the hash table.
+ */
+static bool
+ExecNestLoopHashOuter(NestLoopState *node)
+{
+	NestLoopHashState hstate = node->nl_HashState;
+	TupleTableSlot *keyslot;
+	TupleHashEntry entry;
+
+	node->nl_OuterRows += 1;
+
+	if (hstate->hashtable == NULL)
+	{
+		if (node->nl_SwitchFailed || node->nl_OuterRows <= hstate->threshold)
+			return false;
+
+		node->nl_SwitchedAfter = node->nl_OuterRows;
+		if (!ExecNestLoopBuildHashTable(node))
+		{
+			node->nl_SwitchFailed = true;
+			return false;
+		}
+	}
+
+	hstate->matches = NIL;
+	hstate->nextmatch = 0;
+
+	keyslot = ExecProject(hstate->projOuter);
+	if (ExecNestLoopKeysNotNull(keyslot))
+	{
+		entry = FindTupleHashEntry(hstate->hashtable, keyslot,
+								   hstate->cur_eq_comp,
+								   hstate->lhs_hash_funcs);
+		if (entry != NULL)
+			hstate->matches = (List *) entry->additional;
+	}
+
+	return true;
+}
+
+/*
+ * Are all the hash keys in the projected key tuple non-null?
+ */
+static bool
+ExecNestLoopKeysNotNull(TupleTableSlot *slot)
+{
+	int			i;
+
+	slot_getallattrs(slot);
+	for (i = 0; i < slot->tts_nvalid; i++)
+	{
+		if (slot->tts_isnull[i])
+			return false;
+	}
+	return true;
+}
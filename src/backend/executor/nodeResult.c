@@ -139,6 +139,79 @@ ExecResult(PlanState *pstate)
 	return NULL;
 }
 
+/* ----------------------------------------------------------------
+ *		ExecResultBatch(node)
+ *
+ *		Batch mode counterpart of ExecResult().  We only get here if
+ *		we have an outer plan, and our projection just picks columns
+ *		of its output.
+ * ----------------------------------------------------------------
+ */
+static TupleBatch *
+ExecResultBatch(PlanState *pstate)
+{
+	ResultState *node = castNode(ResultState, pstate);
+	TupleBatch *outerBatch;
+
+	CHECK_FOR_INTERRUPTS();
+
+	/*
+	 * check constant qualifications like (2 > 1), if not already done
+	 */
+	if (node->rs_checkqual)
+	{
+		ExprContext *econtext = node->ps.ps_ExprContext;
+		bool		qualResult = ExecQual(node->resconstantqual, econtext);
+
+		node->rs_checkqual = false;
+		if (!qualResult)
+			node->rs_done = true;
+	}
+
+	if (node->rs_done)
+		return NULL;
+
+	outerBatch = ExecProcNodeBatch(outerPlanState(node));
+	if (outerBatch == NULL)
+		return NULL;
+
+	ExecProjectBatch(node->rs_batch, outerBatch, node->rs_colmap);
+
+	return node->rs_batch;
+}
+
+/* ----------------------------------------------------------------
+ *		ExecResultEnableBatch
+ *
+ *		Switches the node to batch mode, if possible; see
+ *		ExecEnableBatchMode().
+ * ----------------------------------------------------------------
+ */
+bool
+ExecResultEnableBatch(ResultState *node, int natts)
+{
+	Plan	   *plan = node->ps.plan;
+	int		   *colmap;
+	int			ninputcols;
+
+	if (outerPlanState(node) == NULL || plan->qual != NIL)
+		return false;
+
+	colmap = ExecBuildBatchColumnMap(plan->targetlist, OUTER_VAR,
+									 &ninputcols);
+	if (colmap == NULL)
+		return false;
+
+	if (!ExecEnableBatchMode(outerPlanState(node), ninputcols))
+		return false;
+
+	node->rs_batch = MakeTupleBatchHeader(list_length(plan->targetlist));
+	node->rs_colmap = colmap;
+	node->ps.ExecProcNodeBatchReal = ExecResultBatch;
+
+	return true;
+}
+
 /* ----------------------------------------------------------------
  *		ExecResultMarkPos
  * ----------------------------------------------------------------
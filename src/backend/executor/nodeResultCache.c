@@ -50,6 +50,20 @@
  * that may allow us to start putting useful entries back into the cache
  * again.
  *
+ * In a parallel query, the leader and the workers share a single cache kept
+ * in the query's DSA area, so that each of them benefits from the scans
+ * performed by the others.  The shared cache is a dshash table, whose
+ * entries are only added once the scan for their parameters has run to
+ * completion (or has produced its first tuple, for singlerow caches): until
+ * then, the process performing the scan collects the tuples privately.  If
+ * two processes happen to scan for the same parameters at the same time, the
+ * first one to finish publishes its entry and the other one throws its copy
+ * away.  Published entries are never modified, which lets readers release
+ * the hash table's partition lock as soon as they have found an entry, but
+ * it also means that entries are never evicted from the shared cache.
+ * Instead, when the memory budget, shared by all processes, runs out, the
+ * scans that don't find their parameters in the cache go into bypass mode.
+ *
  *
  * INTERFACE ROUTINES
  *		ExecResultCache			- lookup cache, exec subplan when not found
@@ -69,8 +83,11 @@
 #include "common/hashfn.h"
 #include "executor/executor.h"
 #include "executor/nodeResultCache.h"
+#include "lib/dshash.h"
 #include "lib/ilist.h"
 #include "miscadmin.h"
+#include "port/atomics.h"
+#include "storage/lwlock.h"
 #include "utils/lsyscache.h"
 
 /* States of the ExecResultCache state machine */
@@ -88,6 +105,11 @@
 										 (e)->key->params->t_len);
 #define CACHE_TUPLE_BYTES(t)			(sizeof(ResultCacheTuple) + \
 										 (t)->mintuple->t_len)
+#define SHARED_CACHE_TUPLE_BYTES(len)	(MAXALIGN(sizeof(SharedResultCacheTuple)) + \
+										 (len))
+#define SHARED_CACHE_TUPLE_DATA(t)		((MinimalTuple) \
+										 ((char *) (t) + \
+										  MAXALIGN(sizeof(SharedResultCacheTuple))))
 
  /* ResultCacheTuple Stores an individually cached tuple */
 typedef struct ResultCacheTuple
@@ -121,6 +143,47 @@ typedef struct ResultCacheEntry
 	bool		complete;		/* Did we read the outer plan to completion? */
 } ResultCacheEntry;
 
+/*
+ * SharedResultCacheTuple
+ *		An individually cached tuple in the shared cache.  The MinimalTuple
+ *		follows the header, in the same DSA allocation.
+ */
+typedef struct SharedResultCacheTuple
+{
+	dsa_pointer next;			/* The next tuple with the same parameter
+								 * values or InvalidDsaPointer */
+} SharedResultCacheTuple;
+
+/*
+ * SharedResultCacheEntry
+ *		The data struct that the shared cache hash table stores.  Only
+ *		entries that are complete are ever added to it.
+ */
+typedef struct SharedResultCacheEntry
+{
+	dsa_pointer params;			/* Hash key: MinimalTuple of the parameters */
+	dsa_pointer tuplehead;		/* The first SharedResultCacheTuple or
+								 * InvalidDsaPointer if there are none */
+} SharedResultCacheEntry;
+
+/*
+ * ParallelResultCacheState
+ *		Shared state of a result cache in a parallel query.  When
+ *		instrumenting, the SharedResultCacheInfo follows it in the same DSM
+ *		chunk.
+ */
+typedef struct ParallelResultCacheState
+{
+	dshash_table_handle handle; /* The shared cache */
+	pg_atomic_uint64 mem_used;	/* bytes of memory used by the shared cache */
+	uint64		mem_limit;		/* memory limit in bytes for the shared cache */
+	bool		instrumented;	/* Is SharedResultCacheInfo present? */
+} ParallelResultCacheState;
+
+#define PARALLEL_RESULT_CACHE_INFO(ps)	((SharedResultCacheInfo *) \
+										 ((char *) (ps) + \
+										  MAXALIGN(sizeof(ParallelResultCacheState))))
+
 
 #define SH_PREFIX resultcache
 #define SH_ELEMENT_TYPE ResultCacheEntry
@@ -134,6 +197,18 @@ static uint32 ResultCacheHash_hash(struct resultcache_hash *tb,
 static int	ResultCacheHash_equal(struct resultcache_hash *tb,
 								  const ResultCacheKey *params1,
 								  const ResultCacheKey *params2);
+static dshash_hash SharedResultCacheHash_hash(const void *key, size_t keysize,
+											  void *arg);
+static int	SharedResultCacheHash_equal(const void *a, const void *b,
+										size_t keysize, void *arg);
+
+static const dshash_parameters shared_cache_params = {
+	sizeof(dsa_pointer),
+	sizeof(SharedResultCacheEntry),
+	SharedResultCacheHash_equal,
+	SharedResultCacheHash_hash,
+	LWTRANCHE_SHARED_RESULT_CACHE
+};
 
 #define SH_PREFIX resultcache
 #define SH_ELEMENT_TYPE ResultCacheEntry
@@ -148,15 +223,12 @@ static int	ResultCacheHash_equal(struct resultcache_hash *tb,
 #include "lib/simplehash.h"
 
 /*
- * ResultCacheHash_hash
- *		Hash function for simplehash hashtable.  'key' is unused here as we
- *		require that all table lookups first populate the ResultCacheState's
- *		probeslot with the key values to be looked up.
+ * probe_slot_hash
+ *		Compute the hash value of the parameters in rcstate's probeslot.
  */
-static uint32
-ResultCacheHash_hash(struct resultcache_hash *tb, const ResultCacheKey *key)
+static inline uint32
+probe_slot_hash(ResultCacheState *rcstate)
 {
-	ResultCacheState *rcstate = (ResultCacheState *) tb->private_data;
 	TupleTableSlot *pslot = rcstate->probeslot;
 	uint32		hashkey = 0;
 	int			numkeys = rcstate->nkeys;
@@ -181,6 +253,39 @@ ResultCacheHash_hash(struct resultcache_hash *tb, const ResultCacheKey *key)
 	return murmurhash32(hashkey);
 }
 
+/*
+ * probe_slot_equal
+ *		Check whether 'params' are equal to the parameters in rcstate's
+ *		probeslot.
+ */
+static inline bool
+probe_slot_equal(ResultCacheState *rcstate, MinimalTuple params)
+{
+	ExprContext *econtext = rcstate->ss.ps.ps_ExprContext;
+	TupleTableSlot *tslot = rcstate->tableslot;
+	TupleTableSlot *pslot = rcstate->probeslot;
+
+	/* probeslot should have already been prepared by prepare_probe_slot() */
+
+	ExecStoreMinimalTuple(params, tslot, false);
+
+	econtext->ecxt_innertuple = tslot;
+	econtext->ecxt_outertuple = pslot;
+	return ExecQualAndReset(rcstate->cache_eq_expr, econtext);
+}
+
+/*
+ * ResultCacheHash_hash
+ *		Hash function for simplehash hashtable.  'key' is unused here as we
+ *		require that all table lookups first populate the ResultCacheState's
+ *		probeslot with the key values to be looked up.
+ */
+static uint32
+ResultCacheHash_hash(struct resultcache_hash *tb, const ResultCacheKey *key)
+{
+	return probe_slot_hash((ResultCacheState *) tb->private_data);
+}
+
 /*
  * ResultCacheHash_equal
  *		Equality function for confirming hash value matches during a hash
@@ -191,18 +296,37 @@ static int
 ResultCacheHash_equal(struct resultcache_hash *tb, const ResultCacheKey *key1,
 					  const ResultCacheKey *key2)
 {
-	ResultCacheState *rcstate = (ResultCacheState *) tb->private_data;
-	ExprContext *econtext = rcstate->ss.ps.ps_ExprContext;
-	TupleTableSlot *tslot = rcstate->tableslot;
-	TupleTableSlot *pslot = rcstate->probeslot;
+	return !probe_slot_equal((ResultCacheState *) tb->private_data,
+							 key1->params);
+}
 
-	/* probeslot should have already been prepared by prepare_probe_slot() */
+/*
+ * SharedResultCacheHash_hash
+ *		Hash function for the shared cache.  As for the local cache, 'key' is
+ *		unused and the probeslot must hold the values being looked up.
+ */
+static dshash_hash
+SharedResultCacheHash_hash(const void *key, size_t keysize, void *arg)
+{
+	return probe_slot_hash((ResultCacheState *) arg);
+}
 
-	ExecStoreMinimalTuple(key1->params, tslot, false);
+/*
+ * SharedResultCacheHash_equal
+ *		Equality function for the shared cache.  dshash passes the key being
+ *		looked up as 'a', which we ignore in favor of the probeslot, and the
+ *		key of an existing entry as 'b'.
+ */
+static int
+SharedResultCacheHash_equal(const void *a, const void *b, size_t keysize,
+							void *arg)
+{
+	ResultCacheState *rcstate = (ResultCacheState *) arg;
+	dsa_pointer params = *(const dsa_pointer *) b;
 
-	econtext->ecxt_innertuple = tslot;
-	econtext->ecxt_outertuple = pslot;
-	return !ExecQualAndReset(rcstate->cache_eq_expr, econtext);
+	return !probe_slot_equal(rcstate,
+							 (MinimalTuple) dsa_get_address(rcstate->area,
+															params));
 }
 
 /*
@@ -222,12 +346,12 @@ build_hash_table(ResultCacheState *rcstate, uint32 size)
 
 /*
  * prepare_probe_slot
- *		Populate rcstate's probeslot with the values from the tuple stored
- *		in 'key'.  If 'key' is NULL, then perform the population by evaluating
- *		rcstate's param_exprs.
+ *		Populate rcstate's probeslot with the values from the tuple
+ *		'params'.  If 'params' is NULL, then perform the population by
+ *		evaluating rcstate's param_exprs.
  */
 static inline void
-prepare_probe_slot(ResultCacheState *rcstate, ResultCacheKey *key)
+prepare_probe_slot(ResultCacheState *rcstate, MinimalTuple params)
 {
 	TupleTableSlot *pslot = rcstate->probeslot;
 	TupleTableSlot *tslot = rcstate->tableslot;
@@ -235,7 +359,7 @@ prepare_probe_slot(ResultCacheState *rcstate, ResultCacheKey *key)
 
 	ExecClearTuple(pslot);
 
-	if (key == NULL)
+	if (params == NULL)
 	{
 		/* Set the probeslot's values based on the current parameter values */
 		for (int i = 0; i < numKeys; i++)
@@ -245,8 +369,8 @@ prepare_probe_slot(ResultCacheState *rcstate, ResultCacheKey *key)
 	}
 	else
 	{
-		/* Process the key's MinimalTuple and store the values in probeslot */
-		ExecStoreMinimalTuple(key->params, tslot, false);
+		/* Process the MinimalTuple and store the values in probeslot */
+		ExecStoreMinimalTuple(params, tslot, false);
 		slot_getallattrs(tslot);
 		memcpy(pslot->tts_values, tslot->tts_values, sizeof(Datum) * numKeys);
 		memcpy(pslot->tts_isnull, tslot->tts_isnull, sizeof(bool) * numKeys);
@@ -349,7 +473,7 @@ cache_reduce_memory(ResultCacheState *rcstate, ResultCacheKey *specialkey)
 		 * Populate the hash probe slot in preparation for looking up this LRU
 		 * entry.
 		 */
-		prepare_probe_slot(rcstate, key);
+		prepare_probe_slot(rcstate, key->params);
 
 		/*
 		 * Ideally the LRU list pointers would be stored in the entry itself
@@ -488,7 +612,7 @@ cache_lookup(ResultCacheState *rcstate, bool *found)
 			 * We need to repopulate the probeslot as lookups performed during
 			 * the cache evictions above will have stored some other key.
 			 */
-			prepare_probe_slot(rcstate, key);
+			prepare_probe_slot(rcstate, key->params);
 
 			/* Re-find the newly added entry */
 			entry = resultcache_lookup(rcstate->hashtable, NULL);
@@ -567,7 +691,7 @@ cache_store_tuple(ResultCacheState *rcstate, TupleTableSlot *slot)
 			 * We need to repopulate the probeslot as lookups performed during
 			 * the cache evictions above will have stored some other key.
 			 */
-			prepare_probe_slot(rcstate, key);
+			prepare_probe_slot(rcstate, key->params);
 
 			/* Re-find the entry */
 			rcstate->entry = entry = resultcache_lookup(rcstate->hashtable,
@@ -579,6 +703,410 @@ cache_store_tuple(ResultCacheState *rcstate, TupleTableSlot *slot)
 	return true;
 }
 
+/*
+ * shared_cache_alloc
+ *		Allocate 'size' bytes for the shared cache, or return
+ *		InvalidDsaPointer if that would take the shared cache over its memory
+ *		budget.
+ */
+static dsa_pointer
+shared_cache_alloc(ResultCacheState *rcstate, Size size)
+{
+	ParallelResultCacheState *pstate = rcstate->pstate;
+	uint64		mem_used;
+	dsa_pointer dp;
+
+	mem_used = pg_atomic_add_fetch_u64(&pstate->mem_used, size);
+	if (mem_used > pstate->mem_limit)
+	{
+		pg_atomic_sub_fetch_u64(&pstate->mem_used, size);
+		return InvalidDsaPointer;
+	}
+
+	dp = dsa_allocate_extended(rcstate->area, size, DSA_ALLOC_NO_OOM);
+	if (!DsaPointerIsValid(dp))
+	{
+		pg_atomic_sub_fetch_u64(&pstate->mem_used, size);
+		return InvalidDsaPointer;
+	}
+
+	/* Update peak memory usage, as seen by this process */
+	if (mem_used > rcstate->stats.mem_peak)
+		rcstate->stats.mem_peak = mem_used;
+
+	return dp;
+}
+
+/*
+ * shared_cache_free
+ *		Free memory allocated by shared_cache_alloc().
+ */
+static void
+shared_cache_free(ResultCacheState *rcstate, dsa_pointer dp, Size size)
+{
+	dsa_free(rcstate->area, dp);
+	pg_atomic_sub_fetch_u64(&rcstate->pstate->mem_used, size);
+}
+
+/*
+ * shared_cache_discard
+ *		Free the parameters and the tuples that we've collected for an entry
+ *		that we haven't published in the shared cache.
+ */
+static void
+shared_cache_discard(ResultCacheState *rcstate)
+{
+	dsa_pointer dp = rcstate->shared_tuplehead;
+
+	while (DsaPointerIsValid(dp))
+	{
+		SharedResultCacheTuple *tuple = dsa_get_address(rcstate->area, dp);
+		dsa_pointer next = tuple->next;
+
+		shared_cache_free(rcstate, dp,
+						  SHARED_CACHE_TUPLE_BYTES(SHARED_CACHE_TUPLE_DATA(tuple)->t_len));
+		dp = next;
+	}
+
+	if (DsaPointerIsValid(rcstate->shared_params))
+	{
+		MinimalTuple params = dsa_get_address(rcstate->area,
+											  rcstate->shared_params);
+
+		shared_cache_free(rcstate, rcstate->shared_params, params->t_len);
+	}
+
+	rcstate->shared_params = InvalidDsaPointer;
+	rcstate->shared_tuplehead = InvalidDsaPointer;
+	rcstate->shared_last_tuple = InvalidDsaPointer;
+}
+
+/*
+ * shared_cache_lookup
+ *		Look up the scan's current parameters in the shared cache.  If they're
+ *		found, return true and set *tuplehead to the first cached tuple.
+ *		Otherwise, make a private copy of the parameters to fill a new entry
+ *		with, and return false.  rcstate's shared_params is left invalid if
+ *		there's no memory for the copy.
+ */
+static bool
+shared_cache_lookup(ResultCacheState *rcstate, dsa_pointer *tuplehead)
+{
+	SharedResultCacheEntry *entry;
+	MinimalTuple params;
+	dsa_pointer dp;
+
+	/* prepare the probe slot with the current scan parameters */
+	prepare_probe_slot(rcstate, NULL);
+
+	/* The hash function uses the probeslot, so the key is a dummy */
+	dp = InvalidDsaPointer;
+	entry = dshash_find(rcstate->shared_hashtable, &dp, false);
+	if (entry != NULL)
+	{
+		/* Entries are never changed once added, so just remember the head */
+		*tuplehead = entry->tuplehead;
+		dshash_release_lock(rcstate->shared_hashtable, entry);
+		return true;
+	}
+
+	params = ExecCopySlotMinimalTuple(rcstate->probeslot);
+	dp = shared_cache_alloc(rcstate, params->t_len);
+	if (DsaPointerIsValid(dp))
+		memcpy(dsa_get_address(rcstate->area, dp), params, params->t_len);
+	pfree(params);
+
+	rcstate->shared_params = dp;
+	rcstate->shared_tuplehead = InvalidDsaPointer;
+	rcstate->shared_last_tuple = InvalidDsaPointer;
+
+	return false;
+}
+
+/*
+ * shared_cache_store_tuple
+ *		Add the tuple stored in 'slot' to the entry that we're filling.
+ *		Returns false, after discarding the entry, if there's no memory for
+ *		the tuple.
+ */
+static bool
+shared_cache_store_tuple(ResultCacheState *rcstate, TupleTableSlot *slot)
+{
+	MinimalTuple mintuple;
+	bool		shouldFree;
+	dsa_pointer dp;
+
+	Assert(DsaPointerIsValid(rcstate->shared_params));
+
+	mintuple = ExecFetchSlotMinimalTuple(slot, &shouldFree);
+	dp = shared_cache_alloc(rcstate, SHARED_CACHE_TUPLE_BYTES(mintuple->t_len));
+	if (DsaPointerIsValid(dp))
+	{
+		SharedResultCacheTuple *tuple = dsa_get_address(rcstate->area, dp);
+
+		tuple->next = InvalidDsaPointer;
+		memcpy(SHARED_CACHE_TUPLE_DATA(tuple), mintuple, mintuple->t_len);
+
+		if (!DsaPointerIsValid(rcstate->shared_tuplehead))
+			rcstate->shared_tuplehead = dp;
+		else
+		{
+			SharedResultCacheTuple *last;
+
+			/* push this tuple onto the tail of the list */
+			last = dsa_get_address(rcstate->area, rcstate->shared_last_tuple);
+			last->next = dp;
+		}
+		rcstate->shared_last_tuple = dp;
+	}
+	if (shouldFree)
+		pfree(mintuple);
+
+	if (!DsaPointerIsValid(dp))
+	{
+		shared_cache_discard(rcstate);
+		return false;
+	}
+
+	return true;
+}
+
+/*
+ * shared_cache_publish
+ *		Add the entry that we've filled to the shared cache, making it visible
+ *		to the other processes.  If another process has added an entry for the
+ *		same parameters in the meantime, we just throw ours away.
+ */
+static void
+shared_cache_publish(ResultCacheState *rcstate)
+{
+	SharedResultCacheEntry *entry;
+	dsa_pointer params = rcstate->shared_params;
+	bool		found;
+
+	Assert(DsaPointerIsValid(params));
+
+	/*
+	 * The probeslot should still hold the parameters from the lookup, but be
+	 * certain we hash and compare what we're about to store.
+	 */
+	prepare_probe_slot(rcstate, dsa_get_address(rcstate->area, params));
+
+	/* dshash copies the key, i.e. the pointer to our parameters, into entry */
+	entry = dshash_find_or_insert(rcstate->shared_hashtable, &params, &found);
+	if (!found)
+		entry->tuplehead = rcstate->shared_tuplehead;
+	dshash_release_lock(rcstate->shared_hashtable, entry);
+
+	if (found)
+		shared_cache_discard(rcstate);
+
+	/* The tuples now belong to the shared cache */
+	rcstate->shared_params = InvalidDsaPointer;
+	rcstate->shared_tuplehead = InvalidDsaPointer;
+	rcstate->shared_last_tuple = InvalidDsaPointer;
+}
+
+/*
+ * shared_cache_detach
+ *		Stop using the shared cache, reverting to the local one.
+ */
+static void
+shared_cache_detach(ResultCacheState *rcstate)
+{
+	if (rcstate->shared_hashtable == NULL)
+		return;
+
+	/* Don't leak the tuples of an entry we didn't finish filling */
+	shared_cache_discard(rcstate);
+
+	dshash_detach(rcstate->shared_hashtable);
+	rcstate->shared_hashtable = NULL;
+	rcstate->area = NULL;
+	rcstate->pstate = NULL;
+}
+
+/*
+ * shared_cache_attach
+ *		Start using the shared cache described by 'pstate'.
+ */
+static void
+shared_cache_attach(ResultCacheState *rcstate, ParallelResultCacheState *pstate)
+{
+	rcstate->pstate = pstate;
+	rcstate->area = rcstate->ss.ps.state->es_query_dsa;
+	rcstate->shared_hashtable = dshash_attach(rcstate->area,
+											  &shared_cache_params,
+											  pstate->handle, rcstate);
+	rcstate->shared_params = InvalidDsaPointer;
+	rcstate->shared_tuplehead = InvalidDsaPointer;
+	rcstate->shared_last_tuple = InvalidDsaPointer;
+}
+
+/*
+ * ExecSharedResultCache
+ *		ExecResultCache's state machine, for when we're using the shared
+ *		cache.  This only handles the states that touch the cache.
+ */
+static TupleTableSlot *
+ExecSharedResultCache(ResultCacheState *node)
+{
+	PlanState  *outerNode;
+	TupleTableSlot *slot;
+
+	switch (node->rc_status)
+	{
+		case RC_CACHE_LOOKUP:
+			{
+				TupleTableSlot *outerslot;
+				SharedResultCacheTuple *tuple;
+				dsa_pointer tuplehead;
+
+				/*
+				 * Throw away any entry that the previous scan didn't run to
+				 * completion.  It's the same as the local cache purging an
+				 * incomplete entry, except that our entry isn't visible to
+				 * anyone, so we needn't wait until its parameters come up
+				 * again.
+				 */
+				shared_cache_discard(node);
+
+				if (shared_cache_lookup(node, &tuplehead))
+				{
+					node->stats.cache_hits += 1;	/* stats update */
+
+					/* The cache entry is void of any tuples. */
+					if (!DsaPointerIsValid(tuplehead))
+					{
+						node->rc_status = RC_END_OF_SCAN;
+						return NULL;
+					}
+
+					/* Fetch the first cached tuple */
+					node->shared_last_tuple = tuplehead;
+					node->rc_status = RC_CACHE_FETCH_NEXT_TUPLE;
+
+					slot = node->ss.ps.ps_ResultTupleSlot;
+					tuple = dsa_get_address(node->area, tuplehead);
+					ExecStoreMinimalTuple(SHARED_CACHE_TUPLE_DATA(tuple), slot,
+										  false);
+					return slot;
+				}
+
+				/* Handle cache miss */
+				node->stats.cache_misses += 1;	/* stats update */
+
+				/* Scan the outer node for a tuple to cache */
+				outerNode = outerPlanState(node);
+				outerslot = ExecProcNode(outerNode);
+				if (TupIsNull(outerslot))
+				{
+					/* Cache the empty result, if we had room for the key */
+					if (DsaPointerIsValid(node->shared_params))
+						shared_cache_publish(node);
+
+					node->rc_status = RC_END_OF_SCAN;
+					return NULL;
+				}
+
+				/*
+				 * If we failed to copy the parameters or failed to store the
+				 * tuple, then go into bypass mode.
+				 */
+				if (unlikely(!DsaPointerIsValid(node->shared_params) ||
+							 !shared_cache_store_tuple(node, outerslot)))
+				{
+					node->stats.cache_overflows += 1;	/* stats update */
+
+					node->rc_status = RC_CACHE_BYPASS_MODE;
+				}
+				else
+				{
+					/*
+					 * If we only expect a single row from this scan then the
+					 * entry is complete already, so let the other processes
+					 * use it straight away.
+					 */
+					if (node->singlerow)
+						shared_cache_publish(node);
+					node->rc_status = RC_FILLING_CACHE;
+				}
+
+				slot = node->ss.ps.ps_ResultTupleSlot;
+				ExecCopySlot(slot, outerslot);
+				return slot;
+			}
+
+		case RC_CACHE_FETCH_NEXT_TUPLE:
+			{
+				SharedResultCacheTuple *tuple;
+
+				/* We shouldn't be in this state if this is not set */
+				Assert(DsaPointerIsValid(node->shared_last_tuple));
+
+				/* Skip to the next tuple to output */
+				tuple = dsa_get_address(node->area, node->shared_last_tuple);
+				node->shared_last_tuple = tuple->next;
+
+				/* No more tuples in the cache */
+				if (!DsaPointerIsValid(node->shared_last_tuple))
+				{
+					node->rc_status = RC_END_OF_SCAN;
+					return NULL;
+				}
+
+				slot = node->ss.ps.ps_ResultTupleSlot;
+				tuple = dsa_get_address(node->area, node->shared_last_tuple);
+				ExecStoreMinimalTuple(SHARED_CACHE_TUPLE_DATA(tuple), slot,
+									  false);
+
+				return slot;
+			}
+
+		case RC_FILLING_CACHE:
+			{
+				TupleTableSlot *outerslot;
+
+				outerNode = outerPlanState(node);
+				outerslot = ExecProcNode(outerNode);
+				if (TupIsNull(outerslot))
+				{
+					/* No more tuples.  Publish the entry, if not done yet */
+					if (DsaPointerIsValid(node->shared_params))
+						shared_cache_publish(node);
+					node->rc_status = RC_END_OF_SCAN;
+					return NULL;
+				}
+
+				/*
+				 * Validate if the planner properly set the singlerow flag.
+				 * If it's set, we've published the entry after its first
+				 * tuple.
+				 */
+				if (unlikely(!DsaPointerIsValid(node->shared_params)))
+					elog(ERROR, "cache entry already complete");
+
+				/* Record the tuple in the current cache entry */
+				if (unlikely(!shared_cache_store_tuple(node, outerslot)))
+				{
+					/* Couldn't store it?  Handle overflow */
+					node->stats.cache_overflows += 1;	/* stats update */
+
+					node->rc_status = RC_CACHE_BYPASS_MODE;
+				}
+
+				slot = node->ss.ps.ps_ResultTupleSlot;
+				ExecCopySlot(slot, outerslot);
+				return slot;
+			}
+
+		default:
+			elog(ERROR, "unrecognized resultcache state: %d",
+				 (int) node->rc_status);
+			return NULL;
+	}							/* switch */
+}
+
 static TupleTableSlot *
 ExecResultCache(PlanState *pstate)
 {
@@ -586,6 +1114,15 @@ ExecResultCache(PlanState *pstate)
 	PlanState  *outerNode;
 	TupleTableSlot *slot;
 
+	/*
+	 * In a parallel query, the states that use the cache work on the shared
+	 * one.  Bypass mode and the end of the scan are the same for both.
+	 */
+	if (node->shared_hashtable != NULL &&
+		node->rc_status != RC_CACHE_BYPASS_MODE &&
+		node->rc_status != RC_END_OF_SCAN)
+		return ExecSharedResultCache(node);
+
 	switch (node->rc_status)
 	{
 		case RC_CACHE_LOOKUP:
@@ -933,6 +1470,14 @@ ExecInitResultCache(ResultCache *node, EState *estate, int eflags)
 	/* Zero the statistics counters */
 	memset(&rcstate->stats, 0, sizeof(ResultCacheInstrumentation));
 
+	/* We'll switch to a shared cache if we end up in a parallel query */
+	rcstate->pstate = NULL;
+	rcstate->area = NULL;
+	rcstate->shared_hashtable = NULL;
+	rcstate->shared_params = InvalidDsaPointer;
+	rcstate->shared_tuplehead = InvalidDsaPointer;
+	rcstate->shared_last_tuple = InvalidDsaPointer;
+
 	/* Allocate and set up the actual cache */
 	build_hash_table(rcstate, node->est_entries);
 
@@ -972,9 +1517,10 @@ ExecEndResultCache(ResultCacheState *node)
 #endif
 
 	/*
-	 * When ending a parallel worker, copy the statistics gathered by the
-	 * worker back into shared memory so that it can be picked up by the main
-	 * process to report in EXPLAIN ANALYZE.
+	 * When ending a parallel worker, add the statistics gathered by the
+	 * worker to shared memory so that they can be picked up by the main
+	 * process to report in EXPLAIN ANALYZE.  We add rather than copy, as a
+	 * rescanned Gather starts a new worker in the same slot each time.
 	 */
 	if (node->shared_info != NULL && IsParallelWorker())
 	{
@@ -986,9 +1532,16 @@ ExecEndResultCache(ResultCacheState *node)
 
 		Assert(ParallelWorkerNumber <= node->shared_info->num_workers);
 		si = &node->shared_info->sinstrument[ParallelWorkerNumber];
-		memcpy(si, &node->stats, sizeof(ResultCacheInstrumentation));
+		si->cache_hits += node->stats.cache_hits;
+		si->cache_misses += node->stats.cache_misses;
+		si->cache_evictions += node->stats.cache_evictions;
+		si->cache_overflows += node->stats.cache_overflows;
+		si->mem_peak = Max(si->mem_peak, node->stats.mem_peak);
 	}
 
+	/* We're normally detached already, by ExecShutdownResultCache */
+	shared_cache_detach(node);
+
 	/* Remove the cache context */
 	MemoryContextDelete(node->tableContext);
 
@@ -1028,6 +1581,18 @@ ExecReScanResultCache(ResultCacheState *node)
 
 }
 
+/* ----------------------------------------------------------------
+ *		ExecShutdownResultCache
+ *
+ *		Stop using the shared cache before its DSA area goes away.
+ * ----------------------------------------------------------------
+ */
+void
+ExecShutdownResultCache(ResultCacheState *node)
+{
+	shared_cache_detach(node);
+}
+
 /*
  * ExecEstimateCacheEntryOverheadBytes
  *		For use in the query planner to help it estimate the amount of memory
@@ -1048,7 +1613,8 @@ ExecEstimateCacheEntryOverheadBytes(double ntuples)
  /* ----------------------------------------------------------------
   *		ExecResultCacheEstimate
   *
-  *		Estimate space required to propagate result cache statistics.
+  *		Estimate space required for the shared cache's state and to
+  *		propagate result cache statistics.
   * ----------------------------------------------------------------
   */
 void
@@ -1056,12 +1622,17 @@ ExecResultCacheEstimate(ResultCacheState *node, ParallelContext *pcxt)
 {
 	Size		size;
 
-	/* don't need this if not instrumenting or no workers */
-	if (!node->ss.ps.instrument || pcxt->nworkers == 0)
+	/* don't need this if no workers */
+	if (pcxt->nworkers == 0)
 		return;
 
-	size = mul_size(pcxt->nworkers, sizeof(ResultCacheInstrumentation));
-	size = add_size(size, offsetof(SharedResultCacheInfo, sinstrument));
+	size = MAXALIGN(sizeof(ParallelResultCacheState));
+	if (node->ss.ps.instrument)
+	{
+		size = add_size(size, offsetof(SharedResultCacheInfo, sinstrument));
+		size = add_size(size, mul_size(pcxt->nworkers,
+									   sizeof(ResultCacheInstrumentation)));
+	}
 	shm_toc_estimate_chunk(&pcxt->estimator, size);
 	shm_toc_estimate_keys(&pcxt->estimator, 1);
 }
@@ -1069,39 +1640,75 @@ ExecResultCacheEstimate(ResultCacheState *node, ParallelContext *pcxt)
 /* ----------------------------------------------------------------
  *		ExecResultCacheInitializeDSM
  *
- *		Initialize DSM space for result cache statistics.
+ *		Set up the shared cache and DSM space for result cache statistics.
  * ----------------------------------------------------------------
  */
 void
 ExecResultCacheInitializeDSM(ResultCacheState *node, ParallelContext *pcxt)
 {
+	ParallelResultCacheState *pstate;
+	dsa_area   *area = node->ss.ps.state->es_query_dsa;
 	Size		size;
 
-	/* don't need this if not instrumenting or no workers */
-	if (!node->ss.ps.instrument || pcxt->nworkers == 0)
+	/* don't need this if no workers */
+	if (pcxt->nworkers == 0)
 		return;
 
-	size = offsetof(SharedResultCacheInfo, sinstrument)
-		+ pcxt->nworkers * sizeof(ResultCacheInstrumentation);
-	node->shared_info = shm_toc_allocate(pcxt->toc, size);
-	/* ensure any unfilled slots will contain zeroes */
-	memset(node->shared_info, 0, size);
-	node->shared_info->num_workers = pcxt->nworkers;
-	shm_toc_insert(pcxt->toc, node->ss.ps.plan->plan_node_id,
-				   node->shared_info);
+	size = MAXALIGN(sizeof(ParallelResultCacheState));
+	if (node->ss.ps.instrument)
+		size += offsetof(SharedResultCacheInfo, sinstrument)
+			+ pcxt->nworkers * sizeof(ResultCacheInstrumentation);
+	pstate = shm_toc_allocate(pcxt->toc, size);
+	/* ensure any unfilled instrumentation slots will contain zeroes */
+	memset(pstate, 0, size);
+
+	/*
+	 * Following parallel hash joins, give the shared cache the memory that
+	 * each participant's cache would have had.
+	 */
+	pg_atomic_init_u64(&pstate->mem_used, 0);
+	pstate->mem_limit = node->mem_limit * (pcxt->nworkers + 1);
+	pstate->handle = InvalidDsaPointer;
+
+	/* Without a DSA area, everyone keeps using their local cache */
+	if (area != NULL && node->shared_hashtable == NULL)
+	{
+		node->pstate = pstate;
+		node->area = area;
+		node->shared_hashtable = dshash_create(area, &shared_cache_params,
+											   node);
+		pstate->handle = dshash_get_hash_table_handle(node->shared_hashtable);
+	}
+
+	pstate->instrumented = (node->ss.ps.instrument != NULL);
+	if (pstate->instrumented)
+	{
+		node->shared_info = PARALLEL_RESULT_CACHE_INFO(pstate);
+		node->shared_info->num_workers = pcxt->nworkers;
+	}
+	shm_toc_insert(pcxt->toc, node->ss.ps.plan->plan_node_id, pstate);
 }
 
 /* ----------------------------------------------------------------
  *		ExecResultCacheInitializeWorker
  *
- *		Attach worker to DSM space for result cache statistics.
+ *		Attach worker to the shared cache and to DSM space for result cache
+ *		statistics.
  * ----------------------------------------------------------------
  */
 void
 ExecResultCacheInitializeWorker(ResultCacheState *node, ParallelWorkerContext *pwcxt)
 {
-	node->shared_info =
-		shm_toc_lookup(pwcxt->toc, node->ss.ps.plan->plan_node_id, true);
+	ParallelResultCacheState *pstate;
+
+	pstate = shm_toc_lookup(pwcxt->toc, node->ss.ps.plan->plan_node_id, true);
+	if (pstate == NULL)
+		return;
+
+	if (DsaPointerIsValid(pstate->handle))
+		shared_cache_attach(node, pstate);
+	if (pstate->instrumented)
+		node->shared_info = PARALLEL_RESULT_CACHE_INFO(pstate);
 }
 
 /* ----------------------------------------------------------------
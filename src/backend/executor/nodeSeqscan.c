@@ -19,6 +19,7 @@
  *		ExecInitSeqScan			creates and initializes a seqscan node.
  *		ExecEndSeqScan			releases any storage allocated.
  *		ExecReScanSeqScan		rescans the relation
+ *		ExecSeqScanEnableBatch	switches the node to batch mode
  *
  *		ExecSeqScanEstimate		estimates DSM space needed for parallel scan
  *		ExecSeqScanInitializeDSM initialize DSM for parallel scan
@@ -31,9 +32,19 @@
 #include "access/tableam.h"
 #include "executor/execdebug.h"
 #include "executor/nodeSeqscan.h"
+#include "miscadmin.h"
+#include "storage/bufmgr.h"
 #include "utils/rel.h"
 
+/*
+ * Maximum number of pages a batch may point into.  Batches of wide rows are
+ * cut short to stay under it.
+ */
+#define SEQSCAN_BATCH_MAX_PAGES		16
+
 static TupleTableSlot *SeqNext(SeqScanState *node);
+static TupleBatch *ExecSeqScanBatch(PlanState *pstate);
+static void SeqScanReleaseBatch(SeqScanState *node);
 
 /* ----------------------------------------------------------------
  *						Scan Support
@@ -114,6 +125,198 @@ ExecSeqScan(PlanState *pstate)
 					(ExecScanRecheckMtd) SeqRecheck);
 }
 
+/* ----------------------------------------------------------------
+ *		ExecSeqScanBatch(node)
+ *
+ *		Returns the next batch of qualifying tuples, in batch mode.
+ *
+ *		If the table AM supports it, the rows are fetched directly into
+ *		the batch with table_scan_getnextbatch(), otherwise they are
+ *		deformed from the scan slot.  Their pass-by-reference values can
+ *		point into the table's pages, so we keep an extra pin on each page
+ *		the batch uses until the next call.
+ * ----------------------------------------------------------------
+ */
+static TupleBatch *
+ExecSeqScanBatch(PlanState *pstate)
+{
+	SeqScanState *node = castNode(SeqScanState, pstate);
+	TupleBatch *batch = node->batch;
+	ExprContext *econtext = node->ss.ps.ps_ExprContext;
+	Relation	rel = node->ss.ss_currentRelation;
+	bool		getnextbatch = (rel->rd_tableam->scan_getnextbatch != NULL);
+
+	for (;;)
+	{
+		int			nrows = 0;
+
+		CHECK_FOR_INTERRUPTS();
+
+		/* the previous batch is no longer needed */
+		SeqScanReleaseBatch(node);
+		ResetExprContext(econtext);
+
+		if (node->batch_done)
+			return NULL;
+
+		while (nrows < EXEC_BATCH_SIZE)
+		{
+			Buffer		buffer;
+
+			if (getnextbatch)
+			{
+				int			n;
+
+				/* see SeqNext() */
+				if (node->ss.ss_currentScanDesc == NULL)
+					node->ss.ss_currentScanDesc =
+						table_beginscan(rel, node->ss.ps.state->es_snapshot,
+										0, NULL);
+
+				n = table_scan_getnextbatch(node->ss.ss_currentScanDesc,
+											batch->natts,
+											batch->values, batch->isnull,
+											nrows, EXEC_BATCH_SIZE - nrows,
+											&buffer);
+				if (n == 0)
+				{
+					node->batch_done = true;
+					break;
+				}
+				nrows += n;
+			}
+			else
+			{
+				TupleTableSlot *slot = SeqNext(node);
+
+				if (slot == NULL)
+				{
+					node->batch_done = true;
+					break;
+				}
+
+				slot_getsomeattrs(slot, batch->natts);
+				for (int col = 0; col < batch->natts; col++)
+				{
+					batch->values[col][nrows] = slot->tts_values[col];
+					batch->isnull[col][nrows] = slot->tts_isnull[col];
+				}
+				nrows++;
+
+				buffer = ((BufferHeapTupleTableSlot *) slot)->buffer;
+			}
+
+			if (BufferIsValid(buffer) &&
+				(node->batch_nbuffers == 0 ||
+				 node->batch_buffers[node->batch_nbuffers - 1] != buffer))
+			{
+				IncrBufferRefCount(buffer);
+				node->batch_buffers[node->batch_nbuffers++] = buffer;
+				if (node->batch_nbuffers == SEQSCAN_BATCH_MAX_PAGES)
+					break;
+			}
+		}
+
+		if (nrows == 0)
+			continue;
+
+		TupleBatchSelectAll(batch, nrows);
+
+		if (node->batch_qual)
+		{
+			bool		isnull;
+
+			econtext->ecxt_batch = batch;
+			(void) ExecEvalExprSwitchContext(node->batch_qual, econtext,
+											 &isnull);
+			econtext->ecxt_batch = NULL;
+
+			InstrCountFiltered1(node, nrows - batch->nvalid);
+		}
+
+		if (batch->nvalid == 0)
+			continue;
+
+		if (node->batch_result)
+		{
+			ExecProjectBatch(node->batch_result, batch, node->batch_colmap);
+			return node->batch_result;
+		}
+		return batch;
+	}
+}
+
+/*
+ * SeqScanReleaseBatch -- drop the pins held for the current batch
+ */
+static void
+SeqScanReleaseBatch(SeqScanState *node)
+{
+	for (int i = 0; i < node->batch_nbuffers; i++)
+		ReleaseBuffer(node->batch_buffers[i]);
+	node->batch_nbuffers = 0;
+}
+
+/* ----------------------------------------------------------------
+ *		ExecSeqScanEnableBatch
+ *
+ *		Switches the node to batch mode, if possible; see
+ *		ExecEnableBatchMode().  The parent needs the first natts
+ *		columns of our output.
+ * ----------------------------------------------------------------
+ */
+bool
+ExecSeqScanEnableBatch(SeqScanState *node, int natts)
+{
+	SeqScan    *plan = (SeqScan *) node->ss.ps.plan;
+	ExprState  *qual = NULL;
+	int		   *colmap = NULL;
+	int			ninputcols = natts;
+	int			qualnatts = 0;
+
+	/*
+	 * Unless the table AM can return the rows in columnar form itself, we
+	 * rely on a heap tuple staying where it is while its page is pinned.
+	 * EvalPlanQual rechecks need the regular code path.
+	 */
+	if ((node->ss.ss_currentRelation->rd_tableam->scan_getnextbatch == NULL &&
+		 node->ss.ss_ScanTupleSlot->tts_ops != &TTSOpsBufferHeapTuple) ||
+		node->ss.ps.state->es_epq_active != NULL)
+		return false;
+
+	if (node->ss.ps.ps_ProjInfo != NULL)
+	{
+		colmap = ExecBuildBatchColumnMap(plan->plan.targetlist,
+										 plan->scanrelid, &ninputcols);
+		if (colmap == NULL)
+			return false;
+	}
+
+	if (plan->plan.qual != NIL)
+	{
+		qual = ExecInitQualBatch(plan->plan.qual, &node->ss.ps, &qualnatts);
+		if (qual == NULL)
+			return false;
+	}
+
+	node->batch = MakeTupleBatch(Max(ninputcols, qualnatts));
+	if (colmap != NULL)
+	{
+		node->batch_result =
+			MakeTupleBatchHeader(list_length(plan->plan.targetlist));
+		node->batch_colmap = colmap;
+	}
+	node->batch_qual = qual;
+	node->batch_done = false;
+	node->batch_nbuffers = 0;
+	node->batch_buffers = (Buffer *)
+		palloc(sizeof(Buffer) * SEQSCAN_BATCH_MAX_PAGES);
+
+	node->ss.ps.ExecProcNodeBatchReal = ExecSeqScanBatch;
+
+	return true;
+}
+
 
 /* ----------------------------------------------------------------
  *		ExecInitSeqScan
@@ -190,6 +393,11 @@ ExecEndSeqScan(SeqScanState *node)
 	 */
 	scanDesc = node->ss.ss_currentScanDesc;
 
+	/*
+	 * release any pins held for a batch
+	 */
+	SeqScanReleaseBatch(node);
+
 	/*
 	 * Free the exprcontext
 	 */
@@ -227,6 +435,9 @@ ExecReScanSeqScan(SeqScanState *node)
 
 	scan = node->ss.ss_currentScanDesc;
 
+	SeqScanReleaseBatch(node);
+	node->batch_done = false;
+
 	if (scan != NULL)
 		table_rescan(scan,		/* scan desc */
 					 NULL);		/* new scan keys */
@@ -2348,6 +2348,66 @@ llvm_compile_expr(ExprState *state)
 				LLVMBuildBr(b, opblocks[opno + 1]);
 				break;
 
+			case EEOP_BATCH_QUAL_OP:
+				build_EvalXFunc(b, mod, "ExecEvalBatchQualOp",
+								v_state, op, v_econtext);
+				LLVMBuildBr(b, opblocks[opno + 1]);
+				break;
+
+			case EEOP_BATCH_QUAL_INT64:
+				build_EvalXFunc(b, mod, "ExecEvalBatchQualInt64",
+								v_state, op, v_econtext);
+				LLVMBuildBr(b, opblocks[opno + 1]);
+				break;
+
+			case EEOP_BATCH_QUAL_FLOAT8:
+				build_EvalXFunc(b, mod, "ExecEvalBatchQualFloat8",
+								v_state, op, v_econtext);
+				LLVMBuildBr(b, opblocks[opno + 1]);
+				break;
+
+			case EEOP_BATCH_QUAL_ROWS:
+				build_EvalXFunc(b, mod, "ExecEvalBatchQualRows",
+								v_state, op, v_econtext);
+				LLVMBuildBr(b, opblocks[opno + 1]);
+				break;
+
+			case EEOP_BATCH_AGG_TRANS_BYVAL:
+				build_EvalXFunc(b, mod, "ExecEvalBatchAggTransByVal",
+								v_state, op, v_econtext);
+				LLVMBuildBr(b, opblocks[opno + 1]);
+				break;
+
+			case EEOP_BATCH_AGG_TRANS_BYREF:
+				build_EvalXFunc(b, mod, "ExecEvalBatchAggTransByRef",
+								v_state, op, v_econtext);
+				LLVMBuildBr(b, opblocks[opno + 1]);
+				break;
+
+			case EEOP_BATCH_AGG_COUNT:
+				build_EvalXFunc(b, mod, "ExecEvalBatchAggCount",
+								v_state, op, v_econtext);
+				LLVMBuildBr(b, opblocks[opno + 1]);
+				break;
+
+			case EEOP_BATCH_AGG_SUM_INT64:
+				build_EvalXFunc(b, mod, "ExecEvalBatchAggSumInt64",
+								v_state, op, v_econtext);
+				LLVMBuildBr(b, opblocks[opno + 1]);
+				break;
+
+			case EEOP_BATCH_AGG_MIN_INT64:
+				build_EvalXFunc(b, mod, "ExecEvalBatchAggMinInt64",
+								v_state, op, v_econtext);
+				LLVMBuildBr(b, opblocks[opno + 1]);
+				break;
+
+			case EEOP_BATCH_AGG_MAX_INT64:
+				build_EvalXFunc(b, mod, "ExecEvalBatchAggMaxInt64",
+								v_state, op, v_econtext);
+				LLVMBuildBr(b, opblocks[opno + 1]);
+				break;
+
 			case EEOP_LAST:
 				Assert(false);
 				break;
@@ -107,6 +107,16 @@ void	   *referenced_functions[] =
 	ExecEvalAggOrderedTransTuple,
 	ExecEvalArrayCoerce,
 	ExecEvalArrayExpr,
+	ExecEvalBatchAggCount,
+	ExecEvalBatchAggMaxInt64,
+	ExecEvalBatchAggMinInt64,
+	ExecEvalBatchAggSumInt64,
+	ExecEvalBatchAggTransByRef,
+	ExecEvalBatchAggTransByVal,
+	ExecEvalBatchQualFloat8,
+	ExecEvalBatchQualInt64,
+	ExecEvalBatchQualOp,
+	ExecEvalBatchQualRows,
 	ExecEvalConstraintCheck,
 	ExecEvalConstraintNotNull,
 	ExecEvalConvertRowtype,
@@ -75,7 +75,7 @@ static inline uint32 mod_m(uint32 a, uint64 m);
  * implementation allocates only enough memory to target its standard false
  * positive rate, using a simple formula with caller's total_elems estimate as
  * an input.  The bitset might be as small as 1MB, even when bloom_work_mem is
- * much higher.
+ * much higher.  It is only smaller than that if bloom_work_mem is.
  *
  * The Bloom filter is seeded using a value provided by the caller.  Using a
  * distinct seed value on every call makes it unlikely that the same false
@@ -100,7 +100,8 @@ bloom_create(int64 total_elems, int bloom_work_mem, uint64 seed)
 	 * false positive rate still won't exceed 2% in almost all cases.
 	 */
 	bitset_bytes = Min(bloom_work_mem * UINT64CONST(1024), total_elems * 2);
-	bitset_bytes = Max(1024 * 1024, bitset_bytes);
+	bitset_bytes = Max(Min(bloom_work_mem * UINT64CONST(1024), 1024 * 1024),
+					   bitset_bytes);
 
 	/*
 	 * Size in bits should be the highest power of two <= target.  bitset_bits
@@ -193,6 +194,38 @@ bloom_prop_bits_set(bloom_filter *filter)
 	return bits_set / (double) filter->m;
 }
 
+/*
+ * Size of the Bloom filter, including its bitset.
+ *
+ * The filter is a single contiguous chunk of memory, so callers may copy it
+ * elsewhere, e.g. to shared memory, and use the copy as a filter in its own
+ * right.
+ */
+size_t
+bloom_size(bloom_filter *filter)
+{
+	return offsetof(bloom_filter, bitset) + filter->m / BITS_PER_BYTE;
+}
+
+/*
+ * Add all elements of src to dst.
+ *
+ * Both filters must have been created with the same total_elems,
+ * bloom_work_mem and seed arguments.
+ */
+void
+bloom_union(bloom_filter *dst, bloom_filter *src)
+{
+	uint64		bitset_bytes = dst->m / BITS_PER_BYTE;
+
+	if (dst->m != src->m || dst->k_hash_funcs != src->k_hash_funcs ||
+		dst->seed != src->seed)
+		elog(ERROR, "cannot combine Bloom filters of different shapes");
+
+	for (uint64 i = 0; i < bitset_bytes; i++)
+		dst->bitset[i] |= src->bitset[i];
+}
+
 /*
  * Which element in the sequence of powers of two is less than or equal to
  * target_bitset_bits?
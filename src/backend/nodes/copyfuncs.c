@@ -101,6 +101,8 @@ _copyPlannedStmt(const PlannedStmt *from)
 	COPY_NODE_FIELD(utilityStmt);
 	COPY_LOCATION_FIELD(stmt_location);
 	COPY_SCALAR_FIELD(stmt_len);
+	COPY_SCALAR_FIELD(joinOrderTime);
+	COPY_SCALAR_FIELD(joinSearchTime);
 
 	return newnode;
 }
@@ -415,6 +417,8 @@ CopyScanFields(const Scan *from, Scan *newnode)
 	CopyPlanFields((const Plan *) from, (Plan *) newnode);
 
 	COPY_SCALAR_FIELD(scanrelid);
+	COPY_SCALAR_FIELD(feedback_key);
+	COPY_SCALAR_FIELD(feedback_tuples);
 }
 
 /*
@@ -871,6 +875,10 @@ _copyNestLoop(const NestLoop *from)
 	 * copy remainder of node
 	 */
 	COPY_NODE_FIELD(nestParams);
+	COPY_NODE_FIELD(hashoperators);
+	COPY_NODE_FIELD(hashcollations);
+	COPY_NODE_FIELD(outerhashkeys);
+	COPY_NODE_FIELD(innerhashkeys);
 
 	return newnode;
 }
@@ -903,6 +911,9 @@ _copyMergeJoin(const MergeJoin *from)
 		COPY_POINTER_FIELD(mergeStrategies, numCols * sizeof(int));
 		COPY_POINTER_FIELD(mergeNullsFirst, numCols * sizeof(bool));
 	}
+	COPY_NODE_FIELD(rangeBounds);
+	COPY_SCALAR_FIELD(rangeFamily);
+	COPY_SCALAR_FIELD(rangeCollation);
 
 	return newnode;
 }
@@ -927,6 +938,9 @@ _copyHashJoin(const HashJoin *from)
 	COPY_NODE_FIELD(hashoperators);
 	COPY_NODE_FIELD(hashcollations);
 	COPY_NODE_FIELD(hashkeys);
+	COPY_NODE_FIELD(part_prune_info);
+	COPY_SCALAR_FIELD(part_prune_keyno);
+	COPY_SCALAR_FIELD(part_prune_paramid);
 
 	return newnode;
 }
@@ -319,6 +319,8 @@ _outPlannedStmt(StringInfo str, const PlannedStmt *node)
 	WRITE_NODE_FIELD(utilityStmt);
 	WRITE_LOCATION_FIELD(stmt_location);
 	WRITE_INT_FIELD(stmt_len);
+	WRITE_FLOAT_FIELD(joinOrderTime, "%.3f");
+	WRITE_FLOAT_FIELD(joinSearchTime, "%.3f");
 }
 
 /*
@@ -353,6 +355,8 @@ _outScanInfo(StringInfo str, const Scan *node)
 	_outPlanInfo(str, (const Plan *) node);
 
 	WRITE_UINT_FIELD(scanrelid);
+	WRITE_UINT64_FIELD(feedback_key);
+	WRITE_FLOAT_FIELD(feedback_tuples, "%.0f");
 }
 
 /*
@@ -745,6 +749,10 @@ _outNestLoop(StringInfo str, const NestLoop *node)
 	_outJoinPlanInfo(str, (const Join *) node);
 
 	WRITE_NODE_FIELD(nestParams);
+	WRITE_NODE_FIELD(hashoperators);
+	WRITE_NODE_FIELD(hashcollations);
+	WRITE_NODE_FIELD(outerhashkeys);
+	WRITE_NODE_FIELD(innerhashkeys);
 }
 
 static void
@@ -765,6 +773,9 @@ _outMergeJoin(StringInfo str, const MergeJoin *node)
 	WRITE_OID_ARRAY(mergeCollations, numCols);
 	WRITE_INT_ARRAY(mergeStrategies, numCols);
 	WRITE_BOOL_ARRAY(mergeNullsFirst, numCols);
+	WRITE_NODE_FIELD(rangeBounds);
+	WRITE_OID_FIELD(rangeFamily);
+	WRITE_OID_FIELD(rangeCollation);
 }
 
 static void
@@ -778,6 +789,9 @@ _outHashJoin(StringInfo str, const HashJoin *node)
 	WRITE_NODE_FIELD(hashoperators);
 	WRITE_NODE_FIELD(hashcollations);
 	WRITE_NODE_FIELD(hashkeys);
+	WRITE_NODE_FIELD(part_prune_info);
+	WRITE_INT_FIELD(part_prune_keyno);
+	WRITE_INT_FIELD(part_prune_paramid);
 }
 
 static void
@@ -2239,6 +2253,7 @@ _outMergePath(StringInfo str, const MergePath *node)
 	WRITE_NODE_FIELD(innersortkeys);
 	WRITE_BOOL_FIELD(skip_mark_restore);
 	WRITE_BOOL_FIELD(materialize_inner);
+	WRITE_NODE_FIELD(range_bounds);
 }
 
 static void
@@ -2276,6 +2291,8 @@ _outPlannerGlobal(StringInfo str, const PlannerGlobal *node)
 	WRITE_BOOL_FIELD(parallelModeOK);
 	WRITE_BOOL_FIELD(parallelModeNeeded);
 	WRITE_CHAR_FIELD(maxParallelHazard);
+	WRITE_FLOAT_FIELD(joinOrderTime, "%.3f");
+	WRITE_FLOAT_FIELD(joinSearchTime, "%.3f");
 }
 
 static void
@@ -2380,11 +2397,13 @@ _outRelOptInfo(StringInfo str, const RelOptInfo *node)
 	/* can't print unique_for_rels/non_unique_for_rels; BMSes aren't Nodes */
 	WRITE_NODE_FIELD(baserestrictinfo);
 	WRITE_UINT_FIELD(baserestrict_min_security);
+	WRITE_UINT64_FIELD(feedback_key);
 	WRITE_NODE_FIELD(joininfo);
 	WRITE_BOOL_FIELD(has_eclass_joins);
 	WRITE_BOOL_FIELD(consider_partitionwise_join);
 	WRITE_BITMAPSET_FIELD(top_parent_relids);
 	WRITE_BOOL_FIELD(partbounds_merged);
+	WRITE_BITMAPSET_FIELD(live_parts);
 	WRITE_BITMAPSET_FIELD(all_partrels);
 }
 
@@ -1600,6 +1600,8 @@ _readPlannedStmt(void)
 	READ_NODE_FIELD(utilityStmt);
 	READ_LOCATION_FIELD(stmt_location);
 	READ_INT_FIELD(stmt_len);
+	READ_FLOAT_FIELD(joinOrderTime);
+	READ_FLOAT_FIELD(joinSearchTime);
 
 	READ_DONE();
 }
@@ -1809,6 +1811,8 @@ ReadCommonScan(Scan *local_node)
 	ReadCommonPlan(&local_node->plan);
 
 	READ_UINT_FIELD(scanrelid);
+	READ_UINT64_FIELD(feedback_key);
+	READ_FLOAT_FIELD(feedback_tuples);
 }
 
 /*
@@ -2154,6 +2158,10 @@ _readNestLoop(void)
 	ReadCommonJoin(&local_node->join);
 
 	READ_NODE_FIELD(nestParams);
+	READ_NODE_FIELD(hashoperators);
+	READ_NODE_FIELD(hashcollations);
+	READ_NODE_FIELD(outerhashkeys);
+	READ_NODE_FIELD(innerhashkeys);
 
 	READ_DONE();
 }
@@ -2179,6 +2187,9 @@ _readMergeJoin(void)
 	READ_OID_ARRAY(mergeCollations, numCols);
 	READ_INT_ARRAY(mergeStrategies, numCols);
 	READ_BOOL_ARRAY(mergeNullsFirst, numCols);
+	READ_NODE_FIELD(rangeBounds);
+	READ_OID_FIELD(rangeFamily);
+	READ_OID_FIELD(rangeCollation);
 
 	READ_DONE();
 }
@@ -2197,6 +2208,9 @@ _readHashJoin(void)
 	READ_NODE_FIELD(hashoperators);
 	READ_NODE_FIELD(hashcollations);
 	READ_NODE_FIELD(hashkeys);
+	READ_NODE_FIELD(part_prune_info);
+	READ_INT_FIELD(part_prune_keyno);
+	READ_INT_FIELD(part_prune_paramid);
 
 	READ_DONE();
 }
@@ -35,6 +35,7 @@
 #include "optimizer/cost.h"
 #include "optimizer/geqo.h"
 #include "optimizer/inherit.h"
+#include "optimizer/joininfo.h"
 #include "optimizer/optimizer.h"
 #include "optimizer/pathnode.h"
 #include "optimizer/paths.h"
@@ -46,6 +47,7 @@
 #include "parser/parsetree.h"
 #include "partitioning/partbounds.h"
 #include "partitioning/partprune.h"
+#include "portability/instr_time.h"
 #include "rewrite/rewriteManip.h"
 #include "utils/lsyscache.h"
 
@@ -61,6 +63,7 @@ typedef struct pushdown_safety_info
 /* These parameters are set by GUC */
 bool		enable_geqo = false;	/* just in case GUC doesn't set it */
 int			geqo_threshold;
+int			linear_join_threshold = 0;
 int			min_parallel_table_scan_size;
 int			min_parallel_index_scan_size;
 
@@ -97,6 +100,8 @@ static void set_append_rel_size(PlannerInfo *root, RelOptInfo *rel,
 								Index rti, RangeTblEntry *rte);
 static void set_append_rel_pathlist(PlannerInfo *root, RelOptInfo *rel,
 									Index rti, RangeTblEntry *rte);
+static List *get_appendrel_children(PlannerInfo *root, RelOptInfo *rel,
+									Index rti, RangeTblEntry *rte);
 static void generate_orderedappend_paths(PlannerInfo *root, RelOptInfo *rel,
 										 List *live_childrels,
 										 List *all_child_pathkeys);
@@ -125,6 +130,9 @@ static void set_result_pathlist(PlannerInfo *root, RelOptInfo *rel,
 static void set_worktable_pathlist(PlannerInfo *root, RelOptInfo *rel,
 								   RangeTblEntry *rte);
 static RelOptInfo *make_rel_from_joinlist(PlannerInfo *root, List *joinlist);
+static RelOptInfo *linear_join_search(PlannerInfo *root, int levels_needed,
+									  List *initial_rels);
+static List *linear_join_order(PlannerInfo *root, List *initial_rels);
 static bool subquery_is_pushdown_safe(Query *subquery, Query *topquery,
 									  pushdown_safety_info *safetyInfo);
 static bool recurse_pushdown_safe(Node *setOp, Query *topquery,
@@ -932,6 +940,50 @@ set_foreign_pathlist(PlannerInfo *root, RelOptInfo *rel, RangeTblEntry *rte)
 	rel->fdwroutine->GetForeignPaths(root, rel, rte->relid);
 }
 
+/*
+ * get_appendrel_children
+ *	  Return the AppendRelInfos of the members of an append relation.
+ *
+ * For a partitioned table, only the partitions that survived pruning have
+ * AppendRelInfos, and live_parts says which those are.  Using it saves
+ * scanning the whole of root->append_rel_list, which has an entry for every
+ * surviving partition at all levels of the hierarchy, once for each
+ * partitioned table in it.  The result is in the same order either way.
+ */
+static List *
+get_appendrel_children(PlannerInfo *root, RelOptInfo *rel,
+					   Index rti, RangeTblEntry *rte)
+{
+	List	   *children = NIL;
+	ListCell   *l;
+
+	if (rte->rtekind == RTE_RELATION &&
+		rte->relkind == RELKIND_PARTITIONED_TABLE)
+	{
+		int			i = -1;
+
+		while ((i = bms_next_member(rel->live_parts, i)) >= 0)
+		{
+			RelOptInfo *childrel = rel->part_rels[i];
+
+			children = lappend(children,
+							   root->append_rel_array[childrel->relid]);
+		}
+		return children;
+	}
+
+	foreach(l, root->append_rel_list)
+	{
+		AppendRelInfo *appinfo = (AppendRelInfo *) lfirst(l);
+
+		/* append_rel_list contains all append rels; ignore others */
+		if (appinfo->parent_relid == rti)
+			children = lappend(children, appinfo);
+	}
+
+	return children;
+}
+
 /*
  * set_append_rel_size
  *	  Set size estimates for a simple "append relation"
@@ -991,7 +1043,7 @@ set_append_rel_size(PlannerInfo *root, RelOptInfo *rel,
 	nattrs = rel->max_attr - rel->min_attr + 1;
 	parent_attrsizes = (double *) palloc0(nattrs * sizeof(double));
 
-	foreach(l, root->append_rel_list)
+	foreach(l, get_appendrel_children(root, rel, rti, rte))
 	{
 		AppendRelInfo *appinfo = (AppendRelInfo *) lfirst(l);
 		int			childRTindex;
@@ -1000,10 +1052,6 @@ set_append_rel_size(PlannerInfo *root, RelOptInfo *rel,
 		ListCell   *parentvars;
 		ListCell   *childvars;
 
-		/* append_rel_list contains all append rels; ignore others */
-		if (appinfo->parent_relid != parentRTindex)
-			continue;
-
 		childRTindex = appinfo->child_relid;
 		childRTE = root->simple_rte_array[childRTindex];
 
@@ -1215,7 +1263,6 @@ static void
 set_append_rel_pathlist(PlannerInfo *root, RelOptInfo *rel,
 						Index rti, RangeTblEntry *rte)
 {
-	int			parentRTindex = rti;
 	List	   *live_childrels = NIL;
 	ListCell   *l;
 
@@ -1223,17 +1270,13 @@ set_append_rel_pathlist(PlannerInfo *root, RelOptInfo *rel,
 	 * Generate access paths for each member relation, and remember the
 	 * non-dummy children.
 	 */
-	foreach(l, root->append_rel_list)
+	foreach(l, get_appendrel_children(root, rel, rti, rte))
 	{
 		AppendRelInfo *appinfo = (AppendRelInfo *) lfirst(l);
 		int			childRTindex;
 		RangeTblEntry *childRTE;
 		RelOptInfo *childrel;
 
-		/* append_rel_list contains all append rels; ignore others */
-		if (appinfo->parent_relid != parentRTindex)
-			continue;
-
 		/* Re-locate the child RTE and RelOptInfo */
 		childRTindex = appinfo->child_relid;
 		childRTE = root->simple_rte_array[childRTindex];
@@ -2934,21 +2977,46 @@ make_rel_from_joinlist(PlannerInfo *root, List *joinlist)
 	}
 	else
 	{
+		RelOptInfo *rel = NULL;
+		instr_time	starttime;
+		instr_time	duration;
+
 		/*
 		 * Consider the different orders in which we could join the rels,
-		 * using a plugin, GEQO, or the regular join search code.
+		 * using a plugin, linearized DP, GEQO, or the regular join search
+		 * code.  Linearized DP gives up if it can't find a legal join order,
+		 * in which case we fall through to the others.
 		 *
 		 * We put the initial_rels list into a PlannerInfo field because
 		 * has_legal_joinclause() needs to look at it (ugly :-().
 		 */
 		root->initial_rels = initial_rels;
 
+		INSTR_TIME_SET_CURRENT(starttime);
+
 		if (join_search_hook)
-			return (*join_search_hook) (root, levels_needed, initial_rels);
-		else if (enable_geqo && levels_needed >= geqo_threshold)
-			return geqo(root, levels_needed, initial_rels);
+			rel = (*join_search_hook) (root, levels_needed, initial_rels);
 		else
-			return standard_join_search(root, levels_needed, initial_rels);
+		{
+			if (linear_join_threshold > 0 &&
+				levels_needed >= linear_join_threshold)
+				rel = linear_join_search(root, levels_needed, initial_rels);
+			if (rel == NULL)
+			{
+				if (enable_geqo && levels_needed >= geqo_threshold)
+					rel = geqo(root, levels_needed, initial_rels);
+				else
+					rel = standard_join_search(root, levels_needed,
+											   initial_rels);
+			}
+		}
+
+		/* Subproblems were solved above, so this doesn't count them twice */
+		INSTR_TIME_SET_CURRENT(duration);
+		INSTR_TIME_SUBTRACT(duration, starttime);
+		root->glob->joinSearchTime += INSTR_TIME_GET_MILLISEC(duration);
+
+		return rel;
 	}
 }
 
@@ -3067,6 +3135,186 @@ standard_join_search(PlannerInfo *root, int levels_needed, List *initial_rels)
 	return rel;
 }
 
+/*
+ * linear_join_search
+ *	  Find a join order for a large join problem using linearized dynamic
+ *	  programming.
+ *
+ * The full dynamic programming search of standard_join_search() considers
+ * every subset of the initial rels, which takes exponential time.  Here we
+ * first choose a single sequence of the rels (see linear_join_order()), and
+ * then run the same kind of search over the contiguous subsequences of it
+ * only.  For n rels, that builds O(n^2) joinrels with O(n^3) joins, and
+ * still considers bushy plans, unlike GEQO; and it is deterministic.  The
+ * price is that plans joining rels that are far apart in the sequence are
+ * never considered.
+ *
+ * The sequence might not admit any legal join order, if outer joins or
+ * lateral references constrain the order too much.  In that case we forget
+ * the joinrels we made and return NULL, so that the caller can fall back to
+ * another method.
+ */
+static RelOptInfo *
+linear_join_search(PlannerInfo *root, int levels_needed, List *initial_rels)
+{
+	int			nrels = levels_needed;
+	RelOptInfo **joinrels;
+	List	   *order;
+	int			savelength;
+	instr_time	starttime;
+	instr_time	duration;
+	int			len;
+	int			i;
+	ListCell   *lc;
+
+	Assert(list_length(initial_rels) == nrels);
+
+	INSTR_TIME_SET_CURRENT(starttime);
+	order = linear_join_order(root, initial_rels);
+	INSTR_TIME_SET_CURRENT(duration);
+	INSTR_TIME_SUBTRACT(duration, starttime);
+	root->glob->joinOrderTime += INSTR_TIME_GET_MILLISEC(duration);
+
+	/*
+	 * joinrels[i * nrels + j] is the rel joining the i'th through j'th rels
+	 * of the sequence, or NULL if they can't be joined on their own.
+	 */
+	joinrels = (RelOptInfo **) palloc0(nrels * nrels * sizeof(RelOptInfo *));
+	i = 0;
+	foreach(lc, order)
+	{
+		joinrels[i * nrels + i] = (RelOptInfo *) lfirst(lc);
+		i++;
+	}
+
+	/* Remember how to undo our additions to root->join_rel_list, as GEQO */
+	savelength = list_length(root->join_rel_list);
+
+	for (len = 2; len <= nrels; len++)
+	{
+		for (i = 0; i + len <= nrels; i++)
+		{
+			int			j = i + len - 1;
+			RelOptInfo *joinrel = NULL;
+			int			pass;
+			int			k;
+
+			/*
+			 * Build paths for every way of splitting the subsequence in two.
+			 * As in join_search_one_level(), resort to clauseless joins only
+			 * if there is no split that has a join clause.
+			 */
+			for (pass = 0; pass < 2 && joinrel == NULL; pass++)
+			{
+				bool		clauseless = (pass == 1);
+
+				for (k = i; k < j; k++)
+				{
+					RelOptInfo *rel1 = joinrels[i * nrels + k];
+					RelOptInfo *rel2 = joinrels[(k + 1) * nrels + j];
+					RelOptInfo *rel;
+
+					if (rel1 == NULL || rel2 == NULL)
+						continue;
+					if (!clauseless &&
+						!have_relevant_joinclause(root, rel1, rel2) &&
+						!have_join_order_restriction(root, rel1, rel2))
+						continue;
+
+					rel = make_join_rel(root, rel1, rel2);
+					if (rel != NULL)
+						joinrel = rel;
+				}
+			}
+
+			if (joinrel == NULL)
+				continue;
+
+			/* As in standard_join_search(), now that all paths are in */
+			generate_partitionwise_join_paths(root, joinrel);
+			if (len < nrels)
+				generate_useful_gather_paths(root, joinrel, false);
+			set_cheapest(joinrel);
+
+#ifdef OPTIMIZER_DEBUG
+			debug_print_rel(root, joinrel);
+#endif
+
+			joinrels[i * nrels + j] = joinrel;
+		}
+	}
+
+	if (joinrels[nrels - 1] == NULL)
+	{
+		/*
+		 * Forget the joinrels we made.  join_rel_hash might have entries for
+		 * them too, so throw it away; it is rebuilt when next needed.
+		 */
+		root->join_rel_list = list_truncate(root->join_rel_list, savelength);
+		root->join_rel_hash = NULL;
+		return NULL;
+	}
+
+	return joinrels[nrels - 1];
+}
+
+/*
+ * linear_join_order
+ *	  Choose the sequence of rels for linear_join_search().
+ *
+ * Good plans join rels that share join clauses, and join the rels that
+ * produce few rows early.  So we start from the smallest rel, and keep
+ * appending the smallest rel that can be joined to one of those already in
+ * the sequence, or the smallest of all if there is none.  This is a greedy
+ * simplification of the IKKBZ ordering, which needs per-join cost estimates
+ * that we don't have until the joinrels are built.
+ */
+static List *
+linear_join_order(PlannerInfo *root, List *initial_rels)
+{
+	List	   *remaining = list_copy(initial_rels);
+	List	   *order = NIL;
+
+	while (remaining != NIL)
+	{
+		RelOptInfo *best = NULL;
+		bool		best_joinable = false;
+		ListCell   *lc;
+
+		foreach(lc, remaining)
+		{
+			RelOptInfo *rel = (RelOptInfo *) lfirst(lc);
+			bool		joinable = false;
+			ListCell   *lc2;
+
+			foreach(lc2, order)
+			{
+				RelOptInfo *prev_rel = (RelOptInfo *) lfirst(lc2);
+
+				if (have_relevant_joinclause(root, prev_rel, rel) ||
+					have_join_order_restriction(root, prev_rel, rel))
+				{
+					joinable = true;
+					break;
+				}
+			}
+
+			if (best == NULL ||
+				(joinable && !best_joinable) ||
+				(joinable == best_joinable && rel->rows < best->rows))
+			{
+				best = rel;
+				best_joinable = joinable;
+			}
+		}
+
+		order = lappend(order, best);
+		remaining = list_delete_ptr(remaining, best);
+	}
+
+	return order;
+}
+
 /*****************************************************************************
  *			PUSHING QUALS DOWN INTO SUBQUERIES
  *****************************************************************************/
@@ -3838,8 +4086,6 @@ generate_partitionwise_join_paths(PlannerInfo *root, RelOptInfo *rel)
 {
 	List	   *live_children = NIL;
 	int			cnt_parts;
-	int			num_parts;
-	RelOptInfo **part_rels;
 
 	/* Handle only join relations here. */
 	if (!IS_JOIN_REL(rel))
@@ -3855,17 +4101,16 @@ generate_partitionwise_join_paths(PlannerInfo *root, RelOptInfo *rel)
 	/* Guard against stack overflow due to overly deep partition hierarchy. */
 	check_stack_depth();
 
-	num_parts = rel->nparts;
-	part_rels = rel->part_rels;
-
-	/* Collect non-dummy child-joins. */
-	for (cnt_parts = 0; cnt_parts < num_parts; cnt_parts++)
+	/*
+	 * Collect non-dummy child-joins.  Those that have been pruned entirely
+	 * aren't in live_parts, and are certainly dummy.
+	 */
+	cnt_parts = -1;
+	while ((cnt_parts = bms_next_member(rel->live_parts, cnt_parts)) >= 0)
 	{
-		RelOptInfo *child_rel = part_rels[cnt_parts];
+		RelOptInfo *child_rel = rel->part_rels[cnt_parts];
 
-		/* If it's been pruned entirely, it's certainly dummy. */
-		if (child_rel == NULL)
-			continue;
+		Assert(child_rel != NULL);
 
 		/* Add partitionwise join paths for partitioned child-joins. */
 		generate_partitionwise_join_paths(root, child_rel);
@@ -76,6 +76,7 @@
 #include "access/amapi.h"
 #include "access/htup_details.h"
 #include "access/tsmapi.h"
+#include "catalog/pg_class.h"
 #include "executor/executor.h"
 #include "executor/nodeAgg.h"
 #include "executor/nodeHash.h"
@@ -83,6 +84,7 @@
 #include "miscadmin.h"
 #include "nodes/makefuncs.h"
 #include "nodes/nodeFuncs.h"
+#include "optimizer/cardfeedback.h"
 #include "optimizer/clauses.h"
 #include "optimizer/cost.h"
 #include "optimizer/optimizer.h"
@@ -148,6 +150,8 @@ bool		enable_partitionwise_join = false;
 bool		enable_partitionwise_aggregate = false;
 bool		enable_parallel_append = true;
 bool		enable_parallel_hash = true;
+bool		enable_parallel_hashagg = false;
+bool		enable_parallel_mergejoin = false;
 bool		enable_partition_pruning = true;
 bool		enable_async_append = true;
 
@@ -2747,6 +2751,51 @@ cost_agg(Path *path, PlannerInfo *root,
 	path->total_cost = total_cost;
 }
 
+/*
+ * cost_parallel_agg
+ *		Determines and returns the cost of performing a Parallel HashAgg plan
+ *		node, including the cost of its partial input.
+ *
+ * Each participant routes its share of the input to a set of shared
+ * partitions, one per group of grouping keys, and then aggregates whole
+ * partitions.  So each does the work of a HashAgg over its share of the
+ * input and of the groups, plus writing its share of the input to temporary
+ * files and reading it back.
+ *
+ * numGroups is the total number of groups; input_tuples is the number of
+ * tuples per participant, as for any partial path.
+ */
+void
+cost_parallel_agg(Path *path, PlannerInfo *root,
+				  const AggClauseCosts *aggcosts,
+				  int numGroupCols, double numGroups,
+				  List *quals,
+				  Cost input_startup_cost, Cost input_total_cost,
+				  double input_tuples, double input_width)
+{
+	double		parallel_divisor = get_parallel_divisor(path);
+	double		pages;
+	Cost		write_cost;
+	Cost		read_cost;
+
+	cost_agg(path, root, AGG_HASHED, aggcosts,
+			 numGroupCols, clamp_row_est(numGroups / parallel_divisor),
+			 quals,
+			 input_startup_cost, input_total_cost,
+			 input_tuples, input_width);
+
+	/*
+	 * The partitions are written sequentially, and all of them before any
+	 * group can be emitted.  Charge the same CPU cost per tuple as spilling.
+	 */
+	pages = relation_byte_size(input_tuples, input_width) / BLCKSZ;
+	write_cost = pages * seq_page_cost + input_tuples * cpu_tuple_cost;
+	read_cost = pages * seq_page_cost + input_tuples * cpu_tuple_cost;
+
+	path->startup_cost += write_cost;
+	path->total_cost += write_cost + read_cost;
+}
+
 /*
  * cost_windowagg
  *		Determines and returns the cost of performing a WindowAgg plan node,
@@ -3564,8 +3613,11 @@ final_cost_mergejoin(PlannerInfo *root, MergePath *path,
 
 	/*
 	 * If we don't need mark/restore at all, we don't need materialization.
+	 * A parallel-aware merge join restricts its index scan inputs to one key
+	 * range at a time, which a Material node in between would hide; the index
+	 * scan supports mark/restore by itself anyway.
 	 */
-	if (path->skip_mark_restore)
+	if (path->skip_mark_restore || path->jpath.path.parallel_aware)
 		path->materialize_inner = false;
 
 	/*
@@ -3647,6 +3699,14 @@ final_cost_mergejoin(PlannerInfo *root, MergePath *path,
 	cpu_per_tuple = cpu_tuple_cost + qp_qual_cost.per_tuple;
 	run_cost += cpu_per_tuple * mergejointuples;
 
+	/*
+	 * In a parallel-aware merge join, each process joins only the key ranges
+	 * it claims, so the work done by the inputs and by the join itself is
+	 * divided among the processes.  The output row count was scaled already.
+	 */
+	if (path->jpath.path.parallel_aware)
+		run_cost /= get_parallel_divisor(&path->jpath.path);
+
 	/* tlist eval costs are paid per output row, not per tuple scanned */
 	startup_cost += path->jpath.path.pathtarget->cost.startup;
 	run_cost += path->jpath.path.pathtarget->cost.per_tuple * path->jpath.path.rows;
@@ -4920,21 +4980,39 @@ approx_tuple_count(PlannerInfo *root, JoinPath *path, List *quals)
  *		  restriction clauses).
  *	width: the estimated average output tuple width in bytes.
  *	baserestrictcost: estimated cost of evaluating baserestrictinfo clauses.
+ *	feedback_key: key of the rel's scans for cardinality feedback, if any.
  */
 void
 set_baserel_size_estimates(PlannerInfo *root, RelOptInfo *rel)
 {
+	RangeTblEntry *rte = planner_rt_fetch(rel->relid, root);
+	Selectivity selec;
 	double		nrows;
 
 	/* Should only be applied to base relations */
 	Assert(rel->relid > 0);
 
-	nrows = rel->tuples *
-		clauselist_selectivity(root,
-							   rel->baserestrictinfo,
-							   0,
-							   JOIN_INNER,
-							   NULL);
+	/*
+	 * If scans of this table with the same restriction clauses have been
+	 * seen to return some fraction of it, believe that rather than our own
+	 * estimate, which is likely off because the clauses are correlated.
+	 */
+	if (rte->rtekind == RTE_RELATION &&
+		(rte->relkind == RELKIND_RELATION ||
+		 rte->relkind == RELKIND_MATVIEW) &&
+		rte->tablesample == NULL)
+		rel->feedback_key = CardinalityFeedbackKey(rte->relid,
+												   rel->baserestrictinfo);
+
+	if (rel->feedback_key == 0 ||
+		!CardinalityFeedbackLookup(rel->feedback_key, &selec))
+		selec = clauselist_selectivity(root,
+									   rel->baserestrictinfo,
+									   0,
+									   JOIN_INNER,
+									   NULL);
+
+	nrows = rel->tuples * selec;
 
 	rel->rows = clamp_row_est(nrows);
 
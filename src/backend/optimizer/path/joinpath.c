@@ -16,14 +16,23 @@
 
 #include <math.h>
 
+#include "access/stratnum.h"
+#include "catalog/pg_am.h"
+#include "catalog/pg_statistic.h"
+#include "catalog/pg_type.h"
 #include "executor/executor.h"
 #include "foreign/fdwapi.h"
+#include "nodes/makefuncs.h"
 #include "nodes/nodeFuncs.h"
 #include "optimizer/cost.h"
 #include "optimizer/optimizer.h"
 #include "optimizer/pathnode.h"
 #include "optimizer/paths.h"
 #include "optimizer/planmain.h"
+#include "parser/parse_coerce.h"
+#include "utils/datum.h"
+#include "utils/lsyscache.h"
+#include "utils/selfuncs.h"
 #include "utils/typcache.h"
 
 /* Hook for plugins to get control in add_paths_to_joinrel() */
@@ -74,6 +83,12 @@ static void consider_parallel_mergejoin(PlannerInfo *root,
 										JoinType jointype,
 										JoinPathExtraData *extra,
 										Path *inner_cheapest_total);
+static void consider_parallel_range_mergejoin(PlannerInfo *root,
+											  RelOptInfo *joinrel,
+											  RelOptInfo *outerrel,
+											  RelOptInfo *innerrel,
+											  JoinType jointype,
+											  JoinPathExtraData *extra);
 static void hash_inner_and_outer(PlannerInfo *root, RelOptInfo *joinrel,
 								 RelOptInfo *outerrel, RelOptInfo *innerrel,
 								 JoinType jointype, JoinPathExtraData *extra);
@@ -291,6 +306,14 @@ add_paths_to_joinrel(PlannerInfo *root,
 		match_unsorted_outer(root, joinrel, outerrel, innerrel,
 							 jointype, &extra);
 
+	/*
+	 * 2a. Consider parallel-aware mergejoins, in which the participants join
+	 * disjoint key ranges of two index scans.
+	 */
+	if (mergejoin_allowed && enable_mergejoin && enable_parallel_mergejoin)
+		consider_parallel_range_mergejoin(root, joinrel, outerrel, innerrel,
+										  jointype, &extra);
+
 #ifdef NOT_USED
 
 	/*
@@ -1823,6 +1846,265 @@ consider_parallel_mergejoin(PlannerInfo *root,
 	}
 }
 
+/*
+ * range_mergejoin_input_key
+ *	  Check whether 'path' can be an input of a parallel-aware mergejoin whose
+ *	  leading merge key is 'pathkey'.  If so, return the Var of the key.
+ *
+ * The path must be an unparameterized btree index scan whose first column is
+ * the key, so that the executor can restrict it to a key range by adding
+ * scan keys on that column.
+ */
+static Var *
+range_mergejoin_input_key(Path *path, PathKey *pathkey)
+{
+	IndexPath  *ipath;
+	IndexOptInfo *index;
+	ListCell   *lc;
+
+	if ((path->pathtype != T_IndexScan &&
+		 path->pathtype != T_IndexOnlyScan) ||
+		path->param_info != NULL ||
+		!path->parallel_safe)
+		return NULL;
+
+	ipath = (IndexPath *) path;
+	index = ipath->indexinfo;
+	if (index->relam != BTREE_AM_OID ||
+		ipath->indexorderbys != NIL ||
+		index->indexkeys[0] == 0 ||
+		index->sortopfamily == NULL ||
+		index->sortopfamily[0] != pathkey->pk_opfamily ||
+		index->indexcollations[0] != pathkey->pk_eclass->ec_collation ||
+		pathkey->pk_eclass->ec_has_const)
+		return NULL;
+
+	foreach(lc, pathkey->pk_eclass->ec_members)
+	{
+		EquivalenceMember *em = (EquivalenceMember *) lfirst(lc);
+		Expr	   *expr = em->em_expr;
+
+		while (expr && IsA(expr, RelabelType))
+			expr = ((RelabelType *) expr)->arg;
+
+		if (expr && IsA(expr, Var) &&
+			((Var *) expr)->varno == index->rel->relid &&
+			((Var *) expr)->varattno == index->indexkeys[0] &&
+			((Var *) expr)->varlevelsup == 0)
+			return (Var *) expr;
+	}
+
+	return NULL;
+}
+
+/*
+ * range_mergejoin_ops_exist
+ *	  Check that the executor will find the operators to compare the first
+ *	  column of the path's index with range boundaries of type 'boundtype'.
+ */
+static bool
+range_mergejoin_ops_exist(Path *path, Oid boundtype)
+{
+	IndexOptInfo *index = ((IndexPath *) path)->indexinfo;
+
+	return OidIsValid(get_opfamily_member(index->sortopfamily[0],
+										  index->opcintype[0],
+										  boundtype,
+										  BTGreaterEqualStrategyNumber)) &&
+		OidIsValid(get_opfamily_member(index->sortopfamily[0],
+									   index->opcintype[0],
+									   boundtype,
+									   BTLessStrategyNumber));
+}
+
+/*
+ * range_mergejoin_bounds
+ *	  Choose boundaries that split 'key' into about 'nranges' ranges of equal
+ *	  size, according to the histogram of the column.
+ *
+ * The boundaries are returned as a list of Consts of type 'boundtype', in
+ * ascending order of the btree opfamily of 'pathkey'.  Returns NIL if there
+ * is no usable histogram.
+ */
+static List *
+range_mergejoin_bounds(PlannerInfo *root, Var *key, PathKey *pathkey,
+					   Oid boundtype, int nranges)
+{
+	VariableStatData vardata;
+	AttStatsSlot sslot;
+	List	   *bounds = NIL;
+
+	examine_variable(root, (Node *) key, 0, &vardata);
+
+	/*
+	 * Values of the histogram end up in the plan, so insist on the same
+	 * privileges as for looking at them directly.
+	 */
+	if (HeapTupleIsValid(vardata.statsTuple) && vardata.acl_ok &&
+		get_attstatsslot(&sslot, vardata.statsTuple,
+						 STATISTIC_KIND_HISTOGRAM, InvalidOid,
+						 ATTSTATSSLOT_VALUES))
+	{
+		Oid			ltop = get_opfamily_member(pathkey->pk_opfamily,
+											   boundtype, boundtype,
+											   BTLessStrategyNumber);
+
+		/* the histogram must be sorted the way the merge key is */
+		if (sslot.staop == ltop && OidIsValid(ltop) &&
+			sslot.stacoll == pathkey->pk_eclass->ec_collation &&
+			sslot.nvalues > 2)
+		{
+			int16		typlen;
+			bool		typbyval;
+			int			previdx = 0;
+			int			i;
+
+			get_typlenbyval(boundtype, &typlen, &typbyval);
+
+			for (i = 1; i < nranges; i++)
+			{
+				int			idx = (int) ((double) i * (sslot.nvalues - 1) / nranges);
+
+				if (idx <= previdx)
+					continue;
+				bounds = lappend(bounds,
+								 makeConst(boundtype, -1,
+										   pathkey->pk_eclass->ec_collation,
+										   typlen,
+										   datumCopy(sslot.values[idx],
+													 typbyval, typlen),
+										   false, typbyval));
+				previdx = idx;
+			}
+		}
+		free_attstatsslot(&sslot);
+	}
+
+	ReleaseVariableStats(vardata);
+
+	return bounds;
+}
+
+/*
+ * consider_parallel_range_mergejoin
+ *	  Try to build partial paths for a joinrel by joining ordered index scans
+ *	  of both relations, with the participants splitting the leading merge
+ *	  key into ranges and joining one range at a time.
+ *
+ * Unlike consider_parallel_mergejoin, this doesn't need a partial path for
+ * the outer relation, and neither input is scanned in full by every
+ * participant.  Rows whose key is null fall in no range, so only inner joins
+ * and semijoins can be done this way.
+ *
+ * 'joinrel' is the join relation
+ * 'outerrel' is the outer join relation
+ * 'innerrel' is the inner join relation
+ * 'jointype' is the type of join to do
+ * 'extra' contains additional input values
+ */
+static void
+consider_parallel_range_mergejoin(PlannerInfo *root,
+								  RelOptInfo *joinrel,
+								  RelOptInfo *outerrel,
+								  RelOptInfo *innerrel,
+								  JoinType jointype,
+								  JoinPathExtraData *extra)
+{
+	int			parallel_workers;
+	ListCell   *lc1;
+
+	if ((jointype != JOIN_INNER && jointype != JOIN_SEMI) ||
+		!joinrel->consider_parallel ||
+		!bms_is_empty(joinrel->lateral_relids) ||
+		extra->mergeclause_list == NIL ||
+		!IS_SIMPLE_REL(outerrel) ||
+		!IS_SIMPLE_REL(innerrel))
+		return;
+
+	parallel_workers = compute_parallel_worker(outerrel, outerrel->pages, -1,
+											   max_parallel_workers_per_gather);
+	if (parallel_workers <= 0)
+		return;
+
+	foreach(lc1, outerrel->pathlist)
+	{
+		Path	   *outerpath = (Path *) lfirst(lc1);
+		Path	   *innerpath = NULL;
+		PathKey    *pathkey;
+		Var		   *outerkey;
+		Oid			boundtype;
+		List	   *mergeclauses;
+		List	   *innersortkeys;
+		List	   *bounds;
+		JoinCostWorkspace workspace;
+		ListCell   *lc2;
+
+		if (outerpath->pathkeys == NIL)
+			continue;
+		pathkey = linitial_node(PathKey, outerpath->pathkeys);
+		outerkey = range_mergejoin_input_key(outerpath, pathkey);
+		if (outerkey == NULL)
+			continue;
+
+		/*
+		 * The boundaries are compared with the index columns using the
+		 * operators of the outer index's opclass.  Polymorphic opclasses have
+		 * no concrete type for the boundaries.
+		 */
+		boundtype = ((IndexPath *) outerpath)->indexinfo->opcintype[0];
+		if (IsPolymorphicType(boundtype) ||
+			!IsBinaryCoercible(outerkey->vartype, boundtype) ||
+			!range_mergejoin_ops_exist(outerpath, boundtype))
+			continue;
+
+		mergeclauses = find_mergeclauses_for_outer_pathkeys(root,
+															outerpath->pathkeys,
+															extra->mergeclause_list);
+		if (mergeclauses == NIL)
+			continue;
+		innersortkeys = make_inner_pathkeys_for_merge(root, mergeclauses,
+													  outerpath->pathkeys);
+
+		/* find the cheapest inner index scan that delivers that order */
+		foreach(lc2, innerrel->pathlist)
+		{
+			Path	   *path = (Path *) lfirst(lc2);
+
+			if (range_mergejoin_input_key(path,
+										  linitial_node(PathKey, innersortkeys)) == NULL ||
+				!pathkeys_contained_in(innersortkeys, path->pathkeys) ||
+				!range_mergejoin_ops_exist(path, boundtype))
+				continue;
+			if (innerpath == NULL || path->total_cost < innerpath->total_cost)
+				innerpath = path;
+		}
+		if (innerpath == NULL)
+			continue;
+
+		/* use several ranges per participant, to even out the work */
+		bounds = range_mergejoin_bounds(root, outerkey, pathkey, boundtype,
+										(parallel_workers + 1) * 4);
+		if (bounds == NIL)
+			continue;
+
+		initial_cost_mergejoin(root, &workspace, jointype, mergeclauses,
+							   outerpath, innerpath, NIL, NIL, extra);
+
+		add_partial_path(joinrel, (Path *)
+						 create_parallel_mergejoin_path(root,
+														joinrel,
+														jointype,
+														&workspace,
+														extra,
+														outerpath,
+														innerpath,
+														extra->restrictlist,
+														mergeclauses,
+														bounds,
+														parallel_workers));
+	}
+}
+
 /*
  * consider_parallel_nestloop
  *	  Try to build partial paths for a joinrel by joining a partial path for the
@@ -163,6 +163,9 @@ static CustomScan *create_customscan_plan(PlannerInfo *root,
 static NestLoop *create_nestloop_plan(PlannerInfo *root, NestPath *best_path);
 static MergeJoin *create_mergejoin_plan(PlannerInfo *root, MergePath *best_path);
 static HashJoin *create_hashjoin_plan(PlannerInfo *root, HashPath *best_path);
+static void make_hashjoin_pruneinfo(PlannerInfo *root, HashPath *best_path,
+									HashJoin *join_plan, Plan *outer_plan,
+									List *hashclauses);
 static Node *replace_nestloop_params(PlannerInfo *root, Node *expr);
 static Node *replace_nestloop_params_mutator(Node *node, PlannerInfo *root);
 static void fix_indexqual_references(PlannerInfo *root, IndexPath *index_path,
@@ -783,6 +786,29 @@ create_scan_plan(PlannerInfo *root, Path *best_path, int flags)
 			break;
 	}
 
+	/*
+	 * Have the executor report the rows returned by the scan for cardinality
+	 * feedback, if they are what set_baserel_size_estimates estimated.
+	 */
+	if (rel->feedback_key != 0 && best_path->param_info == NULL &&
+		!best_path->parallel_aware)
+	{
+		switch (nodeTag(plan))
+		{
+			case T_SeqScan:
+			case T_IndexScan:
+			case T_IndexOnlyScan:
+			case T_BitmapHeapScan:
+			case T_TidScan:
+			case T_TidRangeScan:
+				((Scan *) plan)->feedback_key = rel->feedback_key;
+				((Scan *) plan)->feedback_tuples = rel->tuples;
+				break;
+			default:
+				break;
+		}
+	}
+
 	/*
 	 * If there are any pseudoconstant clauses attached to this node, insert a
 	 * gating Result node that evaluates the pseudoconstants as one-time
@@ -4288,6 +4314,56 @@ create_nestloop_plan(PlannerInfo *root,
 							  best_path->jointype,
 							  best_path->inner_unique);
 
+	/*
+	 * If the inner side doesn't depend on the outer row, the executor can
+	 * switch to hashing it if the outer side returns many more rows than we
+	 * estimated.  Tell it which join clauses it can use as hash keys.  These
+	 * are chosen the same way as in hash_inner_and_outer().
+	 */
+	if (nestParams == NIL)
+	{
+		Relids		innerrelids = best_path->innerjoinpath->parent->relids;
+		List	   *hashclauses = NIL;
+		ListCell   *lc;
+
+		foreach(lc, joinrestrictclauses)
+		{
+			RestrictInfo *rinfo = lfirst_node(RestrictInfo, lc);
+
+			if (IS_OUTER_JOIN(best_path->jointype) &&
+				RINFO_IS_PUSHED_DOWN(rinfo, best_path->path.parent->relids))
+				continue;
+			if (rinfo->pseudoconstant || !rinfo->can_join ||
+				rinfo->hashjoinoperator == InvalidOid)
+				continue;
+			if ((bms_is_subset(rinfo->left_relids, outerrelids) &&
+				 bms_is_subset(rinfo->right_relids, innerrelids)) ||
+				(bms_is_subset(rinfo->left_relids, innerrelids) &&
+				 bms_is_subset(rinfo->right_relids, outerrelids)))
+				hashclauses = lappend(hashclauses, rinfo);
+		}
+
+		/* put the outer side on the left, like create_hashjoin_plan does */
+		hashclauses = get_switched_clauses(hashclauses, outerrelids);
+		if (best_path->path.param_info)
+			hashclauses = (List *)
+				replace_nestloop_params(root, (Node *) hashclauses);
+
+		foreach(lc, hashclauses)
+		{
+			OpExpr	   *hclause = lfirst_node(OpExpr, lc);
+
+			join_plan->hashoperators = lappend_oid(join_plan->hashoperators,
+												   hclause->opno);
+			join_plan->hashcollations = lappend_oid(join_plan->hashcollations,
+													hclause->inputcollid);
+			join_plan->outerhashkeys = lappend(join_plan->outerhashkeys,
+											   linitial(hclause->args));
+			join_plan->innerhashkeys = lappend(join_plan->innerhashkeys,
+											   lsecond(hclause->args));
+		}
+	}
+
 	copy_generic_path_info(&join_plan->join.plan, &best_path->path);
 
 	return join_plan;
@@ -4594,6 +4670,17 @@ create_mergejoin_plan(PlannerInfo *root,
 							   best_path->jpath.inner_unique,
 							   best_path->skip_mark_restore);
 
+	/*
+	 * A parallel-aware merge join splits the leading merge key into ranges,
+	 * which are ordered like the first mergeclause.
+	 */
+	if (best_path->range_bounds != NIL)
+	{
+		join_plan->rangeBounds = best_path->range_bounds;
+		join_plan->rangeFamily = mergefamilies[0];
+		join_plan->rangeCollation = mergecollations[0];
+	}
+
 	/* Costs of sort and material steps are included in path cost already */
 	copy_generic_path_info(&join_plan->join.plan, &best_path->jpath.path);
 
@@ -4770,9 +4857,117 @@ create_hashjoin_plan(PlannerInfo *root,
 
 	copy_generic_path_info(&join_plan->join.plan, &best_path->jpath.path);
 
+	make_hashjoin_pruneinfo(root, best_path, join_plan, outer_plan,
+							hashclauses);
+
 	return join_plan;
 }
 
+/*
+ * make_hashjoin_pruneinfo
+ *	  Let a hash join prune the subplans of its outer Append by the values of
+ *	  an inner hash key, if the Append scans the partitions of a table
+ *	  partitioned on the matching outer key.
+ *
+ * We build the pruning steps for a clause "outer_key op $n", where $n is a
+ * new PARAM_EXEC Param; the executor sets $n to each distinct value of the
+ * inner key found while building the hash table, and scans only the
+ * partitions that match one of them.  That's only correct if outer rows that
+ * find no match are thrown away, and it's only worth trying with a single
+ * hash table that sees all inner rows, so not for Parallel Hash.
+ */
+static void
+make_hashjoin_pruneinfo(PlannerInfo *root, HashPath *best_path,
+						HashJoin *join_plan, Plan *outer_plan,
+						List *hashclauses)
+{
+	Path	   *outer_path = best_path->jpath.outerjoinpath;
+	RelOptInfo *rel = outer_path->parent;
+	int			keyno;
+	ListCell   *lc;
+
+	if (!enable_partition_pruning)
+		return;
+	if (best_path->jpath.jointype != JOIN_INNER &&
+		best_path->jpath.jointype != JOIN_SEMI &&
+		best_path->jpath.jointype != JOIN_RIGHT)
+		return;
+	if (best_path->jpath.path.parallel_aware)
+		return;
+
+	/*
+	 * The Append's subplans must correspond to the path's subpaths, which is
+	 * what make_partition_pruneinfo() maps partitions to.
+	 */
+	if (!IsA(outer_path, AppendPath) || !IsA(outer_plan, Append) ||
+		outer_path->parallel_aware)
+		return;
+	if (rel->reloptkind != RELOPT_BASEREL || !IS_PARTITIONED_REL(rel))
+		return;
+
+	keyno = 0;
+	foreach(lc, hashclauses)
+	{
+		OpExpr	   *hclause = lfirst_node(OpExpr, lc);
+		Node	   *outer_key = (Node *) linitial(hclause->args);
+		Node	   *inner_key = (Node *) lsecond(hclause->args);
+		bool		is_partkey = false;
+		int			i;
+
+		/*
+		 * Don't waste a Param on clauses that can't match the partition key;
+		 * make_partition_pruneinfo() does the real matching.
+		 */
+		while (IsA(outer_key, RelabelType))
+			outer_key = (Node *) ((RelabelType *) outer_key)->arg;
+		for (i = 0; i < rel->part_scheme->partnatts && !is_partkey; i++)
+		{
+			ListCell   *lc2;
+
+			foreach(lc2, rel->partexprs[i])
+			{
+				Node	   *partexpr = (Node *) lfirst(lc2);
+
+				while (IsA(partexpr, RelabelType))
+					partexpr = (Node *) ((RelabelType *) partexpr)->arg;
+				if (equal(outer_key, partexpr))
+				{
+					is_partkey = true;
+					break;
+				}
+			}
+		}
+
+		if (is_partkey)
+		{
+			Param	   *param;
+			Expr	   *pruneclause;
+			PartitionPruneInfo *pruneinfo;
+
+			param = generate_new_exec_param(root,
+											exprType(inner_key),
+											exprTypmod(inner_key),
+											exprCollation(inner_key));
+			pruneclause = make_opclause(hclause->opno, BOOLOID, false,
+										(Expr *) linitial(hclause->args),
+										(Expr *) param,
+										InvalidOid, hclause->inputcollid);
+			pruneinfo = make_partition_pruneinfo(root, rel,
+												 ((AppendPath *) outer_path)->subpaths,
+												 list_make1(pruneclause));
+			if (pruneinfo != NULL)
+			{
+				join_plan->part_prune_info = pruneinfo;
+				join_plan->part_prune_keyno = keyno;
+				join_plan->part_prune_paramid = param->paramid;
+				return;
+			}
+		}
+
+		keyno++;
+	}
+}
+
 
 /*****************************************************************************
  *
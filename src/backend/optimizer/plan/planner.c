@@ -310,6 +310,8 @@ standard_planner(Query *parse, const char *query_string, int cursorOptions,
 	glob->lastPlanNodeId = 0;
 	glob->transientPlan = false;
 	glob->dependsOnRole = false;
+	glob->joinOrderTime = 0;
+	glob->joinSearchTime = 0;
 
 	/*
 	 * Assess whether it's feasible to use parallel mode for this query. We
@@ -525,6 +527,8 @@ standard_planner(Query *parse, const char *query_string, int cursorOptions,
 	result->utilityStmt = parse->utilityStmt;
 	result->stmt_location = parse->stmt_location;
 	result->stmt_len = parse->stmt_len;
+	result->joinOrderTime = glob->joinOrderTime;
+	result->joinSearchTime = glob->joinSearchTime;
 
 	result->jitFlags = PGJIT_NONE;
 	if (jit_enabled && jit_above_cost >= 0 &&
@@ -6276,6 +6280,33 @@ add_paths_to_grouping_rel(PlannerInfo *root, RelOptInfo *input_rel,
 									 dNumGroups));
 		}
 
+		/*
+		 * Consider a Parallel HashAgg over the cheapest partial input path,
+		 * in which the participants share out the groups rather than each
+		 * computing partial results for all of them.  This needs no combine
+		 * functions and no Finalize step.
+		 */
+		if (enable_parallel_hashagg && !parse->groupingSets &&
+			grouped_rel->consider_parallel &&
+			input_rel->partial_pathlist != NIL)
+		{
+			Path	   *path = (Path *) linitial(input_rel->partial_pathlist);
+			double		total_groups = dNumGroups;
+
+			path = (Path *) create_parallel_agg_path(root,
+													 grouped_rel,
+													 path,
+													 grouped_rel->reltarget,
+													 parse->groupClause,
+													 havingQual,
+													 agg_costs,
+													 dNumGroups);
+			add_path(grouped_rel, (Path *)
+					 create_gather_path(root, grouped_rel, path,
+										grouped_rel->reltarget, NULL,
+										&total_groups));
+		}
+
 		/*
 		 * Generate a Finalize HashAgg Path atop of the cheapest partially
 		 * grouped path, assuming there is one
@@ -6991,8 +7022,10 @@ apply_scanjoin_target_to_paths(PlannerInfo *root,
 		List	   *live_children = NIL;
 		int			partition_idx;
 
-		/* Adjust each partition. */
-		for (partition_idx = 0; partition_idx < rel->nparts; partition_idx++)
+		/* Adjust each partition.  Pruned ones needn't be visited. */
+		partition_idx = -1;
+		while ((partition_idx = bms_next_member(rel->live_parts,
+												partition_idx)) >= 0)
 		{
 			RelOptInfo *child_rel = rel->part_rels[partition_idx];
 			AppendRelInfo **appinfos;
@@ -7000,8 +7033,10 @@ apply_scanjoin_target_to_paths(PlannerInfo *root,
 			List	   *child_scanjoin_targets = NIL;
 			ListCell   *lc;
 
-			/* Pruned or dummy children can be ignored. */
-			if (child_rel == NULL || IS_DUMMY_REL(child_rel))
+			Assert(child_rel != NULL);
+
+			/* Dummy children can be ignored. */
+			if (IS_DUMMY_REL(child_rel))
 				continue;
 
 			/* Translate scan/join targets for this child. */
@@ -7082,7 +7117,6 @@ create_partitionwise_grouping_paths(PlannerInfo *root,
 									PartitionwiseAggregateType patype,
 									GroupPathExtraData *extra)
 {
-	int			nparts = input_rel->nparts;
 	int			cnt_parts;
 	List	   *grouped_live_children = NIL;
 	List	   *partially_grouped_live_children = NIL;
@@ -7093,8 +7127,13 @@ create_partitionwise_grouping_paths(PlannerInfo *root,
 	Assert(patype != PARTITIONWISE_AGGREGATE_PARTIAL ||
 		   partially_grouped_rel != NULL);
 
-	/* Add paths for partitionwise aggregation/grouping. */
-	for (cnt_parts = 0; cnt_parts < nparts; cnt_parts++)
+	/*
+	 * Add paths for partitionwise aggregation/grouping.  Pruned children
+	 * needn't be visited.
+	 */
+	cnt_parts = -1;
+	while ((cnt_parts = bms_next_member(input_rel->live_parts,
+										cnt_parts)) >= 0)
 	{
 		RelOptInfo *child_input_rel = input_rel->part_rels[cnt_parts];
 		PathTarget *child_target = copy_pathtarget(target);
@@ -7104,8 +7143,10 @@ create_partitionwise_grouping_paths(PlannerInfo *root,
 		RelOptInfo *child_grouped_rel;
 		RelOptInfo *child_partially_grouped_rel;
 
-		/* Pruned or dummy children can be ignored. */
-		if (child_input_rel == NULL || IS_DUMMY_REL(child_input_rel))
+		Assert(child_input_rel != NULL);
+
+		/* Dummy children can be ignored. */
+		if (IS_DUMMY_REL(child_input_rel))
 			continue;
 
 		/*
@@ -736,9 +736,31 @@ set_plan_refs(PlannerInfo *root, Plan *plan, int rtoffset)
 
 		case T_NestLoop:
 		case T_MergeJoin:
-		case T_HashJoin:
 			set_join_references(root, (Join *) plan, rtoffset);
 			break;
+		case T_HashJoin:
+			{
+				HashJoin   *hjplan = (HashJoin *) plan;
+
+				set_join_references(root, (Join *) plan, rtoffset);
+
+				if (hjplan->part_prune_info)
+				{
+					foreach(l, hjplan->part_prune_info->prune_infos)
+					{
+						List	   *prune_infos = lfirst(l);
+						ListCell   *l2;
+
+						foreach(l2, prune_infos)
+						{
+							PartitionedRelPruneInfo *pinfo = lfirst(l2);
+
+							pinfo->rtindex += rtoffset;
+						}
+					}
+				}
+			}
+			break;
 
 		case T_Gather:
 		case T_GatherMerge:
@@ -2012,6 +2034,23 @@ set_join_references(PlannerInfo *root, Join *join, int rtoffset)
 				  nlp->paramval->varno == OUTER_VAR))
 				elog(ERROR, "NestLoopParam was not reduced to a simple Var");
 		}
+
+		/*
+		 * The hash keys are evaluated for the outer and the inner tuples
+		 * separately, when the join switches to hashing its inner side.
+		 */
+		nl->outerhashkeys = (List *) fix_upper_expr(root,
+													(Node *) nl->outerhashkeys,
+													outer_itlist,
+													OUTER_VAR,
+													rtoffset,
+													NUM_EXEC_QUAL((Plan *) join));
+		nl->innerhashkeys = (List *) fix_upper_expr(root,
+													(Node *) nl->innerhashkeys,
+													inner_itlist,
+													INNER_VAR,
+													rtoffset,
+													NUM_EXEC_QUAL((Plan *) join));
 	}
 	else if (IsA(join, MergeJoin))
 	{
@@ -0,0 +1,595 @@
+/*-------------------------------------------------------------------------
+ *
+ * cardfeedback.c
+ *	  Row counts observed by instrumented executions, for the planner.
+ *
+ * The planner estimates the selectivity of a relation's restriction clauses
+ * from pg_statistic, assuming that clauses on different columns are
+ * independent unless extended statistics say otherwise.  When they are
+ * correlated, the estimate can be off by orders of magnitude, and it stays
+ * off however often the query runs.  With cardinality_feedback_entries set,
+ * every execution that counts rows anyway, such as EXPLAIN ANALYZE or
+ * auto_explain with log_analyze, records how many rows each scan of a base
+ * relation actually returned, and later planning of a scan of the same
+ * relation with the same clauses uses the observed selectivity instead of
+ * the estimate.
+ *
+ * A scan is identified by a key combining a hash of the relation OID and of
+ * its restriction clauses, including constant values, computed by the
+ * planner and stored in the Scan plan node.  Only scans that return what
+ * set_baserel_size_estimates estimated are recorded: they must not be
+ * parameterized or parallel-aware, and all their executions must have run
+ * to completion.  The observations are kept per database in a fixed-size
+ * hash table in shared memory, averaging the last few of each key; when the
+ * table is full, the entry updated least recently is dropped.
+ *
+ * The table is written out at every checkpoint if it has changed, and read
+ * back at postmaster start.  Losing it is harmless, so there's no WAL.
+ *
+ * Portions Copyright (c) 1996-2021, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * IDENTIFICATION
+ *	  src/backend/optimizer/util/cardfeedback.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include <unistd.h>
+
+#include "access/parallel.h"
+#include "common/hashfn.h"
+#include "executor/instrument.h"
+#include "miscadmin.h"
+#include "nodes/nodeFuncs.h"
+#include "nodes/pathnodes.h"
+#include "optimizer/cardfeedback.h"
+#include "pgstat.h"
+#include "storage/fd.h"
+#include "storage/lwlock.h"
+#include "storage/shmem.h"
+#include "utils/datum.h"
+#include "utils/hsearch.h"
+#include "utils/selfuncs.h"
+
+#define CARD_FEEDBACK_FILE \
+	PGSTAT_STAT_PERMANENT_DIRECTORY "/cardinality_feedback.stat"
+#define CARD_FEEDBACK_FILE_MAGIC	0x43464231	/* "CFB1" */
+
+/*
+ * An observation is averaged with at most this many earlier ones, so that
+ * the selectivity follows changes in the data.
+ */
+#define CARD_FEEDBACK_MAX_WEIGHT	8
+
+typedef struct CardFeedbackKey
+{
+	Oid			dbid;			/* database of the relation */
+	uint64		signature;		/* key computed by CardinalityFeedbackKey */
+} CardFeedbackKey;
+
+typedef struct CardFeedbackEntry
+{
+	CardFeedbackKey key;		/* hash key; must be first */
+	Selectivity selec;			/* average observed selectivity */
+	int			nobserved;		/* # of observations averaged, up to
+								 * CARD_FEEDBACK_MAX_WEIGHT */
+	uint64		last_update;	/* clock value at the last observation */
+} CardFeedbackEntry;
+
+typedef struct CardFeedbackControl
+{
+	/* both protected by CardinalityFeedbackLock */
+	uint64		clock;			/* advanced on every observation */
+	bool		dirty;			/* changed since last written out? */
+} CardFeedbackControl;
+
+/* GUC parameters */
+bool		cardinality_feedback = true;
+int			cardinality_feedback_entries = 0;
+
+static CardFeedbackControl *CardFeedbackCtl = NULL;
+static HTAB *CardFeedbackHash = NULL;
+
+static void load_card_feedback(void);
+static bool card_feedback_key_walker(Node *node, uint64 *hash);
+static bool card_feedback_record_walker(PlanState *planstate,
+										PlanState **skip);
+static void card_feedback_store(uint64 signature, Selectivity selec);
+
+
+/*
+ * CardinalityFeedbackShmemSize: report shared memory space needed
+ */
+Size
+CardinalityFeedbackShmemSize(void)
+{
+	Size		size;
+
+	if (cardinality_feedback_entries == 0)
+		return 0;
+
+	size = MAXALIGN(sizeof(CardFeedbackControl));
+	size = add_size(size, hash_estimate_size(cardinality_feedback_entries,
+											 sizeof(CardFeedbackEntry)));
+
+	return size;
+}
+
+/*
+ * CardinalityFeedbackShmemInit: allocate and initialize shared memory
+ *
+ * The postmaster also loads the entries saved by the last checkpoint.
+ */
+void
+CardinalityFeedbackShmemInit(void)
+{
+	HASHCTL		info;
+	bool		found;
+
+	if (cardinality_feedback_entries == 0)
+		return;
+
+	CardFeedbackCtl = (CardFeedbackControl *)
+		ShmemInitStruct("Cardinality Feedback",
+						sizeof(CardFeedbackControl),
+						&found);
+
+	info.keysize = sizeof(CardFeedbackKey);
+	info.entrysize = sizeof(CardFeedbackEntry);
+	CardFeedbackHash = ShmemInitHash("Cardinality Feedback Hash",
+									 cardinality_feedback_entries,
+									 cardinality_feedback_entries,
+									 &info,
+									 HASH_ELEM | HASH_BLOBS);
+
+	if (!found)
+	{
+		CardFeedbackCtl->clock = 0;
+		CardFeedbackCtl->dirty = false;
+		load_card_feedback();
+	}
+}
+
+/*
+ * Read the entries written out by CheckPointCardinalityFeedback, if any.
+ * Problems are only logged, since we can as well start from scratch.
+ */
+static void
+load_card_feedback(void)
+{
+	FILE	   *file;
+	uint32		magic;
+	int32		nentries;
+	int			i;
+
+	file = AllocateFile(CARD_FEEDBACK_FILE, PG_BINARY_R);
+	if (file == NULL)
+	{
+		if (errno != ENOENT)
+			ereport(LOG,
+					(errcode_for_file_access(),
+					 errmsg("could not open file \"%s\": %m",
+							CARD_FEEDBACK_FILE)));
+		return;
+	}
+
+	if (fread(&magic, sizeof(magic), 1, file) != 1 ||
+		magic != CARD_FEEDBACK_FILE_MAGIC ||
+		fread(&nentries, sizeof(nentries), 1, file) != 1 ||
+		nentries < 0)
+		goto read_error;
+
+	for (i = 0; i < nentries; i++)
+	{
+		CardFeedbackEntry saved;
+		CardFeedbackEntry *entry;
+
+		if (fread(&saved, sizeof(saved), 1, file) != 1)
+			goto read_error;
+
+		/* the table may have been made smaller since */
+		if (i >= cardinality_feedback_entries)
+			break;
+
+		entry = (CardFeedbackEntry *) hash_search(CardFeedbackHash,
+												  &saved.key, HASH_ENTER,
+												  NULL);
+		entry->selec = saved.selec;
+		entry->nobserved = saved.nobserved;
+		entry->last_update = saved.last_update;
+		CardFeedbackCtl->clock = Max(CardFeedbackCtl->clock,
+									 saved.last_update);
+	}
+
+	FreeFile(file);
+	return;
+
+read_error:
+	ereport(LOG,
+			(errmsg("ignoring invalid cardinality feedback file \"%s\"",
+					CARD_FEEDBACK_FILE)));
+	FreeFile(file);
+}
+
+/*
+ * CheckPointCardinalityFeedback
+ *		Write out the observations, if there are new ones.
+ *
+ * Called at every checkpoint.  An error writing the file is only logged;
+ * we'll try again next time.
+ */
+void
+CheckPointCardinalityFeedback(void)
+{
+	CardFeedbackEntry *entries;
+	int32		nentries;
+	uint32		magic = CARD_FEEDBACK_FILE_MAGIC;
+	HASH_SEQ_STATUS status;
+	CardFeedbackEntry *entry;
+	FILE	   *file;
+	const char *tmpfile = CARD_FEEDBACK_FILE ".tmp";
+
+	if (cardinality_feedback_entries == 0)
+		return;
+
+	/* Take a copy, so as not to hold the lock while writing */
+	LWLockAcquire(CardinalityFeedbackLock, LW_EXCLUSIVE);
+	if (!CardFeedbackCtl->dirty)
+	{
+		LWLockRelease(CardinalityFeedbackLock);
+		return;
+	}
+	entries = (CardFeedbackEntry *)
+		palloc(Max(hash_get_num_entries(CardFeedbackHash), 1) *
+			   sizeof(CardFeedbackEntry));
+	nentries = 0;
+	hash_seq_init(&status, CardFeedbackHash);
+	while ((entry = (CardFeedbackEntry *) hash_seq_search(&status)) != NULL)
+		entries[nentries++] = *entry;
+	CardFeedbackCtl->dirty = false;
+	LWLockRelease(CardinalityFeedbackLock);
+
+	file = AllocateFile(tmpfile, PG_BINARY_W);
+	if (file == NULL)
+		goto write_error;
+	if (fwrite(&magic, sizeof(magic), 1, file) != 1 ||
+		fwrite(&nentries, sizeof(nentries), 1, file) != 1 ||
+		fwrite(entries, sizeof(CardFeedbackEntry), nentries,
+			   file) != (size_t) nentries)
+	{
+		FreeFile(file);
+		goto write_error;
+	}
+	if (FreeFile(file) != 0)
+		goto write_error;
+
+	(void) durable_rename(tmpfile, CARD_FEEDBACK_FILE, LOG);
+	pfree(entries);
+	return;
+
+write_error:
+	ereport(LOG,
+			(errcode_for_file_access(),
+			 errmsg("could not write file \"%s\": %m", tmpfile)));
+	unlink(tmpfile);
+	pfree(entries);
+
+	LWLockAcquire(CardinalityFeedbackLock, LW_EXCLUSIVE);
+	CardFeedbackCtl->dirty = true;
+	LWLockRelease(CardinalityFeedbackLock);
+}
+
+/*
+ * CardinalityFeedbackKey
+ *		Compute the key identifying scans of a relation with the given
+ *		restriction clauses, or return 0 if cardinality feedback is off.
+ *
+ * The key doesn't depend on the relation's range table index, so that the
+ * same scan in different queries gets the same key.
+ */
+uint64
+CardinalityFeedbackKey(Oid relid, List *restrictinfo)
+{
+	uint64		hash;
+	ListCell   *lc;
+
+	if (cardinality_feedback_entries == 0 || !cardinality_feedback)
+		return 0;
+
+	hash = hash_bytes_extended((const unsigned char *) &relid,
+							   sizeof(relid), 0);
+	foreach(lc, restrictinfo)
+	{
+		RestrictInfo *rinfo = lfirst_node(RestrictInfo, lc);
+
+		(void) card_feedback_key_walker((Node *) rinfo->clause, &hash);
+	}
+
+	/* 0 means no key */
+	return hash != 0 ? hash : 1;
+}
+
+#define CARD_FEEDBACK_HASH(hash, field) \
+	(*(hash) = hash_combine64(*(hash), \
+							  hash_bytes_extended((const unsigned char *) &(field), \
+												  sizeof(field), 0)))
+
+/*
+ * Fold the parts of an expression that affect its selectivity into *hash:
+ * the node types, the operators and functions, the attribute numbers of
+ * Vars but not their varno, and the values of Consts.
+ */
+static bool
+card_feedback_key_walker(Node *node, uint64 *hash)
+{
+	NodeTag		tag;
+
+	if (node == NULL)
+		return false;
+
+	tag = nodeTag(node);
+	CARD_FEEDBACK_HASH(hash, tag);
+
+	switch (tag)
+	{
+		case T_Var:
+			{
+				Var		   *var = (Var *) node;
+
+				CARD_FEEDBACK_HASH(hash, var->varattno);
+				CARD_FEEDBACK_HASH(hash, var->vartype);
+				CARD_FEEDBACK_HASH(hash, var->varlevelsup);
+			}
+			break;
+		case T_Const:
+			{
+				Const	   *c = (Const *) node;
+
+				CARD_FEEDBACK_HASH(hash, c->consttype);
+				CARD_FEEDBACK_HASH(hash, c->constisnull);
+				if (c->constisnull)
+					break;
+				if (c->constbyval)
+					CARD_FEEDBACK_HASH(hash, c->constvalue);
+				else
+					*hash = hash_combine64(*hash,
+										   hash_bytes_extended((const unsigned char *) DatumGetPointer(c->constvalue),
+															   datumGetSize(c->constvalue,
+																			false,
+																			c->constlen),
+															   0));
+			}
+			break;
+		case T_Param:
+			{
+				Param	   *param = (Param *) node;
+
+				CARD_FEEDBACK_HASH(hash, param->paramkind);
+				CARD_FEEDBACK_HASH(hash, param->paramid);
+				CARD_FEEDBACK_HASH(hash, param->paramtype);
+			}
+			break;
+		case T_OpExpr:
+		case T_DistinctExpr:
+		case T_NullIfExpr:
+			CARD_FEEDBACK_HASH(hash, ((OpExpr *) node)->opno);
+			break;
+		case T_ScalarArrayOpExpr:
+			CARD_FEEDBACK_HASH(hash, ((ScalarArrayOpExpr *) node)->opno);
+			CARD_FEEDBACK_HASH(hash, ((ScalarArrayOpExpr *) node)->useOr);
+			break;
+		case T_FuncExpr:
+			CARD_FEEDBACK_HASH(hash, ((FuncExpr *) node)->funcid);
+			break;
+		case T_BoolExpr:
+			CARD_FEEDBACK_HASH(hash, ((BoolExpr *) node)->boolop);
+			break;
+		case T_NullTest:
+			CARD_FEEDBACK_HASH(hash, ((NullTest *) node)->nulltesttype);
+			break;
+		case T_BooleanTest:
+			CARD_FEEDBACK_HASH(hash, ((BooleanTest *) node)->booltesttype);
+			break;
+		case T_RelabelType:
+			CARD_FEEDBACK_HASH(hash, ((RelabelType *) node)->resulttype);
+			break;
+		case T_CoerceViaIO:
+			CARD_FEEDBACK_HASH(hash, ((CoerceViaIO *) node)->resulttype);
+			break;
+		default:
+			/* the node type and the children will have to do */
+			break;
+	}
+
+	return expression_tree_walker(node, card_feedback_key_walker,
+								  (void *) hash);
+}
+
+/*
+ * CardinalityFeedbackLookup
+ *		Look up the observed selectivity of scans with the given key.
+ *
+ * Returns false, leaving *selec alone, if none has been recorded.
+ */
+bool
+CardinalityFeedbackLookup(uint64 key, Selectivity *selec)
+{
+	CardFeedbackKey hkey;
+	CardFeedbackEntry *entry;
+	bool		found = false;
+
+	Assert(key != 0);
+
+	/* zero the padding, since the key is hashed as a blob */
+	memset(&hkey, 0, sizeof(hkey));
+	hkey.dbid = MyDatabaseId;
+	hkey.signature = key;
+
+	LWLockAcquire(CardinalityFeedbackLock, LW_SHARED);
+	entry = (CardFeedbackEntry *) hash_search(CardFeedbackHash, &hkey,
+											  HASH_FIND, NULL);
+	if (entry != NULL)
+	{
+		*selec = entry->selec;
+		found = true;
+	}
+	LWLockRelease(CardinalityFeedbackLock);
+
+	return found;
+}
+
+/*
+ * CardinalityFeedbackRecord
+ *		Record the row counts of the scans in an instrumented plan tree.
+ *
+ * Called by ExecutorEnd, after all nodes have been shut down, so that the
+ * counts of parallel workers have been gathered.
+ */
+void
+CardinalityFeedbackRecord(PlanState *planstate)
+{
+	PlanState  *skip = NULL;
+
+	if (cardinality_feedback_entries == 0 || !cardinality_feedback)
+		return;
+
+	/* the leader records the counts of the workers along with its own */
+	if (IsParallelWorker())
+		return;
+
+	(void) card_feedback_record_walker(planstate, &skip);
+}
+
+/*
+ * Record the rows returned by planstate, if it is a scan that the planner
+ * asked to know about, then recurse.  *skip is a node whose row count is
+ * not to be trusted.
+ */
+static bool
+card_feedback_record_walker(PlanState *planstate, PlanState **skip)
+{
+	Plan	   *plan = planstate->plan;
+	Instrumentation *instr = planstate->instrument;
+
+	switch (nodeTag(plan))
+	{
+		case T_SeqScan:
+		case T_IndexScan:
+		case T_IndexOnlyScan:
+		case T_BitmapHeapScan:
+		case T_TidScan:
+		case T_TidRangeScan:
+			{
+				Scan	   *scan = (Scan *) plan;
+
+				if (scan->feedback_key == 0 || instr == NULL ||
+					plan->parallel_aware || planstate == *skip ||
+					scan->feedback_tuples <= 0)
+					break;
+
+				/*
+				 * Unless every scan ran to the end, as opposed to being
+				 * stopped early by a LIMIT, say, the count tells little.
+				 */
+				InstrEndLoop(instr);
+				if (instr->nloops == 0 || instr->ncompleted < instr->nloops)
+					break;
+
+				/*
+				 * Rows removed by a hash join's Bloom filter passed the
+				 * scan's quals, so they count towards its selectivity.
+				 */
+				card_feedback_store(scan->feedback_key,
+									(instr->ntuples + instr->nfiltered3) /
+									instr->nloops /
+									scan->feedback_tuples);
+			}
+			break;
+		case T_MergeJoin:
+			if (!((MergeJoin *) plan)->skip_mark_restore)
+			{
+				PlanState  *save_skip = *skip;
+				bool		result;
+
+				/* restoring a mark makes the inner side repeat rows */
+				*skip = innerPlanState(planstate);
+				result = planstate_tree_walker(planstate,
+											   card_feedback_record_walker,
+											   (void *) skip);
+				*skip = save_skip;
+				return result;
+			}
+			break;
+		default:
+			break;
+	}
+
+	return planstate_tree_walker(planstate, card_feedback_record_walker,
+								 (void *) skip);
+}
+
+/*
+ * Merge an observed selectivity into the entry for a key, making room for
+ * it if need be.
+ */
+static void
+card_feedback_store(uint64 signature, Selectivity selec)
+{
+	CardFeedbackKey hkey;
+	CardFeedbackEntry *entry;
+
+	CLAMP_PROBABILITY(selec);
+
+	memset(&hkey, 0, sizeof(hkey));
+	hkey.dbid = MyDatabaseId;
+	hkey.signature = signature;
+
+	LWLockAcquire(CardinalityFeedbackLock, LW_EXCLUSIVE);
+
+	entry = (CardFeedbackEntry *) hash_search(CardFeedbackHash, &hkey,
+											  HASH_FIND, NULL);
+	if (entry == NULL)
+	{
+		if (hash_get_num_entries(CardFeedbackHash) >=
+			cardinality_feedback_entries)
+		{
+			HASH_SEQ_STATUS status;
+			CardFeedbackEntry *victim = NULL;
+			CardFeedbackEntry *e;
+
+			hash_seq_init(&status, CardFeedbackHash);
+			while ((e = (CardFeedbackEntry *) hash_seq_search(&status)) != NULL)
+			{
+				if (victim == NULL || e->last_update < victim->last_update)
+					victim = e;
+			}
+			if (victim != NULL)
+				(void) hash_search(CardFeedbackHash, &victim->key,
+								   HASH_REMOVE, NULL);
+		}
+
+		entry = (CardFeedbackEntry *) hash_search(CardFeedbackHash, &hkey,
+												  HASH_ENTER_NULL, NULL);
+		if (entry == NULL)
+		{
+			LWLockRelease(CardinalityFeedbackLock);
+			return;
+		}
+		entry->selec = selec;
+		entry->nobserved = 1;
+	}
+	else
+	{
+		entry->selec = (entry->selec * entry->nobserved + selec) /
+			(entry->nobserved + 1);
+		if (entry->nobserved < CARD_FEEDBACK_MAX_WEIGHT)
+			entry->nobserved++;
+	}
+
+	entry->last_update = ++CardFeedbackCtl->clock;
+	CardFeedbackCtl->dirty = true;
+
+	LWLockRelease(CardinalityFeedbackLock);
+}
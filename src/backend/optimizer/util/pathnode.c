@@ -2543,6 +2543,59 @@ create_mergejoin_path(PlannerInfo *root,
 	return pathnode;
 }
 
+/*
+ * create_parallel_mergejoin_path
+ *	  Creates a pathnode corresponding to a parallel-aware mergejoin of two
+ *	  btree index scans, whose participants join disjoint ranges of the
+ *	  leading merge key.
+ *
+ * The arguments are as for create_mergejoin_path(), except that neither
+ * input is sorted or parameterized, and 'range_bounds' gives the boundaries
+ * of the key ranges.  The output is unordered, since each participant
+ * returns the rows of the ranges it happened to claim.
+ */
+MergePath *
+create_parallel_mergejoin_path(PlannerInfo *root,
+							   RelOptInfo *joinrel,
+							   JoinType jointype,
+							   JoinCostWorkspace *workspace,
+							   JoinPathExtraData *extra,
+							   Path *outer_path,
+							   Path *inner_path,
+							   List *restrict_clauses,
+							   List *mergeclauses,
+							   List *range_bounds,
+							   int parallel_workers)
+{
+	MergePath  *pathnode = makeNode(MergePath);
+
+	Assert(joinrel->consider_parallel &&
+		   outer_path->parallel_safe && inner_path->parallel_safe);
+	Assert(parallel_workers > 0 && range_bounds != NIL);
+
+	pathnode->jpath.path.pathtype = T_MergeJoin;
+	pathnode->jpath.path.parent = joinrel;
+	pathnode->jpath.path.pathtarget = joinrel->reltarget;
+	pathnode->jpath.path.param_info = NULL;
+	pathnode->jpath.path.parallel_aware = true;
+	pathnode->jpath.path.parallel_safe = true;
+	pathnode->jpath.path.parallel_workers = parallel_workers;
+	pathnode->jpath.path.pathkeys = NIL;
+	pathnode->jpath.jointype = jointype;
+	pathnode->jpath.inner_unique = extra->inner_unique;
+	pathnode->jpath.outerjoinpath = outer_path;
+	pathnode->jpath.innerjoinpath = inner_path;
+	pathnode->jpath.joinrestrictinfo = restrict_clauses;
+	pathnode->path_mergeclauses = mergeclauses;
+	pathnode->outersortkeys = NIL;
+	pathnode->innersortkeys = NIL;
+	pathnode->range_bounds = range_bounds;
+
+	final_cost_mergejoin(root, pathnode, workspace, extra);
+
+	return pathnode;
+}
+
 /*
  * create_hashjoin_path
  *	  Creates a pathnode corresponding to a hash join between two relations.
@@ -3146,6 +3199,63 @@ create_agg_path(PlannerInfo *root,
 	return pathnode;
 }
 
+/*
+ * create_parallel_agg_path
+ *	  Creates a pathnode that represents a Parallel HashAgg, in which all the
+ *	  participants of a parallel query aggregate a partial input path
+ *	  together, each of them returning the final results for a disjoint
+ *	  subset of the groups.
+ *
+ * The arguments are as for create_agg_path(); the strategy is always
+ * AGG_HASHED and there's no split.  'numGroups' is the total number of
+ * groups, though the path's row count is per participant.
+ */
+AggPath *
+create_parallel_agg_path(PlannerInfo *root,
+						 RelOptInfo *rel,
+						 Path *subpath,
+						 PathTarget *target,
+						 List *groupClause,
+						 List *qual,
+						 const AggClauseCosts *aggcosts,
+						 double numGroups)
+{
+	AggPath    *pathnode = makeNode(AggPath);
+
+	Assert(rel->consider_parallel && subpath->parallel_safe);
+	Assert(subpath->parallel_workers > 0);
+
+	pathnode->path.pathtype = T_Agg;
+	pathnode->path.parent = rel;
+	pathnode->path.pathtarget = target;
+	pathnode->path.param_info = NULL;
+	pathnode->path.parallel_aware = true;
+	pathnode->path.parallel_safe = true;
+	pathnode->path.parallel_workers = subpath->parallel_workers;
+	pathnode->path.pathkeys = NIL;	/* output is unordered */
+	pathnode->subpath = subpath;
+
+	pathnode->aggstrategy = AGG_HASHED;
+	pathnode->aggsplit = AGGSPLIT_SIMPLE;
+	pathnode->numGroups = numGroups;
+	pathnode->transitionSpace = aggcosts ? aggcosts->transitionSpace : 0;
+	pathnode->groupClause = groupClause;
+	pathnode->qual = qual;
+
+	cost_parallel_agg(&pathnode->path, root, aggcosts,
+					  list_length(groupClause), numGroups,
+					  qual,
+					  subpath->startup_cost, subpath->total_cost,
+					  subpath->rows, subpath->pathtarget->width);
+
+	/* add tlist eval cost for each output row */
+	pathnode->path.startup_cost += target->cost.startup;
+	pathnode->path.total_cost += target->cost.startup +
+		target->cost.per_tuple * pathnode->path.rows;
+
+	return pathnode;
+}
+
 /*
  * create_groupingsets_path
  *	  Creates a pathnode that represents performing GROUPING SETS aggregation
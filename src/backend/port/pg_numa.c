@@ -0,0 +1,211 @@
+/*-------------------------------------------------------------------------
+ *
+ * pg_numa.c
+ *	  Placement of shared memory on NUMA nodes.
+ *
+ * This is a thin layer over libnuma, which we only use on Linux.  Memory
+ * policies are set with mbind() rather than libnuma's own wrappers, so that
+ * failures can be reported properly instead of being printed to stderr.
+ *
+ * A memory policy only affects pages faulted in after it has been set, so
+ * these functions must be applied to shared memory before anything touches
+ * it.  We use MPOL_PREFERRED rather than MPOL_BIND to direct memory to a
+ * node: if the node runs out of memory, the kernel falls back to another
+ * one, where MPOL_BIND would kill the process touching the page.
+ *
+ * Portions Copyright (c) 1996-2021, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ * IDENTIFICATION
+ *	  src/backend/port/pg_numa.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#ifdef USE_LIBNUMA
+#include <numa.h>
+#include <numaif.h>
+#include <sched.h>
+#endif
+
+#include "port/pg_numa.h"
+
+#ifdef USE_LIBNUMA
+
+/*
+ * Kernel node numbers of the nodes that have memory, indexed by our node
+ * numbers.  Set up on first use.
+ */
+static int *pg_numa_nodes = NULL;
+static int	pg_numa_nnodes = 0;
+
+static void pg_numa_init(void);
+static void pg_numa_set_policy(void *ptr, Size size, int mode,
+							   struct bitmask *nodes);
+
+/*
+ * pg_numa_available -- can we place memory on NUMA nodes?
+ */
+bool
+pg_numa_available(void)
+{
+	return numa_available() >= 0;
+}
+
+/*
+ * pg_numa_num_nodes -- number of NUMA nodes that have memory
+ */
+int
+pg_numa_num_nodes(void)
+{
+	pg_numa_init();
+	return pg_numa_nnodes;
+}
+
+/*
+ * pg_numa_current_node -- node of the CPU we're running on
+ *
+ * Returns -1 if that can't be determined, or if the CPU's node has no
+ * memory of its own.  Since the process can be moved to another CPU at any
+ * time, the result is only a hint.
+ */
+int
+pg_numa_current_node(void)
+{
+	int			cpu;
+	int			node;
+
+	pg_numa_init();
+
+	if (!pg_numa_available())
+		return -1;
+
+	cpu = sched_getcpu();
+	if (cpu < 0)
+		return -1;
+	node = numa_node_of_cpu(cpu);
+
+	for (int i = 0; i < pg_numa_nnodes; i++)
+	{
+		if (pg_numa_nodes[i] == node)
+			return i;
+	}
+	return -1;
+}
+
+/*
+ * pg_numa_interleave_memory -- spread pages over all nodes round-robin
+ *
+ * ptr must be aligned to the page size of the mapping it belongs to.
+ */
+void
+pg_numa_interleave_memory(void *ptr, Size size)
+{
+	struct bitmask *nodes;
+
+	pg_numa_init();
+
+	nodes = numa_allocate_nodemask();
+	for (int i = 0; i < pg_numa_nnodes; i++)
+		numa_bitmask_setbit(nodes, pg_numa_nodes[i]);
+	pg_numa_set_policy(ptr, size, MPOL_INTERLEAVE, nodes);
+	numa_bitmask_free(nodes);
+}
+
+/*
+ * pg_numa_prefer_node -- direct pages to the given node
+ *
+ * ptr must be aligned to the page size of the mapping it belongs to.
+ */
+void
+pg_numa_prefer_node(void *ptr, Size size, int node)
+{
+	struct bitmask *nodes;
+
+	pg_numa_init();
+	Assert(node >= 0 && node < pg_numa_nnodes);
+
+	nodes = numa_allocate_nodemask();
+	numa_bitmask_setbit(nodes, pg_numa_nodes[node]);
+	pg_numa_set_policy(ptr, size, MPOL_PREFERRED, nodes);
+	numa_bitmask_free(nodes);
+}
+
+/*
+ * Find out which nodes have memory.
+ */
+static void
+pg_numa_init(void)
+{
+	bool		available;
+	int			max_node;
+
+	if (pg_numa_nodes != NULL)
+		return;
+
+	/* the rest of libnuma mustn't be used if it's not available */
+	available = pg_numa_available();
+	max_node = available ? numa_max_node() : 0;
+
+	pg_numa_nodes = (int *) malloc(sizeof(int) * (max_node + 1));
+	if (pg_numa_nodes == NULL)
+		ereport(ERROR,
+				(errcode(ERRCODE_OUT_OF_MEMORY),
+				 errmsg("out of memory")));
+
+	if (available)
+	{
+		for (int node = 0; node <= max_node; node++)
+		{
+			if (numa_bitmask_isbitset(numa_all_nodes_ptr, node) &&
+				numa_node_size64(node, NULL) > 0)
+				pg_numa_nodes[pg_numa_nnodes++] = node;
+		}
+	}
+
+	/* make sure callers always see at least one node */
+	if (pg_numa_nnodes == 0)
+		pg_numa_nodes[pg_numa_nnodes++] = 0;
+}
+
+static void
+pg_numa_set_policy(void *ptr, Size size, int mode, struct bitmask *nodes)
+{
+	if (mbind(ptr, size, mode, nodes->maskp, nodes->size + 1, 0) != 0)
+		ereport(ERROR,
+				(errmsg("could not set NUMA memory policy for shared memory: %m")));
+}
+
+#else							/* !USE_LIBNUMA */
+
+bool
+pg_numa_available(void)
+{
+	return false;
+}
+
+int
+pg_numa_num_nodes(void)
+{
+	return 1;
+}
+
+int
+pg_numa_current_node(void)
+{
+	return -1;
+}
+
+void
+pg_numa_interleave_memory(void *ptr, Size size)
+{
+}
+
+void
+pg_numa_prefer_node(void *ptr, Size size, int node)
+{
+}
+
+#endif							/* USE_LIBNUMA */
@@ -41,6 +41,7 @@ void	   *ShmemProtectiveRegion = NULL;
 
 HANDLE		UsedShmemSegID = INVALID_HANDLE_VALUE;
 void	   *UsedShmemSegAddr = NULL;
+Size		UsedShmemPageSize = 0;
 static Size UsedShmemSegSize = 0;
 
 static bool EnableLockPagesPrivilege(int elevel);
@@ -386,6 +387,15 @@ retry:
 	UsedShmemSegAddr = memAddress;
 	UsedShmemSegSize = size;
 	UsedShmemSegID = hmap2;
+	if ((flProtect & SEC_LARGE_PAGES) != 0)
+		UsedShmemPageSize = largePageSize;
+	else
+	{
+		SYSTEM_INFO sysinfo;
+
+		GetSystemInfo(&sysinfo);
+		UsedShmemPageSize = sysinfo.dwPageSize;
+	}
 
 	/* Register on-exit routine to delete the new segment */
 	on_shmem_exit(pgwin32_SharedMemoryDelete, PointerGetDatum(hmap2));
@@ -14,8 +14,10 @@
  */
 #include "postgres.h"
 
+#include "port/pg_numa.h"
 #include "storage/buf_internals.h"
 #include "storage/bufmgr.h"
+#include "storage/pg_shmem.h"
 
 BufferDescPadded *BufferDescriptors;
 char	   *BufferBlocks;
@@ -23,6 +25,12 @@ ConditionVariableMinimallyPadded *BufferIOCVArray;
 WritebackContext BackendWritebackContext;
 CkptSortItem *CkptBufferIds;
 
+/* GUC variable */
+int			numa_buffer_placement = NUMA_BUFFER_PLACEMENT_OFF;
+
+static void PlaceBufferPool(void);
+static void PlaceBufferRange(int first_buffer, int num_buffers, int node);
+
 
 /*
  * Data Structures:
@@ -77,9 +85,11 @@ InitBufferPool(void)
 						NBuffers * sizeof(BufferDescPadded),
 						&foundDescs);
 
+	/* Align buffer pool on IO page size boundary, as direct I/O needs it. */
 	BufferBlocks = (char *)
-		ShmemInitStruct("Buffer Blocks",
-						NBuffers * (Size) BLCKSZ, &foundBufs);
+		PG_IO_ALIGN(ShmemInitStruct("Buffer Blocks",
+									NBuffers * (Size) BLCKSZ + PG_IO_ALIGN_SIZE,
+									&foundBufs));
 
 	/* Align condition variables to cacheline boundary. */
 	BufferIOCVArray = (ConditionVariableMinimallyPadded *)
@@ -98,6 +108,13 @@ InitBufferPool(void)
 		ShmemInitStruct("Checkpoint BufferIds",
 						NBuffers * sizeof(CkptSortItem), &foundBufCkpt);
 
+	/*
+	 * Init other shared buffer-management stuff.  This comes before the
+	 * initialization of the buffer headers because their NUMA placement
+	 * depends on the clock sweep partitions.
+	 */
+	StrategyInitialize(!foundDescs);
+
 	if (foundDescs || foundBufs || foundIOCV || foundBufCkpt)
 	{
 		/* should find all of these, or none of them */
@@ -108,6 +125,10 @@ InitBufferPool(void)
 	{
 		int			i;
 
+		/* This must be done before the memory is touched */
+		if (numa_buffer_placement != NUMA_BUFFER_PLACEMENT_OFF)
+			PlaceBufferPool();
+
 		/*
 		 * Initialize all the buffer headers.
 		 */
@@ -138,14 +159,96 @@ InitBufferPool(void)
 		GetBufferDescriptor(NBuffers - 1)->freeNext = FREENEXT_END_OF_LIST;
 	}
 
-	/* Init other shared buffer-management stuff */
-	StrategyInitialize(!foundDescs);
-
 	/* Initialize per-backend file flush context */
 	WritebackContextInit(&BackendWritebackContext,
 						 &backend_flush_after);
 }
 
+/*
+ * Place the buffer descriptors and blocks on NUMA nodes, as requested by
+ * numa_buffer_placement.
+ *
+ * Memory policies only affect pages faulted in after they have been set, so
+ * this has to be done before anything touches the buffers.
+ */
+static void
+PlaceBufferPool(void)
+{
+	int			nparts = StrategyNumPartitions();
+
+	if (!pg_numa_available())
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("NUMA is not supported on this system"),
+				 errhint("Set numa_buffer_placement to \"off\".")));
+
+	if (numa_buffer_placement == NUMA_BUFFER_PLACEMENT_INTERLEAVE)
+	{
+		PlaceBufferRange(0, NBuffers, -1);
+		elog(DEBUG1, "interleaved shared buffers over %d NUMA nodes",
+			 pg_numa_num_nodes());
+		return;
+	}
+
+	Assert(numa_buffer_placement == NUMA_BUFFER_PLACEMENT_PARTITION);
+
+	for (int i = 0; i < nparts; i++)
+	{
+		int			first_buffer;
+		int			num_buffers;
+
+		StrategyPartitionRange(i, &first_buffer, &num_buffers);
+		PlaceBufferRange(first_buffer, num_buffers,
+						 StrategyPartitionNumaNode(i));
+	}
+	elog(DEBUG1, "placed %d shared buffer partitions on %d NUMA nodes",
+		 nparts, pg_numa_num_nodes());
+}
+
+/*
+ * Place the descriptors and blocks of a range of buffers on the given NUMA
+ * node, or interleave them over all nodes if node is -1.
+ *
+ * The kernel can only place whole pages, so the boundaries are rounded down
+ * to the page size of the shared memory segment, which may be a huge page
+ * size.  Rounding the start and the end in the same direction means that
+ * consecutive ranges never overlap.
+ */
+static void
+PlaceBufferRange(int first_buffer, int num_buffers, int node)
+{
+	struct
+	{
+		char	   *base;
+		Size		elemsize;
+	}			arrays[] =
+	{
+		{(char *) BufferDescriptors, sizeof(BufferDescPadded)},
+		{BufferBlocks, BLCKSZ}
+	};
+
+	Assert(UsedShmemPageSize > 0);
+
+	for (int i = 0; i < lengthof(arrays); i++)
+	{
+		char	   *start;
+		char	   *end;
+
+		start = arrays[i].base + first_buffer * arrays[i].elemsize;
+		end = start + num_buffers * arrays[i].elemsize;
+		start = (char *) TYPEALIGN_DOWN(UsedShmemPageSize, start);
+		end = (char *) TYPEALIGN_DOWN(UsedShmemPageSize, end);
+
+		if (start >= end)
+			continue;
+
+		if (node < 0)
+			pg_numa_interleave_memory(start, end - start);
+		else
+			pg_numa_prefer_node(start, end - start, node);
+	}
+}
+
 /*
  * BufferShmemSize
  *
@@ -162,7 +265,8 @@ BufferShmemSize(void)
 	/* to allow aligning buffer descriptors */
 	size = add_size(size, PG_CACHE_LINE_SIZE);
 
-	/* size of data pages */
+	/* size of data pages, plus alignment padding */
+	size = add_size(size, PG_IO_ALIGN_SIZE);
 	size = add_size(size, mul_size(NBuffers, BLCKSZ));
 
 	/* size of stuff controlled by freelist.c */
@@ -7,7 +7,8 @@
  * must hold a suitable lock on the appropriate BufMappingLock, as specified
  * in the comments.  We can't do the locking inside these functions because
  * in most cases the caller needs to adjust the buffer header contents
- * before the lock is released (see notes in README).
+ * before the lock is released (see notes in README).  The exception is
+ * BufTableLookupOptimistic(), whose result the caller must verify instead.
  *
  *
  * Portions Copyright (c) 1996-2021, PostgreSQL Global Development Group
@@ -105,6 +106,36 @@ BufTableLookup(BufferTag *tagPtr, uint32 hashcode)
 	return result->id;
 }
 
+/*
+ * BufTableLookupOptimistic
+ *		Lookup the given BufferTag without any lock; return buffer ID, or -1
+ *
+ * The result is only a hint: the entry may be changing concurrently, so the
+ * buffer returned may no longer (or never have) held the given tag, and -1
+ * does not prove the tag is absent.  The caller must check the buffer's tag
+ * under the buffer header lock before relying on it, and fall back to
+ * BufTableLookup() under the BufMappingLock if that fails.
+ */
+int
+BufTableLookupOptimistic(BufferTag *tagPtr, uint32 hashcode)
+{
+	volatile BufferLookupEnt *result;
+	int			id;
+
+	result = (volatile BufferLookupEnt *)
+		hash_search_optimistic(SharedBufHash, (void *) tagPtr, hashcode);
+
+	if (!result)
+		return -1;
+
+	/* a stale entry could hold anything, so make sure it's in range */
+	id = result->id;
+	if (id < 0 || id >= NBuffers)
+		return -1;
+
+	return id;
+}
+
 /*
  * BufTableInsert
  *		Insert a hashtable entry for given tag and buffer ID,
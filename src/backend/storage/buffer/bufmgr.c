@@ -45,11 +45,13 @@
 #include "postmaster/bgwriter.h"
 #include "storage/buf_internals.h"
 #include "storage/bufmgr.h"
+#include "storage/fd.h"
 #include "storage/ipc.h"
 #include "storage/proc.h"
 #include "storage/smgr.h"
 #include "storage/standby.h"
 #include "utils/memdebug.h"
+#include "utils/memutils.h"
 #include "utils/ps_status.h"
 #include "utils/rel.h"
 #include "utils/resowner_private.h"
@@ -115,6 +117,25 @@ typedef struct CkptTsStatus
 	int			index;
 } CkptTsStatus;
 
+/*
+ * State the background writer keeps for each clock sweep partition between
+ * BgBufferSync() calls, so it can determine the strategy point's advance rate
+ * and avoid scanning already-cleaned buffers.  Buffer positions are relative
+ * to the start of the partition.
+ */
+typedef struct BgWriterSweepState
+{
+	bool		saved_info_valid;
+	int			prev_strategy_buf_id;
+	uint32		prev_strategy_passes;
+	int			next_to_clean;
+	uint32		next_passes;
+
+	/* Moving averages of allocation rate and clean-buffer density */
+	float		smoothed_alloc;
+	float		smoothed_density;
+} BgWriterSweepState;
+
 /*
  * Type for array used to sort SMgrRelations
  *
@@ -157,9 +178,30 @@ int			checkpoint_flush_after = 0;
 int			bgwriter_flush_after = 0;
 int			backend_flush_after = 0;
 
-/* local state for StartBufferIO and related functions */
-static BufferDesc *InProgressBuf = NULL;
-static bool IsForInput;
+/*
+ * local state for StartBufferIO and related functions
+ *
+ * A backend usually has at most one buffer I/O in progress, but
+ * ReadBufferRange() keeps one per block of the range it is reading, and may
+ * need one more to write out a dirty victim buffer meanwhile.  On top of
+ * that, each read started by StartReadBufferRange() keeps one per block until
+ * it is waited for.
+ */
+#define MAX_IN_PROGRESS_IO \
+	((MAX_ASYNC_READ_RANGES + 1) * MAX_BUFFERS_PER_TRANSFER + 1)
+
+typedef struct InProgressIO
+{
+	BufferDesc *buf;
+	bool		forInput;
+} InProgressIO;
+
+static InProgressIO InProgressIOs[MAX_IN_PROGRESS_IO];
+static int	NumInProgressIOs = 0;
+
+/* reads started by StartReadBufferRange() and not yet completed */
+static ReadBufferRangeIO *PendingReadRanges[MAX_ASYNC_READ_RANGES];
+static int	NumPendingReadRanges = 0;
 
 /* local state for LockBufferForCleanup */
 static BufferDesc *PinCountWaitBuf = NULL;
@@ -462,14 +504,31 @@ static Buffer ReadBuffer_common(SMgrRelation reln, char relpersistence,
 								ReadBufferMode mode, BufferAccessStrategy strategy,
 								bool *hit);
 static bool PinBuffer(BufferDesc *buf, BufferAccessStrategy strategy);
+static bool PinBufferIfTagMatches(BufferDesc *buf, BufferTag *tag,
+								  BufferAccessStrategy strategy);
 static void PinBuffer_Locked(BufferDesc *buf);
 static void UnpinBuffer(BufferDesc *buf, bool fixOwner);
 static void BufferSync(int flags);
 static uint32 WaitBufHdrUnlocked(BufferDesc *buf);
 static int	SyncOneBuffer(int buf_id, bool skip_recently_used,
 						  WritebackContext *wb_context);
+static bool BgBufferSyncPartition(int partition, BgWriterSweepState *state,
+								  int max_pages, bool *hit_limit,
+								  WritebackContext *wb_context);
+static int	SyncBufferRange(CkptSortItem *items, int nitems,
+							WritebackContext *wb_context, int *nwritten);
 static void WaitIO(BufferDesc *buf);
-static bool StartBufferIO(BufferDesc *buf, bool forInput);
+static bool StartBufferIO(BufferDesc *buf, bool forInput, bool nowait);
+static void VerifyReadPage(SMgrRelation smgr, ForkNumber forkNum,
+						   BlockNumber blockNum, Block bufBlock,
+						   ReadBufferMode mode);
+static void CompleteReadRange(SMgrRelation smgr, ForkNumber forkNum,
+							  BlockNumber blockNum, Buffer *buffers,
+							  int nblocks);
+static void StartReadRun(ReadBufferRangeIO *io, SMgrRelation smgr,
+						 int first, int nblocks);
+static void CompleteReadBufferRange(ReadBufferRangeIO *io);
+static void ForgetReadBufferRange(ReadBufferRangeIO *io);
 static void TerminateBufferIO(BufferDesc *buf, bool clear_dirty,
 							  uint32 set_flag_bits);
 static void shared_buffer_write_error_callback(void *arg);
@@ -481,6 +540,7 @@ static BufferDesc *BufferAlloc(SMgrRelation smgr,
 							   BufferAccessStrategy strategy,
 							   bool *foundPtr);
 static void FlushBuffer(BufferDesc *buf, SMgrRelation reln);
+static void FlushBufferRange(BufferDesc **bufs, int nbufs);
 static void FindAndDropRelFileNodeBuffers(RelFileNode rnode,
 										  ForkNumber forkNum,
 										  BlockNumber nForkBlock,
@@ -517,10 +577,19 @@ PrefetchSharedBuffer(SMgrRelation smgr_reln,
 	newHash = BufTableHashCode(&newTag);
 	newPartitionLock = BufMappingPartitionLock(newHash);
 
-	/* see if the block is in the buffer pool already */
-	LWLockAcquire(newPartitionLock, LW_SHARED);
-	buf_id = BufTableLookup(&newTag, newHash);
-	LWLockRelease(newPartitionLock);
+	/*
+	 * See if the block is in the buffer pool already.  The result is only a
+	 * hint for the caller anyway, so an unlocked lookup is good enough when
+	 * it finds something; a miss is double-checked under the lock, since it
+	 * costs a system call.
+	 */
+	buf_id = BufTableLookupOptimistic(&newTag, newHash);
+	if (buf_id < 0)
+	{
+		LWLockAcquire(newPartitionLock, LW_SHARED);
+		buf_id = BufTableLookup(&newTag, newHash);
+		LWLockRelease(newPartitionLock);
+	}
 
 	/* If not in buffers, initiate prefetch */
 	if (buf_id < 0)
@@ -947,7 +1016,7 @@ ReadBuffer_common(SMgrRelation smgr, char relpersistence, ForkNumber forkNum,
 				Assert(buf_state & BM_VALID);
 				buf_state &= ~BM_VALID;
 				UnlockBufHdr(bufHdr, buf_state);
-			} while (!StartBufferIO(bufHdr, true));
+			} while (!StartBufferIO(bufHdr, true, false));
 		}
 	}
 
@@ -1008,25 +1077,7 @@ ReadBuffer_common(SMgrRelation smgr, char relpersistence, ForkNumber forkNum,
 			}
 
 			/* check for garbage data */
-			if (!PageIsVerifiedExtended((Page) bufBlock, blockNum,
-										PIV_LOG_WARNING | PIV_REPORT_STAT))
-			{
-				if (mode == RBM_ZERO_ON_ERROR || zero_damaged_pages)
-				{
-					ereport(WARNING,
-							(errcode(ERRCODE_DATA_CORRUPTED),
-							 errmsg("invalid page in block %u of relation %s; zeroing out page",
-									blockNum,
-									relpath(smgr->smgr_rnode, forkNum))));
-					MemSet((char *) bufBlock, 0, BLCKSZ);
-				}
-				else
-					ereport(ERROR,
-							(errcode(ERRCODE_DATA_CORRUPTED),
-							 errmsg("invalid page in block %u of relation %s",
-									blockNum,
-									relpath(smgr->smgr_rnode, forkNum))));
-			}
+			VerifyReadPage(smgr, forkNum, blockNum, bufBlock, mode);
 		}
 	}
 
@@ -1075,6 +1126,490 @@ ReadBuffer_common(SMgrRelation smgr, char relpersistence, ForkNumber forkNum,
 	return BufferDescriptorGetBuffer(bufHdr);
 }
 
+/*
+ * VerifyReadPage -- check a page just read in for garbage data
+ *
+ * Depending on mode and zero_damaged_pages, an invalid page is either zeroed
+ * with a warning or reported as an error.
+ */
+static void
+VerifyReadPage(SMgrRelation smgr, ForkNumber forkNum, BlockNumber blockNum,
+			   Block bufBlock, ReadBufferMode mode)
+{
+	if (!PageIsVerifiedExtended((Page) bufBlock, blockNum,
+								PIV_LOG_WARNING | PIV_REPORT_STAT))
+	{
+		if (mode == RBM_ZERO_ON_ERROR || zero_damaged_pages)
+		{
+			ereport(WARNING,
+					(errcode(ERRCODE_DATA_CORRUPTED),
+					 errmsg("invalid page in block %u of relation %s; zeroing out page",
+							blockNum,
+							relpath(smgr->smgr_rnode, forkNum))));
+			MemSet((char *) bufBlock, 0, BLCKSZ);
+		}
+		else
+			ereport(ERROR,
+					(errcode(ERRCODE_DATA_CORRUPTED),
+					 errmsg("invalid page in block %u of relation %s",
+							blockNum,
+							relpath(smgr->smgr_rnode, forkNum))));
+	}
+}
+
+/*
+ * ReadBufferRange -- pin a range of consecutive blocks of a relation
+ *
+ * Reads blocks blockNum .. blockNum + nblocks - 1 of the given fork in
+ * RBM_NORMAL mode, and returns the pinned buffers in buffers[].  nblocks
+ * must not exceed MAX_BUFFERS_PER_TRANSFER.
+ *
+ * This is equivalent to calling ReadBufferExtended() for each block, except
+ * that each run of blocks not already present in shared buffers is read in
+ * with a single vectored smgrreadv() call rather than one smgrread() per
+ * block.
+ *
+ * Buffers are always allocated in ascending block order.  Since a backend
+ * holds the I/O-in-progress flag of every buffer in the current run while
+ * allocating the next one, that ordering is what prevents two backends
+ * reading overlapping ranges from waiting for each other's I/O in a cycle.
+ */
+void
+ReadBufferRange(Relation reln, ForkNumber forkNum, BlockNumber blockNum,
+				int nblocks, BufferAccessStrategy strategy, Buffer *buffers)
+{
+	SMgrRelation smgr;
+	int			first_miss = -1;
+
+	Assert(nblocks > 0 && nblocks <= MAX_BUFFERS_PER_TRANSFER);
+
+	/* Open it at the smgr level if not already done */
+	RelationOpenSmgr(reln);
+
+	/* see comments in ReadBufferExtended */
+	if (RELATION_IS_OTHER_TEMP(reln))
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("cannot access temporary tables of other sessions")));
+
+	/* Local buffers don't gain much from this; read them one at a time */
+	if (RelationUsesLocalBuffers(reln))
+	{
+		for (int i = 0; i < nblocks; i++)
+			buffers[i] = ReadBufferExtended(reln, forkNum, blockNum + i,
+											RBM_NORMAL, strategy);
+		return;
+	}
+
+	smgr = reln->rd_smgr;
+
+	for (int i = 0; i < nblocks; i++)
+	{
+		BufferDesc *bufHdr;
+		bool		found;
+
+		/* Make sure we will have room to remember the buffer pin */
+		ResourceOwnerEnlargeBuffers(CurrentResourceOwner);
+
+		TRACE_POSTGRESQL_BUFFER_READ_START(forkNum, blockNum + i,
+										   smgr->smgr_rnode.node.spcNode,
+										   smgr->smgr_rnode.node.dbNode,
+										   smgr->smgr_rnode.node.relNode,
+										   smgr->smgr_rnode.backend,
+										   false);
+
+		pgstat_count_buffer_read(reln);
+		bufHdr = BufferAlloc(smgr, reln->rd_rel->relpersistence, forkNum,
+							 blockNum + i, strategy, &found);
+		buffers[i] = BufferDescriptorGetBuffer(bufHdr);
+
+		if (found)
+		{
+			pgstat_count_buffer_hit(reln);
+			pgBufferUsage.shared_blks_hit++;
+			VacuumPageHit++;
+			if (VacuumCostActive)
+				VacuumCostBalance += VacuumCostPageHit;
+
+			TRACE_POSTGRESQL_BUFFER_READ_DONE(forkNum, blockNum + i,
+											  smgr->smgr_rnode.node.spcNode,
+											  smgr->smgr_rnode.node.dbNode,
+											  smgr->smgr_rnode.node.relNode,
+											  smgr->smgr_rnode.backend,
+											  false,
+											  true);
+
+			/* a cached block ends the current run of misses, if any */
+			if (first_miss >= 0)
+			{
+				CompleteReadRange(smgr, forkNum, blockNum + first_miss,
+								  &buffers[first_miss], i - first_miss);
+				first_miss = -1;
+			}
+		}
+		else
+		{
+			/* IO_IN_PROGRESS is set; remember where this run starts */
+			pgBufferUsage.shared_blks_read++;
+			if (first_miss < 0)
+				first_miss = i;
+		}
+	}
+
+	if (first_miss >= 0)
+		CompleteReadRange(smgr, forkNum, blockNum + first_miss,
+						  &buffers[first_miss], nblocks - first_miss);
+}
+
+/*
+ * CompleteReadRange -- subroutine for ReadBufferRange
+ *
+ * Reads consecutive blocks into pinned shared buffers on which we hold the
+ * I/O-in-progress flag, verifies them and marks them valid.
+ */
+static void
+CompleteReadRange(SMgrRelation smgr, ForkNumber forkNum, BlockNumber blockNum,
+				  Buffer *buffers, int nblocks)
+{
+	char	   *pages[MAX_BUFFERS_PER_TRANSFER];
+	instr_time	io_start,
+				io_time;
+
+	for (int i = 0; i < nblocks; i++)
+		pages[i] = (char *) BufHdrGetBlock(GetBufferDescriptor(buffers[i] - 1));
+
+	if (track_io_timing)
+		INSTR_TIME_SET_CURRENT(io_start);
+
+	smgrreadv(smgr, forkNum, blockNum, pages, nblocks);
+
+	if (track_io_timing)
+	{
+		INSTR_TIME_SET_CURRENT(io_time);
+		INSTR_TIME_SUBTRACT(io_time, io_start);
+		pgstat_count_buffer_read_time(INSTR_TIME_GET_MICROSEC(io_time));
+		INSTR_TIME_ADD(pgBufferUsage.blk_read_time, io_time);
+	}
+
+	for (int i = 0; i < nblocks; i++)
+	{
+		BufferDesc *bufHdr = GetBufferDescriptor(buffers[i] - 1);
+
+		Assert(!(pg_atomic_read_u32(&bufHdr->state) & BM_VALID));	/* spinlock not needed */
+
+		/* check for garbage data */
+		VerifyReadPage(smgr, forkNum, blockNum + i, pages[i], RBM_NORMAL);
+
+		/* Set BM_VALID, terminate IO, and wake up any waiters */
+		TerminateBufferIO(bufHdr, false, BM_VALID);
+
+		VacuumPageMiss++;
+		if (VacuumCostActive)
+			VacuumCostBalance += VacuumCostPageMiss;
+
+		TRACE_POSTGRESQL_BUFFER_READ_DONE(forkNum, blockNum + i,
+										  smgr->smgr_rnode.node.spcNode,
+										  smgr->smgr_rnode.node.dbNode,
+										  smgr->smgr_rnode.node.relNode,
+										  smgr->smgr_rnode.backend,
+										  false,
+										  false);
+	}
+}
+
+/*
+ * CanStartReadBufferRange -- is there room for another StartReadBufferRange?
+ *
+ * A backend can have at most MAX_ASYNC_READ_RANGES such reads going at once.
+ * Callers that find no room should fall back to ReadBufferRange().
+ */
+bool
+CanStartReadBufferRange(void)
+{
+	return NumPendingReadRanges < MAX_ASYNC_READ_RANGES;
+}
+
+/*
+ * StartReadBufferRange -- start reading a range of consecutive blocks
+ *
+ * This is the asynchronous counterpart of ReadBufferRange(): all blocks of
+ * the range are pinned right away, and a read is started for every run of
+ * blocks that were not already in shared buffers, but the caller must call
+ * WaitReadBufferRange() before looking at the buffers.  Whether the reads
+ * actually proceed in the background depends on io_method.  Reads are queued
+ * rather than handed to the kernel immediately; use SubmitReadBufferRanges()
+ * after starting a batch of them.
+ *
+ * Only relations using shared buffers are supported, and the caller must
+ * have checked CanStartReadBufferRange().  *io must stay valid until
+ * WaitReadBufferRange() has returned.
+ */
+void
+StartReadBufferRange(ReadBufferRangeIO *io, Relation reln, ForkNumber forkNum,
+					 BlockNumber blockNum, int nblocks,
+					 BufferAccessStrategy strategy)
+{
+	SMgrRelation smgr;
+	int			first_miss = -1;
+
+	Assert(nblocks > 0 && nblocks <= MAX_BUFFERS_PER_TRANSFER);
+	Assert(!RelationUsesLocalBuffers(reln));
+	Assert(CanStartReadBufferRange());
+
+	/* Open it at the smgr level if not already done */
+	RelationOpenSmgr(reln);
+	smgr = reln->rd_smgr;
+
+	io->rel = reln;
+	io->forknum = forkNum;
+	io->blocknum = blockNum;
+	io->nblocks = nblocks;
+	io->nruns = 0;
+
+	/*
+	 * Register the range before starting any reads, so that AbortBufferIO()
+	 * waits for them if we fail partway.
+	 */
+	PendingReadRanges[NumPendingReadRanges++] = io;
+
+	/* see ReadBufferRange() for why blocks are allocated in this order */
+	for (int i = 0; i < nblocks; i++)
+	{
+		BufferDesc *bufHdr;
+		bool		found;
+
+		/* Make sure we will have room to remember the buffer pin */
+		ResourceOwnerEnlargeBuffers(CurrentResourceOwner);
+
+		TRACE_POSTGRESQL_BUFFER_READ_START(forkNum, blockNum + i,
+										   smgr->smgr_rnode.node.spcNode,
+										   smgr->smgr_rnode.node.dbNode,
+										   smgr->smgr_rnode.node.relNode,
+										   smgr->smgr_rnode.backend,
+										   false);
+
+		pgstat_count_buffer_read(reln);
+		bufHdr = BufferAlloc(smgr, reln->rd_rel->relpersistence, forkNum,
+							 blockNum + i, strategy, &found);
+		io->buffers[i] = BufferDescriptorGetBuffer(bufHdr);
+
+		if (found)
+		{
+			pgstat_count_buffer_hit(reln);
+			pgBufferUsage.shared_blks_hit++;
+			VacuumPageHit++;
+			if (VacuumCostActive)
+				VacuumCostBalance += VacuumCostPageHit;
+
+			TRACE_POSTGRESQL_BUFFER_READ_DONE(forkNum, blockNum + i,
+											  smgr->smgr_rnode.node.spcNode,
+											  smgr->smgr_rnode.node.dbNode,
+											  smgr->smgr_rnode.node.relNode,
+											  smgr->smgr_rnode.backend,
+											  false,
+											  true);
+
+			if (first_miss >= 0)
+			{
+				StartReadRun(io, smgr, first_miss, i - first_miss);
+				first_miss = -1;
+			}
+		}
+		else
+		{
+			pgBufferUsage.shared_blks_read++;
+			if (first_miss < 0)
+				first_miss = i;
+		}
+	}
+
+	if (first_miss >= 0)
+		StartReadRun(io, smgr, first_miss, nblocks - first_miss);
+
+	/*
+	 * WaitIO() may have completed the range meanwhile, and runs started after
+	 * that must be waited for again.  A range without reads needs no entry.
+	 */
+	ForgetReadBufferRange(io);
+	if (io->nruns > 0)
+		PendingReadRanges[NumPendingReadRanges++] = io;
+}
+
+/*
+ * StartReadRun -- subroutine for StartReadBufferRange
+ *
+ * Starts reading a run of buffers on which we hold the I/O-in-progress flag.
+ * smgrstartreadv() can't cross a segment boundary, so the run is split
+ * there if necessary.
+ */
+static void
+StartReadRun(ReadBufferRangeIO *io, SMgrRelation smgr, int first, int nblocks)
+{
+	while (nblocks > 0)
+	{
+		BlockNumber blockNum = io->blocknum + first;
+		char	   *pages[MAX_BUFFERS_PER_TRANSFER];
+		int			n;
+
+		n = Min(nblocks, RELSEG_SIZE - (blockNum % ((BlockNumber) RELSEG_SIZE)));
+
+		for (int i = 0; i < n; i++)
+			pages[i] = (char *)
+				BufHdrGetBlock(GetBufferDescriptor(io->buffers[first + i] - 1));
+
+		Assert(io->nruns < lengthof(io->runs));
+		io->runs[io->nruns].first = first;
+		io->runs[io->nruns].nblocks = n;
+		io->runs[io->nruns].handle = smgrstartreadv(smgr, io->forknum,
+													blockNum, pages, n);
+		io->nruns++;
+
+		first += n;
+		nblocks -= n;
+	}
+}
+
+/*
+ * SubmitReadBufferRanges -- make sure all started reads are in progress
+ */
+void
+SubmitReadBufferRanges(void)
+{
+	FileSubmitIO();
+}
+
+/*
+ * WaitReadBufferRange -- finish a read started by StartReadBufferRange
+ *
+ * On return, all buffers in io->buffers are valid and pinned; the pins now
+ * belong to the caller.
+ */
+void
+WaitReadBufferRange(ReadBufferRangeIO *io)
+{
+	SMgrRelation smgr;
+
+	if (io->nruns > 0)
+		CompleteReadBufferRange(io);
+
+	/*
+	 * Any block that is still not valid failed verification, or had its read
+	 * abandoned by error cleanup.  Read it again the ordinary way, which
+	 * also takes care of reporting or zeroing a damaged page.
+	 */
+	RelationOpenSmgr(io->rel);
+	smgr = io->rel->rd_smgr;
+
+	for (int i = 0; i < io->nblocks; i++)
+	{
+		BufferDesc *bufHdr = GetBufferDescriptor(io->buffers[i] - 1);
+
+		if (pg_atomic_read_u32(&bufHdr->state) & BM_VALID)
+			continue;
+
+		if (StartBufferIO(bufHdr, true, false))
+		{
+			Block		bufBlock = BufHdrGetBlock(bufHdr);
+
+			smgrread(smgr, io->forknum, io->blocknum + i, (char *) bufBlock);
+			VerifyReadPage(smgr, io->forknum, io->blocknum + i, bufBlock,
+						   RBM_NORMAL);
+			TerminateBufferIO(bufHdr, false, BM_VALID);
+		}
+	}
+}
+
+/*
+ * CompleteReadBufferRange -- wait for the reads of a started range
+ *
+ * Buffers whose contents pass verification are marked valid.  The others are
+ * left invalid, with no error raised here; WaitReadBufferRange() deals with
+ * them.  That matters because this is also called from WaitIO(), where the
+ * range's owner isn't expecting to hear about it.
+ */
+static void
+CompleteReadBufferRange(ReadBufferRangeIO *io)
+{
+	SMgrRelation smgr;
+	int			nruns = io->nruns;
+
+	/*
+	 * Forget about the range first.  If we fail partway, AbortBufferIO()
+	 * takes care of the remaining reads and buffers.
+	 */
+	io->nruns = 0;
+	ForgetReadBufferRange(io);
+
+	RelationOpenSmgr(io->rel);
+	smgr = io->rel->rd_smgr;
+
+	for (int r = 0; r < nruns; r++)
+	{
+		int			first = io->runs[r].first;
+		int			nblocks = io->runs[r].nblocks;
+		char	   *pages[MAX_BUFFERS_PER_TRANSFER];
+		instr_time	io_start,
+					io_time;
+
+		for (int i = 0; i < nblocks; i++)
+			pages[i] = (char *)
+				BufHdrGetBlock(GetBufferDescriptor(io->buffers[first + i] - 1));
+
+		if (track_io_timing)
+			INSTR_TIME_SET_CURRENT(io_start);
+
+		smgrwaitreadv(smgr, io->forknum, io->blocknum + first, pages, nblocks,
+					  io->runs[r].handle);
+
+		if (track_io_timing)
+		{
+			INSTR_TIME_SET_CURRENT(io_time);
+			INSTR_TIME_SUBTRACT(io_time, io_start);
+			pgstat_count_buffer_read_time(INSTR_TIME_GET_MICROSEC(io_time));
+			INSTR_TIME_ADD(pgBufferUsage.blk_read_time, io_time);
+		}
+
+		for (int i = 0; i < nblocks; i++)
+		{
+			BufferDesc *bufHdr = GetBufferDescriptor(io->buffers[first + i] - 1);
+			BlockNumber blockNum = io->blocknum + first + i;
+
+			if (PageIsVerifiedExtended((Page) pages[i], blockNum, 0))
+				TerminateBufferIO(bufHdr, false, BM_VALID);
+			else
+				TerminateBufferIO(bufHdr, false, 0);
+
+			VacuumPageMiss++;
+			if (VacuumCostActive)
+				VacuumCostBalance += VacuumCostPageMiss;
+
+			TRACE_POSTGRESQL_BUFFER_READ_DONE(io->forknum, blockNum,
+											  smgr->smgr_rnode.node.spcNode,
+											  smgr->smgr_rnode.node.dbNode,
+											  smgr->smgr_rnode.node.relNode,
+											  smgr->smgr_rnode.backend,
+											  false,
+											  false);
+		}
+	}
+}
+
+/*
+ * ForgetReadBufferRange -- remove a range from PendingReadRanges, if present
+ */
+static void
+ForgetReadBufferRange(ReadBufferRangeIO *io)
+{
+	for (int i = 0; i < NumPendingReadRanges; i++)
+	{
+		if (PendingReadRanges[i] == io)
+		{
+			PendingReadRanges[i] = PendingReadRanges[--NumPendingReadRanges];
+			break;
+		}
+	}
+}
+
 /*
  * BufferAlloc -- subroutine for ReadBuffer.  Handles lookup of a shared
  *		buffer.  If no buffer exists already, selects a replacement
@@ -1119,7 +1654,27 @@ BufferAlloc(SMgrRelation smgr, char relpersistence, ForkNumber forkNum,
 	newHash = BufTableHashCode(&newTag);
 	newPartitionLock = BufMappingPartitionLock(newHash);
 
-	/* see if the block is in the buffer pool already */
+	/*
+	 * See if the block is in the buffer pool already.  First try without
+	 * the mapping lock: for a page that is resident and valid, which is by
+	 * far the most common case, checking the buffer's tag once we have it
+	 * locked is enough, and that avoids contention on the mapping partition
+	 * lock when many backends access the same pages.
+	 */
+	buf_id = BufTableLookupOptimistic(&newTag, newHash);
+	if (buf_id >= 0)
+	{
+		buf = GetBufferDescriptor(buf_id);
+		if (PinBufferIfTagMatches(buf, &newTag, strategy))
+		{
+			if (numa_buffer_placement == NUMA_BUFFER_PLACEMENT_PARTITION)
+				StrategyCountBufferHit(buf_id);
+			*foundPtr = true;
+			return buf;
+		}
+	}
+
+	/* No luck, so do it the hard way */
 	LWLockAcquire(newPartitionLock, LW_SHARED);
 	buf_id = BufTableLookup(&newTag, newHash);
 	if (buf_id >= 0)
@@ -1147,7 +1702,7 @@ BufferAlloc(SMgrRelation smgr, char relpersistence, ForkNumber forkNum,
 			 * own read attempt if the page is still not BM_VALID.
 			 * StartBufferIO does it all.
 			 */
-			if (StartBufferIO(buf, true))
+			if (StartBufferIO(buf, true, false))
 			{
 				/*
 				 * If we get here, previous attempts to read the buffer must
@@ -1157,6 +1712,10 @@ BufferAlloc(SMgrRelation smgr, char relpersistence, ForkNumber forkNum,
 			}
 		}
 
+		if (*foundPtr &&
+			numa_buffer_placement == NUMA_BUFFER_PLACEMENT_PARTITION)
+			StrategyCountBufferHit(buf_id);
+
 		return buf;
 	}
 
@@ -1359,7 +1918,7 @@ BufferAlloc(SMgrRelation smgr, char relpersistence, ForkNumber forkNum,
 				 * then set up our own read attempt if the page is still not
 				 * BM_VALID.  StartBufferIO does it all.
 				 */
-				if (StartBufferIO(buf, true))
+				if (StartBufferIO(buf, true, false))
 				{
 					/*
 					 * If we get here, previous attempts to read the buffer
@@ -1435,7 +1994,7 @@ BufferAlloc(SMgrRelation smgr, char relpersistence, ForkNumber forkNum,
 	 * to read it before we did, so there's nothing left for BufferAlloc() to
 	 * do.
 	 */
-	if (StartBufferIO(buf, true))
+	if (StartBufferIO(buf, true, false))
 		*foundPtr = false;
 	else
 		*foundPtr = true;
@@ -1761,6 +2320,78 @@ PinBuffer(BufferDesc *buf, BufferAccessStrategy strategy)
 	return result;
 }
 
+/*
+ * PinBufferIfTagMatches -- pin a buffer if it holds a valid copy of a page
+ *
+ * This is for buffers found by BufTableLookupOptimistic(), which may have
+ * been reassigned to another page by the time we get here.  The tag is
+ * checked with the buffer header locked, and the buffer is pinned before the
+ * lock is released, after which it can't be reassigned anymore.  As in
+ * ReadRecentBuffer(), we never pin a buffer before knowing it's the one we
+ * want, so as not to confuse code paths like InvalidateBuffer().
+ *
+ * Returns false, without touching the buffer, if it doesn't hold the given
+ * page or the page isn't BM_VALID.  Otherwise the buffer is pinned, and its
+ * usage_count advanced, just as PinBuffer() would do it.
+ *
+ * Note that ResourceOwnerEnlargeBuffers must have been done already.
+ */
+static bool
+PinBufferIfTagMatches(BufferDesc *buf, BufferTag *tag,
+					  BufferAccessStrategy strategy)
+{
+	Buffer		b = BufferDescriptorGetBuffer(buf);
+	PrivateRefCountEntry *ref;
+	uint32		buf_state;
+
+	/*
+	 * If we already have the buffer pinned, its tag can't change under us,
+	 * so there's no need to lock the header to check it.
+	 */
+	if (GetPrivateRefCount(b) > 0)
+	{
+		buf_state = pg_atomic_read_u32(&buf->state);
+		if (!(buf_state & BM_VALID) || !BUFFERTAGS_EQUAL(*tag, buf->tag))
+			return false;
+
+		(void) PinBuffer(buf, strategy);
+		return true;
+	}
+
+	ReservePrivateRefCountEntry();
+
+	buf_state = LockBufHdr(buf);
+	if (!(buf_state & BM_VALID) || !BUFFERTAGS_EQUAL(*tag, buf->tag))
+	{
+		UnlockBufHdr(buf, buf_state);
+		return false;
+	}
+
+	/* same usage_count policy as PinBuffer() */
+	if (strategy == NULL)
+	{
+		if (BUF_STATE_GET_USAGECOUNT(buf_state) < BM_MAX_USAGE_COUNT)
+			buf_state += BUF_USAGECOUNT_ONE;
+	}
+	else
+	{
+		if (BUF_STATE_GET_USAGECOUNT(buf_state) == 0)
+			buf_state += BUF_USAGECOUNT_ONE;
+	}
+	buf_state += BUF_REFCOUNT_ONE;
+	UnlockBufHdr(buf, buf_state);
+
+	/* as in PinBuffer_Locked, we had no pin before */
+	VALGRIND_MAKE_MEM_DEFINED(BufHdrGetBlock(buf), BLCKSZ);
+
+	ref = NewPrivateRefCountEntry(b);
+	ref->refcount++;
+
+	ResourceOwnerRememberBuffer(CurrentResourceOwner, b);
+
+	return true;
+}
+
 /*
  * PinBuffer_Locked -- as above, but caller already locked the buffer header.
  * The spinlock is released before return.
@@ -1942,9 +2573,6 @@ BufferSync(int flags)
 	int			mask = BM_DIRTY;
 	WritebackContext wb_context;
 
-	/* Make sure we can handle the pin inside SyncOneBuffer */
-	ResourceOwnerEnlargeBuffers(CurrentResourceOwner);
-
 	/*
 	 * Unless this is a shutdown checkpoint or we have been explicitly told,
 	 * we write only permanent, dirty buffers.  But at shutdown or end of
@@ -2118,43 +2746,64 @@ BufferSync(int flags)
 		BufferDesc *bufHdr = NULL;
 		CkptTsStatus *ts_stat = (CkptTsStatus *)
 		DatumGetPointer(binaryheap_first(ts_heap));
+		int			nprocessed = 1;
 
 		buf_id = CkptBufferIds[ts_stat->index].buf_id;
 		Assert(buf_id != -1);
 
 		bufHdr = GetBufferDescriptor(buf_id);
 
-		num_processed++;
-
 		/*
 		 * We don't need to acquire the lock here, because we're only looking
 		 * at a single bit. It's possible that someone else writes the buffer
 		 * and clears the flag right after we check, but that doesn't matter
-		 * since SyncOneBuffer will then do nothing.  However, there is a
+		 * since SyncBufferRange will then do nothing.  However, there is a
 		 * further race condition: it's conceivable that between the time we
-		 * examine the bit here and the time SyncOneBuffer acquires the lock,
-		 * someone else not only wrote the buffer but replaced it with another
-		 * page and dirtied it.  In that improbable case, SyncOneBuffer will
-		 * write the buffer though we didn't need to.  It doesn't seem worth
+		 * examine the bit here and the time SyncBufferRange acquires the
+		 * lock, someone else not only wrote the buffer but replaced it with
+		 * another page and dirtied it.  In that improbable case,
+		 * SyncBufferRange will write the buffer though we didn't need to.  It doesn't seem worth
 		 * guarding against this, though.
 		 */
 		if (pg_atomic_read_u32(&bufHdr->state) & BM_CHECKPOINT_NEEDED)
 		{
-			if (SyncOneBuffer(buf_id, false, &wb_context) & BUF_WRITTEN)
+			CkptSortItem *items = &CkptBufferIds[ts_stat->index];
+			int			max_items;
+			int			nitems;
+			int			nwritten;
+
+			/*
+			 * Thanks to the sort order, blocks that are consecutive in the
+			 * same relation fork follow each other; hand over as many of
+			 * them as can be written with a single vectored write.
+			 * SyncBufferRange checks that the buffers really do belong
+			 * together, since a sort item doesn't identify the database and
+			 * the buffers may have been replaced since.
+			 */
+			max_items = Min(ts_stat->num_to_scan - ts_stat->num_scanned,
+							MAX_BUFFERS_PER_TRANSFER);
+			for (nitems = 1; nitems < max_items; nitems++)
 			{
-				TRACE_POSTGRESQL_BUFFER_SYNC_WRITTEN(buf_id);
-				BgWriterStats.m_buf_written_checkpoints++;
-				num_written++;
+				if (items[nitems].relNode != items[0].relNode ||
+					items[nitems].forkNum != items[0].forkNum ||
+					items[nitems].blockNum != items[0].blockNum + nitems)
+					break;
 			}
+
+			nprocessed = SyncBufferRange(items, nitems, &wb_context,
+										 &nwritten);
+			num_written += nwritten;
 		}
 
+		num_processed += nprocessed;
+
 		/*
 		 * Measure progress independent of actually having to flush the buffer
 		 * - otherwise writing become unbalanced.
 		 */
-		ts_stat->progress += ts_stat->progress_slice;
-		ts_stat->num_scanned++;
-		ts_stat->index++;
+		ts_stat->progress += ts_stat->progress_slice * nprocessed;
+		ts_stat->num_scanned += nprocessed;
+		ts_stat->index += nprocessed;
 
 		/* Have all the buffers from the tablespace been processed? */
 		if (ts_stat->num_scanned == ts_stat->num_to_scan)
@@ -2194,35 +2843,78 @@ BufferSync(int flags)
 /*
  * BgBufferSync -- Write out some dirty buffers in the pool.
  *
- * This is called periodically by the background writer process.
+ * This is called periodically by the background writer process.  Each clock
+ * sweep partition is cleaned ahead of its own clock hand, see
+ * BgBufferSyncPartition().
  *
  * Returns true if it's appropriate for the bgwriter process to go into
- * low-power hibernation mode.  (This happens if the strategy clock sweep
- * has been "lapped" and no buffer allocations have occurred recently,
+ * low-power hibernation mode.  (This happens if the strategy clock sweeps
+ * have been "lapped" and no buffer allocations have occurred recently,
  * or if the bgwriter has been effectively disabled by setting
  * bgwriter_lru_maxpages to 0.)
  */
 bool
 BgBufferSync(WritebackContext *wb_context)
 {
-	/* info obtained from freelist.c */
-	int			strategy_buf_id;
-	uint32		strategy_passes;
-	uint32		recent_alloc;
+	static BgWriterSweepState *sweep_states = NULL;
+	static int	first_extra = 0;
+	int			nparts = StrategyNumPartitions();
+	int			max_pages;
+	int			nextra;
+	bool		hit_limit = false;
+	bool		hibernate = true;
+
+	if (sweep_states == NULL)
+	{
+		sweep_states = (BgWriterSweepState *)
+			MemoryContextAllocZero(TopMemoryContext,
+								   nparts * sizeof(BgWriterSweepState));
+		for (int i = 0; i < nparts; i++)
+			sweep_states[i].smoothed_density = 10.0;
+	}
 
 	/*
-	 * Information saved between calls so we can determine the strategy
-	 * point's advance rate and avoid scanning already-cleaned buffers.
+	 * bgwriter_lru_maxpages is shared out among the partitions.  The pages
+	 * left over by the division go to nextra partitions, starting at a
+	 * different one each round, so that the total never exceeds the limit.
 	 */
-	static bool saved_info_valid = false;
-	static int	prev_strategy_buf_id;
-	static uint32 prev_strategy_passes;
-	static int	next_to_clean;
-	static uint32 next_passes;
+	max_pages = bgwriter_lru_maxpages / nparts;
+	nextra = bgwriter_lru_maxpages % nparts;
 
-	/* Moving averages of allocation rate and clean-buffer density */
-	static float smoothed_alloc = 0;
-	static float smoothed_density = 10.0;
+	for (int i = 0; i < nparts; i++)
+	{
+		bool		extra = (i - first_extra + nparts) % nparts < nextra;
+
+		if (!BgBufferSyncPartition(i, &sweep_states[i],
+								   max_pages + (extra ? 1 : 0),
+								   &hit_limit, wb_context))
+			hibernate = false;
+	}
+	first_extra = (first_extra + nextra) % nparts;
+
+	/* report hitting the limit once per round, as for a single sweep */
+	if (hit_limit)
+		BgWriterStats.m_maxwritten_clean++;
+
+	return hibernate;
+}
+
+/*
+ * BgBufferSyncPartition -- BgBufferSync's work for one clock sweep partition
+ *
+ * At most max_pages buffers are written; *hit_limit is set if that stopped
+ * the scan.  Returns true if the partition has been idle enough to hibernate.
+ */
+static bool
+BgBufferSyncPartition(int partition, BgWriterSweepState *state, int max_pages,
+					  bool *hit_limit, WritebackContext *wb_context)
+{
+	/* info obtained from freelist.c */
+	int			strategy_buf_id;
+	uint32		strategy_passes;
+	uint32		recent_alloc;
+	int			first_buffer;
+	int			num_buffers;
 
 	/* Potentially these could be tunables, but for now, not */
 	float		smoothing_samples = 16;
@@ -2250,7 +2942,9 @@ BgBufferSync(WritebackContext *wb_context)
 	 * Find out where the freelist clock sweep currently is, and how many
 	 * buffer allocations have happened since our last call.
 	 */
-	strategy_buf_id = StrategySyncStart(&strategy_passes, &recent_alloc);
+	strategy_buf_id = StrategySyncStart(partition, &strategy_passes,
+										&recent_alloc);
+	StrategyPartitionRange(partition, &first_buffer, &num_buffers);
 
 	/* Report buffer alloc counts to pgstat */
 	BgWriterStats.m_buf_alloc += recent_alloc;
@@ -2262,7 +2956,7 @@ BgBufferSync(WritebackContext *wb_context)
 	 */
 	if (bgwriter_lru_maxpages <= 0)
 	{
-		saved_info_valid = false;
+		state->saved_info_valid = false;
 		return true;
 	}
 
@@ -2274,34 +2968,34 @@ BgBufferSync(WritebackContext *wb_context)
 	 * weird-looking coding of xxx_passes comparisons are to avoid bogus
 	 * behavior when the passes counts wrap around.
 	 */
-	if (saved_info_valid)
+	if (state->saved_info_valid)
 	{
-		int32		passes_delta = strategy_passes - prev_strategy_passes;
+		int32		passes_delta = strategy_passes - state->prev_strategy_passes;
 
-		strategy_delta = strategy_buf_id - prev_strategy_buf_id;
-		strategy_delta += (long) passes_delta * NBuffers;
+		strategy_delta = strategy_buf_id - state->prev_strategy_buf_id;
+		strategy_delta += (long) passes_delta * num_buffers;
 
 		Assert(strategy_delta >= 0);
 
-		if ((int32) (next_passes - strategy_passes) > 0)
+		if ((int32) (state->next_passes - strategy_passes) > 0)
 		{
 			/* we're one pass ahead of the strategy point */
-			bufs_to_lap = strategy_buf_id - next_to_clean;
+			bufs_to_lap = strategy_buf_id - state->next_to_clean;
 #ifdef BGW_DEBUG
 			elog(DEBUG2, "bgwriter ahead: bgw %u-%u strategy %u-%u delta=%ld lap=%d",
-				 next_passes, next_to_clean,
+				 state->next_passes, state->next_to_clean,
 				 strategy_passes, strategy_buf_id,
 				 strategy_delta, bufs_to_lap);
 #endif
 		}
-		else if (next_passes == strategy_passes &&
-				 next_to_clean >= strategy_buf_id)
+		else if (state->next_passes == strategy_passes &&
+				 state->next_to_clean >= strategy_buf_id)
 		{
 			/* on same pass, but ahead or at least not behind */
-			bufs_to_lap = NBuffers - (next_to_clean - strategy_buf_id);
+			bufs_to_lap = num_buffers - (state->next_to_clean - strategy_buf_id);
 #ifdef BGW_DEBUG
 			elog(DEBUG2, "bgwriter ahead: bgw %u-%u strategy %u-%u delta=%ld lap=%d",
-				 next_passes, next_to_clean,
+				 state->next_passes, state->next_to_clean,
 				 strategy_passes, strategy_buf_id,
 				 strategy_delta, bufs_to_lap);
 #endif
@@ -2314,13 +3008,13 @@ BgBufferSync(WritebackContext *wb_context)
 			 */
 #ifdef BGW_DEBUG
 			elog(DEBUG2, "bgwriter behind: bgw %u-%u strategy %u-%u delta=%ld",
-				 next_passes, next_to_clean,
+				 state->next_passes, state->next_to_clean,
 				 strategy_passes, strategy_buf_id,
 				 strategy_delta);
 #endif
-			next_to_clean = strategy_buf_id;
-			next_passes = strategy_passes;
-			bufs_to_lap = NBuffers;
+			state->next_to_clean = strategy_buf_id;
+			state->next_passes = strategy_passes;
+			bufs_to_lap = num_buffers;
 		}
 	}
 	else
@@ -2334,15 +3028,15 @@ BgBufferSync(WritebackContext *wb_context)
 			 strategy_passes, strategy_buf_id);
 #endif
 		strategy_delta = 0;
-		next_to_clean = strategy_buf_id;
-		next_passes = strategy_passes;
-		bufs_to_lap = NBuffers;
+		state->next_to_clean = strategy_buf_id;
+		state->next_passes = strategy_passes;
+		bufs_to_lap = num_buffers;
 	}
 
 	/* Update saved info for next time */
-	prev_strategy_buf_id = strategy_buf_id;
-	prev_strategy_passes = strategy_passes;
-	saved_info_valid = true;
+	state->prev_strategy_buf_id = strategy_buf_id;
+	state->prev_strategy_passes = strategy_passes;
+	state->saved_info_valid = true;
 
 	/*
 	 * Compute how many buffers had to be scanned for each new allocation, ie,
@@ -2353,7 +3047,7 @@ BgBufferSync(WritebackContext *wb_context)
 	if (strategy_delta > 0 && recent_alloc > 0)
 	{
 		scans_per_alloc = (float) strategy_delta / (float) recent_alloc;
-		smoothed_density += (scans_per_alloc - smoothed_density) /
+		state->smoothed_density += (scans_per_alloc - state->smoothed_density) /
 			smoothing_samples;
 	}
 
@@ -2362,22 +3056,22 @@ BgBufferSync(WritebackContext *wb_context)
 	 * strategy point and where we've scanned ahead to, based on the smoothed
 	 * density estimate.
 	 */
-	bufs_ahead = NBuffers - bufs_to_lap;
-	reusable_buffers_est = (float) bufs_ahead / smoothed_density;
+	bufs_ahead = num_buffers - bufs_to_lap;
+	reusable_buffers_est = (float) bufs_ahead / state->smoothed_density;
 
 	/*
 	 * Track a moving average of recent buffer allocations.  Here, rather than
 	 * a true average we want a fast-attack, slow-decline behavior: we
 	 * immediately follow any increase.
 	 */
-	if (smoothed_alloc <= (float) recent_alloc)
-		smoothed_alloc = recent_alloc;
+	if (state->smoothed_alloc <= (float) recent_alloc)
+		state->smoothed_alloc = recent_alloc;
 	else
-		smoothed_alloc += ((float) recent_alloc - smoothed_alloc) /
+		state->smoothed_alloc += ((float) recent_alloc - state->smoothed_alloc) /
 			smoothing_samples;
 
 	/* Scale the estimate by a GUC to allow more aggressive tuning. */
-	upcoming_alloc_est = (int) (smoothed_alloc * bgwriter_lru_multiplier);
+	upcoming_alloc_est = (int) (state->smoothed_alloc * bgwriter_lru_multiplier);
 
 	/*
 	 * If recent_alloc remains at zero for many cycles, smoothed_alloc will
@@ -2388,7 +3082,7 @@ BgBufferSync(WritebackContext *wb_context)
 	 * syndrome.  It will pop back up as soon as recent_alloc increases.
 	 */
 	if (upcoming_alloc_est == 0)
-		smoothed_alloc = 0;
+		state->smoothed_alloc = 0;
 
 	/*
 	 * Even in cases where there's been little or no buffer allocation
@@ -2400,7 +3094,7 @@ BgBufferSync(WritebackContext *wb_context)
 	 * the BGW will be called during the scan_whole_pool time; slice the
 	 * buffer pool into that many sections.
 	 */
-	min_scan_buffers = (int) (NBuffers / (scan_whole_pool_milliseconds / BgWriterDelay));
+	min_scan_buffers = (int) (num_buffers / (scan_whole_pool_milliseconds / BgWriterDelay));
 
 	if (upcoming_alloc_est < (min_scan_buffers + reusable_buffers_est))
 	{
@@ -2428,24 +3122,29 @@ BgBufferSync(WritebackContext *wb_context)
 	/* Execute the LRU scan */
 	while (num_to_scan > 0 && reusable_buffers < upcoming_alloc_est)
 	{
-		int			sync_state = SyncOneBuffer(next_to_clean, true,
-											   wb_context);
+		int			sync_state;
+
+		/* this partition's share of bgwriter_lru_maxpages may be zero */
+		if (num_written >= max_pages)
+		{
+			*hit_limit = true;
+			break;
+		}
+
+		sync_state = SyncOneBuffer(first_buffer + state->next_to_clean,
+								   true, wb_context);
 
-		if (++next_to_clean >= NBuffers)
+		if (++state->next_to_clean >= num_buffers)
 		{
-			next_to_clean = 0;
-			next_passes++;
+			state->next_to_clean = 0;
+			state->next_passes++;
 		}
 		num_to_scan--;
 
 		if (sync_state & BUF_WRITTEN)
 		{
 			reusable_buffers++;
-			if (++num_written >= bgwriter_lru_maxpages)
-			{
-				BgWriterStats.m_maxwritten_clean++;
-				break;
-			}
+			num_written++;
 		}
 		else if (sync_state & BUF_REUSABLE)
 			reusable_buffers++;
@@ -2455,8 +3154,8 @@ BgBufferSync(WritebackContext *wb_context)
 
 #ifdef BGW_DEBUG
 	elog(DEBUG1, "bgwriter: recent_alloc=%u smoothed=%.2f delta=%ld ahead=%d density=%.2f reusable_est=%d upcoming_est=%d scanned=%d wrote=%d reusable=%d",
-		 recent_alloc, smoothed_alloc, strategy_delta, bufs_ahead,
-		 smoothed_density, reusable_buffers_est, upcoming_alloc_est,
+		 recent_alloc, state->smoothed_alloc, strategy_delta, bufs_ahead,
+		 state->smoothed_density, reusable_buffers_est, upcoming_alloc_est,
 		 bufs_to_lap - num_to_scan,
 		 num_written,
 		 reusable_buffers - reusable_buffers_est);
@@ -2475,13 +3174,13 @@ BgBufferSync(WritebackContext *wb_context)
 	if (new_strategy_delta > 0 && new_recent_alloc > 0)
 	{
 		scans_per_alloc = (float) new_strategy_delta / (float) new_recent_alloc;
-		smoothed_density += (scans_per_alloc - smoothed_density) /
+		state->smoothed_density += (scans_per_alloc - state->smoothed_density) /
 			smoothing_samples;
 
 #ifdef BGW_DEBUG
 		elog(DEBUG2, "bgwriter: cleaner density alloc=%u scan=%ld density=%.2f new smoothed=%.2f",
 			 new_recent_alloc, new_strategy_delta,
-			 scans_per_alloc, smoothed_density);
+			 scans_per_alloc, state->smoothed_density);
 #endif
 	}
 
@@ -2565,6 +3264,109 @@ SyncOneBuffer(int buf_id, bool skip_recently_used, WritebackContext *wb_context)
 	return result | BUF_WRITTEN;
 }
 
+/*
+ * SyncBufferRange -- write out a run of buffers for a checkpoint
+ *
+ * items[] are sort items for up to MAX_BUFFERS_PER_TRANSFER consecutive
+ * blocks of one relation fork.  Starting with the first, we collect buffers
+ * that still need to be written and still hold consecutive blocks, and write
+ * them with a single smgrwritev() call.  We stop at the first item that
+ * doesn't qualify, so that the caller can deal with the remaining items
+ * separately.  Returns the number of items processed, which is at least 1,
+ * and sets *nwritten to the number of buffers written.
+ *
+ * Only the first buffer's content lock is waited for.  The rest are acquired
+ * conditionally, because waiting for a lock while holding locks on other
+ * buffers could deadlock against backends that lock pages in a different
+ * order.  Likewise, the run ends at a buffer that another process is already
+ * writing, rather than waiting for that I/O while holding the others.
+ */
+static int
+SyncBufferRange(CkptSortItem *items, int nitems, WritebackContext *wb_context,
+				int *nwritten)
+{
+	BufferDesc *bufs[MAX_BUFFERS_PER_TRANSFER];
+	int			n;
+
+	*nwritten = 0;
+
+	for (n = 0; n < nitems; n++)
+	{
+		BufferDesc *bufHdr = GetBufferDescriptor(items[n].buf_id);
+		uint32		buf_state;
+
+		/* Make sure we can handle the pin */
+		ResourceOwnerEnlargeBuffers(CurrentResourceOwner);
+		ReservePrivateRefCountEntry();
+
+		/*
+		 * As in SyncOneBuffer, the header spinlock is enough to check whether
+		 * the buffer needs writing.
+		 */
+		buf_state = LockBufHdr(bufHdr);
+
+		if (!(buf_state & BM_VALID) || !(buf_state & BM_DIRTY) ||
+			(n > 0 && !(buf_state & BM_CHECKPOINT_NEEDED)) ||
+			(n > 0 && (!RelFileNodeEquals(bufHdr->tag.rnode,
+										  bufs[0]->tag.rnode) ||
+					   bufHdr->tag.forkNum != bufs[0]->tag.forkNum ||
+					   bufHdr->tag.blockNum != bufs[0]->tag.blockNum + n)))
+		{
+			UnlockBufHdr(bufHdr, buf_state);
+			break;
+		}
+
+		PinBuffer_Locked(bufHdr);
+
+		if (n == 0)
+			LWLockAcquire(BufferDescriptorGetContentLock(bufHdr), LW_SHARED);
+		else if (!LWLockConditionalAcquire(BufferDescriptorGetContentLock(bufHdr),
+										   LW_SHARED))
+		{
+			UnpinBuffer(bufHdr, true);
+			break;
+		}
+
+		/*
+		 * Someone else may have flushed the buffer by now.  Don't wait for a
+		 * write in progress after the first buffer, for the same reason as
+		 * for the content locks.
+		 */
+		if (!StartBufferIO(bufHdr, false, n > 0))
+		{
+			LWLockRelease(BufferDescriptorGetContentLock(bufHdr));
+			UnpinBuffer(bufHdr, true);
+			break;
+		}
+
+		bufs[n] = bufHdr;
+	}
+
+	if (n > 0)
+		FlushBufferRange(bufs, n);
+
+	for (int i = 0; i < n; i++)
+	{
+		BufferTag	tag;
+
+		LWLockRelease(BufferDescriptorGetContentLock(bufs[i]));
+
+		tag = bufs[i]->tag;
+
+		UnpinBuffer(bufs[i], true);
+
+		ScheduleBufferTagForWriteback(wb_context, &tag);
+
+		TRACE_POSTGRESQL_BUFFER_SYNC_WRITTEN(BufferDescriptorGetBuffer(bufs[i]) - 1);
+		BgWriterStats.m_buf_written_checkpoints++;
+	}
+
+	*nwritten = n;
+
+	/* if we couldn't write even the first item, we're still done with it */
+	return Max(n, 1);
+}
+
 /*
  *		AtEOXact_Buffers - clean up at end of transaction.
  *
@@ -2830,7 +3632,7 @@ FlushBuffer(BufferDesc *buf, SMgrRelation reln)
 	 * someone else flushed the buffer before we could, so we need not do
 	 * anything.
 	 */
-	if (!StartBufferIO(buf, false))
+	if (!StartBufferIO(buf, false, false))
 		return;
 
 	/* Setup error traceback support for ereport() */
@@ -2933,6 +3735,138 @@ FlushBuffer(BufferDesc *buf, SMgrRelation reln)
 	error_context_stack = errcallback.previous;
 }
 
+/*
+ * FlushBufferRange
+ *		Physically write out a run of shared buffers holding consecutive
+ *		blocks of one relation fork.
+ *
+ * This does the same as calling FlushBuffer() for each buffer, but issues a
+ * single vectored write.  The caller must hold a pin and a share lock on each
+ * buffer, and must already have started output I/O on all of them with
+ * StartBufferIO().
+ */
+static void
+FlushBufferRange(BufferDesc **bufs, int nbufs)
+{
+	static char *pageCopies = NULL;
+	XLogRecPtr	max_recptr = InvalidXLogRecPtr;
+	ErrorContextCallback errcallback;
+	instr_time	io_start,
+				io_time;
+	char	   *bufsToWrite[MAX_BUFFERS_PER_TRANSFER];
+	bool		permanent = false;
+	SMgrRelation reln;
+
+	Assert(nbufs > 0 && nbufs <= MAX_BUFFERS_PER_TRANSFER);
+
+	/* Setup error traceback support for ereport() */
+	errcallback.callback = shared_buffer_write_error_callback;
+	errcallback.arg = (void *) bufs[0];
+	errcallback.previous = error_context_stack;
+	error_context_stack = &errcallback;
+
+	reln = smgropen(bufs[0]->tag.rnode, InvalidBackendId);
+
+	for (int i = 0; i < nbufs; i++)
+	{
+		BufferDesc *buf = bufs[i];
+		XLogRecPtr	recptr;
+		uint32		buf_state;
+
+		TRACE_POSTGRESQL_BUFFER_FLUSH_START(buf->tag.forkNum,
+											buf->tag.blockNum,
+											reln->smgr_rnode.node.spcNode,
+											reln->smgr_rnode.node.dbNode,
+											reln->smgr_rnode.node.relNode);
+
+		/* See FlushBuffer() */
+		buf_state = LockBufHdr(buf);
+		recptr = BufferGetLSN(buf);
+		buf_state &= ~BM_JUST_DIRTIED;
+		UnlockBufHdr(buf, buf_state);
+
+		if (buf_state & BM_PERMANENT)
+		{
+			permanent = true;
+			if (recptr > max_recptr)
+				max_recptr = recptr;
+		}
+	}
+
+	/*
+	 * Honor the WAL-before-data rule for all the blocks at once.  See
+	 * FlushBuffer() for why unlogged buffers are skipped.
+	 */
+	if (permanent)
+		XLogFlush(max_recptr);
+
+	/*
+	 * Set checksums like PageSetChecksumCopy() does, but that function has
+	 * only one page of copy space, so we keep our own.
+	 */
+	for (int i = 0; i < nbufs; i++)
+	{
+		Page		page = (Page) BufHdrGetBlock(bufs[i]);
+
+		if (PageIsNew(page) || !DataChecksumsEnabled())
+			bufsToWrite[i] = (char *) page;
+		else
+		{
+			/* aligned, so that direct I/O can write the copies as they are */
+			if (pageCopies == NULL)
+				pageCopies = (char *)
+					PG_IO_ALIGN(MemoryContextAlloc(TopMemoryContext,
+												   BLCKSZ * MAX_BUFFERS_PER_TRANSFER +
+												   PG_IO_ALIGN_SIZE));
+
+			bufsToWrite[i] = pageCopies + BLCKSZ * i;
+			memcpy(bufsToWrite[i], (char *) page, BLCKSZ);
+			PageSetChecksumInplace((Page) bufsToWrite[i],
+								   bufs[0]->tag.blockNum + i);
+		}
+	}
+
+	if (track_io_timing)
+		INSTR_TIME_SET_CURRENT(io_start);
+
+	smgrwritev(reln,
+			   bufs[0]->tag.forkNum,
+			   bufs[0]->tag.blockNum,
+			   bufsToWrite,
+			   nbufs,
+			   false);
+
+	if (track_io_timing)
+	{
+		INSTR_TIME_SET_CURRENT(io_time);
+		INSTR_TIME_SUBTRACT(io_time, io_start);
+		pgstat_count_buffer_write_time(INSTR_TIME_GET_MICROSEC(io_time));
+		INSTR_TIME_ADD(pgBufferUsage.blk_write_time, io_time);
+	}
+
+	pgBufferUsage.shared_blks_written += nbufs;
+
+	for (int i = 0; i < nbufs; i++)
+	{
+		BufferDesc *buf = bufs[i];
+
+		/*
+		 * Mark the buffer as clean (unless BM_JUST_DIRTIED has become set)
+		 * and end the BM_IO_IN_PROGRESS state.
+		 */
+		TerminateBufferIO(buf, true, 0);
+
+		TRACE_POSTGRESQL_BUFFER_FLUSH_DONE(buf->tag.forkNum,
+										   buf->tag.blockNum,
+										   reln->smgr_rnode.node.spcNode,
+										   reln->smgr_rnode.node.dbNode,
+										   reln->smgr_rnode.node.relNode);
+	}
+
+	/* Pop the error context stack */
+	error_context_stack = errcallback.previous;
+}
+
 /*
  * RelationGetNumberOfBlocksInFork
  *		Determines the current number of pages in the specified relation fork.
@@ -4368,6 +5302,14 @@ WaitIO(BufferDesc *buf)
 {
 	ConditionVariable *cv = BufferDescriptorGetIOCV(buf);
 
+	/*
+	 * Finish our own StartReadBufferRange() reads before going to sleep.  The
+	 * backend doing the I/O we are about to wait for might itself be waiting
+	 * for one of them, and only we can complete them.
+	 */
+	while (NumPendingReadRanges > 0)
+		CompleteReadBufferRange(PendingReadRanges[0]);
+
 	ConditionVariablePrepareToSleep(cv);
 	for (;;)
 	{
@@ -4391,27 +5333,28 @@ WaitIO(BufferDesc *buf)
 /*
  * StartBufferIO: begin I/O on this buffer
  *	(Assumptions)
- *	My process is executing no IO
+ *	My process is not already executing IO on this buffer
  *	The buffer is Pinned
  *
  * In some scenarios there are race conditions in which multiple backends
  * could attempt the same I/O operation concurrently.  If someone else
  * has already started I/O on this buffer then we will block on the
- * I/O condition variable until he's done.
+ * I/O condition variable until he's done, unless nowait is true, in which
+ * case we return false immediately.
  *
  * Input operations are only attempted on buffers that are not BM_VALID,
  * and output operations only on buffers that are BM_VALID and BM_DIRTY,
  * so we can always tell if the work is already done.
  *
  * Returns true if we successfully marked the buffer as I/O busy,
- * false if someone else already did the work.
+ * false if someone else already did the work or (if nowait) is doing it.
  */
 static bool
-StartBufferIO(BufferDesc *buf, bool forInput)
+StartBufferIO(BufferDesc *buf, bool forInput, bool nowait)
 {
 	uint32		buf_state;
 
-	Assert(!InProgressBuf);
+	Assert(NumInProgressIOs < MAX_IN_PROGRESS_IO);
 
 	for (;;)
 	{
@@ -4420,6 +5363,8 @@ StartBufferIO(BufferDesc *buf, bool forInput)
 		if (!(buf_state & BM_IO_IN_PROGRESS))
 			break;
 		UnlockBufHdr(buf, buf_state);
+		if (nowait)
+			return false;
 		WaitIO(buf);
 	}
 
@@ -4435,8 +5380,9 @@ StartBufferIO(BufferDesc *buf, bool forInput)
 	buf_state |= BM_IO_IN_PROGRESS;
 	UnlockBufHdr(buf, buf_state);
 
-	InProgressBuf = buf;
-	IsForInput = forInput;
+	InProgressIOs[NumInProgressIOs].buf = buf;
+	InProgressIOs[NumInProgressIOs].forInput = forInput;
+	NumInProgressIOs++;
 
 	return true;
 }
@@ -4461,8 +5407,14 @@ static void
 TerminateBufferIO(BufferDesc *buf, bool clear_dirty, uint32 set_flag_bits)
 {
 	uint32		buf_state;
+	int			i;
 
-	Assert(buf == InProgressBuf);
+	for (i = NumInProgressIOs - 1; i >= 0; i--)
+	{
+		if (InProgressIOs[i].buf == buf)
+			break;
+	}
+	Assert(i >= 0);
 
 	buf_state = LockBufHdr(buf);
 
@@ -4475,7 +5427,8 @@ TerminateBufferIO(BufferDesc *buf, bool clear_dirty, uint32 set_flag_bits)
 	buf_state |= set_flag_bits;
 	UnlockBufHdr(buf, buf_state);
 
-	InProgressBuf = NULL;
+	/* forget it, moving the last entry into its slot */
+	InProgressIOs[i] = InProgressIOs[--NumInProgressIOs];
 
 	ConditionVariableBroadcast(BufferDescriptorGetIOCV(buf));
 }
@@ -4484,7 +5437,7 @@ TerminateBufferIO(BufferDesc *buf, bool clear_dirty, uint32 set_flag_bits)
  * AbortBufferIO: Clean up any active buffer I/O after an error.
  *
  *	All LWLocks we might have held have been released,
- *	but we haven't yet released buffer pins, so the buffer is still pinned.
+ *	but we haven't yet released buffer pins, so the buffers are still pinned.
  *
  *	If I/O was in progress, we always set BM_IO_ERROR, even though it's
  *	possible the error condition wasn't related to the I/O.
@@ -4492,15 +5445,27 @@ TerminateBufferIO(BufferDesc *buf, bool clear_dirty, uint32 set_flag_bits)
 void
 AbortBufferIO(void)
 {
-	BufferDesc *buf = InProgressBuf;
+	/*
+	 * Reads started by StartReadBufferRange() may still be transferring data
+	 * into their buffers; wait for that before giving up on them.  Their
+	 * owners will find the buffers not valid and read them again.
+	 */
+	if (NumPendingReadRanges > 0)
+	{
+		FileWaitAllIO();
+		for (int i = 0; i < NumPendingReadRanges; i++)
+			PendingReadRanges[i]->nruns = 0;
+		NumPendingReadRanges = 0;
+	}
 
-	if (buf)
+	while (NumInProgressIOs > 0)
 	{
+		BufferDesc *buf = InProgressIOs[NumInProgressIOs - 1].buf;
 		uint32		buf_state;
 
 		buf_state = LockBufHdr(buf);
 		Assert(buf_state & BM_IO_IN_PROGRESS);
-		if (IsForInput)
+		if (InProgressIOs[NumInProgressIOs - 1].forInput)
 		{
 			Assert(!(buf_state & BM_DIRTY));
 
@@ -15,29 +15,96 @@
  */
 #include "postgres.h"
 
+#include "miscadmin.h"
 #include "port/atomics.h"
+#include "port/pg_numa.h"
+#include "storage/ipc.h"
 #include "storage/buf_internals.h"
 #include "storage/bufmgr.h"
 #include "storage/proc.h"
 
 #define INT_ACCESS_ONCE(var)	((int)(*((volatile int *)&(var))))
 
+/*
+ * The buffer pool is divided into clock sweep partitions, each a contiguous
+ * range of buffers with its own clock hand, so that backends evicting
+ * buffers concurrently don't all hammer the same cache line.  A partition is
+ * never smaller than MIN_CLOCK_SWEEP_PARTITION_BUFFERS, so small buffer pools
+ * have a single partition and behave as a classic clock sweep.
+ *
+ * Each backend sweeps one partition at a time, moving on to the next one
+ * after CLOCK_SWEEP_PARTITION_BATCH allocations.  Backends start at
+ * different partitions, so they mostly work on different hands, while over
+ * time every backend evicts from all partitions evenly.  That keeps the
+ * replacement policy global: a backend scanning a large table doesn't just
+ * recycle one partition's worth of buffers.
+ *
+ * With numa_buffer_placement = partition, the partitions are divided evenly
+ * among the NUMA nodes, and each partition's buffers are placed in its
+ * node's memory.  Backends then rotate only among the partitions of the
+ * node they are running on, so that the buffers they allocate are local to
+ * them.  To see how well that works, buffer hits are counted as local or
+ * remote, per partition.  Backends accumulate those counts privately and add
+ * them to the shared counters every NUMA_HIT_FLUSH_INTERVAL hits.
+ */
+#define MAX_CLOCK_SWEEP_PARTITIONS			64
+#define MIN_CLOCK_SWEEP_PARTITION_BUFFERS	2048
+#define CLOCK_SWEEP_PARTITION_BATCH			64
+#define NUMA_HIT_FLUSH_INTERVAL				1024
 
 /*
- * The shared freelist control information.
+ * Shared state of a clock sweep partition.
  */
 typedef struct
 {
-	/* Spinlock: protects the values below */
-	slock_t		buffer_strategy_lock;
+	/* Spinlock: protects completePasses against concurrent wraparounds */
+	slock_t		lock;
+
+	int			firstBuffer;	/* first buffer of the partition */
+	int			numBuffers;		/* number of buffers in the partition */
+	int			numaNode;		/* node its buffers are on, or -1 */
 
 	/*
-	 * Clock sweep hand: index of next buffer to consider grabbing. Note that
-	 * this isn't a concrete buffer - we only ever increase the value. So, to
-	 * get an actual buffer, it needs to be used modulo NBuffers.
+	 * Clock sweep hand: index of next buffer to consider grabbing, relative
+	 * to firstBuffer.  Note that this isn't a concrete buffer - we only ever
+	 * increase the value. So, to get an actual buffer, it needs to be used
+	 * modulo numBuffers.
 	 */
 	pg_atomic_uint32 nextVictimBuffer;
 
+	/*
+	 * Statistics.  completePasses and numBufferAllocs work like the
+	 * corresponding fields of BufferStrategyControl used to, before the
+	 * clock was partitioned.  totalBufferAllocs is never reset, and is only
+	 * used for monitoring.
+	 */
+	uint32		completePasses; /* Complete cycles of the clock sweep */
+	pg_atomic_uint32 numBufferAllocs;	/* Buffers allocated since last reset */
+	pg_atomic_uint64 totalBufferAllocs; /* Buffers allocated ever */
+
+	/* Buffer hits by backends on the same / another node, if numaNode >= 0 */
+	pg_atomic_uint64 localHits;
+	pg_atomic_uint64 remoteHits;
+} ClockSweepPartition;
+
+/* Pad each partition to a cache line boundary, to avoid false sharing */
+typedef union ClockSweepPartitionPadded
+{
+	ClockSweepPartition part;
+	char		pad[CACHELINEALIGN(sizeof(ClockSweepPartition))];
+} ClockSweepPartitionPadded;
+
+/*
+ * The shared freelist control information.
+ */
+typedef struct
+{
+	/* Spinlock: protects the values below */
+	slock_t		buffer_strategy_lock;
+
+	int			numPartitions;	/* number of clock sweep partitions */
+	int			numNumaNodes;	/* nodes they're spread over, or 0 */
+
 	int			firstFreeBuffer;	/* Head of list of unused buffers */
 	int			lastFreeBuffer; /* Tail of list of unused buffers */
 
@@ -46,13 +113,6 @@ typedef struct
 	 * when the list is empty)
 	 */
 
-	/*
-	 * Statistics.  These counters should be wide enough that they can't
-	 * overflow during a single bgwriter cycle.
-	 */
-	uint32		completePasses; /* Complete cycles of the clock sweep */
-	pg_atomic_uint32 numBufferAllocs;	/* Buffers allocated since last reset */
-
 	/*
 	 * Bgworker process to be notified upon activity or -1 if none. See
 	 * StrategyNotifyBgWriter.
@@ -62,6 +122,17 @@ typedef struct
 
 /* Pointers to shared state */
 static BufferStrategyControl *StrategyControl = NULL;
+static ClockSweepPartitionPadded *ClockSweepPartitions = NULL;
+
+/* Partition this backend currently sweeps, and allocations made from it */
+static int	MyClockSweepPartition = -1;
+static int	MyClockSweepPartitionAllocs = 0;
+
+/* NUMA node this backend last ran on, and hits not yet flushed */
+static int	MyNumaNode = -1;
+static uint32 PendingNumaHits[MAX_CLOCK_SWEEP_PARTITIONS][2];
+static int	PendingNumaHitsTotal = 0;
+static bool PendingNumaHitsRegistered = false;
 
 /*
  * Private (non-shared) state for managing a ring of shared buffers to re-use.
@@ -102,15 +173,20 @@ static BufferDesc *GetBufferFromRing(BufferAccessStrategy strategy,
 									 uint32 *buf_state);
 static void AddBufferToRing(BufferAccessStrategy strategy,
 							BufferDesc *buf);
+static int	ClockSweepChoosePartition(void);
+static int	StrategyComputePartitions(void);
+static int	StrategyComputeNumaNodes(void);
+static void StrategyFlushNumaHits(void);
+static void StrategyFlushNumaHitsAtExit(int code, Datum arg);
 
 /*
  * ClockSweepTick - Helper routine for StrategyGetBuffer()
  *
- * Move the clock hand one buffer ahead of its current position and return the
- * id of the buffer now under the hand.
+ * Move the partition's clock hand one buffer ahead of its current position
+ * and return the id of the buffer now under the hand.
  */
 static inline uint32
-ClockSweepTick(void)
+ClockSweepTick(ClockSweepPartition *part)
 {
 	uint32		victim;
 
@@ -120,14 +196,14 @@ ClockSweepTick(void)
 	 * apparent order.
 	 */
 	victim =
-		pg_atomic_fetch_add_u32(&StrategyControl->nextVictimBuffer, 1);
+		pg_atomic_fetch_add_u32(&part->nextVictimBuffer, 1);
 
-	if (victim >= NBuffers)
+	if (victim >= part->numBuffers)
 	{
 		uint32		originalVictim = victim;
 
 		/* always wrap what we look up in BufferDescriptors */
-		victim = victim % NBuffers;
+		victim = victim % part->numBuffers;
 
 		/*
 		 * If we're the one that just caused a wraparound, force
@@ -153,19 +229,64 @@ ClockSweepTick(void)
 				 * could lead to an overflow of nextVictimBuffers, but that's
 				 * highly unlikely and wouldn't be particularly harmful.
 				 */
-				SpinLockAcquire(&StrategyControl->buffer_strategy_lock);
+				SpinLockAcquire(&part->lock);
 
-				wrapped = expected % NBuffers;
+				wrapped = expected % part->numBuffers;
 
-				success = pg_atomic_compare_exchange_u32(&StrategyControl->nextVictimBuffer,
+				success = pg_atomic_compare_exchange_u32(&part->nextVictimBuffer,
 														 &expected, wrapped);
 				if (success)
-					StrategyControl->completePasses++;
-				SpinLockRelease(&StrategyControl->buffer_strategy_lock);
+					part->completePasses++;
+				SpinLockRelease(&part->lock);
 			}
 		}
 	}
-	return victim;
+	return part->firstBuffer + victim;
+}
+
+/*
+ * ClockSweepChoosePartition - Helper routine for StrategyGetBuffer()
+ *
+ * Returns the clock sweep partition this backend should allocate from next.
+ */
+static int
+ClockSweepChoosePartition(void)
+{
+	int			nparts = StrategyControl->numPartitions;
+	int			nnodes = StrategyControl->numNumaNodes;
+
+	if (MyClockSweepPartition < 0)
+	{
+		/* spread backends over the partitions */
+		MyClockSweepPartition = (MyProc != NULL ? MyProc->pgprocno : MyProcPid) % nparts;
+	}
+	else if (++MyClockSweepPartitionAllocs >= CLOCK_SWEEP_PARTITION_BATCH)
+		MyClockSweepPartition = (MyClockSweepPartition + 1) % nparts;
+	else
+		return MyClockSweepPartition;
+
+	MyClockSweepPartitionAllocs = 0;
+
+	/*
+	 * If the partitions are placed on NUMA nodes, stay within the ones of
+	 * the node we're running on.  We might have been moved to another CPU
+	 * since the last time, so check again.  Each node has the same number
+	 * of partitions, so taking the position modulo that number keeps the
+	 * rotation going.
+	 */
+	if (nnodes > 0)
+	{
+		MyNumaNode = pg_numa_current_node();
+		if (MyNumaNode >= 0 && MyNumaNode < nnodes)
+		{
+			int			per_node = nparts / nnodes;
+
+			MyClockSweepPartition = MyNumaNode * per_node +
+				MyClockSweepPartition % per_node;
+		}
+	}
+
+	return MyClockSweepPartition;
 }
 
 /*
@@ -203,6 +324,9 @@ StrategyGetBuffer(BufferAccessStrategy strategy, uint32 *buf_state)
 	BufferDesc *buf;
 	int			bgwprocno;
 	int			trycounter;
+	int			partno;
+	int			parts_tried;
+	ClockSweepPartition *part;
 	uint32		local_buf_state;	/* to avoid repeated (de-)referencing */
 
 	/*
@@ -245,9 +369,14 @@ StrategyGetBuffer(BufferAccessStrategy strategy, uint32 *buf_state)
 	/*
 	 * We count buffer allocation requests so that the bgwriter can estimate
 	 * the rate of buffer consumption.  Note that buffers recycled by a
-	 * strategy object are intentionally not counted here.
+	 * strategy object are intentionally not counted here.  Allocations are
+	 * charged to the partition we start sweeping, even if they end up being
+	 * satisfied from the freelist or another partition.
 	 */
-	pg_atomic_fetch_add_u32(&StrategyControl->numBufferAllocs, 1);
+	partno = ClockSweepChoosePartition();
+	part = &ClockSweepPartitions[partno].part;
+	pg_atomic_fetch_add_u32(&part->numBufferAllocs, 1);
+	pg_atomic_fetch_add_u64(&part->totalBufferAllocs, 1);
 
 	/*
 	 * First check, without acquiring the lock, whether there's buffers in the
@@ -312,11 +441,15 @@ StrategyGetBuffer(BufferAccessStrategy strategy, uint32 *buf_state)
 		}
 	}
 
-	/* Nothing on the freelist, so run the "clock sweep" algorithm */
-	trycounter = NBuffers;
+	/*
+	 * Nothing on the freelist, so run the "clock sweep" algorithm on our
+	 * partition.  If all of its buffers are pinned, try the others in turn.
+	 */
+	trycounter = part->numBuffers;
+	parts_tried = 1;
 	for (;;)
 	{
-		buf = GetBufferDescriptor(ClockSweepTick());
+		buf = GetBufferDescriptor(ClockSweepTick(part));
 
 		/*
 		 * If the buffer is pinned or has a nonzero usage_count, we cannot use
@@ -330,7 +463,8 @@ StrategyGetBuffer(BufferAccessStrategy strategy, uint32 *buf_state)
 			{
 				local_buf_state -= BUF_USAGECOUNT_ONE;
 
-				trycounter = NBuffers;
+				trycounter = part->numBuffers;
+				parts_tried = 1;
 			}
 			else
 			{
@@ -343,15 +477,24 @@ StrategyGetBuffer(BufferAccessStrategy strategy, uint32 *buf_state)
 		}
 		else if (--trycounter == 0)
 		{
-			/*
-			 * We've scanned all the buffers without making any state changes,
-			 * so all the buffers are pinned (or were when we looked at them).
-			 * We could hope that someone will free one eventually, but it's
-			 * probably better to fail than to risk getting stuck in an
-			 * infinite loop.
-			 */
-			UnlockBufHdr(buf, local_buf_state);
-			elog(ERROR, "no unpinned buffers available");
+			if (parts_tried >= StrategyControl->numPartitions)
+			{
+				/*
+				 * We've scanned all the buffers without making any state
+				 * changes, so all the buffers are pinned (or were when we
+				 * looked at them).  We could hope that someone will free one
+				 * eventually, but it's probably better to fail than to risk
+				 * getting stuck in an infinite loop.
+				 */
+				UnlockBufHdr(buf, local_buf_state);
+				elog(ERROR, "no unpinned buffers available");
+			}
+
+			/* everything in this partition is pinned, move on */
+			partno = (partno + 1) % StrategyControl->numPartitions;
+			part = &ClockSweepPartitions[partno].part;
+			trycounter = part->numBuffers;
+			parts_tried++;
 		}
 		UnlockBufHdr(buf, local_buf_state);
 	}
@@ -381,45 +524,198 @@ StrategyFreeBuffer(BufferDesc *buf)
 }
 
 /*
- * StrategySyncStart -- tell BufferSync where to start syncing
+ * StrategyNumPartitions -- number of clock sweep partitions
+ */
+int
+StrategyNumPartitions(void)
+{
+	return StrategyControl->numPartitions;
+}
+
+/*
+ * StrategyPartitionRange -- report the buffers of a clock sweep partition
+ *
+ * The partition consists of *num_buffers buffers starting at *first_buffer.
+ */
+void
+StrategyPartitionRange(int partition, int *first_buffer, int *num_buffers)
+{
+	ClockSweepPartition *part = &ClockSweepPartitions[partition].part;
+
+	Assert(partition >= 0 && partition < StrategyControl->numPartitions);
+
+	*first_buffer = part->firstBuffer;
+	*num_buffers = part->numBuffers;
+}
+
+/*
+ * StrategySyncStart -- tell BgBufferSync where to start syncing
  *
- * The result is the buffer index of the best buffer to sync first.
- * BufferSync() will proceed circularly around the buffer array from there.
+ * The result is the index, relative to the start of the given clock sweep
+ * partition, of the best buffer to sync first.  BgBufferSync() will proceed
+ * circularly around the partition from there.
  *
- * In addition, we return the completed-pass count (which is effectively
- * the higher-order bits of nextVictimBuffer) and the count of recent buffer
- * allocs if non-NULL pointers are passed.  The alloc count is reset after
- * being read.
+ * In addition, we return the partition's completed-pass count (which is
+ * effectively the higher-order bits of nextVictimBuffer) and its count of
+ * recent buffer allocs if non-NULL pointers are passed.  The alloc count is
+ * reset after being read.
  */
 int
-StrategySyncStart(uint32 *complete_passes, uint32 *num_buf_alloc)
+StrategySyncStart(int partition, uint32 *complete_passes,
+				  uint32 *num_buf_alloc)
 {
+	ClockSweepPartition *part = &ClockSweepPartitions[partition].part;
 	uint32		nextVictimBuffer;
 	int			result;
 
-	SpinLockAcquire(&StrategyControl->buffer_strategy_lock);
-	nextVictimBuffer = pg_atomic_read_u32(&StrategyControl->nextVictimBuffer);
-	result = nextVictimBuffer % NBuffers;
+	Assert(partition >= 0 && partition < StrategyControl->numPartitions);
+
+	SpinLockAcquire(&part->lock);
+	nextVictimBuffer = pg_atomic_read_u32(&part->nextVictimBuffer);
+	result = nextVictimBuffer % part->numBuffers;
 
 	if (complete_passes)
 	{
-		*complete_passes = StrategyControl->completePasses;
+		*complete_passes = part->completePasses;
 
 		/*
 		 * Additionally add the number of wraparounds that happened before
 		 * completePasses could be incremented. C.f. ClockSweepTick().
 		 */
-		*complete_passes += nextVictimBuffer / NBuffers;
+		*complete_passes += nextVictimBuffer / part->numBuffers;
 	}
 
 	if (num_buf_alloc)
 	{
-		*num_buf_alloc = pg_atomic_exchange_u32(&StrategyControl->numBufferAllocs, 0);
+		*num_buf_alloc = pg_atomic_exchange_u32(&part->numBufferAllocs, 0);
 	}
-	SpinLockRelease(&StrategyControl->buffer_strategy_lock);
+	SpinLockRelease(&part->lock);
 	return result;
 }
 
+/*
+ * StrategyPartitionNumaNode -- report the NUMA node of a partition
+ *
+ * Returns -1 unless numa_buffer_placement is "partition".
+ */
+int
+StrategyPartitionNumaNode(int partition)
+{
+	Assert(partition >= 0 && partition < StrategyControl->numPartitions);
+
+	return ClockSweepPartitions[partition].part.numaNode;
+}
+
+/*
+ * StrategyPartitionStats -- report cumulative activity of a partition
+ *
+ * *buffers_scanned is the number of buffers the partition's clock hand has
+ * passed, and *buffers_allocated the number of allocations charged to the
+ * partition.  *local_hits and *remote_hits count the hits on the partition's
+ * buffers by backends running on its NUMA node and on other nodes; they are
+ * only maintained if the partition has a node.  All of these only ever
+ * increase, so sampling them over time gives the corresponding rates.
+ * Hits are flushed to shared memory in batches, so they lag a little.
+ */
+void
+StrategyPartitionStats(int partition, uint64 *buffers_scanned,
+					   uint64 *buffers_allocated, uint64 *local_hits,
+					   uint64 *remote_hits)
+{
+	ClockSweepPartition *part = &ClockSweepPartitions[partition].part;
+	uint32		nextVictimBuffer;
+
+	Assert(partition >= 0 && partition < StrategyControl->numPartitions);
+
+	SpinLockAcquire(&part->lock);
+	nextVictimBuffer = pg_atomic_read_u32(&part->nextVictimBuffer);
+	*buffers_scanned = (uint64) part->completePasses * part->numBuffers +
+		nextVictimBuffer;
+	SpinLockRelease(&part->lock);
+
+	*buffers_allocated = pg_atomic_read_u64(&part->totalBufferAllocs);
+	*local_hits = pg_atomic_read_u64(&part->localHits);
+	*remote_hits = pg_atomic_read_u64(&part->remoteHits);
+}
+
+/*
+ * StrategyCountBufferHit -- count a hit on a shared buffer as NUMA local or
+ *		remote
+ *
+ * Called by the buffer manager when a lookup finds the page already in
+ * buffers.  Does nothing unless the buffers are placed on NUMA nodes.
+ */
+void
+StrategyCountBufferHit(int buf_id)
+{
+	int			nparts = StrategyControl->numPartitions;
+	int			q;
+	int			r;
+	int			partition;
+
+	if (StrategyControl->numNumaNodes == 0)
+		return;
+
+	/* invert the division of buffers done by StrategyInitialize() */
+	q = NBuffers / nparts;
+	r = NBuffers % nparts;
+	if (buf_id < r * (q + 1))
+		partition = buf_id / (q + 1);
+	else
+		partition = r + (buf_id - r * (q + 1)) / q;
+	Assert(buf_id >= ClockSweepPartitions[partition].part.firstBuffer &&
+		   buf_id < ClockSweepPartitions[partition].part.firstBuffer +
+		   ClockSweepPartitions[partition].part.numBuffers);
+
+	if (!PendingNumaHitsRegistered)
+	{
+		before_shmem_exit(StrategyFlushNumaHitsAtExit, (Datum) 0);
+		PendingNumaHitsRegistered = true;
+		MyNumaNode = pg_numa_current_node();
+	}
+
+	if (ClockSweepPartitions[partition].part.numaNode == MyNumaNode)
+		PendingNumaHits[partition][0]++;
+	else
+		PendingNumaHits[partition][1]++;
+
+	if (++PendingNumaHitsTotal >= NUMA_HIT_FLUSH_INTERVAL)
+	{
+		StrategyFlushNumaHits();
+
+		/* we might have been moved to another CPU in the meantime */
+		MyNumaNode = pg_numa_current_node();
+	}
+}
+
+/*
+ * Add this backend's pending hit counts to the shared counters.
+ */
+static void
+StrategyFlushNumaHits(void)
+{
+	for (int i = 0; i < StrategyControl->numPartitions; i++)
+	{
+		ClockSweepPartition *part = &ClockSweepPartitions[i].part;
+
+		if (PendingNumaHits[i][0] > 0)
+			pg_atomic_fetch_add_u64(&part->localHits, PendingNumaHits[i][0]);
+		if (PendingNumaHits[i][1] > 0)
+			pg_atomic_fetch_add_u64(&part->remoteHits, PendingNumaHits[i][1]);
+		PendingNumaHits[i][0] = PendingNumaHits[i][1] = 0;
+	}
+	PendingNumaHitsTotal = 0;
+}
+
+/*
+ * before_shmem_exit hook, so that the last hits of a backend are counted
+ */
+static void
+StrategyFlushNumaHitsAtExit(int code, Datum arg)
+{
+	StrategyFlushNumaHits();
+}
+
 /*
  * StrategyNotifyBgWriter -- set or clear allocation notification latch
  *
@@ -461,14 +757,57 @@ StrategyShmemSize(void)
 	/* size of the shared replacement strategy control block */
 	size = add_size(size, MAXALIGN(sizeof(BufferStrategyControl)));
 
+	/* size of the clock sweep partitions */
+	size = add_size(size, mul_size(StrategyComputePartitions(),
+								   sizeof(ClockSweepPartitionPadded)));
+
 	return size;
 }
 
+/*
+ * StrategyComputePartitions -- decide how many clock sweep partitions to use
+ *
+ * If the partitions are to be placed on NUMA nodes, every node gets the
+ * same number of them, even if that makes them smaller than we'd like.
+ */
+static int
+StrategyComputePartitions(void)
+{
+	int			nparts;
+	int			nnodes = StrategyComputeNumaNodes();
+
+	nparts = NBuffers / MIN_CLOCK_SWEEP_PARTITION_BUFFERS;
+	nparts = Max(Min(nparts, MAX_CLOCK_SWEEP_PARTITIONS), 1);
+
+	if (nnodes > 0)
+		nparts = Max(nparts - nparts % nnodes, nnodes);
+
+	return nparts;
+}
+
+/*
+ * StrategyComputeNumaNodes -- decide how many NUMA nodes to place the
+ *		partitions on
+ *
+ * Returns 0 if the partitions are not placed on nodes.
+ */
+static int
+StrategyComputeNumaNodes(void)
+{
+	if (numa_buffer_placement != NUMA_BUFFER_PLACEMENT_PARTITION)
+		return 0;
+
+	/* every node must get at least one partition, and buffer */
+	return Min(Min(pg_numa_num_nodes(), MAX_CLOCK_SWEEP_PARTITIONS), NBuffers);
+}
+
 /*
  * StrategyInitialize -- initialize the buffer cache replacement
  *		strategy.
  *
- * Assumes: All of the buffers are already built into a linked list.
+ * Assumes: All of the buffers will be built into a linked list by
+ *		InitBufferPool(), which calls us first so that it can place the
+ *		partitions on NUMA nodes.
  *		Only called by postmaster and only during initialization.
  */
 void
@@ -512,18 +851,58 @@ StrategyInitialize(bool init)
 		StrategyControl->firstFreeBuffer = 0;
 		StrategyControl->lastFreeBuffer = NBuffers - 1;
 
-		/* Initialize the clock sweep pointer */
-		pg_atomic_init_u32(&StrategyControl->nextVictimBuffer, 0);
-
-		/* Clear statistics */
-		StrategyControl->completePasses = 0;
-		pg_atomic_init_u32(&StrategyControl->numBufferAllocs, 0);
+		StrategyControl->numPartitions = StrategyComputePartitions();
+		StrategyControl->numNumaNodes = StrategyComputeNumaNodes();
 
 		/* No pending notification */
 		StrategyControl->bgwprocno = -1;
 	}
 	else
 		Assert(!init);
+
+	/*
+	 * Get or create the clock sweep partitions
+	 */
+	ClockSweepPartitions = (ClockSweepPartitionPadded *)
+		ShmemInitStruct("Buffer Strategy Partitions",
+						StrategyControl->numPartitions *
+						sizeof(ClockSweepPartitionPadded),
+						&found);
+
+	if (!found)
+	{
+		int			nparts = StrategyControl->numPartitions;
+		int			nnodes = StrategyControl->numNumaNodes;
+
+		Assert(init);
+
+		/* Divide the buffers evenly, giving the remainder to the first ones */
+		for (int i = 0; i < nparts; i++)
+		{
+			ClockSweepPartition *part = &ClockSweepPartitions[i].part;
+
+			SpinLockInit(&part->lock);
+			part->numBuffers = NBuffers / nparts + (i < NBuffers % nparts ? 1 : 0);
+			part->firstBuffer = (i == 0) ? 0 :
+				ClockSweepPartitions[i - 1].part.firstBuffer +
+				ClockSweepPartitions[i - 1].part.numBuffers;
+
+			/* consecutive partitions share a node */
+			part->numaNode = (nnodes > 0) ? i / (nparts / nnodes) : -1;
+
+			/* Initialize the clock sweep pointer */
+			pg_atomic_init_u32(&part->nextVictimBuffer, 0);
+
+			/* Clear statistics */
+			part->completePasses = 0;
+			pg_atomic_init_u32(&part->numBufferAllocs, 0);
+			pg_atomic_init_u64(&part->totalBufferAllocs, 0);
+			pg_atomic_init_u64(&part->localHits, 0);
+			pg_atomic_init_u64(&part->remoteHits, 0);
+		}
+	}
+	else
+		Assert(!init);
 }
 
 
@@ -0,0 +1,336 @@
+/*-------------------------------------------------------------------------
+ *
+ * read_stream.c
+ *	  Look-ahead reading of a stream of relation blocks.
+ *
+ * A read stream hands out pinned buffers for a sequence of blocks chosen by
+ * a caller-supplied callback.  The callback is invoked ahead of the consumer,
+ * which lets us do two things the plain ReadBuffer() interface cannot:
+ *
+ * 1.  Consecutive block numbers are combined into ranges of up to
+ *	   MAX_BUFFERS_PER_TRANSFER blocks, and each range is brought into shared
+ *	   buffers by ReadBufferRange(), which needs only one vectored read system
+ *	   call for every run of blocks that are not cached yet.
+ *
+ * 2.  Ranges that have been formed but not yet consumed form a look-ahead
+ *	   window, whose size is derived from the tablespace's
+ *	   effective_io_concurrency.  When a range does not directly follow the
+ *	   previous one, PrefetchBuffer() is used to tell the kernel about its
+ *	   blocks as soon as it enters the window.  Purely sequential streams
+ *	   don't issue advice, since the kernel's own read-ahead handles them.
+ *
+ * 3.  When io_method is not "sync", ranges of a relation in shared buffers
+ *	   are started with StartReadBufferRange() as soon as they enter the
+ *	   window, so that the kernel works on them while the consumer is busy
+ *	   with earlier blocks.  The window is then limited to
+ *	   MAX_ASYNC_READ_RANGES ranges.
+ *
+ * With direct I/O there is no kernel read-ahead or page cache to prefetch
+ * into, so advice is not issued, and in async mode the window is always
+ * MAX_ASYNC_READ_RANGES ranges wide to make up for the missing read-ahead.
+ *
+ * In synchronous mode, only the buffers of the range currently being consumed
+ * are pinned, so a stream never holds more than MAX_BUFFERS_PER_TRANSFER pins
+ * at a time.  Started ranges hold their pins from the time they are started.
+ *
+ * Portions Copyright (c) 1996-2021, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ * IDENTIFICATION
+ *	  src/backend/storage/buffer/read_stream.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "storage/aio.h"
+#include "storage/fd.h"
+#include "storage/read_stream.h"
+#include "utils/rel.h"
+#include "utils/spccache.h"
+
+/* upper limit on the number of ranges in the look-ahead window */
+#define MAX_LOOKAHEAD_RANGES 64
+
+/* A range of consecutive blocks that has not been read yet */
+typedef struct ReadStreamRange
+{
+	BlockNumber blocknum;
+	int			nblocks;
+	bool		started;		/* read started with StartReadBufferRange()? */
+} ReadStreamRange;
+
+struct ReadStream
+{
+	Relation	rel;
+	ForkNumber	forknum;
+	BufferAccessStrategy strategy;
+	ReadStreamBlockNumberCB callback;
+	void	   *callback_private_data;
+
+	bool		advice_enabled; /* issue PrefetchBuffer() for random ranges? */
+	bool		async;			/* start reads as ranges enter the window? */
+	bool		exhausted;		/* has the callback returned the last block? */
+
+	/* range currently being built from the callback's block numbers */
+	BlockNumber pending_blocknum;
+	int			pending_nblocks;
+
+	/* block following the last range that entered the window */
+	BlockNumber next_sequential_blocknum;
+
+	/* look-ahead window, a circular queue of ranges */
+	int			max_ranges;
+	int			nranges;
+	int			oldest_range;
+	ReadStreamRange *ranges;
+	ReadBufferRangeIO *ios;		/* parallel to ranges, only if async */
+
+	/* pinned buffers of the range being consumed */
+	int			nbuffers;
+	int			next_buffer;
+	Buffer		buffers[MAX_BUFFERS_PER_TRANSFER];
+};
+
+static void read_stream_push_range(ReadStream *stream);
+static void read_stream_look_ahead(ReadStream *stream);
+
+
+/*
+ * ReadStreamBegin -- create a read stream for one fork of a relation
+ *
+ * The strategy, if not NULL, is used for all the reads done by the stream.
+ * The callback is called with callback_private_data to obtain the block
+ * numbers to read.
+ */
+ReadStream *
+ReadStreamBegin(Relation rel, ForkNumber forknum,
+				BufferAccessStrategy strategy,
+				ReadStreamBlockNumberCB callback,
+				void *callback_private_data)
+{
+	ReadStream *stream;
+	int			io_concurrency;
+	bool		direct_io;
+
+	io_concurrency = get_tablespace_io_concurrency(rel->rd_rel->reltablespace);
+	direct_io = ((io_direct_flags & IO_DIRECT_DATA) != 0 &&
+				 forknum == MAIN_FORKNUM);
+
+	stream = (ReadStream *) palloc0(sizeof(ReadStream));
+	stream->rel = rel;
+	stream->forknum = forknum;
+	stream->strategy = strategy;
+	stream->callback = callback;
+	stream->callback_private_data = callback_private_data;
+
+#ifdef USE_PREFETCH
+	stream->advice_enabled = (io_concurrency > 0 && !direct_io);
+#endif
+
+	stream->async = (io_method != IO_METHOD_SYNC &&
+					 !RelationUsesLocalBuffers(rel));
+
+	stream->max_ranges = Min(Max(io_concurrency, 1), MAX_LOOKAHEAD_RANGES);
+	if (stream->async)
+	{
+		if (direct_io)
+			stream->max_ranges = MAX_ASYNC_READ_RANGES;
+		stream->max_ranges = Min(stream->max_ranges, MAX_ASYNC_READ_RANGES);
+		stream->ios = (ReadBufferRangeIO *)
+			palloc(sizeof(ReadBufferRangeIO) * stream->max_ranges);
+	}
+	stream->ranges = (ReadStreamRange *)
+		palloc(sizeof(ReadStreamRange) * stream->max_ranges);
+	stream->pending_blocknum = InvalidBlockNumber;
+	stream->next_sequential_blocknum = InvalidBlockNumber;
+
+	return stream;
+}
+
+/*
+ * ReadStreamNextBuffer -- return the next buffer of the stream
+ *
+ * The buffer is pinned, and it's up to the caller to release it.  Returns
+ * InvalidBuffer once the callback has reported the end of the stream and all
+ * blocks have been returned.
+ */
+Buffer
+ReadStreamNextBuffer(ReadStream *stream)
+{
+	ReadStreamRange *range;
+
+	/* fast path: hand out the remaining buffers of the current range */
+	if (stream->next_buffer < stream->nbuffers)
+		return stream->buffers[stream->next_buffer++];
+
+	read_stream_look_ahead(stream);
+
+	/* flush out a partially built range once there's nothing else to do */
+	if (stream->nranges == 0 && stream->pending_nblocks > 0)
+		read_stream_push_range(stream);
+
+	if (stream->nranges == 0)
+	{
+		Assert(stream->exhausted);
+		return InvalidBuffer;
+	}
+
+	/* read in the oldest range, and top up the window behind it */
+	range = &stream->ranges[stream->oldest_range];
+	if (range->started)
+	{
+		ReadBufferRangeIO *io = &stream->ios[stream->oldest_range];
+
+		WaitReadBufferRange(io);
+		memcpy(stream->buffers, io->buffers, sizeof(Buffer) * range->nblocks);
+	}
+	else
+		ReadBufferRange(stream->rel, stream->forknum, range->blocknum,
+						range->nblocks, stream->strategy, stream->buffers);
+	stream->nbuffers = range->nblocks;
+	stream->next_buffer = 0;
+	stream->oldest_range = (stream->oldest_range + 1) % stream->max_ranges;
+	stream->nranges--;
+
+	read_stream_look_ahead(stream);
+
+	return stream->buffers[stream->next_buffer++];
+}
+
+/*
+ * ReadStreamReset -- forget all look-ahead state
+ *
+ * Releases the pins of buffers not yet returned to the caller.  The callback
+ * will be asked for more block numbers on the next ReadStreamNextBuffer()
+ * call, even if it had previously reported the end of the stream.
+ */
+void
+ReadStreamReset(ReadStream *stream)
+{
+	while (stream->next_buffer < stream->nbuffers)
+		ReleaseBuffer(stream->buffers[stream->next_buffer++]);
+
+	/* started ranges have pinned their buffers already */
+	for (int i = 0; i < stream->nranges; i++)
+	{
+		int			slot = (stream->oldest_range + i) % stream->max_ranges;
+
+		if (stream->ranges[slot].started)
+		{
+			ReadBufferRangeIO *io = &stream->ios[slot];
+
+			WaitReadBufferRange(io);
+			for (int j = 0; j < io->nblocks; j++)
+				ReleaseBuffer(io->buffers[j]);
+		}
+	}
+
+	stream->nbuffers = 0;
+	stream->next_buffer = 0;
+	stream->nranges = 0;
+	stream->oldest_range = 0;
+	stream->pending_blocknum = InvalidBlockNumber;
+	stream->pending_nblocks = 0;
+	stream->next_sequential_blocknum = InvalidBlockNumber;
+	stream->exhausted = false;
+}
+
+/*
+ * ReadStreamEnd -- release a read stream and the pins it still holds
+ */
+void
+ReadStreamEnd(ReadStream *stream)
+{
+	ReadStreamReset(stream);
+	pfree(stream->ranges);
+	if (stream->ios)
+		pfree(stream->ios);
+	pfree(stream);
+}
+
+/*
+ * Move the pending range into the look-ahead window.  In async mode its read
+ * is started right away, if the buffer manager has room for it; otherwise
+ * the kernel is advised about it, unless it continues the previous range.
+ */
+static void
+read_stream_push_range(ReadStream *stream)
+{
+	ReadStreamRange *range;
+	int			slot;
+
+	Assert(stream->pending_nblocks > 0);
+	Assert(stream->nranges < stream->max_ranges);
+
+	slot = (stream->oldest_range + stream->nranges) % stream->max_ranges;
+	range = &stream->ranges[slot];
+	range->blocknum = stream->pending_blocknum;
+	range->nblocks = stream->pending_nblocks;
+	range->started = false;
+	stream->nranges++;
+
+	if (stream->async && CanStartReadBufferRange())
+	{
+		StartReadBufferRange(&stream->ios[slot], stream->rel, stream->forknum,
+							 range->blocknum, range->nblocks,
+							 stream->strategy);
+		range->started = true;
+	}
+	else if (stream->advice_enabled &&
+		range->blocknum != stream->next_sequential_blocknum)
+	{
+		for (int i = 0; i < range->nblocks; i++)
+			(void) PrefetchBuffer(stream->rel, stream->forknum,
+								  range->blocknum + i);
+	}
+	stream->next_sequential_blocknum = range->blocknum + range->nblocks;
+
+	stream->pending_blocknum = InvalidBlockNumber;
+	stream->pending_nblocks = 0;
+}
+
+/*
+ * Ask the callback for more block numbers until the look-ahead window is
+ * full or the stream is exhausted.
+ */
+static void
+read_stream_look_ahead(ReadStream *stream)
+{
+	int			nranges_before = stream->nranges;
+
+	while (!stream->exhausted && stream->nranges < stream->max_ranges)
+	{
+		BlockNumber blocknum;
+
+		blocknum = stream->callback(stream, stream->callback_private_data);
+
+		if (!BlockNumberIsValid(blocknum))
+		{
+			stream->exhausted = true;
+			if (stream->pending_nblocks > 0)
+				read_stream_push_range(stream);
+			break;
+		}
+
+		/* can we extend the pending range? */
+		if (stream->pending_nblocks > 0 &&
+			stream->pending_nblocks < MAX_BUFFERS_PER_TRANSFER &&
+			blocknum == stream->pending_blocknum + stream->pending_nblocks)
+		{
+			stream->pending_nblocks++;
+			continue;
+		}
+
+		if (stream->pending_nblocks > 0)
+			read_stream_push_range(stream);
+
+		stream->pending_blocknum = blocknum;
+		stream->pending_nblocks = 1;
+	}
+
+	/* let the kernel work on all the reads we have just started */
+	if (stream->async && stream->nranges > nranges_before)
+		SubmitReadBufferRanges();
+}
@@ -0,0 +1,350 @@
+/*-------------------------------------------------------------------------
+ *
+ * aio.c
+ *	  Asynchronous file I/O submission and completion.
+ *
+ * Each backend keeps a small table of I/O operations it has started but not
+ * yet waited for.  How an operation is carried out depends on io_method:
+ *
+ * sync		The operation is performed with preadv() as soon as it is
+ *			started, so waiting for it just collects the result.  This is
+ *			always available, and is the default.
+ *
+ * io_uring	Operations are queued on a per-backend io_uring (Linux only, and
+ *			only if built with --with-liburing).  Queued operations are handed
+ *			to the kernel in batches by pgaio_submit(), and completions are
+ *			reaped by pgaio_wait(), so that the backend can do other work
+ *			while the device processes its requests.
+ *
+ * The buffers an operation reads into must remain valid until pgaio_wait()
+ * has returned for it.  Callers that hand out handles across an error
+ * boundary must use pgaio_wait_all() during error cleanup before such memory
+ * is reused.
+ *
+ * Portions Copyright (c) 1996-2021, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ * IDENTIFICATION
+ *	  src/backend/storage/file/aio.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include <unistd.h>
+#ifdef USE_LIBURING
+#include <liburing.h>
+#endif
+
+#include "miscadmin.h"
+#include "pgstat.h"
+#include "port/pg_iovec.h"
+#include "storage/aio.h"
+#include "storage/ipc.h"
+#include "utils/memutils.h"
+
+/* GUC parameter */
+int			io_method = IO_METHOD_SYNC;
+
+/* An I/O operation that has been started but not yet waited for */
+typedef struct PgAioOp
+{
+	bool		in_use;
+	bool		completed;
+	int			fd;
+	off_t		offset;
+	uint32		wait_event_info;
+	int			result;			/* bytes transferred, or -1 on failure */
+	int			error;			/* errno, if result is -1 */
+	int			iovcnt;
+	struct iovec iov[PG_IOV_MAX];
+} PgAioOp;
+
+static PgAioOp *pgaio_ops = NULL;
+static int	pgaio_num_in_use = 0;
+
+#ifdef USE_LIBURING
+static struct io_uring pgaio_ring;
+static bool pgaio_ring_initialized = false;
+static int	pgaio_num_unsubmitted = 0;
+#endif
+
+static void pgaio_perform_sync(PgAioOp *op);
+
+#ifdef USE_LIBURING
+static void pgaio_uring_init(void);
+static void pgaio_uring_prepare(PgAioOp *op, int handle);
+static void pgaio_uring_reap(void);
+static void pgaio_uring_shutdown(int code, Datum arg);
+#endif
+
+
+/*
+ * pgaio_start_readv -- start reading into an iovec array
+ *
+ * Returns a handle to be passed to pgaio_wait().  The iovec array itself is
+ * copied, but the memory it points to must stay valid until then.
+ */
+int
+pgaio_start_readv(int fd, const struct iovec *iov, int iovcnt, off_t offset,
+				  uint32 wait_event_info)
+{
+	PgAioOp    *op;
+	int			handle;
+
+	Assert(iovcnt > 0 && iovcnt <= PG_IOV_MAX);
+
+	if (pgaio_ops == NULL)
+		pgaio_ops = (PgAioOp *)
+			MemoryContextAllocZero(TopMemoryContext,
+								   sizeof(PgAioOp) * PGAIO_MAX_IN_FLIGHT);
+
+	if (pgaio_num_in_use >= PGAIO_MAX_IN_FLIGHT)
+		elog(ERROR, "too many asynchronous I/O operations in progress");
+
+#ifdef USE_LIBURING
+	/*
+	 * Set up the ring before claiming a slot, so that a failure to do so
+	 * leaves no operation behind that can never complete.
+	 */
+	if (io_method == IO_METHOD_IO_URING && !pgaio_ring_initialized)
+		pgaio_uring_init();
+#endif
+
+	for (handle = 0; pgaio_ops[handle].in_use; handle++)
+		;
+
+	op = &pgaio_ops[handle];
+	op->in_use = true;
+	op->completed = false;
+	op->fd = fd;
+	op->offset = offset;
+	op->wait_event_info = wait_event_info;
+	op->iovcnt = iovcnt;
+	memcpy(op->iov, iov, sizeof(struct iovec) * iovcnt);
+	pgaio_num_in_use++;
+
+#ifdef USE_LIBURING
+	if (io_method == IO_METHOD_IO_URING)
+	{
+		pgaio_uring_prepare(op, handle);
+		return handle;
+	}
+#endif
+
+	pgaio_perform_sync(op);
+
+	return handle;
+}
+
+/*
+ * pgaio_submit -- hand all queued operations to the kernel
+ *
+ * Operations are also submitted implicitly when waiting for one of them, but
+ * callers that queue several operations in a row should call this once they
+ * are done, so that the kernel can work on all of them at once.  fd.c also
+ * calls this before closing a file descriptor, since the kernel resolves the
+ * descriptor of a queued operation only when it is submitted.
+ */
+void
+pgaio_submit(void)
+{
+#ifdef USE_LIBURING
+	while (pgaio_num_unsubmitted > 0)
+	{
+		int			ret;
+
+		ret = io_uring_submit(&pgaio_ring);
+		if (ret == -EINTR || ret == -EAGAIN)
+			continue;
+		if (ret < 0)
+		{
+			/*
+			 * We can't tell which operations the kernel has accepted, and
+			 * shared buffers may be waiting for them, so there's no way to
+			 * clean up sensibly.
+			 */
+			errno = -ret;
+			elog(PANIC, "could not submit I/O requests to io_uring: %m");
+		}
+		pgaio_num_unsubmitted -= ret;
+	}
+#endif
+}
+
+/*
+ * pgaio_wait -- wait for an operation to complete, and release its handle
+ *
+ * Returns the number of bytes transferred, which may be less than requested,
+ * or -1 with errno set if the operation failed.
+ */
+int
+pgaio_wait(int handle)
+{
+	PgAioOp    *op;
+	int			result;
+
+	Assert(pgaio_ops != NULL && handle >= 0 && handle < PGAIO_MAX_IN_FLIGHT);
+	op = &pgaio_ops[handle];
+	Assert(op->in_use);
+
+#ifdef USE_LIBURING
+	if (!op->completed)
+	{
+		pgaio_submit();
+
+		pgstat_report_wait_start(op->wait_event_info);
+		while (!op->completed)
+			pgaio_uring_reap();
+		pgstat_report_wait_end();
+	}
+#endif
+
+	Assert(op->completed);
+	result = op->result;
+	op->in_use = false;
+	pgaio_num_in_use--;
+
+	if (result < 0)
+		errno = op->error;
+
+	return result;
+}
+
+/*
+ * pgaio_wait_all -- wait for all operations of this backend, discarding
+ * their results
+ *
+ * This is meant for error cleanup, when the memory that operations in flight
+ * are transferring is about to be released or reused.
+ */
+void
+pgaio_wait_all(void)
+{
+	for (int handle = 0; pgaio_num_in_use > 0 && handle < PGAIO_MAX_IN_FLIGHT; handle++)
+	{
+		if (pgaio_ops[handle].in_use)
+			(void) pgaio_wait(handle);
+	}
+}
+
+/*
+ * Carry out an operation synchronously, for io_method = sync.
+ */
+static void
+pgaio_perform_sync(PgAioOp *op)
+{
+	int			rc;
+
+retry:
+	errno = 0;
+	pgstat_report_wait_start(op->wait_event_info);
+	rc = pg_preadv(op->fd, op->iov, op->iovcnt, op->offset);
+	pgstat_report_wait_end();
+
+	/* OK to retry if interrupted */
+	if (rc < 0 && errno == EINTR)
+		goto retry;
+
+	op->result = rc;
+	op->error = (rc < 0) ? errno : 0;
+	op->completed = true;
+}
+
+#ifdef USE_LIBURING
+
+/*
+ * Set up this backend's io_uring, the first time it is needed.
+ */
+static void
+pgaio_uring_init(void)
+{
+	int			ret;
+
+	ret = io_uring_queue_init(PGAIO_MAX_IN_FLIGHT, &pgaio_ring, 0);
+	if (ret < 0)
+	{
+		errno = -ret;
+		ereport(ERROR,
+				(errmsg("could not initialize io_uring: %m"),
+				 errhint("Set io_method to \"sync\" if io_uring is not available on this system.")));
+	}
+
+	pgaio_ring_initialized = true;
+	on_proc_exit(pgaio_uring_shutdown, 0);
+}
+
+/*
+ * Queue an operation on the ring.  It is not visible to the kernel until
+ * the next pgaio_submit().
+ */
+static void
+pgaio_uring_prepare(PgAioOp *op, int handle)
+{
+	struct io_uring_sqe *sqe;
+
+	Assert(pgaio_ring_initialized);
+
+	/* if the submission queue is full, make room by submitting it */
+	while ((sqe = io_uring_get_sqe(&pgaio_ring)) == NULL)
+		pgaio_submit();
+
+	io_uring_prep_readv(sqe, op->fd, op->iov, op->iovcnt, op->offset);
+	io_uring_sqe_set_data(sqe, (void *) (uintptr_t) handle);
+
+	pgaio_num_unsubmitted++;
+}
+
+/*
+ * Wait for at least one completion, and record its result.
+ */
+static void
+pgaio_uring_reap(void)
+{
+	struct io_uring_cqe *cqe;
+	PgAioOp    *op;
+	int			ret;
+
+	ret = io_uring_wait_cqe(&pgaio_ring, &cqe);
+	if (ret == -EINTR || ret == -EAGAIN)
+		return;
+	if (ret < 0)
+	{
+		errno = -ret;
+		elog(PANIC, "could not wait for io_uring completion: %m");
+	}
+
+	op = &pgaio_ops[(uintptr_t) io_uring_cqe_get_data(cqe)];
+	Assert(op->in_use && !op->completed);
+
+	if (cqe->res == -EINTR || cqe->res == -EAGAIN)
+	{
+		/* OK to retry if interrupted */
+		io_uring_cqe_seen(&pgaio_ring, cqe);
+		pgaio_uring_prepare(op, op - pgaio_ops);
+		pgaio_submit();
+		return;
+	}
+
+	op->result = (cqe->res < 0) ? -1 : cqe->res;
+	op->error = (cqe->res < 0) ? -cqe->res : 0;
+	op->completed = true;
+
+	io_uring_cqe_seen(&pgaio_ring, cqe);
+}
+
+/*
+ * on_proc_exit hook to release the ring
+ */
+static void
+pgaio_uring_shutdown(int code, Datum arg)
+{
+	if (pgaio_ring_initialized)
+	{
+		io_uring_queue_exit(&pgaio_ring);
+		pgaio_ring_initialized = false;
+	}
+}
+
+#endif							/* USE_LIBURING */
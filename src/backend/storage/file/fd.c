@@ -95,6 +95,7 @@
 #include "miscadmin.h"
 #include "pgstat.h"
 #include "port/pg_iovec.h"
+#include "storage/aio.h"
 #include "portability/mem.h"
 #include "storage/fd.h"
 #include "storage/ipc.h"
@@ -163,6 +164,13 @@ bool		data_sync_retry = false;
 /* How SyncDataDirectory() should do its job. */
 int			recovery_init_sync_method = RECOVERY_INIT_SYNC_METHOD_FSYNC;
 
+/*
+ * Which kinds of files are opened with O_DIRECT; a combination of the
+ * IO_DIRECT_* flags, set from the io_direct GUC.  The flag is added by the
+ * callers opening those files, which must also take care of alignment.
+ */
+int			io_direct_flags = 0;
+
 /* Debugging.... */
 
 #ifdef FDDEBUG
@@ -1204,6 +1212,9 @@ LruDelete(File file)
 
 	vfdP = &VfdCache[file];
 
+	/* the kernel must have seen any I/O queued against this descriptor */
+	pgaio_submit();
+
 	/*
 	 * Close the file.  We aren't expecting this to fail; if it does, better
 	 * to leak the FD than to mess up our internal state.
@@ -1883,6 +1894,9 @@ FileClose(File file)
 
 	if (!FileIsNotOpen(file))
 	{
+		/* see LruDelete */
+		pgaio_submit();
+
 		/* close the file */
 		if (close(vfdP->fd) != 0)
 		{
@@ -2076,6 +2090,129 @@ retry:
 	return returnCode;
 }
 
+/*
+ * FileReadV -- like FileRead, but scatters the data read from consecutive
+ * file positions into the supplied iovec array using a single system call.
+ *
+ * Returns the total number of bytes read, which can be less than the sum of
+ * the iov_len fields at EOF, or -1 with errno set on failure.
+ */
+int
+FileReadV(File file, const struct iovec *iov, int iovcnt, off_t offset,
+		  uint32 wait_event_info)
+{
+	int			returnCode;
+	Vfd		   *vfdP;
+
+	Assert(FileIsValid(file));
+	Assert(iovcnt > 0 && iovcnt <= PG_IOV_MAX);
+
+	DO_DB(elog(LOG, "FileReadV: %d (%s) " INT64_FORMAT " %d",
+			   file, VfdCache[file].fileName,
+			   (int64) offset,
+			   iovcnt));
+
+	returnCode = FileAccess(file);
+	if (returnCode < 0)
+		return returnCode;
+
+	vfdP = &VfdCache[file];
+
+retry:
+	pgstat_report_wait_start(wait_event_info);
+	returnCode = pg_preadv(vfdP->fd, iov, iovcnt, offset);
+	pgstat_report_wait_end();
+
+	if (returnCode < 0)
+	{
+		/*
+		 * See comments in FileRead()
+		 */
+#ifdef WIN32
+		DWORD		error = GetLastError();
+
+		switch (error)
+		{
+			case ERROR_NO_SYSTEM_RESOURCES:
+				pg_usleep(1000L);
+				errno = EINTR;
+				break;
+			default:
+				_dosmaperr(error);
+				break;
+		}
+#endif
+		/* OK to retry if interrupted */
+		if (errno == EINTR)
+			goto retry;
+	}
+
+	return returnCode;
+}
+
+/*
+ * FileStartReadV -- start an asynchronous FileReadV
+ *
+ * Returns a handle to pass to FileWaitIO(), or -1 with errno set if the file
+ * could not be accessed.  The memory the iovec array points to must stay
+ * valid until FileWaitIO() has returned.  Depending on io_method, the read
+ * may already have been carried out when this returns.
+ */
+int
+FileStartReadV(File file, const struct iovec *iov, int iovcnt, off_t offset,
+			   uint32 wait_event_info)
+{
+	int			returnCode;
+
+	Assert(FileIsValid(file));
+
+	DO_DB(elog(LOG, "FileStartReadV: %d (%s) " INT64_FORMAT " %d",
+			   file, VfdCache[file].fileName,
+			   (int64) offset,
+			   iovcnt));
+
+	returnCode = FileAccess(file);
+	if (returnCode < 0)
+		return returnCode;
+
+	return pgaio_start_readv(VfdCache[file].fd, iov, iovcnt, offset,
+							 wait_event_info);
+}
+
+/*
+ * FileSubmitIO -- make sure the kernel is working on all I/O started so far
+ */
+void
+FileSubmitIO(void)
+{
+	pgaio_submit();
+}
+
+/*
+ * FileWaitIO -- wait for an I/O started by FileStartReadV
+ *
+ * Returns the number of bytes transferred, or -1 with errno set on failure.
+ * The handle must not be used again afterwards.
+ */
+int
+FileWaitIO(int handle)
+{
+	return pgaio_wait(handle);
+}
+
+/*
+ * FileWaitAllIO -- wait for all I/O started by this backend, discarding the
+ * results
+ *
+ * This is for error cleanup, before the memory that I/O in flight reads into
+ * is released.
+ */
+void
+FileWaitAllIO(void)
+{
+	pgaio_wait_all();
+}
+
 int
 FileWrite(File file, char *buffer, int amount, off_t offset,
 		  uint32 wait_event_info)
@@ -2174,6 +2311,71 @@ retry:
 	return returnCode;
 }
 
+/*
+ * FileWriteV -- write from an array of buffers, like FileWrite
+ *
+ * This is only supported for files not subject to temp_file_limit.  Returns
+ * the number of bytes written, which can be less than requested.
+ */
+int
+FileWriteV(File file, const struct iovec *iov, int iovcnt, off_t offset,
+		   uint32 wait_event_info)
+{
+	int			returnCode;
+	Vfd		   *vfdP;
+
+	Assert(FileIsValid(file));
+	Assert(iovcnt > 0 && iovcnt <= PG_IOV_MAX);
+
+	DO_DB(elog(LOG, "FileWriteV: %d (%s) " INT64_FORMAT " %d",
+			   file, VfdCache[file].fileName,
+			   (int64) offset,
+			   iovcnt));
+
+	returnCode = FileAccess(file);
+	if (returnCode < 0)
+		return returnCode;
+
+	vfdP = &VfdCache[file];
+	Assert(!(vfdP->fdstate & FD_TEMP_FILE_LIMIT));
+
+retry:
+	errno = 0;
+	pgstat_report_wait_start(wait_event_info);
+	returnCode = pg_pwritev(vfdP->fd, iov, iovcnt, offset);
+	pgstat_report_wait_end();
+
+	/* if write didn't set errno, assume problem is no disk space */
+	if (returnCode == 0 && errno == 0)
+		errno = ENOSPC;
+
+	if (returnCode < 0)
+	{
+		/*
+		 * See comments in FileRead()
+		 */
+#ifdef WIN32
+		DWORD		error = GetLastError();
+
+		switch (error)
+		{
+			case ERROR_NO_SYSTEM_RESOURCES:
+				pg_usleep(1000L);
+				errno = EINTR;
+				break;
+			default:
+				_dosmaperr(error);
+				break;
+		}
+#endif
+		/* OK to retry if interrupted */
+		if (errno == EINTR)
+			goto retry;
+	}
+
+	return returnCode;
+}
+
 int
 FileSync(File file, uint32 wait_event_info)
 {
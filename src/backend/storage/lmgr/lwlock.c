@@ -175,7 +175,11 @@ static const char *const BuiltinTrancheNames[] = {
 	/* LWTRANCHE_PARALLEL_APPEND: */
 	"ParallelAppend",
 	/* LWTRANCHE_PER_XACT_PREDICATE_LIST: */
-	"PerXactPredicateList"
+	"PerXactPredicateList",
+	/* LWTRANCHE_SHARED_RESULT_CACHE: */
+	"SharedResultCache",
+	/* LWTRANCHE_SHARED_PLAN_CACHE_AREA: */
+	"SharedPlanCacheArea"
 };
 
 StaticAssertDecl(lengthof(BuiltinTrancheNames) ==
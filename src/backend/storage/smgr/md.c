@@ -31,6 +31,7 @@
 #include "miscadmin.h"
 #include "pg_trace.h"
 #include "pgstat.h"
+#include "port/pg_iovec.h"
 #include "postmaster/bgwriter.h"
 #include "storage/bufmgr.h"
 #include "storage/fd.h"
@@ -87,6 +88,23 @@ typedef struct _MdfdVec
 
 static MemoryContext MdCxt;		/* context for all MdfdVec objects */
 
+/*
+ * With io_direct = 'data', the main fork of every relation is opened with
+ * O_DIRECT.  The other forks are small and frequently accessed, so they are
+ * left to the kernel's page cache.
+ *
+ * Direct I/O requires buffers aligned to PG_IO_ALIGN_SIZE.  Shared and local
+ * buffers are allocated that way, but some callers read or write blocks in
+ * ordinary palloc'd memory; such transfers go through md_bounce_buffer.
+ */
+#define MD_DIRECT_IO(forknum) \
+	((io_direct_flags & IO_DIRECT_DATA) != 0 && (forknum) == MAIN_FORKNUM)
+
+#define MD_NEEDS_BOUNCE(forknum, buffer) \
+	(MD_DIRECT_IO(forknum) && (char *) PG_IO_ALIGN(buffer) != (buffer))
+
+static char *md_bounce_buffer = NULL;
+
 
 /* Populate a file tag describing an md.c segment file. */
 #define INIT_MD_FILETAG(a,xx_rnode,xx_forknum,xx_segno) \
@@ -122,6 +140,10 @@ static MemoryContext MdCxt;		/* context for all MdfdVec objects */
 static void mdunlinkfork(RelFileNodeBackend rnode, ForkNumber forkNum,
 						 bool isRedo);
 static MdfdVec *mdopenfork(SMgrRelation reln, ForkNumber forknum, int behavior);
+static int	_mdfd_open_flags(ForkNumber forknum);
+static char *md_get_bounce_buffer(void);
+static bool md_buffers_need_bounce(ForkNumber forknum, char **buffers,
+								   BlockNumber nblocks);
 static void register_dirty_segment(SMgrRelation reln, ForkNumber forknum,
 								   MdfdVec *seg);
 static void register_unlink_segment(RelFileNodeBackend rnode, ForkNumber forknum,
@@ -201,14 +223,14 @@ mdcreate(SMgrRelation reln, ForkNumber forkNum, bool isRedo)
 
 	path = relpath(reln->smgr_rnode, forkNum);
 
-	fd = PathNameOpenFile(path, O_RDWR | O_CREAT | O_EXCL | PG_BINARY);
+	fd = PathNameOpenFile(path, _mdfd_open_flags(forkNum) | O_CREAT | O_EXCL);
 
 	if (fd < 0)
 	{
 		int			save_errno = errno;
 
 		if (isRedo)
-			fd = PathNameOpenFile(path, O_RDWR | PG_BINARY);
+			fd = PathNameOpenFile(path, _mdfd_open_flags(forkNum));
 		if (fd < 0)
 		{
 			/* be sure to report the error reported by create, not open */
@@ -441,6 +463,9 @@ mdextend(SMgrRelation reln, ForkNumber forknum, BlockNumber blocknum,
 
 	Assert(seekpos < (off_t) BLCKSZ * RELSEG_SIZE);
 
+	if (MD_NEEDS_BOUNCE(forknum, buffer))
+		buffer = memcpy(md_get_bounce_buffer(), buffer, BLCKSZ);
+
 	if ((nbytes = FileWrite(v->mdfd_vfd, buffer, BLCKSZ, seekpos, WAIT_EVENT_DATA_FILE_EXTEND)) != BLCKSZ)
 	{
 		if (nbytes < 0)
@@ -487,7 +512,7 @@ mdopenfork(SMgrRelation reln, ForkNumber forknum, int behavior)
 
 	path = relpath(reln->smgr_rnode, forknum);
 
-	fd = PathNameOpenFile(path, O_RDWR | PG_BINARY);
+	fd = PathNameOpenFile(path, _mdfd_open_flags(forknum));
 
 	if (fd < 0)
 	{
@@ -514,6 +539,54 @@ mdopenfork(SMgrRelation reln, ForkNumber forknum, int behavior)
 	return mdfd;
 }
 
+/*
+ * _mdfd_open_flags() -- Flags for opening a segment file of the given fork.
+ */
+static int
+_mdfd_open_flags(ForkNumber forknum)
+{
+	int			flags = O_RDWR | PG_BINARY;
+
+	if (MD_DIRECT_IO(forknum))
+		flags |= PG_O_DIRECT;
+
+	return flags;
+}
+
+/*
+ * md_get_bounce_buffer() -- Get the aligned block used for direct I/O from
+ *		or into unaligned memory.
+ */
+static char *
+md_get_bounce_buffer(void)
+{
+	if (md_bounce_buffer == NULL)
+		md_bounce_buffer = (char *)
+			PG_IO_ALIGN(MemoryContextAlloc(TopMemoryContext,
+										   BLCKSZ + PG_IO_ALIGN_SIZE));
+
+	return md_bounce_buffer;
+}
+
+/*
+ * md_buffers_need_bounce() -- Can't some of these buffers be used for
+ *		direct I/O as they are?
+ */
+static bool
+md_buffers_need_bounce(ForkNumber forknum, char **buffers, BlockNumber nblocks)
+{
+	if (!MD_DIRECT_IO(forknum))
+		return false;
+
+	for (int i = 0; i < nblocks; i++)
+	{
+		if (MD_NEEDS_BOUNCE(forknum, buffers[i]))
+			return true;
+	}
+
+	return false;
+}
+
 /*
  *  mdopen() -- Initialize newly-opened relation.
  */
@@ -567,6 +640,10 @@ mdprefetch(SMgrRelation reln, ForkNumber forknum, BlockNumber blocknum)
 
 	Assert(seekpos < (off_t) BLCKSZ * RELSEG_SIZE);
 
+	/* advice would only pull the block into the page cache we bypass */
+	if (MD_DIRECT_IO(forknum))
+		return true;
+
 	(void) FilePrefetch(v->mdfd_vfd, seekpos, BLCKSZ, WAIT_EVENT_DATA_FILE_PREFETCH);
 #endif							/* USE_PREFETCH */
 
@@ -583,6 +660,10 @@ void
 mdwriteback(SMgrRelation reln, ForkNumber forknum,
 			BlockNumber blocknum, BlockNumber nblocks)
 {
+	/* with direct I/O, there are no dirty pages in the kernel to flush */
+	if (MD_DIRECT_IO(forknum))
+		return;
+
 	/*
 	 * Issue flush requests in as few requests as possible; have to split at
 	 * segment boundaries though, since those are actually separate files.
@@ -635,6 +716,10 @@ mdread(SMgrRelation reln, ForkNumber forknum, BlockNumber blocknum,
 	off_t		seekpos;
 	int			nbytes;
 	MdfdVec    *v;
+	char	   *target = buffer;
+
+	if (MD_NEEDS_BOUNCE(forknum, buffer))
+		buffer = md_get_bounce_buffer();
 
 	TRACE_POSTGRESQL_SMGR_MD_READ_START(forknum, blocknum,
 										reln->smgr_rnode.node.spcNode,
@@ -684,6 +769,192 @@ mdread(SMgrRelation reln, ForkNumber forknum, BlockNumber blocknum,
 							blocknum, FilePathName(v->mdfd_vfd),
 							nbytes, BLCKSZ)));
 	}
+
+	if (buffer != target)
+		memcpy(target, buffer, BLCKSZ);
+}
+
+/*
+ *	mdreadv() -- Read the specified range of consecutive blocks from a
+ *		relation, one buffer per block.
+ *
+ * The blocks are read with as few vectored reads as the segment layout
+ * allows.  Short reads are handled exactly as in mdread(): they raise an
+ * error unless zero_damaged_pages is on or we are in recovery, in which case
+ * the missing blocks are returned as zeroes.
+ */
+void
+mdreadv(SMgrRelation reln, ForkNumber forknum, BlockNumber blocknum,
+		char **buffers, BlockNumber nblocks)
+{
+	/* unaligned buffers can't be read directly; let mdread() bounce them */
+	if (md_buffers_need_bounce(forknum, buffers, nblocks))
+	{
+		for (int i = 0; i < nblocks; i++)
+			mdread(reln, forknum, blocknum + i, buffers[i]);
+		return;
+	}
+
+	while (nblocks > 0)
+	{
+		struct iovec iov[PG_IOV_MAX];
+		off_t		seekpos;
+		int			nbytes;
+		int			nblocks_this_segment;
+		int			nblocks_read;
+		MdfdVec    *v;
+
+		v = _mdfd_getseg(reln, forknum, blocknum, false,
+						 EXTENSION_FAIL | EXTENSION_CREATE_RECOVERY);
+
+		seekpos = (off_t) BLCKSZ * (blocknum % ((BlockNumber) RELSEG_SIZE));
+
+		Assert(seekpos < (off_t) BLCKSZ * RELSEG_SIZE);
+
+		nblocks_this_segment =
+			Min(nblocks,
+				RELSEG_SIZE - (blocknum % ((BlockNumber) RELSEG_SIZE)));
+		nblocks_this_segment = Min(nblocks_this_segment, PG_IOV_MAX);
+
+		for (int i = 0; i < nblocks_this_segment; i++)
+		{
+			iov[i].iov_base = buffers[i];
+			iov[i].iov_len = BLCKSZ;
+		}
+
+		TRACE_POSTGRESQL_SMGR_MD_READ_START(forknum, blocknum,
+											reln->smgr_rnode.node.spcNode,
+											reln->smgr_rnode.node.dbNode,
+											reln->smgr_rnode.node.relNode,
+											reln->smgr_rnode.backend);
+
+		nbytes = FileReadV(v->mdfd_vfd, iov, nblocks_this_segment, seekpos,
+						   WAIT_EVENT_DATA_FILE_READ);
+
+		TRACE_POSTGRESQL_SMGR_MD_READ_DONE(forknum, blocknum,
+										   reln->smgr_rnode.node.spcNode,
+										   reln->smgr_rnode.node.dbNode,
+										   reln->smgr_rnode.node.relNode,
+										   reln->smgr_rnode.backend,
+										   nbytes,
+										   BLCKSZ * nblocks_this_segment);
+
+		if (nbytes < 0)
+			ereport(ERROR,
+					(errcode_for_file_access(),
+					 errmsg("could not read blocks %u..%u in file \"%s\": %m",
+							blocknum,
+							blocknum + nblocks_this_segment - 1,
+							FilePathName(v->mdfd_vfd))));
+
+		nblocks_read = nbytes / BLCKSZ;
+
+		if (nblocks_read == 0)
+		{
+			/*
+			 * Short read of the first block: we are at or past EOF, or we
+			 * read a partial block at EOF.  See mdread() for why this is
+			 * tolerated in some cases.  Deal with this one block and retry
+			 * the vectored read from the next one.
+			 */
+			if (zero_damaged_pages || InRecovery)
+				MemSet(buffers[0], 0, BLCKSZ);
+			else
+				ereport(ERROR,
+						(errcode(ERRCODE_DATA_CORRUPTED),
+						 errmsg("could not read block %u in file \"%s\": read only %d of %d bytes",
+								blocknum, FilePathName(v->mdfd_vfd),
+								nbytes, BLCKSZ)));
+			nblocks_read = 1;
+		}
+
+		/*
+		 * Any blocks beyond the ones we read completely are retried on the
+		 * next loop iteration.  That copes both with kernels that return
+		 * short vectored reads and with hitting EOF in mid-range.
+		 */
+		buffers += nblocks_read;
+		blocknum += nblocks_read;
+		nblocks -= nblocks_read;
+	}
+}
+
+/*
+ *	mdstartreadv() -- Start reading a range of consecutive blocks.
+ *
+ * The range must lie within one segment.  Returns a handle that has to be
+ * passed to mdwaitreadv(), along with the same arguments, before the buffers
+ * can be used.
+ */
+int
+mdstartreadv(SMgrRelation reln, ForkNumber forknum, BlockNumber blocknum,
+			 char **buffers, BlockNumber nblocks)
+{
+	struct iovec iov[PG_IOV_MAX];
+	off_t		seekpos;
+	int			handle;
+	MdfdVec    *v;
+
+	Assert(nblocks > 0 && nblocks <= PG_IOV_MAX);
+	Assert((blocknum % ((BlockNumber) RELSEG_SIZE)) + nblocks <= RELSEG_SIZE);
+	Assert(!md_buffers_need_bounce(forknum, buffers, nblocks));
+
+	v = _mdfd_getseg(reln, forknum, blocknum, false,
+					 EXTENSION_FAIL | EXTENSION_CREATE_RECOVERY);
+
+	seekpos = (off_t) BLCKSZ * (blocknum % ((BlockNumber) RELSEG_SIZE));
+
+	for (int i = 0; i < nblocks; i++)
+	{
+		iov[i].iov_base = buffers[i];
+		iov[i].iov_len = BLCKSZ;
+	}
+
+	handle = FileStartReadV(v->mdfd_vfd, iov, nblocks, seekpos,
+							WAIT_EVENT_DATA_FILE_READ);
+	if (handle < 0)
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not read blocks %u..%u in file \"%s\": %m",
+						blocknum, blocknum + nblocks - 1,
+						FilePathName(v->mdfd_vfd))));
+
+	return handle;
+}
+
+/*
+ *	mdwaitreadv() -- Wait for a read started by mdstartreadv().
+ *
+ * A short read is completed synchronously by mdreadv(), which applies the
+ * usual rules about reads beyond EOF.
+ */
+void
+mdwaitreadv(SMgrRelation reln, ForkNumber forknum, BlockNumber blocknum,
+			char **buffers, BlockNumber nblocks, int handle)
+{
+	int			nbytes;
+	BlockNumber nblocks_read;
+
+	nbytes = FileWaitIO(handle);
+	if (nbytes < 0)
+	{
+		int			save_errno = errno;
+		MdfdVec    *v;
+
+		v = _mdfd_getseg(reln, forknum, blocknum, false,
+						 EXTENSION_FAIL | EXTENSION_CREATE_RECOVERY);
+		errno = save_errno;
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not read blocks %u..%u in file \"%s\": %m",
+						blocknum, blocknum + nblocks - 1,
+						FilePathName(v->mdfd_vfd))));
+	}
+
+	nblocks_read = nbytes / BLCKSZ;
+	if (nblocks_read < nblocks)
+		mdreadv(reln, forknum, blocknum + nblocks_read,
+				buffers + nblocks_read, nblocks - nblocks_read);
 }
 
 /*
@@ -719,6 +990,9 @@ mdwrite(SMgrRelation reln, ForkNumber forknum, BlockNumber blocknum,
 
 	Assert(seekpos < (off_t) BLCKSZ * RELSEG_SIZE);
 
+	if (MD_NEEDS_BOUNCE(forknum, buffer))
+		buffer = memcpy(md_get_bounce_buffer(), buffer, BLCKSZ);
+
 	nbytes = FileWrite(v->mdfd_vfd, buffer, BLCKSZ, seekpos, WAIT_EVENT_DATA_FILE_WRITE);
 
 	TRACE_POSTGRESQL_SMGR_MD_WRITE_DONE(forknum, blocknum,
@@ -750,6 +1024,104 @@ mdwrite(SMgrRelation reln, ForkNumber forknum, BlockNumber blocknum,
 		register_dirty_segment(reln, forknum, v);
 }
 
+/*
+ *	mdwritev() -- Write a range of consecutive blocks from the supplied
+ *		buffers, one buffer per block.
+ *
+ * This is the vectored counterpart of mdwrite(): the blocks must already
+ * exist, and are written with as few vectored writes as the segment layout
+ * allows.
+ */
+void
+mdwritev(SMgrRelation reln, ForkNumber forknum, BlockNumber blocknum,
+		 char **buffers, BlockNumber nblocks, bool skipFsync)
+{
+	/* unaligned buffers can't be written directly; let mdwrite() bounce them */
+	if (md_buffers_need_bounce(forknum, buffers, nblocks))
+	{
+		for (int i = 0; i < nblocks; i++)
+			mdwrite(reln, forknum, blocknum + i, buffers[i], skipFsync);
+		return;
+	}
+
+	while (nblocks > 0)
+	{
+		struct iovec iov[PG_IOV_MAX];
+		off_t		seekpos;
+		int			nbytes;
+		int			nblocks_this_segment;
+		int			nblocks_written;
+		MdfdVec    *v;
+
+		/* This assert is too expensive to have on normally ... */
+#ifdef CHECK_WRITE_VS_EXTEND
+		Assert(blocknum + nblocks <= mdnblocks(reln, forknum));
+#endif
+
+		v = _mdfd_getseg(reln, forknum, blocknum, skipFsync,
+						 EXTENSION_FAIL | EXTENSION_CREATE_RECOVERY);
+
+		seekpos = (off_t) BLCKSZ * (blocknum % ((BlockNumber) RELSEG_SIZE));
+
+		Assert(seekpos < (off_t) BLCKSZ * RELSEG_SIZE);
+
+		nblocks_this_segment =
+			Min(nblocks,
+				RELSEG_SIZE - (blocknum % ((BlockNumber) RELSEG_SIZE)));
+		nblocks_this_segment = Min(nblocks_this_segment, PG_IOV_MAX);
+
+		for (int i = 0; i < nblocks_this_segment; i++)
+		{
+			iov[i].iov_base = buffers[i];
+			iov[i].iov_len = BLCKSZ;
+		}
+
+		TRACE_POSTGRESQL_SMGR_MD_WRITE_START(forknum, blocknum,
+											 reln->smgr_rnode.node.spcNode,
+											 reln->smgr_rnode.node.dbNode,
+											 reln->smgr_rnode.node.relNode,
+											 reln->smgr_rnode.backend);
+
+		nbytes = FileWriteV(v->mdfd_vfd, iov, nblocks_this_segment, seekpos,
+							WAIT_EVENT_DATA_FILE_WRITE);
+
+		TRACE_POSTGRESQL_SMGR_MD_WRITE_DONE(forknum, blocknum,
+											reln->smgr_rnode.node.spcNode,
+											reln->smgr_rnode.node.dbNode,
+											reln->smgr_rnode.node.relNode,
+											reln->smgr_rnode.backend,
+											nbytes,
+											BLCKSZ * nblocks_this_segment);
+
+		if (nbytes < 0)
+			ereport(ERROR,
+					(errcode_for_file_access(),
+					 errmsg("could not write blocks %u..%u in file \"%s\": %m",
+							blocknum,
+							blocknum + nblocks_this_segment - 1,
+							FilePathName(v->mdfd_vfd))));
+
+		nblocks_written = nbytes / BLCKSZ;
+
+		if (nblocks_written == 0)
+		{
+			/*
+			 * Short write of the first block.  Let mdwrite() try that one
+			 * again on its own; it will report the problem if it persists.
+			 */
+			mdwrite(reln, forknum, blocknum, buffers[0], skipFsync);
+			nblocks_written = 1;
+		}
+		else if (!skipFsync && !SmgrIsTemp(reln))
+			register_dirty_segment(reln, forknum, v);
+
+		/* retry any blocks that were not written completely */
+		buffers += nblocks_written;
+		blocknum += nblocks_written;
+		nblocks -= nblocks_written;
+	}
+}
+
 /*
  *	mdnblocks() -- Get the number of blocks stored in a relation.
  *
@@ -1149,7 +1521,7 @@ _mdfd_openseg(SMgrRelation reln, ForkNumber forknum, BlockNumber segno,
 	fullpath = _mdfd_segpath(reln, forknum, segno);
 
 	/* open the file */
-	fd = PathNameOpenFile(fullpath, O_RDWR | PG_BINARY | oflags);
+	fd = PathNameOpenFile(fullpath, _mdfd_open_flags(forknum) | oflags);
 
 	pfree(fullpath);
 
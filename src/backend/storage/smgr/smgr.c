@@ -54,8 +54,20 @@ typedef struct f_smgr
 								  BlockNumber blocknum);
 	void		(*smgr_read) (SMgrRelation reln, ForkNumber forknum,
 							  BlockNumber blocknum, char *buffer);
+	void		(*smgr_readv) (SMgrRelation reln, ForkNumber forknum,
+							   BlockNumber blocknum, char **buffers,
+							   BlockNumber nblocks);
+	int			(*smgr_startreadv) (SMgrRelation reln, ForkNumber forknum,
+									BlockNumber blocknum, char **buffers,
+									BlockNumber nblocks);
+	void		(*smgr_waitreadv) (SMgrRelation reln, ForkNumber forknum,
+								   BlockNumber blocknum, char **buffers,
+								   BlockNumber nblocks, int handle);
 	void		(*smgr_write) (SMgrRelation reln, ForkNumber forknum,
 							   BlockNumber blocknum, char *buffer, bool skipFsync);
+	void		(*smgr_writev) (SMgrRelation reln, ForkNumber forknum,
+								BlockNumber blocknum, char **buffers,
+								BlockNumber nblocks, bool skipFsync);
 	void		(*smgr_writeback) (SMgrRelation reln, ForkNumber forknum,
 								   BlockNumber blocknum, BlockNumber nblocks);
 	BlockNumber (*smgr_nblocks) (SMgrRelation reln, ForkNumber forknum);
@@ -77,7 +89,11 @@ static const f_smgr smgrsw[] = {
 		.smgr_extend = mdextend,
 		.smgr_prefetch = mdprefetch,
 		.smgr_read = mdread,
+		.smgr_readv = mdreadv,
+		.smgr_startreadv = mdstartreadv,
+		.smgr_waitreadv = mdwaitreadv,
 		.smgr_write = mdwrite,
+		.smgr_writev = mdwritev,
 		.smgr_writeback = mdwriteback,
 		.smgr_nblocks = mdnblocks,
 		.smgr_truncate = mdtruncate,
@@ -504,6 +520,48 @@ smgrread(SMgrRelation reln, ForkNumber forknum, BlockNumber blocknum,
 	smgrsw[reln->smgr_which].smgr_read(reln, forknum, blocknum, buffer);
 }
 
+/*
+ *	smgrreadv() -- read a range of consecutive blocks from a relation into
+ *				   the supplied buffers, one buffer per block.
+ *
+ *		This is equivalent to calling smgrread() for each block, but allows
+ *		the storage manager to combine the reads into fewer system calls.
+ */
+void
+smgrreadv(SMgrRelation reln, ForkNumber forknum, BlockNumber blocknum,
+		  char **buffers, BlockNumber nblocks)
+{
+	smgrsw[reln->smgr_which].smgr_readv(reln, forknum, blocknum, buffers,
+										nblocks);
+}
+
+/*
+ *	smgrstartreadv() -- start reading a range of consecutive blocks
+ *
+ *		The range must not cross a segment boundary.  The returned handle must
+ *		be passed to smgrwaitreadv(), with the same other arguments, and the
+ *		buffers must not be touched until that has returned.  Depending on
+ *		io_method, the read may proceed in the background meanwhile.
+ */
+int
+smgrstartreadv(SMgrRelation reln, ForkNumber forknum, BlockNumber blocknum,
+			   char **buffers, BlockNumber nblocks)
+{
+	return smgrsw[reln->smgr_which].smgr_startreadv(reln, forknum, blocknum,
+													buffers, nblocks);
+}
+
+/*
+ *	smgrwaitreadv() -- wait for a read started by smgrstartreadv()
+ */
+void
+smgrwaitreadv(SMgrRelation reln, ForkNumber forknum, BlockNumber blocknum,
+			  char **buffers, BlockNumber nblocks, int handle)
+{
+	smgrsw[reln->smgr_which].smgr_waitreadv(reln, forknum, blocknum,
+											buffers, nblocks, handle);
+}
+
 /*
  *	smgrwrite() -- Write the supplied buffer out.
  *
@@ -527,6 +585,20 @@ smgrwrite(SMgrRelation reln, ForkNumber forknum, BlockNumber blocknum,
 										buffer, skipFsync);
 }
 
+/*
+ *	smgrwritev() -- write a range of consecutive blocks from the supplied
+ *					buffers, one buffer per block.
+ *
+ *		This is equivalent to calling smgrwrite() for each block, but allows
+ *		the storage manager to combine the writes into fewer system calls.
+ */
+void
+smgrwritev(SMgrRelation reln, ForkNumber forknum, BlockNumber blocknum,
+		   char **buffers, BlockNumber nblocks, bool skipFsync)
+{
+	smgrsw[reln->smgr_which].smgr_writev(reln, forknum, blocknum, buffers,
+										 nblocks, skipFsync);
+}
 
 /*
  *	smgrwriteback() -- Trigger kernel writeback for the supplied range of
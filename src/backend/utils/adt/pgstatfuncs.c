@@ -16,6 +16,7 @@
 
 #include "access/htup_details.h"
 #include "access/xlog.h"
+#include "access/xlogprefetch.h"
 #include "catalog/pg_authid.h"
 #include "catalog/pg_type.h"
 #include "common/ip.h"
@@ -25,6 +26,7 @@
 #include "postmaster/bgworker_internals.h"
 #include "postmaster/postmaster.h"
 #include "replication/slot.h"
+#include "storage/buf_internals.h"
 #include "storage/proc.h"
 #include "storage/procarray.h"
 #include "utils/acl.h"
@@ -1865,6 +1867,63 @@ pg_stat_get_wal(PG_FUNCTION_ARGS)
 	PG_RETURN_DATUM(HeapTupleGetDatum(heap_form_tuple(tupdesc, values, nulls)));
 }
 
+/*
+ * Returns statistics of recovery prefetching.
+ */
+Datum
+pg_stat_get_recovery_prefetch(PG_FUNCTION_ARGS)
+{
+#define PG_STAT_GET_RECOVERY_PREFETCH_COLS	9
+	TupleDesc	tupdesc;
+	Datum		values[PG_STAT_GET_RECOVERY_PREFETCH_COLS];
+	bool		nulls[PG_STAT_GET_RECOVERY_PREFETCH_COLS];
+	XLogPrefetchStatsData stats;
+
+	/* Initialise values and NULL flags arrays */
+	MemSet(values, 0, sizeof(values));
+	MemSet(nulls, 0, sizeof(nulls));
+
+	/* Initialise attributes information in the tuple descriptor */
+	tupdesc = CreateTemplateTupleDesc(PG_STAT_GET_RECOVERY_PREFETCH_COLS);
+	TupleDescInitEntry(tupdesc, (AttrNumber) 1, "stats_reset",
+					   TIMESTAMPTZOID, -1, 0);
+	TupleDescInitEntry(tupdesc, (AttrNumber) 2, "prefetch",
+					   INT8OID, -1, 0);
+	TupleDescInitEntry(tupdesc, (AttrNumber) 3, "hit",
+					   INT8OID, -1, 0);
+	TupleDescInitEntry(tupdesc, (AttrNumber) 4, "skip_init",
+					   INT8OID, -1, 0);
+	TupleDescInitEntry(tupdesc, (AttrNumber) 5, "skip_new",
+					   INT8OID, -1, 0);
+	TupleDescInitEntry(tupdesc, (AttrNumber) 6, "skip_fpw",
+					   INT8OID, -1, 0);
+	TupleDescInitEntry(tupdesc, (AttrNumber) 7, "skip_rep",
+					   INT8OID, -1, 0);
+	TupleDescInitEntry(tupdesc, (AttrNumber) 8, "wal_distance",
+					   INT4OID, -1, 0);
+	TupleDescInitEntry(tupdesc, (AttrNumber) 9, "io_depth",
+					   INT4OID, -1, 0);
+
+	BlessTupleDesc(tupdesc);
+
+	/* Get a snapshot of the startup process's counters */
+	XLogPrefetchGetStats(&stats);
+
+	/* Fill values and NULLs */
+	values[0] = TimestampTzGetDatum(stats.reset_time);
+	values[1] = Int64GetDatum(stats.prefetch);
+	values[2] = Int64GetDatum(stats.hit);
+	values[3] = Int64GetDatum(stats.skip_init);
+	values[4] = Int64GetDatum(stats.skip_new);
+	values[5] = Int64GetDatum(stats.skip_fpw);
+	values[6] = Int64GetDatum(stats.skip_rep);
+	values[7] = Int32GetDatum(stats.wal_distance);
+	values[8] = Int32GetDatum(stats.io_depth);
+
+	/* Returns the record as Datum */
+	PG_RETURN_DATUM(HeapTupleGetDatum(heap_form_tuple(tupdesc, values, nulls)));
+}
+
 /*
  * Returns statistics of SLRU caches.
  */
@@ -1942,6 +2001,96 @@ pg_stat_get_slru(PG_FUNCTION_ARGS)
 	return (Datum) 0;
 }
 
+/*
+ * Returns activity of the clock sweep partitions of shared buffers.
+ *
+ * Unlike the other functions here, this reads the counters straight from
+ * shared memory rather than from the stats collector, so the values are
+ * always current.
+ */
+Datum
+pg_stat_get_buffer_partitions(PG_FUNCTION_ARGS)
+{
+#define PG_STAT_GET_BUFFER_PARTITIONS_COLS	8
+	ReturnSetInfo *rsinfo = (ReturnSetInfo *) fcinfo->resultinfo;
+	TupleDesc	tupdesc;
+	Tuplestorestate *tupstore;
+	MemoryContext per_query_ctx;
+	MemoryContext oldcontext;
+	int			nparts;
+
+	/* check to see if caller supports us returning a tuplestore */
+	if (rsinfo == NULL || !IsA(rsinfo, ReturnSetInfo))
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("set-valued function called in context that cannot accept a set")));
+	if (!(rsinfo->allowedModes & SFRM_Materialize))
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("materialize mode required, but it is not allowed in this context")));
+
+	/* Build a tuple descriptor for our result type */
+	if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+		elog(ERROR, "return type must be a row type");
+
+	per_query_ctx = rsinfo->econtext->ecxt_per_query_memory;
+	oldcontext = MemoryContextSwitchTo(per_query_ctx);
+
+	tupstore = tuplestore_begin_heap(true, false, work_mem);
+	rsinfo->returnMode = SFRM_Materialize;
+	rsinfo->setResult = tupstore;
+	rsinfo->setDesc = tupdesc;
+
+	MemoryContextSwitchTo(oldcontext);
+
+	nparts = StrategyNumPartitions();
+
+	for (int i = 0; i < nparts; i++)
+	{
+		/* for each row */
+		Datum		values[PG_STAT_GET_BUFFER_PARTITIONS_COLS];
+		bool		nulls[PG_STAT_GET_BUFFER_PARTITIONS_COLS];
+		int			first_buffer;
+		int			num_buffers;
+		int			numa_node;
+		uint64		buffers_scanned;
+		uint64		buffers_allocated;
+		uint64		local_hits;
+		uint64		remote_hits;
+
+		StrategyPartitionRange(i, &first_buffer, &num_buffers);
+		numa_node = StrategyPartitionNumaNode(i);
+		StrategyPartitionStats(i, &buffers_scanned, &buffers_allocated,
+							   &local_hits, &remote_hits);
+
+		MemSet(nulls, 0, sizeof(nulls));
+
+		values[0] = Int32GetDatum(i);
+		/* report buffer IDs the way pg_buffercache does, starting at 1 */
+		values[1] = Int32GetDatum(first_buffer + 1);
+		values[2] = Int32GetDatum(num_buffers);
+		values[3] = Int64GetDatum((int64) buffers_scanned);
+		values[4] = Int64GetDatum((int64) buffers_allocated);
+
+		/* hits are only counted if the partition is placed on a node */
+		if (numa_node >= 0)
+		{
+			values[5] = Int32GetDatum(numa_node);
+			values[6] = Int64GetDatum((int64) local_hits);
+			values[7] = Int64GetDatum((int64) remote_hits);
+		}
+		else
+			nulls[5] = nulls[6] = nulls[7] = true;
+
+		tuplestore_putvalues(tupstore, tupdesc, values, nulls);
+	}
+
+	/* clean up and return the tuplestore */
+	tuplestore_donestoring(tupstore);
+
+	return (Datum) 0;
+}
+
 Datum
 pg_stat_get_xact_numscans(PG_FUNCTION_ARGS)
 {
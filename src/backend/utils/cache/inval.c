@@ -757,6 +757,19 @@ PrepareInvalidationState(void)
 	transInvalInfo = myInfo;
 }
 
+/*
+ * TransactionHasInvalidations
+ *		Has the current transaction queued any invalidation messages?
+ *
+ * If so, it has modified catalogs, and what it sees of them may not be
+ * visible to anybody else yet.
+ */
+bool
+TransactionHasInvalidations(void)
+{
+	return transInvalInfo != NULL;
+}
+
 /*
  * PostPrepare_Inval
  *		Clean up after successful PREPARE.
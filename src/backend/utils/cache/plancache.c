@@ -65,12 +65,14 @@
 #include "parser/analyze.h"
 #include "parser/parsetree.h"
 #include "storage/lmgr.h"
+#include "storage/sinval.h"
 #include "tcop/pquery.h"
 #include "tcop/utility.h"
 #include "utils/inval.h"
 #include "utils/memutils.h"
 #include "utils/resowner_private.h"
 #include "utils/rls.h"
+#include "utils/sharedplancache.h"
 #include "utils/snapmgr.h"
 #include "utils/syscache.h"
 
@@ -121,7 +123,8 @@ int			plan_cache_mode;
 /*
  * InitPlanCache: initialize module during InitPostgres.
  *
- * All we need to do is hook into inval.c's callback lists.
+ * All we need to do is hook into inval.c's callback lists, and attach to the
+ * shared plan cache if there is one.
  */
 void
 InitPlanCache(void)
@@ -134,6 +137,8 @@ InitPlanCache(void)
 	CacheRegisterSyscacheCallback(AMOPOPID, PlanCacheSysCallback, (Datum) 0);
 	CacheRegisterSyscacheCallback(FOREIGNSERVEROID, PlanCacheSysCallback, (Datum) 0);
 	CacheRegisterSyscacheCallback(FOREIGNDATAWRAPPEROID, PlanCacheSysCallback, (Datum) 0);
+
+	InitSharedPlanCache();
 }
 
 /*
@@ -880,9 +885,11 @@ BuildCachedPlan(CachedPlanSource *plansource, List *qlist,
 				ParamListInfo boundParams, QueryEnvironment *queryEnv)
 {
 	CachedPlan *plan;
-	List	   *plist;
+	List	   *plist = NIL;
 	bool		snapshot_set;
 	bool		is_transient;
+	bool		use_shared;
+	uint64		inval_count = 0;
 	MemoryContext plan_context;
 	MemoryContext oldcxt = CurrentMemoryContext;
 	ListCell   *lc;
@@ -905,40 +912,84 @@ BuildCachedPlan(CachedPlanSource *plansource, List *qlist,
 		qlist = RevalidateCachedQuery(plansource, queryEnv);
 
 	/*
-	 * If we don't already have a copy of the querytree list that can be
-	 * scribbled on by the planner, make one.  For a one-shot plan, we assume
-	 * it's okay to scribble on the original query_list.
+	 * A generic plan might have been built by another backend already.  If
+	 * it's in the shared plan cache, take that, after locking its relations
+	 * and making sure it wasn't invalidated meanwhile.
 	 */
-	if (qlist == NIL)
+	use_shared = (boundParams == NULL && queryEnv == NULL &&
+				  SharedPlanCacheUsable(plansource));
+	if (use_shared)
 	{
-		if (!plansource->is_oneshot)
-			qlist = copyObject(plansource->query_list);
-		else
-			qlist = plansource->query_list;
+		uint64		generation;
+
+		plist = SharedPlanCacheLookup(plansource, &generation);
+		if (plist != NIL)
+		{
+			AcquireExecutorLocks(plist, true);
+			if (!SharedPlanCacheRecheck(plansource, generation))
+			{
+				AcquireExecutorLocks(plist, false);
+				plist = NIL;
+			}
+		}
+		inval_count = SharedInvalidMessageCounter;
 	}
 
-	/*
-	 * If a snapshot is already set (the normal case), we can just use that
-	 * for planning.  But if it isn't, and we need one, install one.
-	 */
-	snapshot_set = false;
-	if (!ActiveSnapshotSet() &&
-		plansource->raw_parse_tree &&
-		analyze_requires_snapshot(plansource->raw_parse_tree))
+	if (plist == NIL)
 	{
-		PushActiveSnapshot(GetTransactionSnapshot());
-		snapshot_set = true;
-	}
+		/* the recheck of a shared plan may have found the query stale, too */
+		if (!plansource->is_valid)
+			qlist = RevalidateCachedQuery(plansource, queryEnv);
 
-	/*
-	 * Generate the plan.
-	 */
-	plist = pg_plan_queries(qlist, plansource->query_string,
-							plansource->cursor_options, boundParams);
+		/*
+		 * If we don't already have a copy of the querytree list that can be
+		 * scribbled on by the planner, make one.  For a one-shot plan, we
+		 * assume it's okay to scribble on the original query_list.
+		 */
+		if (qlist == NIL)
+		{
+			if (!plansource->is_oneshot)
+				qlist = copyObject(plansource->query_list);
+			else
+				qlist = plansource->query_list;
+		}
 
-	/* Release snapshot if we got one */
-	if (snapshot_set)
-		PopActiveSnapshot();
+		/*
+		 * If a snapshot is already set (the normal case), we can just use
+		 * that for planning.  But if it isn't, and we need one, install one.
+		 */
+		snapshot_set = false;
+		if (!ActiveSnapshotSet() &&
+			plansource->raw_parse_tree &&
+			analyze_requires_snapshot(plansource->raw_parse_tree))
+		{
+			PushActiveSnapshot(GetTransactionSnapshot());
+			snapshot_set = true;
+		}
+
+		/*
+		 * Generate the plan.
+		 */
+		plist = pg_plan_queries(qlist, plansource->query_string,
+								plansource->cursor_options, boundParams);
+
+		/* Release snapshot if we got one */
+		if (snapshot_set)
+			PopActiveSnapshot();
+
+		/*
+		 * Offer the plan to other backends, unless something was invalidated
+		 * while we planned: we can't tell whether the plan is affected, and
+		 * other backends may already have processed the invalidation.
+		 */
+		if (use_shared)
+		{
+			AcceptInvalidationMessages();
+			if (inval_count == SharedInvalidMessageCounter &&
+				plansource->is_valid)
+				SharedPlanCacheInsert(plansource, plist);
+		}
+	}
 
 	/*
 	 * Normally we make a dedicated memory context for the CachedPlan and its
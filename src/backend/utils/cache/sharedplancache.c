@@ -0,0 +1,742 @@
+/*-------------------------------------------------------------------------
+ *
+ * sharedplancache.c
+ *	  Cross-backend cache of generic plans.
+ *
+ * plancache.c keeps its plans in backend-local memory, so every backend
+ * that prepares the same statement plans it again.  When
+ * shared_plan_cache_size is set, generic plans are also stored, in
+ * serialized form, in a hash table in shared memory, from which other
+ * backends can copy them instead of planning.
+ *
+ * An entry is keyed by database, role and a hash of the analyzed query
+ * tree, the active search path, the parameter types and the cursor options;
+ * the entry itself records all of them, so that hash collisions are
+ * detected.  The query tree rather than the query text is compared because
+ * parse analysis depends on session settings such as DateStyle and
+ * transform_null_equals: the same text can mean different things in
+ * different sessions.
+ * The plan text lives in a DSA area carved out of the main shared memory
+ * segment, whose size is fixed at postmaster start.  When that is full, the
+ * least recently used entries are evicted.
+ *
+ * Invalidation is driven off the same sinval events as for local plans:
+ * every backend registers inval.c callbacks that remove the shared entries
+ * depending on the object being modified.  Since each backend processes
+ * each event, an entry is removed as soon as any backend notices, and at the
+ * latest when the backend that wants to use it does.  That leaves two races,
+ * handled like this:
+ *
+ * - A backend might insert a plan that was built before an invalidation it
+ *	 has not yet processed, after other backends have processed it.  So the
+ *	 inserting backend accepts pending invalidations first, and gives up if
+ *	 any arrived since it started planning.
+ *
+ * - A backend might look up a plan that has been invalidated by an event
+ *	 that nobody has processed yet.  So, like CheckCachedPlan, the caller
+ *	 locks the plan's relations, accepts invalidations, and then checks that
+ *	 the entry is still there.
+ *
+ * Plans that cannot be shared safely are not stored: those that depend on
+ * row-level security or on TransactionXmin, those of statements whose
+ * parameters are resolved by parser hooks, as in PL/pgSQL, and those built
+ * by a backend that has a temporary namespace or uncommitted catalog
+ * changes.
+ *
+ * Portions Copyright (c) 1996-2021, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * IDENTIFICATION
+ *	  src/backend/utils/cache/sharedplancache.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "catalog/namespace.h"
+#include "common/hashfn.h"
+#include "miscadmin.h"
+#include "nodes/parsenodes.h"
+#include "nodes/plannodes.h"
+#include "port/atomics.h"
+#include "storage/ipc.h"
+#include "storage/lwlock.h"
+#include "storage/shmem.h"
+#include "utils/dsa.h"
+#include "utils/hsearch.h"
+#include "utils/inval.h"
+#include "utils/memutils.h"
+#include "utils/sharedplancache.h"
+#include "utils/syscache.h"
+
+
+/*
+ * The hash table is sized assuming that a serialized plan takes about this
+ * many kilobytes.
+ */
+#define SHARED_PLAN_AVG_KB			4
+#define SHARED_PLAN_MIN_ENTRIES		64
+
+/*
+ * Hash key of a shared plan.  'hash' covers the query tree, search path,
+ * parameter types and cursor options, which are stored in the entry's data
+ * for verification.
+ */
+typedef struct SharedPlanKey
+{
+	Oid			dbid;			/* database the plan belongs to */
+	Oid			roleid;			/* role the plan was built for */
+	uint64		hash;			/* hash of everything else that matters */
+} SharedPlanKey;
+
+typedef struct SharedPlanEntry
+{
+	SharedPlanKey key;			/* hash key; must be first */
+	dsa_pointer data;			/* SharedPlanData in the area */
+	uint64		generation;		/* identifies this version of the entry */
+	pg_atomic_uint64 last_used; /* clock value at the last use */
+} SharedPlanEntry;
+
+/* A dependency on a syscache entry, as in a PlanInvalItem */
+typedef struct SharedPlanInvalItem
+{
+	int			cacheId;
+	uint32		hashValue;
+} SharedPlanInvalItem;
+
+/*
+ * Serialized plan and everything needed to match and invalidate it.  The
+ * arrays follow the struct in this order, then the text of the analyzed
+ * query tree and the plan text, both null-terminated.
+ */
+typedef struct SharedPlanData
+{
+	int			cursor_options;
+	int			num_params;		/* length of parameter type array */
+	int			num_search_path;	/* length of namespace OID array */
+	int			num_relations;	/* length of relation OID array */
+	int			num_invalitems; /* length of SharedPlanInvalItem array */
+	Size		query_offset;	/* offset of query tree text from start */
+	Size		plan_offset;	/* offset of plan text from start */
+} SharedPlanData;
+
+#define SharedPlanParamTypes(data) \
+	((Oid *) ((char *) (data) + MAXALIGN(sizeof(SharedPlanData))))
+#define SharedPlanSearchPath(data) \
+	(SharedPlanParamTypes(data) + (data)->num_params)
+#define SharedPlanRelations(data) \
+	(SharedPlanSearchPath(data) + (data)->num_search_path)
+#define SharedPlanInvalItems(data) \
+	((SharedPlanInvalItem *) (SharedPlanRelations(data) + (data)->num_relations))
+
+typedef struct SharedPlanCacheControl
+{
+	uint64		next_generation;	/* protected by SharedPlanCacheLock */
+	pg_atomic_uint64 clock;		/* advanced on every use of an entry */
+} SharedPlanCacheControl;
+
+/* The DSA area follows the control struct */
+#define SharedPlanCacheAreaPlace(ctl) \
+	((char *) (ctl) + MAXALIGN(sizeof(SharedPlanCacheControl)))
+
+/* GUC parameter */
+int			shared_plan_cache_size = 0;
+
+static SharedPlanCacheControl *SharedPlanCtl = NULL;
+static HTAB *SharedPlanHash = NULL;
+static dsa_area *SharedPlanArea = NULL;
+
+static void SharedPlanCacheRelCallback(Datum arg, Oid relid);
+static void SharedPlanCacheObjectCallback(Datum arg, int cacheid,
+										  uint32 hashvalue);
+static void SharedPlanCacheSysCallback(Datum arg, int cacheid,
+									   uint32 hashvalue);
+
+
+static Size
+shared_plan_area_size(void)
+{
+	return Max((Size) shared_plan_cache_size * 1024, dsa_minimum_size());
+}
+
+static long
+shared_plan_max_entries(void)
+{
+	return Max(shared_plan_cache_size / SHARED_PLAN_AVG_KB,
+			   SHARED_PLAN_MIN_ENTRIES);
+}
+
+/*
+ * SharedPlanCacheShmemSize: report shared memory space needed
+ */
+Size
+SharedPlanCacheShmemSize(void)
+{
+	Size		size;
+
+	if (shared_plan_cache_size == 0)
+		return 0;
+
+	size = MAXALIGN(sizeof(SharedPlanCacheControl));
+	size = add_size(size, shared_plan_area_size());
+	size = add_size(size, hash_estimate_size(shared_plan_max_entries(),
+											 sizeof(SharedPlanEntry)));
+
+	return size;
+}
+
+/*
+ * SharedPlanCacheShmemInit: allocate and initialize shared memory
+ */
+void
+SharedPlanCacheShmemInit(void)
+{
+	HASHCTL		info;
+	bool		found;
+
+	if (shared_plan_cache_size == 0)
+		return;
+
+	SharedPlanCtl = (SharedPlanCacheControl *)
+		ShmemInitStruct("Shared Plan Cache",
+						add_size(MAXALIGN(sizeof(SharedPlanCacheControl)),
+								 shared_plan_area_size()),
+						&found);
+
+	if (!found)
+	{
+		dsa_area   *area;
+
+		SharedPlanCtl->next_generation = 1;
+		pg_atomic_init_u64(&SharedPlanCtl->clock, 0);
+
+		/*
+		 * Keep the area within the space we reserved for it: it must not
+		 * grow into DSM segments, which would outlive no one in particular.
+		 */
+		area = dsa_create_in_place(SharedPlanCacheAreaPlace(SharedPlanCtl),
+								   shared_plan_area_size(),
+								   LWTRANCHE_SHARED_PLAN_CACHE_AREA, NULL);
+		dsa_pin(area);
+		dsa_set_size_limit(area, shared_plan_area_size());
+		dsa_detach(area);
+	}
+
+	info.keysize = sizeof(SharedPlanKey);
+	info.entrysize = sizeof(SharedPlanEntry);
+	SharedPlanHash = ShmemInitHash("Shared Plan Cache Hash",
+								   shared_plan_max_entries(),
+								   shared_plan_max_entries(),
+								   &info,
+								   HASH_ELEM | HASH_BLOBS);
+}
+
+/*
+ * InitSharedPlanCache: initialize module during InitPostgres.
+ *
+ * Attach to the shared area and hook into inval.c's callback lists, which
+ * we watch for the same events as plancache.c.
+ */
+void
+InitSharedPlanCache(void)
+{
+	MemoryContext oldcxt;
+
+	if (shared_plan_cache_size == 0)
+		return;
+
+	oldcxt = MemoryContextSwitchTo(TopMemoryContext);
+	SharedPlanArea = dsa_attach_in_place(SharedPlanCacheAreaPlace(SharedPlanCtl),
+										 NULL);
+	MemoryContextSwitchTo(oldcxt);
+	on_shmem_exit(dsa_on_shmem_exit_release_in_place,
+				  PointerGetDatum(SharedPlanCacheAreaPlace(SharedPlanCtl)));
+
+	CacheRegisterRelcacheCallback(SharedPlanCacheRelCallback, (Datum) 0);
+	CacheRegisterSyscacheCallback(PROCOID, SharedPlanCacheObjectCallback, (Datum) 0);
+	CacheRegisterSyscacheCallback(TYPEOID, SharedPlanCacheObjectCallback, (Datum) 0);
+	CacheRegisterSyscacheCallback(NAMESPACEOID, SharedPlanCacheSysCallback, (Datum) 0);
+	CacheRegisterSyscacheCallback(OPEROID, SharedPlanCacheSysCallback, (Datum) 0);
+	CacheRegisterSyscacheCallback(AMOPOPID, SharedPlanCacheSysCallback, (Datum) 0);
+	CacheRegisterSyscacheCallback(FOREIGNSERVEROID, SharedPlanCacheSysCallback, (Datum) 0);
+	CacheRegisterSyscacheCallback(FOREIGNDATAWRAPPEROID, SharedPlanCacheSysCallback, (Datum) 0);
+}
+
+/*
+ * SharedPlanCacheUsable: may the generic plan of this plansource be shared?
+ */
+bool
+SharedPlanCacheUsable(CachedPlanSource *plansource)
+{
+	Oid			tempNamespaceId;
+	Oid			tempToastNamespaceId;
+	ListCell   *lc;
+
+	if (SharedPlanArea == NULL)
+		return false;
+
+	/*
+	 * The query text must fully determine the query tree, which it doesn't
+	 * if parameters are resolved by hooks, or if RLS made the rewritten query
+	 * depend on the environment.  Only saved plansources are long-lived
+	 * enough to be worth the trouble.
+	 */
+	if (!plansource->is_saved || plansource->is_oneshot ||
+		plansource->parserSetup != NULL || plansource->dependsOnRLS ||
+		!plansource->is_valid)
+		return false;
+
+	/* Utility statements have no plans worth sharing */
+	foreach(lc, plansource->query_list)
+	{
+		Query	   *query = lfirst_node(Query, lc);
+
+		if (query->commandType == CMD_UTILITY)
+			return false;
+	}
+
+	/*
+	 * Names might resolve to our own temporary objects, and uncommitted
+	 * catalog changes mustn't leak into plans other backends see.
+	 */
+	GetTempNamespaceState(&tempNamespaceId, &tempToastNamespaceId);
+	if (OidIsValid(tempNamespaceId))
+		return false;
+	if (TransactionHasInvalidations())
+		return false;
+
+	return true;
+}
+
+/*
+ * Build the hash key of a plansource.  *search_path is set to the active
+ * search path and *query_text to the text of the analyzed query tree, both
+ * of which are part of the key.
+ */
+static void
+shared_plan_make_key(CachedPlanSource *plansource, SharedPlanKey *key,
+					 List **search_path, char **query_text)
+{
+	uint64		hash;
+	ListCell   *lc;
+
+	*search_path = fetch_search_path(true);
+	*query_text = nodeToString(plansource->query_list);
+
+	hash = hash_bytes_extended((const unsigned char *) *query_text,
+							   strlen(*query_text), 0);
+	if (plansource->num_params > 0)
+		hash = hash_combine64(hash,
+							  hash_bytes_extended((const unsigned char *) plansource->param_types,
+												  plansource->num_params * sizeof(Oid),
+												  0));
+	foreach(lc, *search_path)
+		hash = hash_combine64(hash, (uint64) lfirst_oid(lc));
+	hash = hash_combine64(hash, (uint64) plansource->cursor_options);
+
+	memset(key, 0, sizeof(SharedPlanKey));
+	key->dbid = MyDatabaseId;
+	key->roleid = GetUserId();
+	key->hash = hash;
+}
+
+/*
+ * Does a shared entry's data really belong to this plansource?
+ */
+static bool
+shared_plan_matches(SharedPlanData *data, CachedPlanSource *plansource,
+					List *search_path, const char *query_text)
+{
+	Oid		   *path = SharedPlanSearchPath(data);
+	ListCell   *lc;
+	int			i;
+
+	if (data->cursor_options != plansource->cursor_options ||
+		data->num_params != plansource->num_params ||
+		data->num_search_path != list_length(search_path))
+		return false;
+	if (plansource->num_params > 0 &&
+		memcmp(SharedPlanParamTypes(data), plansource->param_types,
+			   plansource->num_params * sizeof(Oid)) != 0)
+		return false;
+	i = 0;
+	foreach(lc, search_path)
+	{
+		if (path[i++] != lfirst_oid(lc))
+			return false;
+	}
+
+	return strcmp((char *) data + data->query_offset, query_text) == 0;
+}
+
+/*
+ * Remove an entry and free its data.  Caller must hold SharedPlanCacheLock
+ * exclusively.
+ */
+static void
+shared_plan_remove(SharedPlanEntry *entry)
+{
+	dsa_free(SharedPlanArea, entry->data);
+	hash_search(SharedPlanHash, &entry->key, HASH_REMOVE, NULL);
+}
+
+/*
+ * Evict the least recently used entry.  Caller must hold SharedPlanCacheLock
+ * exclusively.  Returns false if the cache is empty.
+ */
+static bool
+shared_plan_evict(void)
+{
+	HASH_SEQ_STATUS status;
+	SharedPlanEntry *entry;
+	SharedPlanEntry *victim = NULL;
+	uint64		victim_used = PG_UINT64_MAX;
+
+	hash_seq_init(&status, SharedPlanHash);
+	while ((entry = (SharedPlanEntry *) hash_seq_search(&status)) != NULL)
+	{
+		uint64		used = pg_atomic_read_u64(&entry->last_used);
+
+		if (used < victim_used)
+		{
+			victim = entry;
+			victim_used = used;
+		}
+	}
+
+	if (victim == NULL)
+		return false;
+	shared_plan_remove(victim);
+	return true;
+}
+
+/*
+ * SharedPlanCacheLookup: fetch a shared generic plan for a plansource.
+ *
+ * Returns the list of PlannedStmts, built in the caller's memory context, or
+ * NIL if there is none.  On success, *generation is set to identify the
+ * entry for SharedPlanCacheRecheck, which the caller must use after locking
+ * the plan's relations.
+ */
+List *
+SharedPlanCacheLookup(CachedPlanSource *plansource, uint64 *generation)
+{
+	SharedPlanKey key;
+	SharedPlanEntry *entry;
+	List	   *search_path;
+	char	   *query_text;
+	char	   *plan_text = NULL;
+	List	   *stmt_list;
+
+	shared_plan_make_key(plansource, &key, &search_path, &query_text);
+
+	LWLockAcquire(SharedPlanCacheLock, LW_SHARED);
+	entry = (SharedPlanEntry *) hash_search(SharedPlanHash, &key,
+											HASH_FIND, NULL);
+	if (entry != NULL)
+	{
+		SharedPlanData *data = dsa_get_address(SharedPlanArea, entry->data);
+
+		if (shared_plan_matches(data, plansource, search_path, query_text))
+		{
+			plan_text = pstrdup((char *) data + data->plan_offset);
+			*generation = entry->generation;
+			pg_atomic_write_u64(&entry->last_used,
+								pg_atomic_fetch_add_u64(&SharedPlanCtl->clock, 1));
+		}
+	}
+	LWLockRelease(SharedPlanCacheLock);
+
+	list_free(search_path);
+	pfree(query_text);
+
+	if (plan_text == NULL)
+		return NIL;
+
+	stmt_list = (List *) stringToNode(plan_text);
+	pfree(plan_text);
+
+	return stmt_list;
+}
+
+/*
+ * SharedPlanCacheRecheck: is a plan found by SharedPlanCacheLookup current?
+ *
+ * Caller must hold the locks needed to execute the plan.  Any invalidation
+ * that affects the plan and has been sent by now is processed here, and
+ * removes the entry if nobody else has already.
+ */
+bool
+SharedPlanCacheRecheck(CachedPlanSource *plansource, uint64 generation)
+{
+	SharedPlanKey key;
+	SharedPlanEntry *entry;
+	List	   *search_path;
+	char	   *query_text;
+	bool		valid;
+
+	AcceptInvalidationMessages();
+	if (!plansource->is_valid)
+		return false;
+
+	shared_plan_make_key(plansource, &key, &search_path, &query_text);
+	list_free(search_path);
+	pfree(query_text);
+
+	LWLockAcquire(SharedPlanCacheLock, LW_SHARED);
+	entry = (SharedPlanEntry *) hash_search(SharedPlanHash, &key,
+											HASH_FIND, NULL);
+	valid = (entry != NULL && entry->generation == generation);
+	LWLockRelease(SharedPlanCacheLock);
+
+	return valid;
+}
+
+/*
+ * SharedPlanCacheInsert: store a newly built generic plan of a plansource.
+ *
+ * Caller must have made sure that no invalidation arrived while the plan was
+ * being built.  Failure to find room is not an error; the plan just isn't
+ * shared.
+ */
+void
+SharedPlanCacheInsert(CachedPlanSource *plansource, List *stmt_list)
+{
+	SharedPlanKey key;
+	SharedPlanEntry *entry;
+	SharedPlanData *data;
+	List	   *search_path;
+	List	   *relations = NIL;
+	List	   *invalitems = NIL;
+	char	   *query_text;
+	char	   *plan_text;
+	Size		query_len;
+	Size		plan_len;
+	Size		len;
+	dsa_pointer dp;
+	bool		found;
+	ListCell   *lc;
+	int			i;
+
+	foreach(lc, stmt_list)
+	{
+		PlannedStmt *plannedstmt = lfirst_node(PlannedStmt, lc);
+
+		/* plans depending on TransactionXmin are only good for a while */
+		if (plannedstmt->commandType == CMD_UTILITY ||
+			plannedstmt->transientPlan)
+		{
+			list_free(relations);
+			list_free(invalitems);
+			return;
+		}
+		relations = list_concat(relations, plannedstmt->relationOids);
+		invalitems = list_concat(invalitems, plannedstmt->invalItems);
+	}
+
+	shared_plan_make_key(plansource, &key, &search_path, &query_text);
+	plan_text = nodeToString(stmt_list);
+
+	/* flatten everything into one chunk */
+	query_len = strlen(query_text) + 1;
+	plan_len = strlen(plan_text) + 1;
+	len = MAXALIGN(sizeof(SharedPlanData)) +
+		(plansource->num_params + list_length(search_path) +
+		 list_length(relations)) * sizeof(Oid) +
+		list_length(invalitems) * sizeof(SharedPlanInvalItem);
+	data = (SharedPlanData *) palloc(len + query_len + plan_len);
+	data->cursor_options = plansource->cursor_options;
+	data->num_params = plansource->num_params;
+	data->num_search_path = list_length(search_path);
+	data->num_relations = list_length(relations);
+	data->num_invalitems = list_length(invalitems);
+	data->query_offset = len;
+	data->plan_offset = len + query_len;
+	if (plansource->num_params > 0)
+		memcpy(SharedPlanParamTypes(data), plansource->param_types,
+			   plansource->num_params * sizeof(Oid));
+	i = 0;
+	foreach(lc, search_path)
+		SharedPlanSearchPath(data)[i++] = lfirst_oid(lc);
+	i = 0;
+	foreach(lc, relations)
+		SharedPlanRelations(data)[i++] = lfirst_oid(lc);
+	i = 0;
+	foreach(lc, invalitems)
+	{
+		PlanInvalItem *item = lfirst_node(PlanInvalItem, lc);
+
+		SharedPlanInvalItems(data)[i].cacheId = item->cacheId;
+		SharedPlanInvalItems(data)[i].hashValue = item->hashValue;
+		i++;
+	}
+	memcpy((char *) data + data->query_offset, query_text, query_len);
+	memcpy((char *) data + data->plan_offset, plan_text, plan_len);
+	len += query_len + plan_len;
+
+	LWLockAcquire(SharedPlanCacheLock, LW_EXCLUSIVE);
+
+	/*
+	 * Replace any existing entry; it's either another backend's copy of the
+	 * same plan, or a colliding statement that has to make room.
+	 */
+	entry = (SharedPlanEntry *) hash_search(SharedPlanHash, &key,
+											HASH_FIND, NULL);
+	if (entry != NULL)
+		shared_plan_remove(entry);
+
+	while (!DsaPointerIsValid(dp = dsa_allocate_extended(SharedPlanArea, len,
+														 DSA_ALLOC_NO_OOM)))
+	{
+		if (!shared_plan_evict())
+			break;
+	}
+
+	if (DsaPointerIsValid(dp))
+	{
+		if (hash_get_num_entries(SharedPlanHash) >= shared_plan_max_entries())
+			shared_plan_evict();
+
+		entry = (SharedPlanEntry *) hash_search(SharedPlanHash, &key,
+												HASH_ENTER_NULL, &found);
+		if (entry != NULL)
+		{
+			Assert(!found);
+			memcpy(dsa_get_address(SharedPlanArea, dp), data, len);
+			entry->data = dp;
+			entry->generation = SharedPlanCtl->next_generation++;
+			pg_atomic_init_u64(&entry->last_used,
+							   pg_atomic_fetch_add_u64(&SharedPlanCtl->clock, 1));
+		}
+		else
+			dsa_free(SharedPlanArea, dp);
+	}
+
+	LWLockRelease(SharedPlanCacheLock);
+
+	pfree(data);
+	pfree(query_text);
+	pfree(plan_text);
+	list_free(search_path);
+	list_free(relations);
+	list_free(invalitems);
+}
+
+/*
+ * Does an entry depend on the given relation, or on the given syscache
+ * entry?  relid == InvalidOid and cacheid < 0 matches everything;
+ * hashvalue == 0 matches all entries of the cache.
+ */
+static bool
+shared_plan_depends_on(SharedPlanData *data, Oid relid,
+					   int cacheid, uint32 hashvalue)
+{
+	int			i;
+
+	if (OidIsValid(relid))
+	{
+		for (i = 0; i < data->num_relations; i++)
+		{
+			if (SharedPlanRelations(data)[i] == relid)
+				return true;
+		}
+		return false;
+	}
+
+	if (cacheid >= 0)
+	{
+		for (i = 0; i < data->num_invalitems; i++)
+		{
+			SharedPlanInvalItem *item = &SharedPlanInvalItems(data)[i];
+
+			if (item->cacheId == cacheid &&
+				(hashvalue == 0 || item->hashValue == hashvalue))
+				return true;
+		}
+		return false;
+	}
+
+	return true;
+}
+
+/*
+ * Remove all entries depending on the given object; see
+ * shared_plan_depends_on.
+ *
+ * Every backend gets here for every event, so first look for matches with a
+ * shared lock: usually somebody else has already removed them.
+ */
+static void
+shared_plan_invalidate(Oid relid, int cacheid, uint32 hashvalue)
+{
+	HASH_SEQ_STATUS status;
+	SharedPlanEntry *entry;
+	bool		any = false;
+
+	if (SharedPlanHash == NULL)
+		return;
+
+	LWLockAcquire(SharedPlanCacheLock, LW_SHARED);
+	hash_seq_init(&status, SharedPlanHash);
+	while ((entry = (SharedPlanEntry *) hash_seq_search(&status)) != NULL)
+	{
+		if (shared_plan_depends_on(dsa_get_address(SharedPlanArea, entry->data),
+								   relid, cacheid, hashvalue))
+		{
+			any = true;
+			hash_seq_term(&status);
+			break;
+		}
+	}
+	LWLockRelease(SharedPlanCacheLock);
+
+	if (!any)
+		return;
+
+	/* dynahash allows removing the entry just returned by a scan */
+	LWLockAcquire(SharedPlanCacheLock, LW_EXCLUSIVE);
+	hash_seq_init(&status, SharedPlanHash);
+	while ((entry = (SharedPlanEntry *) hash_seq_search(&status)) != NULL)
+	{
+		if (shared_plan_depends_on(dsa_get_address(SharedPlanArea, entry->data),
+								   relid, cacheid, hashvalue))
+			shared_plan_remove(entry);
+	}
+	LWLockRelease(SharedPlanCacheLock);
+}
+
+/*
+ * SharedPlanCacheRelCallback
+ *		Relcache inval callback function
+ *
+ * Remove all plans mentioning the given rel, or all plans if
+ * relid == InvalidOid.  The latter happens after a sinval queue overflow,
+ * when this backend can't tell what it missed.
+ */
+static void
+SharedPlanCacheRelCallback(Datum arg, Oid relid)
+{
+	shared_plan_invalidate(relid, OidIsValid(relid) ? 0 : -1, 0);
+}
+
+/*
+ * SharedPlanCacheObjectCallback
+ *		Syscache inval callback function for PROCOID and TYPEOID caches
+ */
+static void
+SharedPlanCacheObjectCallback(Datum arg, int cacheid, uint32 hashvalue)
+{
+	shared_plan_invalidate(InvalidOid, cacheid, hashvalue);
+}
+
+/*
+ * SharedPlanCacheSysCallback
+ *		Syscache inval callback function for other caches
+ *
+ * Just remove everything...
+ */
+static void
+SharedPlanCacheSysCallback(Datum arg, int cacheid, uint32 hashvalue)
+{
+	shared_plan_invalidate(InvalidOid, -1, 0);
+}
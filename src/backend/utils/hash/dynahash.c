@@ -127,6 +127,9 @@
 /* Number of freelists to be used for a partitioned hash table. */
 #define NUM_FREELISTS			32
 
+/* Longest collision chain hash_search_optimistic() will follow. */
+#define HASH_OPTIMISTIC_MAX_STEPS	64
+
 /* A hash bucket is a linked list of HASHELEMENTs */
 typedef HASHELEMENT *HASHBUCKET;
 
@@ -1288,6 +1291,68 @@ hash_update_hash_key(HTAB *hashp,
 	return true;
 }
 
+/*
+ * hash_search_optimistic -- look up a key without holding the partition lock
+ *
+ * This is a HASH_FIND that can be used on a partitioned shared hashtable
+ * while other backends are inserting and removing entries.  That works
+ * because partitioned tables are never expanded, so the bucket array is
+ * stable, and because the memory of shared hashtable elements is never
+ * released, so following a stale link can't take us outside the table.
+ *
+ * The price is that the result is only a hint.  An entry in the middle of
+ * being inserted or removed may be missed, and the entry returned may
+ * already have been removed, or even reused for another key, by the time
+ * the caller looks at it.  Callers must verify the result by other means,
+ * and must fall back to a regular locked search when NULL is returned and
+ * they need a definite answer.
+ *
+ * A chain that concurrent removals keep changing, or that has led us into a
+ * freelist, could in principle be followed indefinitely, so we give up
+ * after a bounded number of steps.
+ */
+void *
+hash_search_optimistic(HTAB *hashp, const void *keyPtr, uint32 hashvalue)
+{
+	HASHHDR    *hctl = hashp->hctl;
+	uint32		bucket;
+	long		segment_num;
+	long		segment_ndx;
+	HASHSEGMENT segp;
+	HASHBUCKET	currBucket;
+	HashCompareFunc match;
+	Size		keysize;
+	int			steps;
+
+	Assert(hashp->isshared && IS_PARTITIONED(hctl));
+
+	bucket = calc_bucket(hctl, hashvalue);
+
+	segment_num = bucket >> hashp->sshift;
+	segment_ndx = MOD(bucket, hashp->ssize);
+
+	segp = hashp->dir[segment_num];
+
+	if (segp == NULL)
+		hash_corrupted(hashp);
+
+	match = hashp->match;
+	keysize = hashp->keysize;
+
+	currBucket = ((volatile HASHBUCKET *) segp)[segment_ndx];
+	for (steps = 0;
+		 currBucket != NULL && steps < HASH_OPTIMISTIC_MAX_STEPS;
+		 steps++)
+	{
+		if (currBucket->hashvalue == hashvalue &&
+			match(ELEMENTKEY(currBucket), keyPtr, keysize) == 0)
+			return (void *) ELEMENTKEY(currBucket);
+		currBucket = ((volatile HASHELEMENT *) currBucket)->link;
+	}
+
+	return NULL;
+}
+
 /*
  * Allocate a new hashtable entry if possible; return NULL if out of memory.
  * (Or, if the underlying space allocator throws error for out-of-memory,
@@ -41,6 +41,7 @@
 #include "access/twophase.h"
 #include "access/xact.h"
 #include "access/xlog_internal.h"
+#include "access/xlogprefetch.h"
 #include "catalog/namespace.h"
 #include "catalog/pg_authid.h"
 #include "catalog/storage.h"
@@ -51,12 +52,15 @@
 #include "commands/vacuum.h"
 #include "commands/variable.h"
 #include "common/string.h"
+#include "executor/nodeHashjoin.h"
+#include "executor/nodeNestloop.h"
 #include "funcapi.h"
 #include "jit/jit.h"
 #include "libpq/auth.h"
 #include "libpq/libpq.h"
 #include "libpq/pqformat.h"
 #include "miscadmin.h"
+#include "optimizer/cardfeedback.h"
 #include "optimizer/cost.h"
 #include "optimizer/geqo.h"
 #include "optimizer/optimizer.h"
@@ -79,6 +83,7 @@
 #include "replication/syncrep.h"
 #include "replication/walreceiver.h"
 #include "replication/walsender.h"
+#include "storage/aio.h"
 #include "storage/bufmgr.h"
 #include "storage/dsm_impl.h"
 #include "storage/fd.h"
@@ -103,6 +108,7 @@
 #include "utils/ps_status.h"
 #include "utils/queryjumble.h"
 #include "utils/rls.h"
+#include "utils/sharedplancache.h"
 #include "utils/snapmgr.h"
 #include "utils/tzparser.h"
 #include "utils/inval.h"
@@ -174,6 +180,9 @@ static bool check_wal_consistency_checking(char **newval, void **extra,
 										   GucSource source);
 static void assign_wal_consistency_checking(const char *newval, void *extra);
 
+static bool check_io_direct(char **newval, void **extra, GucSource source);
+static void assign_io_direct(const char *newval, void *extra);
+
 #ifdef HAVE_SYSLOG
 static int	syslog_facility = LOG_LOCAL0;
 #else
@@ -519,6 +528,55 @@ static struct config_enum_entry recovery_init_sync_method_options[] = {
 	{NULL, 0, false}
 };
 
+static const struct config_enum_entry wal_compression_options[] = {
+	{"pglz", WAL_COMPRESSION_PGLZ, false},
+#ifdef USE_LZ4
+	{"lz4", WAL_COMPRESSION_LZ4, false},
+#endif
+#ifdef USE_ZSTD
+	{"zstd", WAL_COMPRESSION_ZSTD, false},
+#endif
+	{"on", WAL_COMPRESSION_PGLZ, false},
+	{"off", WAL_COMPRESSION_NONE, false},
+	{"true", WAL_COMPRESSION_PGLZ, true},
+	{"false", WAL_COMPRESSION_NONE, true},
+	{"yes", WAL_COMPRESSION_PGLZ, true},
+	{"no", WAL_COMPRESSION_NONE, true},
+	{"1", WAL_COMPRESSION_PGLZ, true},
+	{"0", WAL_COMPRESSION_NONE, true},
+	{NULL, 0, false}
+};
+
+static const struct config_enum_entry recovery_prefetch_options[] = {
+	{"off", RECOVERY_PREFETCH_OFF, false},
+	{"on", RECOVERY_PREFETCH_ON, false},
+	{"try", RECOVERY_PREFETCH_TRY, false},
+	{"true", RECOVERY_PREFETCH_ON, true},
+	{"false", RECOVERY_PREFETCH_OFF, true},
+	{"yes", RECOVERY_PREFETCH_ON, true},
+	{"no", RECOVERY_PREFETCH_OFF, true},
+	{"1", RECOVERY_PREFETCH_ON, true},
+	{"0", RECOVERY_PREFETCH_OFF, true},
+	{NULL, 0, false}
+};
+
+static struct config_enum_entry io_method_options[] = {
+	{"sync", IO_METHOD_SYNC, false},
+#ifdef USE_LIBURING
+	{"io_uring", IO_METHOD_IO_URING, false},
+#endif
+	{NULL, 0, false}
+};
+
+static struct config_enum_entry numa_buffer_placement_options[] = {
+	{"off", NUMA_BUFFER_PLACEMENT_OFF, false},
+#ifdef USE_LIBNUMA
+	{"interleave", NUMA_BUFFER_PLACEMENT_INTERLEAVE, false},
+	{"partition", NUMA_BUFFER_PLACEMENT_PARTITION, false},
+#endif
+	{NULL, 0, false}
+};
+
 static struct config_enum_entry shared_memory_options[] = {
 #ifndef WIN32
 	{"sysv", SHMEM_TYPE_SYSV, false},
@@ -643,6 +701,7 @@ static char *log_timezone_string;
 static char *timezone_abbreviations_string;
 static char *data_directory;
 static char *session_authorization_string;
+static char *io_direct_string;
 static int	max_function_args;
 static int	max_index_keys;
 static int	max_identifier_length;
@@ -742,6 +801,8 @@ const char *const config_group_names[] =
 	gettext_noop("Write-Ahead Log / Checkpoints"),
 	/* WAL_ARCHIVING */
 	gettext_noop("Write-Ahead Log / Archiving"),
+	/* WAL_RECOVERY */
+	gettext_noop("Write-Ahead Log / Recovery"),
 	/* WAL_ARCHIVE_RECOVERY */
 	gettext_noop("Write-Ahead Log / Archive Recovery"),
 	/* WAL_RECOVERY_TARGET */
@@ -1131,6 +1192,26 @@ static struct config_bool ConfigureNamesBool[] =
 		true,
 		NULL, NULL, NULL
 	},
+	{
+		{"enable_parallel_hashagg", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Enables the planner's use of parallel hash aggregation plans."),
+			NULL,
+			GUC_EXPLAIN
+		},
+		&enable_parallel_hashagg,
+		false,
+		NULL, NULL, NULL
+	},
+	{
+		{"enable_parallel_mergejoin", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Enables the planner's use of parallel merge join plans."),
+			NULL,
+			GUC_EXPLAIN
+		},
+		&enable_parallel_mergejoin,
+		false,
+		NULL, NULL, NULL
+	},
 	{
 		{"enable_partition_pruning", PGC_USERSET, QUERY_TUNING_METHOD,
 			gettext_noop("Enables plan-time and execution-time partition pruning."),
@@ -1304,16 +1385,6 @@ static struct config_bool ConfigureNamesBool[] =
 		NULL, NULL, NULL
 	},
 
-	{
-		{"wal_compression", PGC_SUSET, WAL_SETTINGS,
-			gettext_noop("Compresses full-page writes written in WAL file."),
-			NULL
-		},
-		&wal_compression,
-		false,
-		NULL, NULL, NULL
-	},
-
 	{
 		{"wal_init_zero", PGC_SUSET, WAL_SETTINGS,
 			gettext_noop("Writes zeroes to new WAL files before first use."),
@@ -2025,6 +2096,51 @@ static struct config_bool ConfigureNamesBool[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"batch_execution", PGC_USERSET, QUERY_TUNING_OTHER,
+			gettext_noop("Allows the executor to pass rows between plan nodes in batches."),
+			NULL,
+			GUC_EXPLAIN
+		},
+		&batch_execution,
+		false,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"hashjoin_bloom_filter", PGC_USERSET, QUERY_TUNING_OTHER,
+			gettext_noop("Allows hash joins to pass a Bloom filter of their inner side to the scan of their outer side."),
+			NULL,
+			GUC_EXPLAIN
+		},
+		&hashjoin_bloom_filter,
+		true,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"hashjoin_radix_partitioning", PGC_USERSET, QUERY_TUNING_OTHER,
+			gettext_noop("Allows hash joins to probe their hash table in cache-sized partitions."),
+			gettext_noop("Outer tuples are read in blocks and reordered by hash bucket, "
+						 "so the join's output order changes."),
+			GUC_EXPLAIN
+		},
+		&hashjoin_radix_partitioning,
+		false,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"cardinality_feedback", PGC_USERSET, QUERY_TUNING_OTHER,
+			gettext_noop("Enables the planner to learn from the row counts of instrumented executions."),
+			gettext_noop("Has no effect unless cardinality_feedback_entries is set."),
+			GUC_EXPLAIN
+		},
+		&cardinality_feedback,
+		true,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"jit_debugging_support", PGC_SU_BACKEND, DEVELOPER_OPTIONS,
 			gettext_noop("Register JIT-compiled functions with debugger."),
@@ -2176,6 +2292,16 @@ static struct config_int ConfigureNamesInt[] =
 		8, 1, INT_MAX,
 		NULL, NULL, NULL
 	},
+	{
+		{"linear_join_threshold", PGC_USERSET, QUERY_TUNING_OTHER,
+			gettext_noop("Sets the threshold of FROM items beyond which linearized dynamic programming is used."),
+			gettext_noop("Zero disables linearized dynamic programming."),
+			GUC_EXPLAIN
+		},
+		&linear_join_threshold,
+		0, 0, INT_MAX,
+		NULL, NULL, NULL
+	},
 	{
 		{"geqo_threshold", PGC_USERSET, QUERY_TUNING_GEQO,
 			gettext_noop("Sets the threshold of FROM items beyond which GEQO is used."),
@@ -2316,6 +2442,27 @@ static struct config_int ConfigureNamesInt[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"shared_plan_cache_size", PGC_POSTMASTER, RESOURCES_MEM,
+			gettext_noop("Sets the amount of shared memory used to share generic plans between sessions."),
+			gettext_noop("Zero disables the shared plan cache."),
+			GUC_UNIT_KB
+		},
+		&shared_plan_cache_size,
+		0, 0, MAX_KILOBYTES,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"cardinality_feedback_entries", PGC_POSTMASTER, RESOURCES_MEM,
+			gettext_noop("Sets the maximum number of scans whose observed row counts are kept for the planner."),
+			gettext_noop("Zero disables cardinality feedback.")
+		},
+		&cardinality_feedback_entries,
+		0, 0, INT_MAX / 2,
+		NULL, NULL, NULL
+	},
+
 	/*
 	 * We sometimes multiply the number of shared buffers by two without
 	 * checking for overflow, so we mustn't allow more than INT_MAX / 2.
@@ -2821,6 +2968,27 @@ static struct config_int ConfigureNamesInt[] =
 		check_wal_buffers, NULL, NULL
 	},
 
+	{
+		{"wal_insert_locks", PGC_POSTMASTER, WAL_SETTINGS,
+			gettext_noop("Sets the number of locks allowing concurrent insertions into WAL."),
+			gettext_noop("-1 means use the number of CPUs, between 8 and 128.")
+		},
+		&NumXLogInsertLocks,
+		-1, -1, 1024,
+		check_wal_insert_locks, NULL, NULL
+	},
+
+	{
+		{"recovery_prefetch_distance", PGC_SIGHUP, WAL_RECOVERY,
+			gettext_noop("Sets how far ahead of replay to read WAL when prefetching."),
+			NULL,
+			GUC_UNIT_BYTE
+		},
+		&recovery_prefetch_distance,
+		256 * 1024, 0, INT_MAX,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"wal_writer_delay", PGC_SIGHUP, WAL_SETTINGS,
 			gettext_noop("Time between WAL flushes performed in the WAL writer."),
@@ -3672,6 +3840,18 @@ static struct config_real ConfigureNamesReal[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"nestloop_switch_threshold", PGC_USERSET, QUERY_TUNING_OTHER,
+			gettext_noop("Sets the multiple of its estimated row count at which "
+						 "a nested loop's outer side makes it switch to hashing its inner side."),
+			gettext_noop("Zero disables switching."),
+			GUC_EXPLAIN
+		},
+		&nestloop_switch_threshold,
+		10.0, 0.0, DBL_MAX,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"geqo_selection_bias", PGC_USERSET, QUERY_TUNING_GEQO,
 			gettext_noop("GEQO: selective pressure within the population."),
@@ -4021,6 +4201,18 @@ static struct config_string ConfigureNamesString[] =
 		check_temp_tablespaces, assign_temp_tablespaces, NULL
 	},
 
+	{
+		{"io_direct", PGC_POSTMASTER, RESOURCES_DISK,
+			gettext_noop("Sets the kinds of files to access with direct I/O."),
+			gettext_noop("Valid values are combinations of \"data\" and \"wal\", "
+						 "or an empty string to disable direct I/O."),
+			GUC_LIST_INPUT
+		},
+		&io_direct_string,
+		"",
+		check_io_direct, assign_io_direct, NULL
+	},
+
 	{
 		{"dynamic_library_path", PGC_SUSET, CLIENT_CONN_OTHER,
 			gettext_noop("Sets the path for dynamically loadable modules."),
@@ -4856,6 +5048,26 @@ static struct config_enum ConfigureNamesEnum[] =
 		NULL, assign_xlog_sync_method, NULL
 	},
 
+	{
+		{"wal_compression", PGC_SUSET, WAL_SETTINGS,
+			gettext_noop("Compresses full-page writes written in WAL file with specified method."),
+			NULL
+		},
+		&wal_compression,
+		WAL_COMPRESSION_NONE, wal_compression_options,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"recovery_prefetch", PGC_SIGHUP, WAL_RECOVERY,
+			gettext_noop("Prefetches referenced blocks during recovery."),
+			gettext_noop("Looks ahead in the WAL to find references to uncached data.")
+		},
+		&recovery_prefetch,
+		RECOVERY_PREFETCH_TRY, recovery_prefetch_options,
+		check_recovery_prefetch, NULL, NULL
+	},
+
 	{
 		{"xmlbinary", PGC_USERSET, CLIENT_CONN_STATEMENT,
 			gettext_noop("Sets how binary values are to be encoded in XML."),
@@ -4887,6 +5099,16 @@ static struct config_enum ConfigureNamesEnum[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"numa_buffer_placement", PGC_POSTMASTER, RESOURCES_MEM,
+			gettext_noop("Sets how shared buffers are placed on NUMA nodes."),
+			NULL
+		},
+		&numa_buffer_placement,
+		NUMA_BUFFER_PLACEMENT_OFF, numa_buffer_placement_options,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"force_parallel_mode", PGC_USERSET, DEVELOPER_OPTIONS,
 			gettext_noop("Forces use of parallel query facilities."),
@@ -4954,6 +5176,15 @@ static struct config_enum ConfigureNamesEnum[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"io_method", PGC_POSTMASTER, RESOURCES_ASYNCHRONOUS,
+			gettext_noop("Selects the method used for asynchronous I/O."),
+		},
+		&io_method,
+		IO_METHOD_SYNC, io_method_options,
+		NULL, NULL, NULL
+	},
+
 	/* End-of-list marker */
 	{
 		{NULL, 0, 0, NULL, NULL}, NULL, 0, NULL, NULL, NULL, NULL
@@ -11708,6 +11939,69 @@ assign_log_destination(const char *newval, void *extra)
 	Log_destination = *((int *) extra);
 }
 
+static bool
+check_io_direct(char **newval, void **extra, GucSource source)
+{
+	char	   *rawstring;
+	List	   *elemlist;
+	ListCell   *l;
+	int			newflags = 0;
+	int		   *myextra;
+
+	/* Need a modifiable copy of string */
+	rawstring = pstrdup(*newval);
+
+	/* Parse string into list of identifiers */
+	if (!SplitIdentifierString(rawstring, ',', &elemlist))
+	{
+		/* syntax error in list */
+		GUC_check_errdetail("List syntax is invalid.");
+		pfree(rawstring);
+		list_free(elemlist);
+		return false;
+	}
+
+	foreach(l, elemlist)
+	{
+		char	   *tok = (char *) lfirst(l);
+
+		if (pg_strcasecmp(tok, "data") == 0)
+			newflags |= IO_DIRECT_DATA;
+		else if (pg_strcasecmp(tok, "wal") == 0)
+			newflags |= IO_DIRECT_WAL;
+		else
+		{
+			GUC_check_errdetail("Unrecognized key word: \"%s\".", tok);
+			pfree(rawstring);
+			list_free(elemlist);
+			return false;
+		}
+	}
+
+	pfree(rawstring);
+	list_free(elemlist);
+
+#if PG_O_DIRECT == 0
+	if (newflags != 0)
+	{
+		GUC_check_errdetail("Direct I/O is not supported on this platform.");
+		return false;
+	}
+#endif
+
+	myextra = (int *) guc_malloc(ERROR, sizeof(int));
+	*myextra = newflags;
+	*extra = (void *) myextra;
+
+	return true;
+}
+
+static void
+assign_io_direct(const char *newval, void *extra)
+{
+	io_direct_flags = *((int *) extra);
+}
+
 static void
 assign_syslog_facility(int newval, void *extra)
 {
@@ -25,6 +25,7 @@
 #include "storage/bufpage.h"
 #include "storage/dsm.h"
 #include "storage/lockdefs.h"
+#include "storage/read_stream.h"
 #include "storage/shm_toc.h"
 #include "utils/relcache.h"
 #include "utils/snapshot.h"
@@ -71,6 +72,15 @@ typedef struct HeapScanDescData
 	 */
 	ParallelBlockTableScanWorkerData *rs_parallelworkerdata;
 
+	/*
+	 * Look-ahead reads for serial sequential scans, set up by heapgetpage().
+	 * NULL when not in use.  rs_stream_nextblock and rs_stream_nblocksleft
+	 * track the blocks the stream has yet to ask for.
+	 */
+	ReadStream *rs_read_stream;
+	BlockNumber rs_stream_nextblock;
+	BlockNumber rs_stream_nblocksleft;
+
 	/* these fields only used in page-at-a-time mode and for bitmap scans */
 	int			rs_cindex;		/* current tuple's index in vistuples */
 	int			rs_ntuples;		/* number of visible tuples on page */
@@ -129,6 +139,9 @@ extern bool heap_getnextslot(TableScanDesc sscan,
 							 ScanDirection direction, struct TupleTableSlot *slot);
 extern void heap_set_tidrange(TableScanDesc sscan, ItemPointer mintid,
 							  ItemPointer maxtid);
+extern int	heap_getnextbatch(TableScanDesc sscan, int natts,
+							  Datum **values, bool **isnull,
+							  int row, int maxrows, Buffer *buffer);
 extern bool heap_getnextslot_tidrange(TableScanDesc sscan,
 									  ScanDirection direction,
 									  TupleTableSlot *slot);
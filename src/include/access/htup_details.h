@@ -804,6 +804,9 @@ extern HeapTuple heap_modify_tuple_by_cols(HeapTuple tuple,
 										   bool *replIsnull);
 extern void heap_deform_tuple(HeapTuple tuple, TupleDesc tupleDesc,
 							  Datum *values, bool *isnull);
+extern void heap_deform_tuples(TupleDesc tupleDesc, HeapTupleHeader *tuples,
+							   int ntuples, int natts,
+							   Datum **values, bool **isnull, int row);
 extern void heap_freetuple(HeapTuple htup);
 extern MinimalTuple heap_form_minimal_tuple(TupleDesc tupleDescriptor,
 											Datum *values, bool *isnull);
@@ -326,6 +326,15 @@ typedef struct TableAmRoutine
 									 ScanDirection direction,
 									 TupleTableSlot *slot);
 
+	/*
+	 * Optional function to fetch the next tuples of a forward scan in
+	 * columnar form.  See table_scan_getnextbatch() for details.
+	 */
+	int			(*scan_getnextbatch) (TableScanDesc scan, int natts,
+									  Datum **values, bool **isnull,
+									  int row, int maxrows,
+									  Buffer *buffer);
+
 	/*-----------
 	 * Optional functions to provide scanning for ranges of ItemPointers.
 	 * Implementations must either provide both of these functions, or neither
@@ -1044,6 +1053,37 @@ table_scan_getnextslot(TableScanDesc sscan, ScanDirection direction, TupleTableS
 	return sscan->rs_rd->rd_tableam->scan_getnextslot(sscan, direction, slot);
 }
 
+/*
+ * Fetch the next tuples of a forward scan, without going through a slot.
+ *
+ * The first natts attributes of each tuple are stored column by column:
+ * attribute attnum of the i'th tuple returned goes to values[attnum - 1][row
+ * + i] and isnull[attnum - 1][row + i].  Returns the number of tuples
+ * fetched, which is at most maxrows, or 0 at the end of the scan.
+ *
+ * Pass-by-reference values may point into a shared buffer, which is then
+ * returned in *buffer, else *buffer is set to InvalidBuffer.  The values are
+ * only guaranteed to remain valid until the next call on the scan, unless
+ * the caller acquires its own pin on that buffer.
+ *
+ * This is only supported if the AM provides the scan_getnextbatch callback.
+ */
+static inline int
+table_scan_getnextbatch(TableScanDesc sscan, int natts,
+						Datum **values, bool **isnull, int row, int maxrows,
+						Buffer *buffer)
+{
+	/* see table_scan_getnextslot() */
+	if (unlikely(TransactionIdIsValid(CheckXidAlive) && !bsysscan))
+		elog(ERROR, "unexpected table_scan_getnextbatch call during logical decoding");
+
+	Assert(sscan->rs_rd->rd_tableam->scan_getnextbatch != NULL);
+
+	return sscan->rs_rd->rd_tableam->scan_getnextbatch(sscan, natts,
+													   values, isnull,
+													   row, maxrows, buffer);
+}
+
 /* ----------------------------------------------------------------------------
  * TID Range scanning related functions.
  * ----------------------------------------------------------------------------
@@ -0,0 +1,59 @@
+/*-------------------------------------------------------------------------
+ *
+ * xlogprefetch.h
+ *		Declarations for the recovery prefetching module.
+ *
+ * Portions Copyright (c) 2021, PostgreSQL Global Development Group
+ *
+ * IDENTIFICATION
+ *		src/include/access/xlogprefetch.h
+ *-------------------------------------------------------------------------
+ */
+#ifndef XLOGPREFETCH_H
+#define XLOGPREFETCH_H
+
+#include "access/xlogdefs.h"
+#include "datatype/timestamp.h"
+
+/* Possible values for recovery_prefetch */
+typedef enum
+{
+	RECOVERY_PREFETCH_OFF,
+	RECOVERY_PREFETCH_ON,
+	RECOVERY_PREFETCH_TRY
+}			RecoveryPrefetchValue;
+
+/* GUCs */
+extern int	recovery_prefetch;
+extern int	recovery_prefetch_distance;
+
+/* A snapshot of the statistics shown in pg_stat_recovery_prefetch */
+typedef struct XLogPrefetchStatsData
+{
+	TimestampTz reset_time;		/* time of last reset */
+	int64		prefetch;		/* prefetches initiated */
+	int64		hit;			/* blocks already in shared buffers */
+	int64		skip_init;		/* blocks that redo will zero-initialize */
+	int64		skip_new;		/* blocks that don't exist yet */
+	int64		skip_fpw;		/* blocks restored from full page images */
+	int64		skip_rep;		/* repeated references to the same block */
+	int			wal_distance;	/* how far ahead of replay, in bytes */
+	int			io_depth;		/* prefetches replay hasn't reached yet */
+} XLogPrefetchStatsData;
+
+struct XLogPrefetcher;
+typedef struct XLogPrefetcher XLogPrefetcher;
+
+extern Size XLogPrefetchShmemSize(void);
+extern void XLogPrefetchShmemInit(void);
+
+extern void XLogPrefetchRequestReset(void);
+extern void XLogPrefetchGetStats(XLogPrefetchStatsData *stats);
+
+extern XLogPrefetcher *XLogPrefetcherAllocate(void);
+extern void XLogPrefetcherFree(XLogPrefetcher *prefetcher);
+extern void XLogPrefetcherReadAhead(XLogPrefetcher *prefetcher,
+									XLogRecPtr replaying_lsn,
+									XLogRecPtr next_lsn);
+
+#endif							/* XLOGPREFETCH_H */
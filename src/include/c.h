@@ -273,6 +273,17 @@
 #define unlikely(x) ((x) != 0)
 #endif
 
+/*
+ * Hint to the CPU that the memory at the given address will be read soon,
+ * so that it can start loading it into cache.  This is only worthwhile well
+ * ahead of the access, in code that would otherwise stall on cache misses.
+ */
+#if __GNUC__ >= 3
+#define pg_prefetch_mem(a)	__builtin_prefetch(a)
+#else
+#define pg_prefetch_mem(a)	((void) 0)
+#endif
+
 /*
  * CppAsString
  *		Convert the argument to a string, using the C preprocessor.
@@ -757,6 +768,7 @@ typedef NameData *Name;
 #define MAXALIGN(LEN)			TYPEALIGN(MAXIMUM_ALIGNOF, (LEN))
 /* MAXALIGN covers only built-in types, not buffers */
 #define BUFFERALIGN(LEN)		TYPEALIGN(ALIGNOF_BUFFER, (LEN))
+#define PG_IO_ALIGN(LEN)		TYPEALIGN(PG_IO_ALIGN_SIZE, (LEN))
 #define CACHELINEALIGN(LEN)		TYPEALIGN(PG_CACHE_LINE_SIZE, (LEN))
 
 #define TYPEALIGN_DOWN(ALIGNVAL,LEN)  \
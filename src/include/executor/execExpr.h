@@ -255,6 +255,27 @@ typedef enum ExprEvalOp
 	EEOP_AGG_ORDERED_TRANS_DATUM,
 	EEOP_AGG_ORDERED_TRANS_TUPLE,
 
+	/*
+	 * Steps operating on all selected rows of econtext->ecxt_batch at once.
+	 * Expressions containing these consist of nothing else but EEOP_DONE.
+	 */
+
+	/* filter the batch with a strict two-argument boolean function */
+	EEOP_BATCH_QUAL_OP,
+	/* filter the batch by comparing a column with a constant, vectorized */
+	EEOP_BATCH_QUAL_INT64,
+	EEOP_BATCH_QUAL_FLOAT8,
+	/* filter the batch with an arbitrary qual, one row at a time */
+	EEOP_BATCH_QUAL_ROWS,
+	/* advance a plain aggregate's transition value over the batch */
+	EEOP_BATCH_AGG_TRANS_BYVAL,
+	EEOP_BATCH_AGG_TRANS_BYREF,
+	/* the same for count(), and for sum/min/max of integers, vectorized */
+	EEOP_BATCH_AGG_COUNT,
+	EEOP_BATCH_AGG_SUM_INT64,
+	EEOP_BATCH_AGG_MIN_INT64,
+	EEOP_BATCH_AGG_MAX_INT64,
+
 	/* non-existent operation, used e.g. to check array lengths */
 	EEOP_LAST
 } ExprEvalOp;
@@ -667,6 +688,41 @@ typedef struct ExprEvalStep
 			int			transno;
 			int			setoff;
 		}			agg_trans;
+
+		/* for EEOP_BATCH_QUAL_OP */
+		struct
+		{
+			/* arguments not taken from a column are preset in fcinfo */
+			FunctionCallInfo fcinfo_data;
+			PGFunction	fn_addr;
+			int			lcol;		/* batch column of 1st argument, or -1 */
+			int			rcol;		/* batch column of 2nd argument, or -1 */
+		}			batch_qual_op;
+
+		/* for EEOP_BATCH_QUAL_{INT64,FLOAT8} */
+		struct
+		{
+			int			col;	/* batch column to compare */
+			int			cmp;	/* comparison, a BatchCmpOp */
+			Datum		constval;	/* constant to compare with */
+		}			batch_qual_const;
+
+		/* for EEOP_BATCH_QUAL_ROWS */
+		struct
+		{
+			ExprState  *qual;	/* evaluated with each row as scan tuple */
+			TupleTableSlot *slot;	/* virtual slot to put the rows in */
+			int			natts;	/* number of columns to copy to slot */
+		}			batch_qual_rows;
+
+		/* for EEOP_BATCH_AGG_* */
+		struct
+		{
+			AggStatePerTrans pertrans;
+			ExprContext *aggcontext;
+			int			transno;
+			int			col;	/* batch column of the argument, or -1 */
+		}			batch_agg_trans;
 	}			d;
 } ExprEvalStep;
 
@@ -779,4 +835,25 @@ extern void ExecEvalAggOrderedTransDatum(ExprState *state, ExprEvalStep *op,
 extern void ExecEvalAggOrderedTransTuple(ExprState *state, ExprEvalStep *op,
 										 ExprContext *econtext);
 
+extern void ExecEvalBatchQualOp(ExprState *state, ExprEvalStep *op,
+								ExprContext *econtext);
+extern void ExecEvalBatchQualInt64(ExprState *state, ExprEvalStep *op,
+								   ExprContext *econtext);
+extern void ExecEvalBatchQualFloat8(ExprState *state, ExprEvalStep *op,
+									ExprContext *econtext);
+extern void ExecEvalBatchQualRows(ExprState *state, ExprEvalStep *op,
+								  ExprContext *econtext);
+extern void ExecEvalBatchAggTransByVal(ExprState *state, ExprEvalStep *op,
+									   ExprContext *econtext);
+extern void ExecEvalBatchAggTransByRef(ExprState *state, ExprEvalStep *op,
+									   ExprContext *econtext);
+extern void ExecEvalBatchAggCount(ExprState *state, ExprEvalStep *op,
+								  ExprContext *econtext);
+extern void ExecEvalBatchAggSumInt64(ExprState *state, ExprEvalStep *op,
+									 ExprContext *econtext);
+extern void ExecEvalBatchAggMinInt64(ExprState *state, ExprEvalStep *op,
+									 ExprContext *econtext);
+extern void ExecEvalBatchAggMaxInt64(ExprState *state, ExprEvalStep *op,
+									 ExprContext *econtext);
+
 #endif							/* EXEC_EXPR_H */
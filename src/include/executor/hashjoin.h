@@ -110,6 +110,15 @@ typedef struct HashSkewBucket
 #define SKEW_HASH_MEM_PERCENT  2
 #define SKEW_MIN_OUTER_FRACTION  0.01
 
+/*
+ * A Bloom filter of the inner hash values, built for the outer scan, takes
+ * up to BLOOM_HASH_MEM_PERCENT of hash_mem.  Its space is counted in
+ * spaceUsed, so the table proper gets that much less.  In a Parallel Hash,
+ * that space is split between the participants' private filters and the
+ * shared copy they're merged into.
+ */
+#define BLOOM_HASH_MEM_PERCENT  5
+
 /*
  * To reduce palloc overhead, the HashJoinTuples for the current batch are
  * packed in 32kB buffers instead of pallocing each tuple individually.
@@ -243,6 +252,7 @@ typedef struct ParallelHashJoinState
 	int			nparticipants;
 	size_t		space_allowed;
 	size_t		total_tuples;	/* total number of inner tuples */
+	dsa_pointer bloom;			/* union of participants' Bloom filters */
 	LWLock		lock;			/* lock protecting the above */
 
 	Barrier		build_barrier;	/* synchronization for the build phases */
@@ -345,6 +355,12 @@ typedef struct HashJoinTableData
 	Size		spaceUsedSkew;	/* skew hash table's current space usage */
 	Size		spaceAllowedSkew;	/* upper limit for skew hashtable */
 
+	/*
+	 * Bloom filter of the hash values of all inner tuples, or NULL.  In a
+	 * Parallel Hash this points into the shared area once the table is built.
+	 */
+	struct bloom_filter *bloom;
+
 	MemoryContext hashCxt;		/* context for whole-hash-join storage */
 	MemoryContext batchCxt;		/* context for this-batch-only storage */
 
@@ -359,4 +375,29 @@ typedef struct HashJoinTableData
 	dsa_pointer current_chunk_shared;
 }			HashJoinTableData;
 
+/*
+ * State of a radix-partitioned probe of a private, single-batch hash table.
+ *
+ * Rather than probing the hash table with each outer tuple as it arrives, we
+ * read a block of outer tuples, partition them by the high-order bits of
+ * their bucket number, and then probe with one partition at a time.  Each
+ * partition covers a contiguous range of buckets, which (once the table has
+ * been clustered by ExecHashTableCluster) is a contiguous, cache-sized range
+ * of memory, so the probes of a partition hit the CPU cache rather than main
+ * memory.
+ */
+typedef struct HashJoinRadixState
+{
+	int			log2_npartitions;	/* number of partitions, as a power of 2 */
+	MemoryContext blockCxt;		/* holds the outer tuples of the block */
+	int			ntuples;		/* number of outer tuples in the block */
+	int			maxtuples;		/* allocated length of the arrays below */
+	int			next;			/* index into order[] of next tuple to probe */
+	MinimalTuple *tuples;		/* outer tuples, in arrival order */
+	uint32	   *hashvalues;		/* their hash values */
+	int		   *order;			/* indexes of tuples, sorted by partition */
+	int		   *counts;			/* per-partition counts for the sort */
+	bool		exhausted;		/* outer plan has returned its last tuple */
+} HashJoinRadixState;
+
 #endif							/* HASHJOIN_H */
@@ -24,6 +24,9 @@ extern void ExecAppendEstimate(AppendState *node, ParallelContext *pcxt);
 extern void ExecAppendInitializeDSM(AppendState *node, ParallelContext *pcxt);
 extern void ExecAppendReInitializeDSM(AppendState *node, ParallelContext *pcxt);
 extern void ExecAppendInitializeWorker(AppendState *node, ParallelWorkerContext *pwcxt);
+extern bool ExecAppendSupportsJoinPruning(AppendState *node);
+extern void ExecAppendSetJoinSubplans(AppendState *node, bool pruned,
+									  Bitmapset *subplans);
 
 extern void ExecAsyncAppendResponse(AsyncRequest *areq);
 
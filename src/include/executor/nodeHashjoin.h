@@ -18,6 +18,9 @@
 #include "nodes/execnodes.h"
 #include "storage/buffile.h"
 
+extern bool hashjoin_bloom_filter;
+extern bool hashjoin_radix_partitioning;
+
 extern HashJoinState *ExecInitHashJoin(HashJoin *node, EState *estate, int eflags);
 extern void ExecEndHashJoin(HashJoinState *node);
 extern void ExecReScanHashJoin(HashJoinState *node);
@@ -31,4 +34,10 @@ extern void ExecHashJoinInitializeWorker(HashJoinState *state,
 extern void ExecHashJoinSaveTuple(MinimalTuple tuple, uint32 hashvalue,
 								  BufFile **fileptr);
 
+extern bool ExecHashJoinBloomFilterCheck(HashJoinBloomFilter *filter,
+										 ExprContext *econtext);
+extern void ExecHashJoinCollectPruneValue(HashJoinPartitionPrune *prune,
+										  HashJoinTable hashtable,
+										  ExprContext *econtext);
+
 #endif							/* NODEHASHJOIN_H */
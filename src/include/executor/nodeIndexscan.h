@@ -30,8 +30,8 @@ extern void ExecIndexScanInitializeWorker(IndexScanState *node,
 										  ParallelWorkerContext *pwcxt);
 
 /*
- * These routines are exported to share code with nodeIndexonlyscan.c and
- * nodeBitmapIndexscan.c
+ * These routines are exported to share code with nodeIndexonlyscan.c,
+ * nodeBitmapIndexscan.c and nodeMergejoin.c
  */
 extern void ExecIndexBuildScanKeys(PlanState *planstate, Relation index,
 								   List *quals, bool isorderby,
@@ -43,5 +43,8 @@ extern void ExecIndexEvalRuntimeKeys(ExprContext *econtext,
 extern bool ExecIndexEvalArrayKeys(ExprContext *econtext,
 								   IndexArrayKeyInfo *arrayKeys, int numArrayKeys);
 extern bool ExecIndexAdvanceArrayKeys(IndexArrayKeyInfo *arrayKeys, int numArrayKeys);
+extern ScanKey ExecIndexAddLeadingScanKeys(ScanKey *scanKeys, int *numScanKeys,
+										   IndexRuntimeKeyInfo *runtimeKeys,
+										   int numRuntimeKeys, int nkeys);
 
 #endif							/* NODEINDEXSCAN_H */
@@ -14,10 +14,16 @@
 #ifndef NODEMERGEJOIN_H
 #define NODEMERGEJOIN_H
 
+#include "access/parallel.h"
 #include "nodes/execnodes.h"
 
 extern MergeJoinState *ExecInitMergeJoin(MergeJoin *node, EState *estate, int eflags);
 extern void ExecEndMergeJoin(MergeJoinState *node);
 extern void ExecReScanMergeJoin(MergeJoinState *node);
+extern void ExecMergeJoinEstimate(MergeJoinState *state, ParallelContext *pcxt);
+extern void ExecMergeJoinInitializeDSM(MergeJoinState *state, ParallelContext *pcxt);
+extern void ExecMergeJoinReInitializeDSM(MergeJoinState *state, ParallelContext *pcxt);
+extern void ExecMergeJoinInitializeWorker(MergeJoinState *state,
+										  ParallelWorkerContext *pwcxt);
 
 #endif							/* NODEMERGEJOIN_H */
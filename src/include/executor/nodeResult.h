@@ -21,5 +21,6 @@ extern void ExecEndResult(ResultState *node);
 extern void ExecResultMarkPos(ResultState *node);
 extern void ExecResultRestrPos(ResultState *node);
 extern void ExecReScanResult(ResultState *node);
+extern bool ExecResultEnableBatch(ResultState *node, int natts);
 
 #endif							/* NODERESULT_H */
@@ -20,6 +20,7 @@
 extern ResultCacheState *ExecInitResultCache(ResultCache *node, EState *estate, int eflags);
 extern void ExecEndResultCache(ResultCacheState *node);
 extern void ExecReScanResultCache(ResultCacheState *node);
+extern void ExecShutdownResultCache(ResultCacheState *node);
 extern double ExecEstimateCacheEntryOverheadBytes(double ntuples);
 extern void ExecResultCacheEstimate(ResultCacheState *node,
 									ParallelContext *pcxt);
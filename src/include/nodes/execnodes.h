@@ -35,6 +35,8 @@
 
 struct PlanState;				/* forward references in this file */
 struct ParallelHashJoinState;
+struct ParallelAggState;
+struct SharedTuplestoreAccessor;
 struct ExecRowMark;
 struct ExprState;
 struct ExprContext;
@@ -258,6 +260,9 @@ typedef struct ExprContext
 #define FIELDNO_EXPRCONTEXT_DOMAINNULL 13
 	bool		domainValue_isNull;
 
+	/* Batch of rows that EEOP_BATCH_* expression steps operate on */
+	struct TupleBatch *ecxt_batch;
+
 	/* Link to containing EState (NULL if a standalone ExprContext) */
 	struct EState *ecxt_estate;
 
@@ -952,6 +957,16 @@ typedef struct DomainConstraintState
  */
 typedef TupleTableSlot *(*ExecProcNodeMtd) (struct PlanState *pstate);
 
+/* ----------------
+ *	 ExecProcNodeBatchMtd
+ *
+ * This is the method called by ExecProcNodeBatch to return the next batch
+ * of rows from an executor node in batch mode.  It returns NULL if no more
+ * rows are available; a returned batch always has at least one row selected.
+ * ----------------
+ */
+typedef struct TupleBatch *(*ExecProcNodeBatchMtd) (struct PlanState *pstate);
+
 /* ----------------
  *		PlanState node
  *
@@ -972,6 +987,10 @@ typedef struct PlanState
 	ExecProcNodeMtd ExecProcNode;	/* function to return next tuple */
 	ExecProcNodeMtd ExecProcNodeReal;	/* actual function, if above is a
 										 * wrapper */
+	ExecProcNodeBatchMtd ExecProcNodeBatch; /* function to return next
+											 * batch, if in batch mode */
+	ExecProcNodeBatchMtd ExecProcNodeBatchReal; /* actual function, if above
+												 * is a wrapper */
 
 	Instrumentation *instrument;	/* Optional runtime stats for this node */
 	WorkerInstrumentation *worker_instrument;	/* per-worker instrumentation */
@@ -1077,6 +1096,11 @@ typedef struct PlanState
 		if (((PlanState *)(node))->instrument) \
 			((PlanState *)(node))->instrument->nfiltered2 += (delta); \
 	} while(0)
+#define InstrCountFiltered3(node, delta) \
+	do { \
+		if (((PlanState *)(node))->instrument) \
+			((PlanState *)(node))->instrument->nfiltered3 += (delta); \
+	} while(0)
 
 /*
  * EPQState is state for executing an EvalPlanQual recheck on a candidate
@@ -1159,6 +1183,8 @@ typedef struct ResultState
 	ExprState  *resconstantqual;
 	bool		rs_done;		/* are we done? */
 	bool		rs_checkqual;	/* do we need to check the qual? */
+	struct TupleBatch *rs_batch;	/* projected output, in batch mode */
+	int		   *rs_colmap;		/* input column of each output column */
 } ResultState;
 
 /* ----------------
@@ -1273,6 +1299,8 @@ struct AppendState
 	struct PartitionPruneState *as_prune_state;
 	Bitmapset  *as_valid_subplans;
 	Bitmapset  *as_valid_asyncplans;	/* valid asynchronous plans indexes */
+	bool		as_join_pruned; /* restricted by a join above? */
+	Bitmapset  *as_join_subplans;	/* if so, subplans the join still needs */
 	bool		(*choose_next_subplan) (AppendState *);
 };
 
@@ -1370,6 +1398,7 @@ typedef struct BitmapOrState
  *		currentRelation    relation being scanned (NULL if none)
  *		currentScanDesc    current scan descriptor for scan (NULL if none)
  *		ScanTupleSlot	   pointer to slot in tuple table holding scan tuple
+ *		BloomFilter		   filter installed by a Hash Join above (NULL if none)
  * ----------------
  */
 typedef struct ScanState
@@ -1378,6 +1407,7 @@ typedef struct ScanState
 	Relation	ss_currentRelation;
 	struct TableScanDescData *ss_currentScanDesc;
 	TupleTableSlot *ss_ScanTupleSlot;
+	struct HashJoinBloomFilter *ss_BloomFilter;
 } ScanState;
 
 /* ----------------
@@ -1388,6 +1418,15 @@ typedef struct SeqScanState
 {
 	ScanState	ss;				/* its first field is NodeTag */
 	Size		pscan_len;		/* size of parallel heap scan descriptor */
+
+	/* state for batch mode, see ExecSeqScanEnableBatch() */
+	struct TupleBatch *batch;	/* rows read from the relation */
+	struct TupleBatch *batch_result;	/* projected output, or NULL */
+	int		   *batch_colmap;	/* input column of each output column */
+	ExprState  *batch_qual;		/* qual evaluated over the batch */
+	bool		batch_done;		/* reached the end of the relation? */
+	int			batch_nbuffers; /* number of pages pinned for the batch */
+	Buffer	   *batch_buffers;	/* the pinned pages */
 } SeqScanState;
 
 /* ----------------
@@ -1914,14 +1953,26 @@ typedef struct JoinState
  *		NeedNewOuter	   true if need new outer tuple on next call
  *		MatchedOuter	   true if found a join match for current outer tuple
  *		NullInnerTupleSlot prepared null tuple for left outer joins
+ *		HashState		   state for switching to hashing the inner side
+ *						   (NULL if the join can't switch)
+ *		OuterRows		   number of outer tuples fetched so far
+ *		SwitchedAfter	   number of outer tuples fetched when the join
+ *						   tried to switch to hashing, or 0 if it hasn't
+ *		SwitchFailed	   true if the inner side didn't fit in memory
  * ----------------
  */
+typedef struct NestLoopHashStateData *NestLoopHashState;
+
 typedef struct NestLoopState
 {
 	JoinState	js;				/* its first field is NodeTag */
 	bool		nl_NeedNewOuter;
 	bool		nl_MatchedOuter;
 	TupleTableSlot *nl_NullInnerTupleSlot;
+	NestLoopHashState nl_HashState;
+	double		nl_OuterRows;
+	double		nl_SwitchedAfter;
+	bool		nl_SwitchFailed;
 } NestLoopState;
 
 /* ----------------
@@ -1944,10 +1995,12 @@ typedef struct NestLoopState
  *		NullInnerTupleSlot prepared null tuple for left outer joins
  *		OuterEContext	   workspace for computing outer tuple's join values
  *		InnerEContext	   workspace for computing inner tuple's join values
+ *		RangeState		   key ranges of a parallel-aware join, else NULL
  * ----------------
  */
 /* private in nodeMergejoin.c: */
 typedef struct MergeJoinClauseData *MergeJoinClause;
+typedef struct MergeJoinRangeStateData *MergeJoinRangeState;
 
 typedef struct MergeJoinState
 {
@@ -1969,6 +2022,7 @@ typedef struct MergeJoinState
 	TupleTableSlot *mj_NullInnerTupleSlot;
 	ExprContext *mj_OuterEContext;
 	ExprContext *mj_InnerEContext;
+	MergeJoinRangeState mj_RangeState;
 } MergeJoinState;
 
 /* ----------------
@@ -1994,6 +2048,11 @@ typedef struct MergeJoinState
  *		hj_JoinState			current state of ExecHashJoin state machine
  *		hj_MatchedOuter			true if found a join match for current outer
  *		hj_OuterNotEmpty		true if outer relation known not empty
+ *		hj_BloomFilter			filter for the outer scan (NULL if none)
+ *		hj_RadixState			state of radix-partitioned probing
+ *								(NULL if not probing that way)
+ *		hj_PartitionPrune		state for pruning the outer Append by the
+ *								inner key values (NULL if none)
  * ----------------
  */
 
@@ -2021,8 +2080,84 @@ typedef struct HashJoinState
 	int			hj_JoinState;
 	bool		hj_MatchedOuter;
 	bool		hj_OuterNotEmpty;
+	struct HashJoinBloomFilter *hj_BloomFilter;
+	struct HashJoinRadixState *hj_RadixState;
+	struct HashJoinPartitionPrune *hj_PartitionPrune;
 } HashJoinState;
 
+/* ----------------
+ *	 HashJoinBloomFilter information
+ *
+ *		A Hash Join whose outer input is a relation scan hands the scan a
+ *		Bloom filter of the hash values in its hash table once that has been
+ *		built, so that the scan can discard rows that cannot find a join
+ *		partner after they are qualified but before they are projected
+ *		and passed up.
+ *
+ *		scan					the outer scan
+ *		hashkeys				outer hash keys, in terms of the scan tuple
+ *		hashtable				hash table holding the filter (NULL if
+ *								the filter is not installed)
+ *		nchecked				number of rows checked against the filter
+ *		nremoved				number of rows discarded by it
+ *		disabled				true if the filter doesn't pay off
+ * ----------------
+ */
+typedef struct HashJoinBloomFilter
+{
+	ScanState  *scan;
+	List	   *hashkeys;		/* list of ExprState nodes */
+	HashJoinTable hashtable;
+	uint64		nchecked;
+	uint64		nremoved;
+	bool		disabled;
+} HashJoinBloomFilter;
+
+/* ----------------
+ *	 HashJoinPartitionPrune information
+ *
+ *		A Hash Join whose outer input is an Append over the partitions of a
+ *		table partitioned on one of the join keys collects the distinct
+ *		values of the matching inner key while building its hash table, and
+ *		then tells the Append to skip the partitions that can't hold any of
+ *		them.
+ *
+ *		append					the outer Append
+ *		prunestate				pruning state built from the plan's
+ *								part_prune_info
+ *		keyexpr					the inner key, evaluated in the Hash node
+ *		keyno					its index among the hash keys
+ *		paramid					PARAM_EXEC param standing for it in the
+ *								pruning steps
+ *		valuecxt				memory context holding the values
+ *		values					open-addressing hash set of the values
+ *		nvalues					number of values in the set
+ *		overflowed				true if there were too many values to
+ *								bother pruning
+ * ----------------
+ */
+typedef struct HashJoinPruneValue
+{
+	Datum		value;
+	uint32		hash;
+	bool		used;
+} HashJoinPruneValue;
+
+typedef struct HashJoinPartitionPrune
+{
+	struct AppendState *append;
+	struct PartitionPruneState *prunestate;
+	ExprState  *keyexpr;
+	int			keyno;
+	int			paramid;
+	int16		typlen;			/* type of the key values */
+	bool		typbyval;
+	MemoryContext valuecxt;
+	HashJoinPruneValue *values;
+	int			nvalues;
+	bool		overflowed;
+} HashJoinPartitionPrune;
+
 
 /* ----------------------------------------------------------------
  *				 Materialization State Information
@@ -2049,6 +2184,8 @@ typedef struct MaterialState
 struct ResultCacheEntry;
 struct ResultCacheTuple;
 struct ResultCacheKey;
+struct ParallelResultCacheState;
+struct dshash_table;
 
 typedef struct ResultCacheInstrumentation
 {
@@ -2110,6 +2247,17 @@ typedef struct ResultCacheState
 								 * complete after caching the first tuple. */
 	ResultCacheInstrumentation stats;	/* execution statistics */
 	SharedResultCacheInfo *shared_info; /* statistics for parallel workers */
+
+	/* Shared cache, used instead of 'hashtable' in parallel queries */
+	struct ParallelResultCacheState *pstate;	/* shared state, or NULL */
+	dsa_area   *area;			/* area holding the shared cache */
+	struct dshash_table *shared_hashtable;	/* shared cache entries, or NULL
+											 * when using the local cache */
+	dsa_pointer shared_params;	/* key of the entry we're filling, not yet
+								 * visible to other processes */
+	dsa_pointer shared_tuplehead;	/* first tuple of the entry we're filling */
+	dsa_pointer shared_last_tuple;	/* like 'last_tuple', for the shared
+									 * cache */
 } ResultCacheState;
 
 /* ----------------
@@ -2345,6 +2493,12 @@ typedef struct AggState
 										 * ->hash_pergroup */
 	ProjectionInfo *combinedproj;	/* projection machinery */
 	SharedAggInfo *shared_info; /* one entry per worker */
+	ExprState  *batch_evaltrans;	/* transition expression used when reading
+									 * the input in batches, else NULL */
+	struct ParallelAggState *parallel_state;	/* shared state of a Parallel
+												 * HashAgg, else NULL */
+	struct SharedTuplestoreAccessor **hash_partitions;	/* shared input
+														 * partitions */
 } AggState;
 
 /* ----------------
@@ -2551,6 +2705,12 @@ typedef struct HashState
 	 */
 	HashInstrumentation *hinstrument;
 
+	/* Build a Bloom filter of the hash values along with the table? */
+	bool		build_bloom_filter;
+
+	/* Collect inner key values for our parent's partition pruning, or NULL */
+	struct HashJoinPartitionPrune *partition_prune;
+
 	/* Parallel hash state. */
 	struct ParallelHashJoinState *parallel_state;
 } HashState;
@@ -129,6 +129,10 @@ typedef struct PlannerGlobal
 	char		maxParallelHazard;	/* worst PROPARALLEL hazard level */
 
 	PartitionDirectory partition_directory; /* partition descriptors */
+
+	double		joinOrderTime;	/* msec spent ordering rels for linear DP */
+
+	double		joinSearchTime; /* msec spent in join searches, in total */
 } PlannerGlobal;
 
 /* macro for fetching the Plan associated with a SubPlan node */
@@ -562,6 +566,9 @@ typedef struct PartitionSchemeData *PartitionScheme;
  *					clauses at a single tuple (only used for base rels)
  *		baserestrict_min_security - Smallest security_level found among
  *					clauses in baserestrictinfo
+ *		feedback_key - Key under which the rows returned by scans of this
+ *					relation are recorded for cardinality feedback, or 0
+ *					(only used for base rels)
  *		joininfo  - List of RestrictInfo nodes, containing info about each
  *					join clause in which this relation participates (but
  *					note this excludes clauses that might be derivable from
@@ -610,6 +617,7 @@ typedef struct PartitionSchemeData *PartitionScheme;
  *		partbounds_merged - true if partition bounds are merged ones
  *		partition_qual - Partition constraint if not the root
  *		part_rels - RelOptInfos for each partition
+ *		live_parts - Indexes of the part_rels entries that are set
  *		all_partrels - Relids set of all partition relids
  *		partexprs, nullable_partexprs - Partition key expressions
  *
@@ -741,6 +749,7 @@ typedef struct RelOptInfo
 	QualCost	baserestrictcost;	/* cost of evaluating the above */
 	Index		baserestrict_min_security;	/* min security_level found in
 											 * baserestrictinfo */
+	uint64		feedback_key;	/* cardinality feedback key, or 0 */
 	List	   *joininfo;		/* RestrictInfo structures for join clauses
 								 * involving this rel */
 	bool		has_eclass_joins;	/* T means joininfo is incomplete */
@@ -762,6 +771,8 @@ typedef struct RelOptInfo
 	List	   *partition_qual; /* Partition constraint, if not the root */
 	struct RelOptInfo **part_rels;	/* Array of RelOptInfos of partitions,
 									 * stored in the same order as bounds */
+	Bitmapset  *live_parts;		/* Indexes into part_rels[] of partitions
+								 * that survived partition pruning */
 	Relids		all_partrels;	/* Relids set of all partition relids */
 	List	  **partexprs;		/* Non-nullable partition key expressions */
 	List	  **nullable_partexprs; /* Nullable partition key expressions */
@@ -1630,6 +1641,11 @@ typedef JoinPath NestPath;
  *
  * materialize_inner is true if a Material node should be placed atop the
  * inner input.  This may appear with or without an inner Sort step.
+ *
+ * range_bounds is non-NIL for a parallel-aware merge join of two btree index
+ * scans.  It lists Consts that split the leading merge key into ranges; the
+ * participants claim the ranges one at a time and join the matching ranges
+ * of both index scans.
  */
 
 typedef struct MergePath
@@ -1640,6 +1656,7 @@ typedef struct MergePath
 	List	   *innersortkeys;	/* keys for explicit sort, if any */
 	bool		skip_mark_restore;	/* can executor skip mark/restore? */
 	bool		materialize_inner;	/* add Materialize to inner? */
+	List	   *range_bounds;	/* key range boundaries, if parallel-aware */
 } MergePath;
 
 /*
@@ -88,6 +88,10 @@ typedef struct PlannedStmt
 	/* statement location in source string (copied from Query) */
 	int			stmt_location;	/* start location, or -1 if unknown */
 	int			stmt_len;		/* length in bytes; 0 means "rest of string" */
+
+	/* time spent on join searches, for EXPLAIN (copied from PlannerGlobal) */
+	double		joinOrderTime;	/* msec spent ordering rels for linear DP */
+	double		joinSearchTime; /* msec spent in join searches, in total */
 } PlannedStmt;
 
 /* macro for fetching the Plan associated with a SubPlan node */
@@ -342,6 +346,8 @@ typedef struct Scan
 {
 	Plan		plan;
 	Index		scanrelid;		/* relid is index into the range table */
+	uint64		feedback_key;	/* cardinality feedback key, or 0 */
+	double		feedback_tuples;	/* rel's tuple count when planned */
 } Scan;
 
 /* ----------------
@@ -715,12 +721,23 @@ typedef struct Join
  * Vars, but perhaps someday that'd be worth relaxing.  (Note: during plan
  * creation, the paramval can actually be a PlaceHolderVar expression; but it
  * must be a Var with varno OUTER_VAR by the time it gets to the executor.)
+ *
+ * If the inner subplan doesn't depend on the outer row, and some of the join
+ * clauses are hashable, the executor may switch to hashing the inner side
+ * when the outer side turns out to return many more rows than estimated.
+ * hashoperators, hashcollations, outerhashkeys and innerhashkeys describe
+ * those clauses, in the same way as for a HashJoin; they're NIL if the join
+ * can't switch.
  * ----------------
  */
 typedef struct NestLoop
 {
 	Join		join;
 	List	   *nestParams;		/* list of NestLoopParam nodes */
+	List	   *hashoperators;	/* operators of hashable join clauses */
+	List	   *hashcollations; /* their input collations */
+	List	   *outerhashkeys;	/* outer-side arguments of the clauses */
+	List	   *innerhashkeys;	/* inner-side arguments of the clauses */
 } NestLoop;
 
 typedef struct NestLoopParam
@@ -739,6 +756,12 @@ typedef struct NestLoopParam
  * of each mergeclause may be of different datatypes, but they are ordered the
  * same way according to the common opfamily and collation.  The operator in
  * each mergeclause must be an equality operator of the indicated opfamily.
+ *
+ * In a parallel-aware merge join, both inputs are btree index scans whose
+ * first column is the leading merge key.  rangeBounds is a list of Consts,
+ * in ascending order according to rangeFamily and rangeCollation, that split
+ * that key into list_length(rangeBounds) + 1 ranges.  Each participant joins
+ * whole ranges, restricting both index scans to the range it has claimed.
  * ----------------
  */
 typedef struct MergeJoin
@@ -751,6 +774,9 @@ typedef struct MergeJoin
 	Oid		   *mergeCollations;	/* per-clause OIDs of collations */
 	int		   *mergeStrategies;	/* per-clause ordering (ASC or DESC) */
 	bool	   *mergeNullsFirst;	/* per-clause nulls ordering */
+	List	   *rangeBounds;	/* key range boundaries, if parallel-aware */
+	Oid			rangeFamily;	/* btree opfamily ordering the boundaries */
+	Oid			rangeCollation; /* collation ordering the boundaries */
 } MergeJoin;
 
 /* ----------------
@@ -769,6 +795,15 @@ typedef struct HashJoin
 	 * perform lookups in the hashtable over the inner plan.
 	 */
 	List	   *hashkeys;
+
+	/*
+	 * Info for pruning the subplans of an outer Append by the values of one
+	 * of the inner hash keys, or NULL.  The pruning steps refer to a
+	 * PARAM_EXEC Param that the join sets to each distinct inner value.
+	 */
+	struct PartitionPruneInfo *part_prune_info;
+	int			part_prune_keyno;	/* index of the hash key in hashkeys */
+	int			part_prune_paramid; /* ID of the Param standing for it */
 } HashJoin;
 
 /* ----------------
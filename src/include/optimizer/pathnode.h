@@ -169,6 +169,17 @@ extern MergePath *create_mergejoin_path(PlannerInfo *root,
 										List *mergeclauses,
 										List *outersortkeys,
 										List *innersortkeys);
+extern MergePath *create_parallel_mergejoin_path(PlannerInfo *root,
+													RelOptInfo *joinrel,
+													JoinType jointype,
+													JoinCostWorkspace *workspace,
+													JoinPathExtraData *extra,
+													Path *outer_path,
+													Path *inner_path,
+													List *restrict_clauses,
+													List *mergeclauses,
+													List *range_bounds,
+													int parallel_workers);
 
 extern HashPath *create_hashjoin_path(PlannerInfo *root,
 									  RelOptInfo *joinrel,
@@ -226,6 +237,14 @@ extern AggPath *create_agg_path(PlannerInfo *root,
 								List *qual,
 								const AggClauseCosts *aggcosts,
 								double numGroups);
+extern AggPath *create_parallel_agg_path(PlannerInfo *root,
+										 RelOptInfo *rel,
+										 Path *subpath,
+										 PathTarget *target,
+										 List *groupClause,
+										 List *qual,
+										 const AggClauseCosts *aggcosts,
+										 double numGroups);
 extern GroupingSetsPath *create_groupingsets_path(PlannerInfo *root,
 												  RelOptInfo *rel,
 												  Path *subpath,
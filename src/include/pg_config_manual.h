@@ -265,6 +265,14 @@
  */
 #define PG_CACHE_LINE_SIZE		128
 
+/*
+ * Assumed alignment requirement for direct I/O.  Buffers used for reads and
+ * writes of files opened with O_DIRECT, as well as the file offsets and
+ * transfer sizes, must be multiples of this.  4096 is enough for common
+ * filesystems and devices.
+ */
+#define PG_IO_ALIGN_SIZE		4096
+
 /*
  *------------------------------------------------------------------------
  * The following symbols are for enabling debugging code, not for
@@ -1032,6 +1032,11 @@ extern void pgstat_initstats(Relation rel);
 		if ((rel)->pgstat_info != NULL)								\
 			(rel)->pgstat_info->t_counts.t_tuples_returned++;		\
 	} while (0)
+#define pgstat_count_heap_getnext_n(rel, n)							\
+	do {															\
+		if ((rel)->pgstat_info != NULL)								\
+			(rel)->pgstat_info->t_counts.t_tuples_returned += (n);	\
+	} while (0)
 #define pgstat_count_heap_fetch(rel)								\
 	do {															\
 		if ((rel)->pgstat_info != NULL)								\
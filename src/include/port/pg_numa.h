@@ -0,0 +1,27 @@
+/*-------------------------------------------------------------------------
+ *
+ * pg_numa.h
+ *	  Placement of shared memory on NUMA nodes.
+ *
+ * Nodes are identified by their index among the nodes that have memory,
+ * numbered from 0 to pg_numa_num_nodes() - 1, which need not match the
+ * kernel's node numbers.  Without NUMA support (see --with-libnuma), there
+ * is a single node and the memory placement functions do nothing.
+ *
+ * Portions Copyright (c) 1996-2021, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * src/include/port/pg_numa.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef PG_NUMA_H
+#define PG_NUMA_H
+
+extern bool pg_numa_available(void);
+extern int	pg_numa_num_nodes(void);
+extern int	pg_numa_current_node(void);
+extern void pg_numa_interleave_memory(void *ptr, Size size);
+extern void pg_numa_prefer_node(void *ptr, Size size, int node);
+
+#endif							/* PG_NUMA_H */
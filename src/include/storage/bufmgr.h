@@ -55,6 +55,14 @@ typedef struct PrefetchBufferResult
 	bool		initiated_io;	/* If true, a miss resulting in async I/O */
 } PrefetchBufferResult;
 
+/* Possible values for numa_buffer_placement */
+typedef enum NumaBufferPlacement
+{
+	NUMA_BUFFER_PLACEMENT_OFF,	/* leave it to the kernel */
+	NUMA_BUFFER_PLACEMENT_INTERLEAVE,	/* spread pages over all nodes */
+	NUMA_BUFFER_PLACEMENT_PARTITION /* give each node a range of buffers */
+}			NumaBufferPlacement;
+
 /* forward declared, to avoid having to expose buf_internals.h here */
 struct WritebackContext;
 
@@ -78,6 +86,7 @@ extern int	bgwriter_flush_after;
 
 /* in buf_init.c */
 extern PGDLLIMPORT char *BufferBlocks;
+extern int	numa_buffer_placement;
 
 /* in localbuf.c */
 extern PGDLLIMPORT int NLocBuffer;
@@ -87,6 +96,32 @@ extern PGDLLIMPORT int32 *LocalRefCount;
 /* upper limit for effective_io_concurrency */
 #define MAX_IO_CONCURRENCY 1000
 
+/* maximum number of blocks ReadBufferRange() can read with one call */
+#define MAX_BUFFERS_PER_TRANSFER 16
+
+/* maximum number of StartReadBufferRange() reads a backend can have going */
+#define MAX_ASYNC_READ_RANGES 4
+
+/*
+ * State of a multi-block read started by StartReadBufferRange().  Each run
+ * of blocks that weren't already cached is read by a separate smgr I/O.
+ */
+typedef struct ReadBufferRangeIO
+{
+	Relation	rel;
+	ForkNumber	forknum;
+	BlockNumber blocknum;		/* first block of the range */
+	int			nblocks;		/* number of blocks in the range */
+	Buffer		buffers[MAX_BUFFERS_PER_TRANSFER];	/* all pinned */
+	int			nruns;			/* number of reads not yet waited for */
+	struct
+	{
+		int			first;		/* index of first buffer of the run */
+		int			nblocks;	/* number of buffers in the run */
+		int			handle;		/* smgr I/O handle */
+	}			runs[MAX_BUFFERS_PER_TRANSFER];
+} ReadBufferRangeIO;
+
 /* special block number for ReadBuffer() */
 #define P_NEW	InvalidBlockNumber	/* grow the file to get a new page */
 
@@ -182,6 +217,15 @@ extern Buffer ReadBuffer(Relation reln, BlockNumber blockNum);
 extern Buffer ReadBufferExtended(Relation reln, ForkNumber forkNum,
 								 BlockNumber blockNum, ReadBufferMode mode,
 								 BufferAccessStrategy strategy);
+extern void ReadBufferRange(Relation reln, ForkNumber forkNum,
+							BlockNumber blockNum, int nblocks,
+							BufferAccessStrategy strategy, Buffer *buffers);
+extern bool CanStartReadBufferRange(void);
+extern void StartReadBufferRange(ReadBufferRangeIO *io, Relation reln,
+								 ForkNumber forkNum, BlockNumber blockNum,
+								 int nblocks, BufferAccessStrategy strategy);
+extern void SubmitReadBufferRanges(void);
+extern void WaitReadBufferRange(ReadBufferRangeIO *io);
 extern Buffer ReadBufferWithoutRelcache(RelFileNode rnode,
 										ForkNumber forkNum, BlockNumber blockNum,
 										ReadBufferMode mode, BufferAccessStrategy strategy);
@@ -32,8 +32,19 @@ extern bool mdprefetch(SMgrRelation reln, ForkNumber forknum,
 					   BlockNumber blocknum);
 extern void mdread(SMgrRelation reln, ForkNumber forknum, BlockNumber blocknum,
 				   char *buffer);
+extern void mdreadv(SMgrRelation reln, ForkNumber forknum, BlockNumber blocknum,
+					char **buffers, BlockNumber nblocks);
+extern int	mdstartreadv(SMgrRelation reln, ForkNumber forknum,
+						 BlockNumber blocknum, char **buffers,
+						 BlockNumber nblocks);
+extern void mdwaitreadv(SMgrRelation reln, ForkNumber forknum,
+						BlockNumber blocknum, char **buffers,
+						BlockNumber nblocks, int handle);
 extern void mdwrite(SMgrRelation reln, ForkNumber forknum,
 					BlockNumber blocknum, char *buffer, bool skipFsync);
+extern void mdwritev(SMgrRelation reln, ForkNumber forknum,
+					 BlockNumber blocknum, char **buffers,
+					 BlockNumber nblocks, bool skipFsync);
 extern void mdwriteback(SMgrRelation reln, ForkNumber forknum,
 						BlockNumber blocknum, BlockNumber nblocks);
 extern BlockNumber mdnblocks(SMgrRelation reln, ForkNumber forknum);
@@ -69,6 +69,7 @@ extern HANDLE UsedShmemSegID;
 extern void *ShmemProtectiveRegion;
 #endif
 extern void *UsedShmemSegAddr;
+extern Size UsedShmemPageSize;	/* set only in the creating process */
 
 #if !defined(WIN32) && !defined(EXEC_BACKEND)
 #define DEFAULT_SHARED_MEMORY_TYPE SHMEM_TYPE_MMAP
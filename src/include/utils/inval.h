@@ -30,6 +30,8 @@ extern void AtEOXact_Inval(bool isCommit);
 
 extern void AtEOSubXact_Inval(bool isCommit);
 
+extern bool TransactionHasInvalidations(void);
+
 extern void PostPrepare_Inval(void);
 
 extern void CommandEndInvalidationMessages(void);
@@ -0,0 +1,105 @@
+# Copyright (c) 2021, PostgreSQL Global Development Group
+
+# Verify that sessions share generic plans through the shared plan cache,
+# and that ALTER TABLE removes the shared plans of the table
+
+use strict;
+use warnings;
+use PostgresNode;
+use TestLib;
+use Test::More tests => 10;
+
+# shared_plan_cache_size can only be set at server start
+my $node = get_new_node('primary');
+$node->init();
+$node->append_conf(
+	'postgresql.conf', qq{
+shared_plan_cache_size = 1MB
+plan_cache_mode = force_generic_plan
+});
+$node->start;
+
+$node->safe_psql(
+	'postgres', q{
+	create table spc (a int primary key, b text);
+	insert into spc select g, 'b' || g from generate_series(1, 1000) g;
+	analyze spc;
+});
+
+# Prepare and run a statement in a new session.  Planner settings are not
+# part of the key of a shared plan, so a session that disables index scans
+# tells us from the plan it gets whether it planned the statement itself.
+sub run_statement
+{
+	my ($settings) = @_;
+
+	return $node->safe_psql(
+		'postgres', qq{
+	$settings
+	prepare q(int) as select * from spc where a = \$1;
+	explain (costs off) execute q(1);
+	execute q(1);
+});
+}
+
+my $noindex = 'set enable_indexscan = off; set enable_bitmapscan = off;';
+my $output;
+
+$output = run_statement($noindex);
+like($output, qr/Seq Scan on spc/, 'first session plans a seq scan');
+
+# A second session uses the plan of the first, although it would choose an
+# index scan itself
+$output = run_statement('');
+like($output, qr/Seq Scan on spc/, 'second session gets the shared plan');
+like($output, qr/^1\|b1$/m, 'shared plan returns the right row');
+
+# ALTER TABLE in yet another session removes the shared plan
+$node->safe_psql('postgres', 'alter table spc add column c int default 7');
+
+$output = run_statement('');
+like($output, qr/Index Scan using spc_pkey on spc/,
+	'plan is rebuilt after ALTER TABLE');
+like($output, qr/^1\|b1\|7$/m, 'rebuilt plan returns the new column');
+
+# and the rebuilt plan is shared again
+$output = run_statement($noindex);
+like($output, qr/Index Scan using spc_pkey on spc/,
+	'rebuilt plan is shared');
+like($output, qr/^1\|b1\|7$/m, 'rebuilt shared plan returns the new column');
+
+# Plans of another role are not shared
+$node->safe_psql(
+	'postgres', q{
+	create role spc_other;
+	grant select on spc to spc_other;
+});
+$output = run_statement("set role spc_other; $noindex");
+like($output, qr/Seq Scan on spc/, 'plans are not shared between roles');
+
+# The same query text means different things under different DateStyles, so
+# those sessions must not share plans
+$node->safe_psql(
+	'postgres', q{
+	create table spc_dates (d date);
+	insert into spc_dates
+		select date '2021-01-01' + g from generate_series(0, 364) g;
+	analyze spc_dates;
+});
+
+sub count_dates
+{
+	my ($datestyle) = @_;
+
+	return $node->safe_psql(
+		'postgres', qq{
+	set datestyle = '$datestyle';
+	prepare d as select count(*) from spc_dates where d > '01/02/2021';
+	execute d;
+});
+}
+
+is(count_dates('ISO, MDY'), '363', 'date constant read as month first');
+is(count_dates('ISO, DMY'), '333', 'date constant read as day first');
+
+$node->stop;
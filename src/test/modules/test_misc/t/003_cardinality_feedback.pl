@@ -0,0 +1,105 @@
+# Copyright (c) 2021, PostgreSQL Global Development Group
+
+# Verify that the planner uses the row counts observed by EXPLAIN ANALYZE
+# for scans with correlated predicates
+
+use strict;
+use warnings;
+use PostgresNode;
+use TestLib;
+use Test::More tests => 13;
+
+# cardinality_feedback_entries can only be set at server start
+my $node = get_new_node('primary');
+$node->init();
+$node->append_conf('postgresql.conf', 'cardinality_feedback_entries = 100');
+$node->start;
+
+# a and b are equal in every row, so the planner underestimates rows that
+# match predicates on both of them
+$node->safe_psql(
+	'postgres', q{
+	create table cf_row (a int, b int);
+	create table cf_batch (a int, b int);
+	create table cf_bloom (a int, b int);
+	insert into cf_row select g % 100, g % 100 from generate_series(1, 10000) g;
+	insert into cf_batch select * from cf_row;
+	insert into cf_bloom select * from cf_row;
+	create table cf_keys (x int);
+	insert into cf_keys select g from generate_series(0, 9) g;
+	analyze cf_row, cf_batch, cf_bloom, cf_keys;
+});
+
+# Return the row estimate of the scan of the given table
+sub estimate
+{
+	my ($table, $quals) = @_;
+
+	my $output =
+	  $node->safe_psql('postgres', "explain select * from $table where $quals");
+	$output =~ /Seq Scan on $table  \(cost=[\d.]+\.\.[\d.]+ rows=(\d+) /
+	  or die "unexpected plan: $output";
+	return $1;
+}
+
+my $output;
+
+is(estimate('cf_row', 'a = 1 and b = 1'), 1, 'row mode scan estimate');
+is(estimate('cf_batch', 'a = 1 and b = 1'), 1, 'batch mode scan estimate');
+is(estimate('cf_bloom', 'a < 50 and b < 50'),
+	2500, 'Bloom-filtered scan estimate');
+
+# Plain EXPLAIN does not execute the query and records nothing
+$node->safe_psql('postgres',
+	'explain select * from cf_row where a = 1 and b = 1');
+is(estimate('cf_row', 'a = 1 and b = 1'), 1, 'EXPLAIN records nothing');
+
+$node->safe_psql('postgres',
+	'explain analyze select * from cf_row where a = 1 and b = 1');
+is(estimate('cf_row', 'a = 1 and b = 1'),
+	100, 'row mode scan count is used');
+
+$output = $node->safe_psql(
+	'postgres', q{
+	set batch_execution = on;
+	explain analyze select count(*) from cf_batch where a = 1 and b = 1;
+});
+like($output, qr/Batch Mode: true/, 'scan runs in batch mode');
+is(estimate('cf_batch', 'a = 1 and b = 1'),
+	100, 'batch mode scan count is used');
+
+# The hash join's Bloom filter removes 4000 of the 5000 rows that pass the
+# scan's quals; those still count towards the quals' selectivity
+$output = $node->safe_psql(
+	'postgres', q{
+	set enable_nestloop = off;
+	set enable_mergejoin = off;
+	explain analyze select count(*) from cf_bloom join cf_keys on a = x
+		where a < 50 and b < 50;
+});
+like(
+	$output,
+	qr/Rows Removed by Bloom Filter: 4000/,
+	'Bloom filter removes rows from the scan');
+is(estimate('cf_bloom', 'a < 50 and b < 50'),
+	5000, 'Bloom-filtered scan count is used');
+
+# A checkpoint saves the observations, and they are loaded at server start.
+# Stop in immediate mode, so that only the checkpoint can have saved them.
+$node->safe_psql('postgres', 'checkpoint');
+$node->stop('immediate');
+$node->start;
+
+is(estimate('cf_row', 'a = 1 and b = 1'),
+	100, 'row mode scan count survives a crash restart');
+is(estimate('cf_bloom', 'a < 50 and b < 50'),
+	5000, 'Bloom-filtered scan count survives a crash restart');
+
+$node->restart;
+
+is(estimate('cf_row', 'a = 1 and b = 1'),
+	100, 'row mode scan count survives a clean restart');
+is(estimate('cf_batch', 'a = 1 and b = 1'),
+	100, 'batch mode scan count survives a clean restart');
+
+$node->stop;
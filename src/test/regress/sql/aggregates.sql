@@ -1234,3 +1234,48 @@ drop table agg_hash_1;
 drop table agg_hash_2;
 drop table agg_hash_3;
 drop table agg_hash_4;
+
+--
+-- Test plain aggregation with the input read in batches
+--
+create temp table batch_t as
+  select i, case when i % 3 = 0 then null else i end as x,
+         (case when i % 3 = 0 then null else i end)::text as t,
+         case when i = 7 then 'NaN'::float8 else i / 4.0::float8 end as f
+  from generate_series(1, 1000) i;
+
+set batch_execution = on;
+
+explain (costs off)
+  select count(*), count(x), sum(x), max(t) from batch_t
+  where i % 2 = 0 and x < 100;
+
+select count(*), count(x), sum(x), max(x), avg(x), min(t), max(t)
+  from batch_t;
+select count(*), count(x), sum(x), max(x) from batch_t where i > 500;
+select count(*), count(x), sum(x), max(t) from batch_t
+  where i % 2 = 0 and x < 100;
+select count(*), sum(x) from batch_t where x > i;
+
+-- comparisons with constants, including NaNs in float8 columns
+select count(*) from batch_t where f > 200;
+select count(*) from batch_t where f <= 1.5;
+select count(*) from batch_t where f <> 2;
+select count(*) from batch_t where 250 > i;
+select count(*), min(i), max(i) from batch_t where i >= 990::int8;
+select count(*) from batch_t where x = 4::int2;
+select sum(x), max(x), count(x) from batch_t where i % 3 = 0;
+select count(*), sum(unique1), min(unique1), max(unique1), max(ten)
+  from tenk1 where hundred < 10;
+
+-- aggregates with FILTER can't be computed over batches
+explain (costs off)
+  select count(*) filter (where x > 5) from batch_t;
+select count(*) filter (where x > 5) from batch_t;
+-- tuples with nulls, and tuples lacking attributes added later
+alter table batch_t add column m int default 42;
+insert into batch_t values (1001, 1001, '1001', 250.25, 7);
+select count(*), count(x), sum(i), sum(m), max(t) from batch_t where f > 200;
+
+reset batch_execution;
+drop table batch_t;
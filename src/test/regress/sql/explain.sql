@@ -75,6 +75,13 @@ select true as "OK"
 select explain_filter_to_json('explain (settings, format json) select * from int8_tbl i8') #> '{0,Settings,plan_cache_mode}';
 rollback;
 
+-- Join search phases in the summary
+begin;
+set local linear_join_threshold = 2;
+select explain_filter('explain (summary, costs off) select * from int8_tbl a join int8_tbl b on a.q1 = b.q2');
+select explain_filter_to_json('explain (summary, format json) select * from int8_tbl a join int8_tbl b on a.q1 = b.q2') -> 0 ?& array['Join Ordering Time', 'Join Search Time'] as "OK";
+rollback;
+
 --
 -- Test production of per-worker data
 --
@@ -2279,3 +2279,91 @@ where exists (select 1 from j3
       and t1.unique1 < 1;
 
 drop table j3;
+
+--
+-- nested loops that switch to hashing their inner side at runtime
+--
+begin;
+
+set local enable_hashjoin = off;
+set local enable_mergejoin = off;
+set local enable_material = off;
+set local enable_resultcache = off;
+
+-- NULL keys on both sides, and duplicate and missing keys on the inner side
+create temp table nls_outer as
+  select g as id, case when g % 10 = 0 then null else g % 50 end as k
+  from generate_series(1, 200) g;
+create temp table nls_inner as
+  select g as id, case when g % 13 = 0 then null else g % 40 end as k
+  from generate_series(1, 100) g;
+analyze nls_outer;
+analyze nls_inner;
+
+-- the non-hashable part of the join qual must still be checked
+create temp view nls_joins as
+  select 'inner' as kind, count(*), sum(o.id) as o, sum(i.id) as i
+    from nls_outer o join nls_inner i on o.k = i.k and o.id > i.id
+  union all select 'left', count(*), sum(o.id), sum(i.id)
+    from nls_outer o left join nls_inner i on o.k = i.k and o.id > i.id
+  union all select 'semi', count(*), sum(o.id), null
+    from nls_outer o
+    where exists (select from nls_inner i where o.k = i.k and o.id > i.id)
+  union all select 'anti', count(*), sum(o.id), null
+    from nls_outer o
+    where not exists (select from nls_inner i where o.k = i.k and o.id > i.id);
+explain (costs off) select * from nls_joins;
+
+-- never switch
+set local nestloop_switch_threshold = 0;
+select * from nls_joins;
+
+-- switch after a couple of outer rows
+set local nestloop_switch_threshold = 0.01;
+select * from nls_joins;
+explain (analyze, costs off, timing off, summary off)
+  select * from nls_outer o left join nls_inner i on o.k = i.k and o.id > i.id;
+
+-- if the inner side doesn't fit in hash_mem, carry on as a nested loop
+set local work_mem = '64kB';
+set local hash_mem_multiplier = 1;
+create temp table nls_wide as
+  select id, k, repeat('x', 1000) as pad from nls_inner;
+analyze nls_wide;
+explain (analyze, costs off, timing off, summary off)
+  select count(*) from nls_outer o left join nls_wide i on o.k = i.k;
+select count(*), sum(i.id) from nls_outer o left join nls_wide i on o.k = i.k;
+set local nestloop_switch_threshold = 0;
+select count(*), sum(i.id) from nls_outer o left join nls_wide i on o.k = i.k;
+
+rollback;
+
+--
+-- linearized dynamic programming for large join problems
+--
+begin;
+
+create temp view ljt_counts as
+  select 'inner' as kind, count(*)
+    from tenk1 a join tenk2 b on a.unique1 = b.unique2
+    join onek c on c.unique1 = a.hundred
+    join int4_tbl d on d.f1 = c.ten
+  union all
+  -- the outer joins allow no join order over the sequence of rels, so we
+  -- fall back to the exhaustive search or GEQO
+  select 'outer', count(*)
+    from onek a left join (int4_tbl b left join tenk1 c on b.f1 = c.unique1)
+      on a.unique1 = c.unique2
+    join int2_tbl d on d.f1 = a.ten;
+
+select * from ljt_counts;
+
+set local linear_join_threshold = 2;
+explain (costs off) select * from ljt_counts;
+select * from ljt_counts;
+
+set local geqo_threshold = 2;
+explain (costs off) select * from ljt_counts;
+select * from ljt_counts;
+
+rollback;
@@ -467,6 +467,122 @@ $$
 $$);
 rollback to settings;
 
+-- Bloom filters pushed down into the outer scan.  Which rows are false
+-- positives depends on the hash values, so just check that most of the rows
+-- without a partner were removed.
+create or replace function bloom_filter_removed(query text)
+returns float language plpgsql
+as
+$$
+declare
+  whole_plan json;
+  scan_node jsonb;
+begin
+  execute 'explain (analyze, format ''json'') ' || query into whole_plan;
+  scan_node := jsonb_path_query_first(whole_plan::jsonb,
+    'strict $.**?(exists (@."Rows Removed by Bloom Filter"))');
+  return coalesce((scan_node->>'Rows Removed by Bloom Filter')::float *
+                  (scan_node->>'Actual Loops')::float, 0);
+end;
+$$;
+create table bloom_inner as select generate_series(1, 1000) * 7 as id;
+analyze bloom_inner;
+
+-- non-parallel, for the join types that throw away outer rows
+savepoint settings;
+set local max_parallel_workers_per_gather = 0;
+explain (costs off)
+  select count(*) from simple r join bloom_inner s using (id);
+select count(*) from simple r join bloom_inner s using (id);
+select bloom_filter_removed($$
+  select count(*) from simple r join bloom_inner s using (id);
+$$) > 18000 as filtered;
+explain (costs off)
+  select count(*) from simple r
+  where exists (select from bloom_inner s where s.id = r.id);
+select count(*) from simple r
+  where exists (select from bloom_inner s where s.id = r.id);
+select bloom_filter_removed($$
+  select count(*) from simple r
+  where exists (select from bloom_inner s where s.id = r.id);
+$$) > 18000 as filtered;
+explain (costs off)
+  select count(*) from simple r right join bloom_inner s using (id);
+select count(*) from simple r right join bloom_inner s using (id);
+select bloom_filter_removed($$
+  select count(*) from simple r right join bloom_inner s using (id);
+$$) > 18000 as filtered;
+-- the scan's quals must be checked before the hash keys are computed
+explain (costs off)
+  select count(*) from simple r join bloom_inner s on s.id = 7000 / (r.id - 1)
+  where r.id <> 1;
+select count(*) from simple r join bloom_inner s on s.id = 7000 / (r.id - 1)
+  where r.id <> 1;
+-- every row checked early on finds a partner, so the filter is dropped
+select count(*) from simple r
+  join (select id from simple where id <= 5000) s using (id);
+select bloom_filter_removed($$
+  select count(*) from simple r
+  join (select id from simple where id <= 5000) s using (id);
+$$) as removed;
+-- the filter can be turned off
+set local hashjoin_bloom_filter = off;
+select bloom_filter_removed($$
+  select count(*) from simple r join bloom_inner s using (id);
+$$) as removed;
+rollback to settings;
+
+-- parallel with parallel-aware hash join, where the participants share a
+-- filter
+savepoint settings;
+set local max_parallel_workers_per_gather = 2;
+set local enable_parallel_hash = on;
+explain (costs off)
+  select count(*) from simple r join bloom_inner s using (id);
+select count(*) from simple r join bloom_inner s using (id);
+select bloom_filter_removed($$
+  select count(*) from simple r join bloom_inner s using (id);
+$$) > 18000 as filtered;
+rollback to settings;
+
+-- Radix-partitioned probing must find the same matches as probing each
+-- outer tuple as it arrives.  "simple" is larger than one partition's worth
+-- of hash table, and the outer side spans more than one block of outer
+-- tuples.
+savepoint settings;
+set local max_parallel_workers_per_gather = 0;
+set local enable_mergejoin = off;
+set local enable_material = off;
+set local work_mem = '4MB';
+create table radix_outer as
+  select g % 30000 - 5000 as id from generate_series(1, 80000) g;
+analyze radix_outer;
+create temp view radix_joins as
+  select 'inner' as kind, count(*), sum(r.id) as r, sum(s.id) as s
+    from radix_outer r join simple s using (id)
+  union all select 'left', count(*), sum(r.id), sum(s.id)
+    from radix_outer r left join simple s using (id)
+  union all select 'full', count(*), sum(r.id), sum(s.id)
+    from radix_outer r full join simple s on s.id = r.id + 10000
+  union all select 'semi', count(*), sum(r.id), null
+    from radix_outer r where exists (select from simple s where s.id = r.id)
+  union all select 'anti', count(*), sum(r.id), null
+    from radix_outer r where not exists (select from simple s where s.id = r.id)
+  union all select 'rescan', count(*), sum(ss.r), sum(ss.s)
+    from (values (1), (2)) v(x) left join
+      (select count(*) c, sum(r.id) r, sum(s.id) s
+       from radix_outer r join simple s using (id)) ss on true;
+explain (costs off) select * from radix_joins;
+set local hashjoin_radix_partitioning = on;
+select * from radix_joins;
+select original, final from hash_join_batches(
+$$
+  select count(*) from radix_outer r join simple s using (id);
+$$);
+set local hashjoin_radix_partitioning = off;
+select * from radix_joins;
+rollback to settings;
+
 rollback;
 
 
@@ -1142,3 +1142,57 @@ SELECT t1.*, t2.* FROM alpha t1 INNER JOIN beta t2 ON (t1.a = t2.a AND t1.c = t2
 EXPLAIN (COSTS OFF)
 SELECT t1.*, t2.* FROM alpha t1 INNER JOIN beta t2 ON (t1.a = t2.a AND t1.b = t2.b AND t1.c = t2.c) WHERE ((t1.b >= 100 AND t1.b < 110) OR (t1.b >= 200 AND t1.b < 210)) AND ((t2.b >= 100 AND t2.b < 110) OR (t2.b >= 200 AND t2.b < 210)) AND t1.c IN ('0004', '0009') ORDER BY t1.a, t1.b;
 SELECT t1.*, t2.* FROM alpha t1 INNER JOIN beta t2 ON (t1.a = t2.a AND t1.b = t2.b AND t1.c = t2.c) WHERE ((t1.b >= 100 AND t1.b < 110) OR (t1.b >= 200 AND t1.b < 210)) AND ((t2.b >= 100 AND t2.b < 110) OR (t2.b >= 200 AND t2.b < 210)) AND t1.c IN ('0004', '0009') ORDER BY t1.a, t1.b;
+
+--
+-- partitionwise join and aggregation skipping pruned partitions, at both
+-- levels of a partition hierarchy
+--
+CREATE TABLE pwp1 (a int, b int, c text) PARTITION BY RANGE (a);
+CREATE TABLE pwp1_p1 PARTITION OF pwp1 FOR VALUES FROM (0) TO (100);
+CREATE TABLE pwp1_p2 PARTITION OF pwp1 FOR VALUES FROM (100) TO (200) PARTITION BY LIST (b);
+CREATE TABLE pwp1_p2_1 PARTITION OF pwp1_p2 FOR VALUES IN (0, 1);
+CREATE TABLE pwp1_p2_2 PARTITION OF pwp1_p2 FOR VALUES IN (2, 3);
+CREATE TABLE pwp1_p3 PARTITION OF pwp1 FOR VALUES FROM (200) TO (300);
+CREATE TABLE pwp1_p4 PARTITION OF pwp1 FOR VALUES FROM (300) TO (400);
+INSERT INTO pwp1 SELECT i % 400, i % 4, to_char(i, 'FM0000') FROM generate_series(0, 1599) i;
+ANALYZE pwp1;
+CREATE TABLE pwp2 (a int, b int, c text) PARTITION BY RANGE (a);
+CREATE TABLE pwp2_p1 PARTITION OF pwp2 FOR VALUES FROM (0) TO (100);
+CREATE TABLE pwp2_p2 PARTITION OF pwp2 FOR VALUES FROM (100) TO (200) PARTITION BY LIST (b);
+CREATE TABLE pwp2_p2_1 PARTITION OF pwp2_p2 FOR VALUES IN (0, 1);
+CREATE TABLE pwp2_p2_2 PARTITION OF pwp2_p2 FOR VALUES IN (2, 3);
+CREATE TABLE pwp2_p3 PARTITION OF pwp2 FOR VALUES FROM (200) TO (300);
+CREATE TABLE pwp2_p4 PARTITION OF pwp2 FOR VALUES FROM (300) TO (400);
+INSERT INTO pwp2 SELECT i % 400, i % 4, to_char(i, 'FM0000') FROM generate_series(0, 799) i;
+ANALYZE pwp2;
+
+SET enable_partitionwise_aggregate TO true;
+
+-- the p1 and p2_1 partitions are pruned on both sides
+EXPLAIN (COSTS OFF)
+SELECT count(*), sum(n), sum(s) FROM (SELECT t1.a, count(*) n, sum(t1.a + t2.b) s FROM pwp1 t1 INNER JOIN pwp2 t2 ON t1.a = t2.a AND t1.b = t2.b WHERE t1.a >= 100 AND t2.b IN (2, 3) GROUP BY t1.a) ss;
+SELECT count(*), sum(n), sum(s) FROM (SELECT t1.a, count(*) n, sum(t1.a + t2.b) s FROM pwp1 t1 INNER JOIN pwp2 t2 ON t1.a = t2.a AND t1.b = t2.b WHERE t1.a >= 100 AND t2.b IN (2, 3) GROUP BY t1.a) ss;
+
+-- pruned only on the outer side
+EXPLAIN (COSTS OFF)
+SELECT count(*), sum(n), sum(s) FROM (SELECT t1.a, count(t2.a) n, sum(t2.a) s FROM pwp1 t1 LEFT JOIN pwp2 t2 ON t1.a = t2.a AND t1.b = t2.b WHERE t1.a >= 100 AND t1.b IN (2, 3) GROUP BY t1.a) ss;
+SELECT count(*), sum(n), sum(s) FROM (SELECT t1.a, count(t2.a) n, sum(t2.a) s FROM pwp1 t1 LEFT JOIN pwp2 t2 ON t1.a = t2.a AND t1.b = t2.b WHERE t1.a >= 100 AND t1.b IN (2, 3) GROUP BY t1.a) ss;
+
+-- full and partial aggregation of a pruned table
+EXPLAIN (COSTS OFF)
+SELECT count(*), sum(n) FROM (SELECT a, count(*) n FROM pwp1 WHERE a >= 100 AND b IN (2, 3) GROUP BY a) ss;
+SELECT count(*), sum(n) FROM (SELECT a, count(*) n FROM pwp1 WHERE a >= 100 AND b IN (2, 3) GROUP BY a) ss;
+EXPLAIN (COSTS OFF)
+SELECT b, count(*), min(c) FROM pwp1 WHERE a >= 100 AND b IN (2, 3) GROUP BY b ORDER BY b;
+SELECT b, count(*), min(c) FROM pwp1 WHERE a >= 100 AND b IN (2, 3) GROUP BY b ORDER BY b;
+
+-- compare with the results of joining and aggregating the parents
+SET enable_partitionwise_join TO false;
+SET enable_partitionwise_aggregate TO false;
+SELECT count(*), sum(n), sum(s) FROM (SELECT t1.a, count(*) n, sum(t1.a + t2.b) s FROM pwp1 t1 INNER JOIN pwp2 t2 ON t1.a = t2.a AND t1.b = t2.b WHERE t1.a >= 100 AND t2.b IN (2, 3) GROUP BY t1.a) ss;
+SELECT count(*), sum(n), sum(s) FROM (SELECT t1.a, count(t2.a) n, sum(t2.a) s FROM pwp1 t1 LEFT JOIN pwp2 t2 ON t1.a = t2.a AND t1.b = t2.b WHERE t1.a >= 100 AND t1.b IN (2, 3) GROUP BY t1.a) ss;
+SET enable_partitionwise_join TO true;
+RESET enable_partitionwise_aggregate;
+
+DROP TABLE pwp1;
+DROP TABLE pwp2;
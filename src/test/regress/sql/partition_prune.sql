@@ -1112,6 +1112,96 @@ select * from rangep where b IN((select 1),(select 2)) order by a;
 reset enable_sort;
 drop table rangep;
 
+--
+-- Test run-time pruning of the outer Append of a hash join by the values of
+-- the inner join key
+--
+begin;
+create table hjp (a int, b int) partition by range (a);
+create table hjp_1 partition of hjp for values from (0) to (100);
+create table hjp_2 partition of hjp for values from (100) to (200);
+create table hjp_3 partition of hjp for values from (200) to (300);
+create table hjp_4 partition of hjp for values from (300) to (400);
+insert into hjp select g % 400, g from generate_series(0, 3999) g;
+create table hjp_inner (a int, b int8);
+insert into hjp_inner values (5, 1), (150, 1), (250, 2), (350, 2), (null, 1);
+-- more distinct values than the join collects for pruning
+create table hjp_many as
+  select g as a from generate_series(1000, 3000) g union all select 5;
+analyze hjp;
+analyze hjp_inner;
+analyze hjp_many;
+
+-- The hash table's size varies between platforms
+create function explain_hashjoin_prune(text) returns setof text
+language plpgsql as
+$$
+declare
+    ln text;
+begin
+    for ln in
+        execute format('explain (analyze, costs off, summary off, timing off) %s',
+            $1)
+    loop
+        continue when ln ~ '^\s+Buckets: ';
+        return next ln;
+    end loop;
+end;
+$$;
+
+set local enable_hashjoin = on;
+set local enable_nestloop = off;
+set local enable_mergejoin = off;
+set local max_parallel_workers_per_gather = 0;
+set local hashjoin_bloom_filter = off;
+
+-- Inner, semi and right joins scan only hjp_1 and hjp_2
+select explain_hashjoin_prune('
+select count(*) from hjp join hjp_inner i on hjp.a = i.a where i.b = 1');
+select explain_hashjoin_prune('
+select count(*) from hjp
+where exists (select from hjp_inner i where i.a = hjp.a and i.b = 1)');
+select explain_hashjoin_prune('
+select count(*) from hjp right join hjp_inner i on hjp.a = i.a where i.b = 1');
+select count(*) from hjp right join hjp_inner i on hjp.a = i.a where i.b = 1;
+
+-- Inner key of a different type from the partition key
+select explain_hashjoin_prune('
+select count(*) from hjp join hjp_inner i on hjp.a = i.b + 148');
+
+-- Too many distinct inner values to prune by
+select explain_hashjoin_prune('
+select count(*) from hjp join hjp_many m on hjp.a = m.a');
+select explain_hashjoin_prune('
+select count(*) from hjp join (select * from hjp_many where a < 2000) m
+  on hjp.a = m.a');
+
+-- Rescans that reuse the hash table keep the partitions pruned
+set local enable_material = off;
+select explain_hashjoin_prune('
+select * from (values (1), (2)) v(x)
+  left join (select count(*) from hjp join hjp_inner i on hjp.a = i.a
+             where i.b = 1) ss on true');
+-- and rescans that rebuild it prune them again
+select explain_hashjoin_prune('
+select * from (values (1), (2)) v(x),
+  lateral (select count(*) from hjp join hjp_inner i on hjp.a = i.a
+           where i.b = v.x) ss');
+select * from (values (1), (2)) v(x),
+  lateral (select count(*) from hjp join hjp_inner i on hjp.a = i.a
+           where i.b = v.x) ss;
+
+-- An Append that did initial pruning is left alone
+set local plan_cache_mode = force_generic_plan;
+prepare hjp_q (int) as
+select count(*) from hjp join hjp_inner i on hjp.a = i.a
+where i.b = 1 and hjp.a > $1;
+select explain_hashjoin_prune('execute hjp_q (100)');
+execute hjp_q (100);
+deallocate hjp_q;
+
+rollback;
+
 --
 -- Check that gen_prune_steps_from_opexps() works well for various cases of
 -- clauses for different partition keys
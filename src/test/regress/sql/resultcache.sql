@@ -87,6 +87,83 @@ SELECT COUNT(*),AVG(t2.unique1) FROM tenk1 t1,
 LATERAL (SELECT t2.unique1 FROM tenk1 t2 WHERE t1.twenty = t2.unique1) t2
 WHERE t1.unique1 < 1000;
 
+-- In a parallel query, the processes share a single cache.  As the split of
+-- work between them varies, sum up the counts from the leader and all
+-- workers.
+create function explain_resultcache_totals(query text,
+    out lookups bigint, out misses bigint, out evictions bigint,
+    out overflows bigint)
+language plpgsql as
+$$
+declare
+    plan jsonb;
+    node jsonb;
+begin
+    execute format('explain (analyze, costs off, summary off, timing off, format json) %s',
+        query) into plan;
+    node := jsonb_path_query_first(plan,
+        'strict $.**?(@."Node Type" == "Result Cache")');
+    select sum((s->>'Cache Hits')::bigint + (s->>'Cache Misses')::bigint),
+           sum((s->>'Cache Misses')::bigint),
+           sum((s->>'Cache Evictions')::bigint),
+           sum((s->>'Cache Overflows')::bigint)
+      into lookups, misses, evictions, overflows
+      from (select node as s
+            union all
+            select jsonb_array_elements(node->'Workers')) ss;
+end;
+$$;
+
+-- Every lookup is counted once, and each process misses a given parameter
+-- value at most once.
+SELECT lookups, misses BETWEEN 20 AND 60 AS misses_ok, evictions, overflows
+FROM explain_resultcache_totals('
+SELECT COUNT(*),AVG(t2.unique1) FROM tenk1 t1,
+LATERAL (SELECT t2.unique1 FROM tenk1 t2 WHERE t1.twenty = t2.unique1) t2
+WHERE t1.unique1 < 1000;');
+
+-- The shared cache survives a rescan of the Gather, so workers started for
+-- later scans find all the entries already cached.
+SET enable_hashjoin TO off;
+SET enable_mergejoin TO off;
+SET enable_material TO off;
+EXPLAIN (COSTS OFF)
+SELECT v.x, s.c, s.a FROM (VALUES (1), (2), (3)) v(x) LEFT JOIN
+(SELECT COUNT(*) c, AVG(t2.unique1) a FROM tenk1 t1,
+ LATERAL (SELECT t2.unique1 FROM tenk1 t2 WHERE t1.twenty = t2.unique1) t2
+ WHERE t1.unique1 < 1000) s ON s.c > v.x;
+SELECT lookups, misses BETWEEN 20 AND 60 AS misses_ok, evictions, overflows
+FROM explain_resultcache_totals('
+SELECT v.x, s.c, s.a FROM (VALUES (1), (2), (3)) v(x) LEFT JOIN
+(SELECT COUNT(*) c, AVG(t2.unique1) a FROM tenk1 t1,
+ LATERAL (SELECT t2.unique1 FROM tenk1 t2 WHERE t1.twenty = t2.unique1) t2
+ WHERE t1.unique1 < 1000) s ON s.c > v.x;');
+SELECT v.x, s.c, s.a FROM (VALUES (1), (2), (3)) v(x) LEFT JOIN
+(SELECT COUNT(*) c, AVG(t2.unique1) a FROM tenk1 t1,
+ LATERAL (SELECT t2.unique1 FROM tenk1 t2 WHERE t1.twenty = t2.unique1) t2
+ WHERE t1.unique1 < 1000) s ON s.c > v.x;
+RESET enable_material;
+
+-- Reduce work_mem so that the shared cache fills up.  There's no eviction in
+-- shared mode, so the scans that don't fit must bypass the cache.  The
+-- COALESCE makes the wide value get computed below the Result Cache.
+SET work_mem TO '64kB';
+SELECT lookups, misses >= 20 AS misses_ok, evictions, overflows > 0 AS overflowed
+FROM explain_resultcache_totals('
+SELECT COUNT(*),SUM(length(t2.s)) FROM tenk1 t1 LEFT JOIN
+LATERAL (SELECT coalesce(repeat(t2.stringu1, 2000), '''') AS s
+         FROM tenk1 t2 WHERE t1.twenty = t2.unique1) t2 ON true;');
+
+-- And check that bypassing the cache gives the correct results.
+SELECT COUNT(*),SUM(length(t2.s)) FROM tenk1 t1 LEFT JOIN
+LATERAL (SELECT coalesce(repeat(t2.stringu1, 2000), '') AS s
+         FROM tenk1 t2 WHERE t1.twenty = t2.unique1) t2 ON true;
+RESET work_mem;
+RESET enable_mergejoin;
+RESET enable_hashjoin;
+
+DROP FUNCTION explain_resultcache_totals(text);
+
 RESET max_parallel_workers_per_gather;
 RESET parallel_tuple_cost;
 RESET parallel_setup_cost;
@@ -314,6 +314,133 @@ reset enable_material;
 
 reset enable_hashagg;
 
+-- test parallel hash aggregation.  array_agg has no combine function, so
+-- the only way to aggregate in parallel is to share out the groups.
+set enable_parallel_hashagg = on;
+set enable_sort = off;
+
+explain (costs off)
+select count(*), sum(c), sum(s) from
+  (select thousand, cardinality(array_agg(unique2)) c, sum(unique1) s
+   from tenk1 group by thousand having sum(unique1) > 50000) ss;
+select count(*), sum(c), sum(s) from
+  (select thousand, cardinality(array_agg(unique2)) c, sum(unique1) s
+   from tenk1 group by thousand having sum(unique1) > 50000) ss;
+
+-- spill to disk
+set work_mem = '64kB';
+explain (costs off)
+select count(*), sum(c), sum(s), max(m) from
+  (select unique1 % 5000, cardinality(array_agg(unique2)) c,
+          sum(unique2) s, max(stringu1) m
+   from tenk1 group by unique1 % 5000) ss;
+select count(*), sum(c), sum(s), max(m) from
+  (select unique1 % 5000, cardinality(array_agg(unique2)) c,
+          sum(unique2) s, max(stringu1) m
+   from tenk1 group by unique1 % 5000) ss;
+reset work_mem;
+
+-- compare with a serial plan
+set max_parallel_workers_per_gather = 0;
+select count(*), sum(c), sum(s) from
+  (select thousand, cardinality(array_agg(unique2)) c, sum(unique1) s
+   from tenk1 group by thousand having sum(unique1) > 50000) ss;
+set work_mem = '64kB';
+select count(*), sum(c), sum(s), max(m) from
+  (select unique1 % 5000, cardinality(array_agg(unique2)) c,
+          sum(unique2) s, max(stringu1) m
+   from tenk1 group by unique1 % 5000) ss;
+reset work_mem;
+set max_parallel_workers_per_gather = 4;
+
+--test rescan behavior of parallel hash aggregation
+set enable_material = false;
+
+explain (costs off)
+select * from
+  (select count(*) c, sum(cardinality(a)) n, sum(s) s from
+    (select thousand, array_agg(unique2) a, sum(unique1) s
+     from tenk1 group by thousand having sum(unique1) > 50000) ss) ss
+  right join (values (1),(2),(3)) v(x) on true;
+select * from
+  (select count(*) c, sum(cardinality(a)) n, sum(s) s from
+    (select thousand, array_agg(unique2) a, sum(unique1) s
+     from tenk1 group by thousand having sum(unique1) > 50000) ss) ss
+  right join (values (1),(2),(3)) v(x) on true;
+
+reset enable_material;
+
+reset enable_sort;
+reset enable_parallel_hashagg;
+
+-- test parallel-aware merge joins of key ranges of two index scans
+set enable_parallel_mergejoin = on;
+set enable_hashjoin = off;
+set enable_nestloop = off;
+set enable_hashagg = off;
+set enable_sort = off;
+-- NULL keys on both sides, which fall in no key range; the keys of pmj_b
+-- are of a different type from those of pmj_a
+create table pmj_a as
+  select case when g % 10 = 0 then null else g end as a, g as b,
+         g % 5 as c, g % 3000 as d
+  from generate_series(1, 20000) g;
+create index on pmj_a (a);
+create index on pmj_a (c);
+create index on pmj_a (d);
+create table pmj_b as
+  select case when g % 7 = 0 then null else g::int8 end as a, g as b
+  from generate_series(1, 20000, 2) g;
+create index on pmj_b (a);
+analyze pmj_a;
+analyze pmj_b;
+explain (costs off)
+  select count(*), sum(t1.unique2 + t2.unique2)
+  from tenk1 t1 join tenk2 t2 on t1.unique1 = t2.unique1;
+select count(*), sum(t1.unique2 + t2.unique2)
+  from tenk1 t1 join tenk2 t2 on t1.unique1 = t2.unique1;
+explain (costs off)
+  select count(*), sum(x.b + y.b) from pmj_a x join pmj_b y on x.a = y.a;
+select count(*), sum(x.b + y.b) from pmj_a x join pmj_b y on x.a = y.a;
+explain (costs off)
+  select count(*), sum(x.b) from pmj_a x
+  where exists (select from pmj_a y where y.d = x.a);
+select count(*), sum(x.b) from pmj_a x
+  where exists (select from pmj_a y where y.d = x.a);
+explain (costs off)
+  select count(*), sum(y.b) from pmj_b y
+  where exists (select from pmj_a x where x.d = y.a);
+select count(*), sum(y.b) from pmj_b y
+  where exists (select from pmj_a x where x.d = y.a);
+-- a column with no histogram can't be split into ranges
+explain (costs off)
+  select count(*) from pmj_a x join pmj_a y on x.c = y.c;
+-- rescan the Gather, which hands out the key ranges again
+set enable_material = off;
+explain (costs off)
+  select * from (values (1), (2)) v(x)
+  left join (select count(*) c, sum(t1.unique2 + t2.unique2) s
+             from tenk1 t1 join tenk2 t2 on t1.unique1 = t2.unique1) ss on true;
+select * from (values (1), (2)) v(x)
+  left join (select count(*) c, sum(t1.unique2 + t2.unique2) s
+             from tenk1 t1 join tenk2 t2 on t1.unique1 = t2.unique1) ss on true;
+reset enable_material;
+-- compare with serial merge joins
+set max_parallel_workers_per_gather = 0;
+select count(*), sum(x.b + y.b) from pmj_a x join pmj_b y on x.a = y.a;
+select count(*), sum(x.b) from pmj_a x
+  where exists (select from pmj_a y where y.d = x.a);
+select count(*), sum(y.b) from pmj_b y
+  where exists (select from pmj_a x where x.d = y.a);
+set max_parallel_workers_per_gather = 4;
+drop table pmj_a;
+drop table pmj_b;
+reset enable_sort;
+reset enable_hashagg;
+reset enable_nestloop;
+reset enable_hashjoin;
+reset enable_parallel_mergejoin;
+
 -- check parallelized int8 aggregate (bug #14897)
 explain (costs off)
 select avg(unique1::int8) from tenk1;
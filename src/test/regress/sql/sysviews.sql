@@ -39,6 +39,7 @@ select count(*) >= 0 as ok from pg_prepared_xacts;
 
 -- There must be only one record
 select count(*) = 1 as ok from pg_stat_wal;
+select count(*) = 1 as ok from pg_stat_recovery_prefetch;
 
 -- We expect no walreceiver running in this test
 select count(*) = 0 as ok from pg_stat_wal_receiver;
@@ -0,0 +1,28 @@
+/*-------------------------------------------------------------------------
+ *
+ * sha2.h
+ *	  Constants related to SHA224, 256, 384 AND 512.
+ *
+ * Portions Copyright (c) 1996-2021, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * IDENTIFICATION
+ *		  src/include/common/sha2.h
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#ifndef _PG_SHA2_H_
+#define _PG_SHA2_H_
+
+/*** SHA224/256/384/512 Various Length Definitions ***********************/
+#define PG_SHA224_BLOCK_LENGTH			64
+#define PG_SHA224_DIGEST_LENGTH			28
+#define PG_SHA256_BLOCK_LENGTH			64
+#define PG_SHA256_DIGEST_LENGTH			32
+#define PG_SHA384_BLOCK_LENGTH			128
+#define PG_SHA384_DIGEST_LENGTH			48
+#define PG_SHA512_BLOCK_LENGTH			128
+#define PG_SHA512_DIGEST_LENGTH			64
+
+#endif							/* _PG_SHA2_H_ */
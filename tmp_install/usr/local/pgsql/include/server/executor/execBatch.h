@@ -0,0 +1,53 @@
+/*-------------------------------------------------------------------------
+ *
+ * execBatch.h
+ *	  Support for batch-at-a-time execution of plan nodes.
+ *
+ *
+ * Portions Copyright (c) 1996-2021, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * src/include/executor/execBatch.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef EXECBATCH_H
+#define EXECBATCH_H
+
+#include "nodes/pg_list.h"
+
+/* maximum number of rows in a batch */
+#define EXEC_BATCH_SIZE		1024
+
+/*
+ * TupleBatch -- a set of deformed rows exchanged between plan nodes in
+ * batch mode.
+ *
+ * Values are stored column by column: values[col][row] and isnull[col][row]
+ * hold the col'th output column of the row'th row.  Of the nrows rows
+ * present, only those whose indexes appear in the first nvalid entries of
+ * sel[] are part of the node's output; the others have been filtered out.
+ * The entries of sel[] are in ascending order.
+ *
+ * A batch, and any pass-by-reference values it points to, is only valid
+ * until the next call to ExecProcNodeBatch() on the node that returned it.
+ */
+typedef struct TupleBatch
+{
+	int			natts;			/* number of columns */
+	int			nrows;			/* number of rows present */
+	int			nvalid;			/* number of entries in sel[] */
+	Datum	  **values;			/* per-column value arrays */
+	bool	  **isnull;			/* per-column null flag arrays */
+	uint16	   *sel;			/* selection vector */
+} TupleBatch;
+
+extern TupleBatch *MakeTupleBatch(int natts);
+extern TupleBatch *MakeTupleBatchHeader(int natts);
+extern void TupleBatchSelectAll(TupleBatch *batch, int nrows);
+extern int *ExecBuildBatchColumnMap(List *targetlist, Index varno,
+									int *ninputcols);
+extern void ExecProjectBatch(TupleBatch *result, TupleBatch *input,
+							 const int *colmap);
+
+#endif							/* EXECBATCH_H */
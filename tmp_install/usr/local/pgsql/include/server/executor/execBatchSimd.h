@@ -0,0 +1,70 @@
+/*-------------------------------------------------------------------------
+ *
+ * execBatchSimd.h
+ *	  Vectorized kernels for filtering and aggregating batch columns.
+ *
+ * The kernels operate on the rows of a TupleBatch column listed in a
+ * selection vector.  Each kernel has a plain C implementation, and
+ * implementations using SSE4.2 or AVX2 instructions on x86-64, or NEON on
+ * AArch64.  On x86-64, the best implementation the CPU supports is chosen
+ * at runtime, on the first call, like pg_comp_crc32c() does.
+ *
+ * All the kernels treat the column's datums as 64-bit values, so they are
+ * only available when Datum is 64 bits wide.
+ *
+ * Portions Copyright (c) 1996-2021, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * src/include/executor/execBatchSimd.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef EXECBATCHSIMD_H
+#define EXECBATCHSIMD_H
+
+#ifdef USE_FLOAT8_BYVAL
+
+/* Comparison of a column against a constant */
+typedef enum BatchCmpOp
+{
+	BATCH_CMP_EQ,
+	BATCH_CMP_NE,
+	BATCH_CMP_LT,
+	BATCH_CMP_LE,
+	BATCH_CMP_GT,
+	BATCH_CMP_GE
+} BatchCmpOp;
+
+/*
+ * Filter kernels.  Keep those of the nsel rows listed in sel[] that are not
+ * null and for which "value op constval" holds, compacting sel[] in place,
+ * and return the number of rows kept.
+ *
+ * pg_batch_filter_int64 compares the datums as signed 64-bit integers, which
+ * is correct for any mix of int2, int4 and int8 values, since their datums
+ * are sign-extended.  pg_batch_filter_float8 compares float8 datums with the
+ * semantics of the float8 comparison operators, i.e. NaN is equal to itself
+ * and greater than any other value; constval must not be NaN.
+ */
+extern int	(*pg_batch_filter_int64) (const Datum *values, const bool *isnull,
+									  uint16 *sel, int nsel,
+									  int64 constval, BatchCmpOp op);
+extern int	(*pg_batch_filter_float8) (const Datum *values, const bool *isnull,
+									   uint16 *sel, int nsel,
+									   float8 constval, BatchCmpOp op);
+
+/*
+ * Aggregate kernels.  Compute the sum (wrapping around on overflow), or the
+ * minimum and maximum, of the non-null values among the nsel rows listed in
+ * sel[], as signed 64-bit integers.  Return the number of non-null values;
+ * if that's zero, the output arguments are not set.
+ */
+extern int	(*pg_batch_sum_int64) (const Datum *values, const bool *isnull,
+								   const uint16 *sel, int nsel, int64 *sum);
+extern int	(*pg_batch_minmax_int64) (const Datum *values, const bool *isnull,
+									  const uint16 *sel, int nsel,
+									  int64 *min, int64 *max);
+
+#endif							/* USE_FLOAT8_BYVAL */
+
+#endif							/* EXECBATCHSIMD_H */
@@ -0,0 +1,29 @@
+/*-------------------------------------------------------------------------
+ *
+ * nodeMergejoin.h
+ *
+ *
+ *
+ * Portions Copyright (c) 1996-2021, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * src/include/executor/nodeMergejoin.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef NODEMERGEJOIN_H
+#define NODEMERGEJOIN_H
+
+#include "access/parallel.h"
+#include "nodes/execnodes.h"
+
+extern MergeJoinState *ExecInitMergeJoin(MergeJoin *node, EState *estate, int eflags);
+extern void ExecEndMergeJoin(MergeJoinState *node);
+extern void ExecReScanMergeJoin(MergeJoinState *node);
+extern void ExecMergeJoinEstimate(MergeJoinState *state, ParallelContext *pcxt);
+extern void ExecMergeJoinInitializeDSM(MergeJoinState *state, ParallelContext *pcxt);
+extern void ExecMergeJoinReInitializeDSM(MergeJoinState *state, ParallelContext *pcxt);
+extern void ExecMergeJoinInitializeWorker(MergeJoinState *state,
+										  ParallelWorkerContext *pwcxt);
+
+#endif							/* NODEMERGEJOIN_H */
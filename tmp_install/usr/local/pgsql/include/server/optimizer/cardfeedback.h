@@ -0,0 +1,33 @@
+/*-------------------------------------------------------------------------
+ *
+ * cardfeedback.h
+ *	  Row counts observed by instrumented executions, for the planner.
+ *
+ * See cardfeedback.c for comments.
+ *
+ * Portions Copyright (c) 1996-2021, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * src/include/optimizer/cardfeedback.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef CARDFEEDBACK_H
+#define CARDFEEDBACK_H
+
+#include "nodes/execnodes.h"
+#include "nodes/pg_list.h"
+
+/* GUC parameters */
+extern PGDLLIMPORT bool cardinality_feedback;
+extern PGDLLIMPORT int cardinality_feedback_entries;
+
+extern Size CardinalityFeedbackShmemSize(void);
+extern void CardinalityFeedbackShmemInit(void);
+extern void CheckPointCardinalityFeedback(void);
+
+extern uint64 CardinalityFeedbackKey(Oid relid, List *restrictinfo);
+extern bool CardinalityFeedbackLookup(uint64 key, Selectivity *selec);
+extern void CardinalityFeedbackRecord(PlanState *planstate);
+
+#endif							/* CARDFEEDBACK_H */
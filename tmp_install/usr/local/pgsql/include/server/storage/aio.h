@@ -0,0 +1,45 @@
+/*-------------------------------------------------------------------------
+ *
+ * aio.h
+ *	  Asynchronous file I/O submission and completion.
+ *
+ * This is the low-level engine behind FileStartReadV() and FileWaitIO() in
+ * fd.c.  Callers outside fd.c should use those rather
+ * than the functions declared here, which operate on raw file descriptors.
+ *
+ *
+ * Portions Copyright (c) 1996-2021, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * src/include/storage/aio.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef AIO_H
+#define AIO_H
+
+struct iovec;					/* avoid including port/pg_iovec.h here */
+
+/* Possible values for io_method */
+typedef enum IoMethod
+{
+	IO_METHOD_SYNC,				/* perform I/O when it is started */
+	IO_METHOD_IO_URING			/* submit to a per-backend io_uring */
+}			IoMethod;
+
+/* GUC parameter */
+extern int	io_method;
+
+/*
+ * Maximum number of asynchronous I/Os a backend can have started but not yet
+ * waited for.
+ */
+#define PGAIO_MAX_IN_FLIGHT 128
+
+extern int	pgaio_start_readv(int fd, const struct iovec *iov, int iovcnt,
+							  off_t offset, uint32 wait_event_info);
+extern void pgaio_submit(void);
+extern int	pgaio_wait(int handle);
+extern void pgaio_wait_all(void);
+
+#endif							/* AIO_H */
@@ -0,0 +1,38 @@
+/*-------------------------------------------------------------------------
+ *
+ * read_stream.h
+ *	  Look-ahead reading of a stream of relation blocks.
+ *
+ *
+ * Portions Copyright (c) 1996-2021, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * src/include/storage/read_stream.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef READ_STREAM_H
+#define READ_STREAM_H
+
+#include "storage/bufmgr.h"
+
+typedef struct ReadStream ReadStream;
+
+/*
+ * Callback that returns the next block number the stream should read, or
+ * InvalidBlockNumber at the end of the stream.  It is called ahead of the
+ * consumer, so it must not depend on the consumer having seen the previous
+ * blocks.
+ */
+typedef BlockNumber (*ReadStreamBlockNumberCB) (ReadStream *stream,
+												void *callback_private_data);
+
+extern ReadStream *ReadStreamBegin(Relation rel, ForkNumber forknum,
+								   BufferAccessStrategy strategy,
+								   ReadStreamBlockNumberCB callback,
+								   void *callback_private_data);
+extern Buffer ReadStreamNextBuffer(ReadStream *stream);
+extern void ReadStreamReset(ReadStream *stream);
+extern void ReadStreamEnd(ReadStream *stream);
+
+#endif							/* READ_STREAM_H */
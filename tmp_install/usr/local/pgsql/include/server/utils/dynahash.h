@@ -0,0 +1,19 @@
+/*-------------------------------------------------------------------------
+ *
+ * dynahash
+ *	  POSTGRES dynahash.h file definitions
+ *
+ *
+ * Portions Copyright (c) 1996-2021, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * src/include/utils/dynahash.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef DYNAHASH_H
+#define DYNAHASH_H
+
+extern int	my_log2(long num);
+
+#endif							/* DYNAHASH_H */
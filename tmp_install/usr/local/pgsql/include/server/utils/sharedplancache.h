@@ -0,0 +1,35 @@
+/*-------------------------------------------------------------------------
+ *
+ * sharedplancache.h
+ *	  Cross-backend cache of generic plans.
+ *
+ * See sharedplancache.c for comments.
+ *
+ * Portions Copyright (c) 1996-2021, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * src/include/utils/sharedplancache.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef SHAREDPLANCACHE_H
+#define SHAREDPLANCACHE_H
+
+#include "utils/plancache.h"
+
+/* GUC parameter */
+extern PGDLLIMPORT int shared_plan_cache_size;
+
+extern Size SharedPlanCacheShmemSize(void);
+extern void SharedPlanCacheShmemInit(void);
+extern void InitSharedPlanCache(void);
+
+extern bool SharedPlanCacheUsable(CachedPlanSource *plansource);
+extern List *SharedPlanCacheLookup(CachedPlanSource *plansource,
+								   uint64 *generation);
+extern bool SharedPlanCacheRecheck(CachedPlanSource *plansource,
+								   uint64 generation);
+extern void SharedPlanCacheInsert(CachedPlanSource *plansource,
+								  List *stmt_list);
+
+#endif							/* SHAREDPLANCACHE_H */